@@ -0,0 +1,135 @@
+#pragma once
+
+// Internal header, the scan of byte sets shared by strings::char_set,
+// unicode::rune_set and the PEG searches. Not installed.
+
+#include "zbs/_slice.hh"
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
+
+namespace zbs {
+namespace detail {
+
+// A set of bytes as a nibble bitmap: byte c is a member if the row
+// rows[(c & 15) | (c & 128) >> 3] has the bit (c >> 4 & 7) set. Sets without
+// 'high' rows only have the first 16 of them and never contain bytes >= 0x80.
+struct byte_bitmap {
+	const uint8 *rows;
+	bool high;
+
+	bool has(uint8 c) const {
+		if (c >= 0x80 && !high) {
+			return false;
+		}
+		return rows[(c & 15) | (c & 128) >> 3] & (1 << (c >> 4 & 7));
+	}
+};
+
+#ifdef __SSSE3__
+// The bitmap in SSE registers. The low nibble of a byte selects a row, the
+// high nibble selects a bit in it.
+struct byte_bitmap_sse {
+	__m128i lo_rows;
+	__m128i hi_rows;
+	__m128i bits;
+	bool high;
+
+	explicit byte_bitmap_sse(byte_bitmap set):
+		lo_rows(_mm_loadu_si128((const __m128i*)set.rows)),
+		hi_rows(set.high ? _mm_loadu_si128((const __m128i*)(set.rows + 16)) :
+			_mm_setzero_si128()),
+		// without the high rows the bytes >= 0x80 select a zero bit
+		bits(set.high ?
+			_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+				1, 2, 4, 8, 16, 32, 64, -128) :
+			_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+				0, 0, 0, 0, 0, 0, 0, 0)),
+		high(set.high)
+	{
+	}
+
+	// Returns the mask of the members among the 16 bytes at 'p', stores the
+	// mask of the bytes >= 0x80 among them in 'non_ascii'.
+	int members(const char *p, int *non_ascii) const {
+		const __m128i nibble = _mm_set1_epi8(0x0F);
+		const __m128i x = _mm_loadu_si128((const __m128i*)p);
+		const __m128i lo = _mm_and_si128(x, nibble);
+		__m128i row = _mm_shuffle_epi8(lo_rows, lo);
+		if (high) {
+			const __m128i h = _mm_cmplt_epi8(x, _mm_setzero_si128());
+			row = _mm_or_si128(_mm_andnot_si128(h, row),
+				_mm_and_si128(h, _mm_shuffle_epi8(hi_rows, lo)));
+		}
+		const __m128i bit = _mm_shuffle_epi8(bits,
+			_mm_and_si128(_mm_srli_epi16(x, 4), nibble));
+		*non_ascii = _mm_movemask_epi8(x);
+		return ~_mm_movemask_epi8(_mm_cmpeq_epi8(
+			_mm_and_si128(row, bit), _mm_setzero_si128())) & 0xFFFF;
+	}
+};
+#endif
+
+// Returns the offset of the first byte in 's' with the membership in 'set'
+// equal to 'in', or of the first byte >= 0x80 if 'stop_non_ascii'. Returns
+// s.len() if there is no such byte. With SSSE3 16 bytes are tested at once.
+inline int scan_bytes(slice<const char> s, byte_bitmap set, bool in,
+	bool stop_non_ascii)
+{
+	const char *p = s.data();
+	const int n = s.len();
+	int i = 0;
+#ifdef __SSSE3__
+	const byte_bitmap_sse sse(set);
+	for (; i + 16 <= n; i += 16) {
+		int non_ascii;
+		const int members = sse.members(p + i, &non_ascii);
+		int stops = in ? members : ~members & 0xFFFF;
+		if (stop_non_ascii) {
+			stops |= non_ascii;
+		}
+		if (stops != 0) {
+			return i + __builtin_ctz(stops);
+		}
+	}
+#endif
+	for (; i < n; i++) {
+		const uint8 c = p[i];
+		if (set.has(c) == in || (stop_non_ascii && c >= 0x80)) {
+			return i;
+		}
+	}
+	return n;
+}
+
+// Same as scan_bytes, but looks for the last such byte. Returns -1 if there is
+// none.
+inline int scan_bytes_last(slice<const char> s, byte_bitmap set, bool in,
+	bool stop_non_ascii)
+{
+	const char *p = s.data();
+	int i = s.len();
+#ifdef __SSSE3__
+	const byte_bitmap_sse sse(set);
+	for (; i - 16 >= 0; i -= 16) {
+		int non_ascii;
+		const int members = sse.members(p + i - 16, &non_ascii);
+		int stops = in ? members : ~members & 0xFFFF;
+		if (stop_non_ascii) {
+			stops |= non_ascii;
+		}
+		if (stops != 0) {
+			return i - 16 + 31 - __builtin_clz(stops);
+		}
+	}
+#endif
+	for (i--; i >= 0; i--) {
+		const uint8 c = p[i];
+		if (set.has(c) == in || (stop_non_ascii && c >= 0x80)) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+}} // namespace zbs::detail
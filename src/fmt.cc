@@ -2,8 +2,11 @@
 // license, you can find more details in 3rdparty/musl_license.txt file.
 
 #include "zbs/fmt.hh"
+#include "zbs/io.hh"
 #include "zbs/_vector.hh"
 #include "zbs/_types.hh"
+#include "zbs/strings.hh"
+#include "zbs/unicode/utf8.hh"
 
 #include <errno.h>
 #include <ctype.h>
@@ -181,12 +184,12 @@ static void pop_arg(union arg *arg, int type, va_list *ap)
 	}
 }
 
-static void out(zbs::vector<char> *f, const char *s, size_t l)
+static void out(zbs::fmt::sink *f, const char *s, size_t l)
 {
-	f->append(zbs::slice<const char>(s, l));
+	if (l) f->write(zbs::slice<const char>(s, l));
 }
 
-static void pad(zbs::vector<char> *f, char c, int w, int l, int fl)
+static void pad(zbs::fmt::sink *f, char c, int w, int l, int fl)
 {
 	char pad[256];
 	if (fl & (LEFT_ADJ | ZERO_PAD) || l >= w) return;
@@ -213,17 +216,15 @@ static char *fmt_o(uintmax_t x, char *s)
 
 static char *fmt_u(uintmax_t x, char *s)
 {
-	unsigned long y;
-	for (   ; x>ULONG_MAX; x/=10) *--s = '0' + x%10;
-	for (y=x;           y; y/=10) *--s = '0' + y%10;
-	return s;
+	if (!x) return s;
+	return zbs::fmt::detail::format_uint(s, x);
 }
 
-static int fmt_fp(zbs::vector<char> *f, long double y, int w, int p, int fl, int t)
+static int fmt_fp(zbs::fmt::sink *f, long double y, int w, int p, int fl, int t)
 {
 	uint32_t big[(LDBL_MAX_EXP+LDBL_MANT_DIG)/9+1];
 	uint32_t *a, *d, *r, *z;
-	int e2=0, e, i, j, l;
+	int e2=0, e, i, j, l, need;
 	char buf[9+LDBL_MANT_DIG/4], *s;
 	const char *prefix="-0X+0X 0X-0x+0x 0x";
 	int pl;
@@ -302,6 +303,7 @@ static int fmt_fp(zbs::vector<char> *f, long double y, int w, int p, int fl, int
 		return MAX(w, pl+l);
 	}
 	if (p<0) p=6;
+	need = 1+(p+LDBL_MANT_DIG/3U+8)/9;
 
 	if (y) y *= 0x1p28, e2-=28;
 
@@ -321,8 +323,8 @@ static int fmt_fp(zbs::vector<char> *f, long double y, int w, int p, int fl, int
 			*d = x % 1000000000;
 			carry = x / 1000000000;
 		}
-		if (!z[-1] && z>a) z--;
 		if (carry) *--a = carry;
+		while (z>a && !z[-1]) z--;
 		e2-=sh;
 	}
 	while (e2<0) {
@@ -337,7 +339,7 @@ static int fmt_fp(zbs::vector<char> *f, long double y, int w, int p, int fl, int
 		if (carry) *z++ = carry;
 		/* Avoid (slow!) computation past requested precision */
 		b = (t|32)=='f' ? r : a;
-		if (z-b > 2+p/9) z = b+2+p/9;
+		if (z-b > need) z = b+need;
 		e2+=sh;
 	}
 
@@ -358,7 +360,8 @@ static int fmt_fp(zbs::vector<char> *f, long double y, int w, int p, int fl, int
 		if (x || d+1!=z) {
 			long double round = CONCAT(0x1p,LDBL_MANT_DIG);
 			long double small;
-			if (*d/i & 1) round += 2;
+			if ((*d/i & 1) || (i==1000000000 && d>a && (d[-1]&1)))
+				round += 2;
 			if (x<(uint32_t)i/2) small=0x0.8p0;
 			else if (x==(uint32_t)i/2 && d+1==z) small=0x1.0p0;
 			else small=0x1.8p0;
@@ -369,9 +372,9 @@ static int fmt_fp(zbs::vector<char> *f, long double y, int w, int p, int fl, int
 				*d = *d + i;
 				while (*d > 999999999) {
 					*d--=0;
+					if (d<a) *--a=0;
 					(*d)++;
 				}
-				if (d<a) a=d;
 				for (i=10, e=9*(r-a); *a>=(uint32_t)i; i*=10, e++);
 			}
 		}
@@ -450,6 +453,78 @@ static int fmt_fp(zbs::vector<char> *f, long double y, int w, int p, int fl, int
 	return MAX(w, pl+l);
 }
 
+/* Formats a double with the shortest digits when the output is known to be
+ * the same as fmt_fp's. It is, if the requested number of significant digits
+ * is at most 15 and the shortest digits fit in it: for normal doubles the
+ * shortest digits are then also the correctly rounded ones. Returns -1 if
+ * the fast path doesn't apply. */
+static int fmt_fp_shortest(zbs::fmt::sink *f, double y, int w, int p, int fl, int t)
+{
+	char digits[17], body[400], *b = body;
+	const char *prefix = "-0X+0X 0X-0x+0x 0x";
+	int n, x, need, pl, l, i;
+
+	if (fl & ALT_FORM) return -1;
+	if (!std::isfinite(y) || fabs(y) < DBL_MIN) return -1;
+	if (p < 0) p = 6;
+
+	n = zbs::fmt::detail::shortest_digits(y, digits, &x);
+	switch (t|32) {
+	case 'e': need = p+1; break;
+	case 'f': need = x+1+p; break;
+	case 'g': need = p ? p : 1; break;
+	default: return -1;
+	}
+	if (need > 15 || n > need) return -1;
+
+	pl = 1;
+	if (std::signbit(y)) {
+		y = -y;
+	} else if (fl & MARK_POS) {
+		prefix += 3;
+	} else if (fl & PAD_POS) {
+		prefix += 6;
+	} else prefix++, pl = 0;
+
+	if ((t|32) == 'g') {
+		/* trailing zeros are removed, the shortest digits have none */
+		if (x < -4 || x >= need) {
+			t = 'e' - ('g' - t);
+			p = n - 1;
+		} else {
+			t = 'f';
+			p = MAX(n - 1 - x, 0);
+		}
+	}
+
+	if ((t|32) == 'e') {
+		*b++ = digits[0];
+		if (p) *b++ = '.';
+		for (i=1; i<=p; i++) *b++ = i < n ? digits[i] : '0';
+		*b++ = t;
+		*b++ = x < 0 ? '-' : '+';
+		if (x < 0) x = -x;
+		if (x < 10) *b++ = '0';
+		char ebuf[4], *e = fmt_u(x, ebuf+4);
+		if (e == ebuf+4) *--e = '0';
+		while (e < ebuf+4) *b++ = *e++;
+	} else {
+		/* digit i has the weight 10^(x-i) */
+		if (x < 0) *b++ = '0';
+		for (i=0; i<=x; i++) *b++ = i < n ? digits[i] : '0';
+		if (p) *b++ = '.';
+		for (i=x+1; i<=x+p; i++) *b++ = i >= 0 && i < n ? digits[i] : '0';
+	}
+	l = b - body;
+
+	pad(f, ' ', w, pl+l, fl);
+	out(f, prefix, pl);
+	pad(f, '0', w, pl+l, fl^ZERO_PAD);
+	out(f, body, l);
+	pad(f, ' ', w, pl+l, fl^LEFT_ADJ);
+	return MAX(w, pl+l);
+}
+
 static int getint(char **s) {
 	int i;
 	for (i=0; isdigit(**s); (*s)++)
@@ -459,7 +534,7 @@ static int getint(char **s) {
 
 static char nullstr[] = "(null)";
 
-static int printf_core(zbs::vector<char> *f, const char *fmt, va_list *ap, union arg *nl_arg, int *nl_type)
+static int printf_core(zbs::fmt::sink *f, const char *fmt, va_list *ap, union arg *nl_arg, int *nl_type)
 {
 	char *a, *z, *s=(char*)fmt;
 	unsigned l10n=0, fl;
@@ -641,6 +716,8 @@ static int printf_core(zbs::vector<char> *f, const char *fmt, va_list *ap, union
 			continue;
 		case 'e': case 'f': case 'g': case 'a':
 		case 'E': case 'F': case 'G': case 'A':
+			if (st == DBL && (l = fmt_fp_shortest(f, arg.f, w, p, fl, t)) >= 0)
+				continue;
 			l = fmt_fp(f, arg.f, w, p, fl, t);
 			continue;
 		}
@@ -668,7 +745,7 @@ static int printf_core(zbs::vector<char> *f, const char *fmt, va_list *ap, union
 	return 1;
 }
 
-static int vvprintf(zbs::vector<char> *f, const char *fmt, va_list ap)
+static int vvprintf(zbs::fmt::sink *f, const char *fmt, va_list ap)
 {
 	va_list ap2;
 	int nl_type[NL_ARGMAX+1] = {0};
@@ -685,33 +762,762 @@ static int vvprintf(zbs::vector<char> *f, const char *fmt, va_list ap)
 namespace zbs {
 namespace fmt {
 
+namespace {
+
+// Appends to a string.
+struct string_sink : sink {
+	string *s;
+
+	explicit string_sink(string *s): s(s) {}
+	void write(slice<const char> p) override { s->append(p); }
+};
+
+// Copies as much as fits into a buffer and counts the rest.
+struct slice_sink : sink {
+	slice<char> buf;
+	int n = 0;
+
+	explicit slice_sink(slice<char> buf): buf(buf) {}
+	void write(slice<const char> p) override {
+		if (n < buf.len()) {
+			const int l = MIN(p.len(), buf.len() - n);
+			memcpy(buf.data() + n, p.data(), l);
+		}
+		n += p.len();
+	}
+};
+
+// Collects the output in a buffer on the stack and passes it to a writer in
+// large pieces. Nothing is written after a failure.
+struct writer_sink : sink {
+	io::writer *w;
+	error err{error_verbosity::quiet};
+	int n = 0;
+	int len = 0;
+	char buf[512];
+
+	explicit writer_sink(io::writer *w): w(w) {}
+	void write(slice<const char> p) override {
+		n += p.len();
+		if (err) {
+			return;
+		}
+		if (p.len() <= (int)sizeof(buf) - len) {
+			memcpy(buf + len, p.data(), p.len());
+			len += p.len();
+			return;
+		}
+		const slice<const char> v[] = {{buf, len}, p};
+		w->writev(v, &err);
+		len = 0;
+	}
+
+	// Writes the rest, returns the number of bytes written or -1.
+	int finish() {
+		if (len > 0 && !err) {
+			w->write({buf, len}, &err);
+		}
+		len = 0;
+		return err ? -1 : n;
+	}
+};
+
+// Writes straight into the buffer of a buffered writer.
+struct buffered_writer_sink : sink {
+	io::buffered_writer *w;
+	error err{error_verbosity::quiet};
+	int n = 0;
+
+	explicit buffered_writer_sink(io::buffered_writer *w): w(w) {}
+	void write(slice<const char> p) override {
+		n += p.len();
+		if (!err) {
+			w->write(p, &err);
+		}
+	}
+};
+
+} // anonymous namespace
+
 string sprintf(const char *format, ...) {
-	vector<char> buf;
 	va_list vl;
 	va_start(vl, format);
-	vvprintf(&buf, format, vl);
+	string s = vsprintf(format, vl);
 	va_end(vl);
-	buf.append('\0');
-	int len = buf.len()-1;
-	int cap = buf.cap()-1;
-	char *data = buf.detach_unsafe();
-
-	string s;
-	s.attach_unsafe(data, len, cap);
 	return s;
 }
 
 string vsprintf(const char *format, va_list vl) {
-	vector<char> buf;
-	vvprintf(&buf, format, vl);
-	buf.append('\0');
-	int len = buf.len()-1;
-	int cap = buf.cap()-1;
-	char *data = buf.detach_unsafe();
-
 	string s;
-	s.attach_unsafe(data, len, cap);
+	vappend(s, format, vl);
 	return s;
 }
 
+int append(string &s, const char *format, ...) {
+	va_list vl;
+	va_start(vl, format);
+	int n = vappend(s, format, vl);
+	va_end(vl);
+	return n;
+}
+
+int vappend(string &s, const char *format, va_list vl) {
+	string_sink ss(&s);
+	return vvprintf(&ss, format, vl);
+}
+
+int snprintf(slice<char> buf, const char *format, ...) {
+	va_list vl;
+	va_start(vl, format);
+	int n = vsnprintf(buf, format, vl);
+	va_end(vl);
+	return n;
+}
+
+int vsnprintf(slice<char> buf, const char *format, va_list vl) {
+	// leave room for the terminating zero
+	slice_sink ss(buf.len() > 0 ? buf.sub(0, buf.len()-1) : buf);
+	int n = vvprintf(&ss, format, vl);
+	if (buf.len() > 0) {
+		buf[MIN(ss.n, buf.len()-1)] = '\0';
+	}
+	return n;
+}
+
+int vformat_to(sink &s, const char *format, va_list vl) {
+	return vvprintf(&s, format, vl);
+}
+
+int fprintf(io::writer &w, const char *format, ...) {
+	va_list vl;
+	va_start(vl, format);
+	int n = vfprintf(w, format, vl);
+	va_end(vl);
+	return n;
+}
+
+int vfprintf(io::writer &w, const char *format, va_list vl) {
+	if (auto bw = dynamic_cast<io::buffered_writer*>(&w)) {
+		buffered_writer_sink bs(bw);
+		int n = vvprintf(&bs, format, vl);
+		if (bs.err) {
+			return -1;
+		}
+		return n;
+	}
+	writer_sink ws(&w);
+	int n = vvprintf(&ws, format, vl);
+	if (ws.finish() < 0) {
+		return -1;
+	}
+	return n;
+}
+
+int printf(const char *format, ...) {
+	va_list vl;
+	va_start(vl, format);
+	int n = vprintf(format, vl);
+	va_end(vl);
+	return n;
+}
+
+int vprintf(const char *format, va_list vl) {
+	io::fd_writer out(1);
+	return vfprintf(out, format, vl);
+}
+
+//============================================================================
+// numbers
+//============================================================================
+
+static const char digit_pairs[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+char *detail::format_uint(char *end, uint64 v) {
+	while (v >= 100) {
+		const int i = (v % 100) * 2;
+		v /= 100;
+		end -= 2;
+		end[0] = digit_pairs[i];
+		end[1] = digit_pairs[i+1];
+	}
+	if (v >= 10) {
+		end -= 2;
+		end[0] = digit_pairs[v*2];
+		end[1] = digit_pairs[v*2+1];
+	} else {
+		*--end = '0' + v;
+	}
+	return end;
+}
+
+void append_int(string &s, int64 v) {
+	if (v < 0) {
+		s.append('-');
+		append_uint(s, -uint64(v));
+		return;
+	}
+	append_uint(s, v);
+}
+
+void append_uint(string &s, uint64 v) {
+	char buf[20];
+	char *p = detail::format_uint(buf + sizeof(buf), v);
+	s.append(slice<const char>(p, buf + sizeof(buf) - p));
+}
+
+// The shortest digits are found with the Schubfach algorithm by Raffaello
+// Giulietti ("The Schubfach way to render doubles", 2020). For a binary
+// floating point value c * 2^q it computes the decimal interval of values
+// which round to it, scaled by a 126-bit approximation of a power of ten, and
+// picks the shortest decimal in the interval, or the closest one to the value
+// if there are two candidates of the same length.
+
+#include "fmt_private_tables.inl"
+
+static inline uint64 mul_high(uint64 a, uint64 b) {
+	return (unsigned __int128)a * b >> 64;
+}
+
+// floor(e * log10(2))
+static inline int flog10pow2(int e) {
+	return (int64(e) * 661971961083LL) >> 41;
+}
+
+// floor(e * log10(2) + log10(3/4))
+static inline int flog10_three_quarters_pow2(int e) {
+	return (int64(e) * 661971961083LL - 274743187321LL) >> 41;
+}
+
+// floor(e * log2(10))
+static inline int flog2pow10(int e) {
+	return (int64(e) * 913124641741LL) >> 38;
+}
+
+// Returns floor(g * cp / 2^127), with the lowest bit set if the result is
+// inexact.
+static inline uint64 round_to_odd(const uint64 *g, uint64 cp) {
+	const uint64 mask63 = (uint64(1) << 63) - 1;
+	const uint64 x1 = mul_high(g[1], cp);
+	const uint64 y0 = g[0] * cp;
+	const uint64 y1 = mul_high(g[0], cp);
+	const uint64 z = (y0 >> 1) + x1;
+	const uint64 vbp = y1 + (z >> 63);
+	return vbp | (((z & mask63) + mask63) >> 63);
+}
+
+// The parameters of a binary floating point format: values are c * 2^q with
+// c < 2^precision.
+struct float_format {
+	int q_min;    // the exponent of subnormals
+	int precision;
+};
+
+static const float_format double_format = {-1074, 53};
+static const float_format float_format_ = {-149, 24};
+
+struct decimal {
+	uint64 f;
+	int e; // the value is f * 10^e
+};
+
+static decimal to_decimal(const float_format &ff, int q, uint64 c) {
+	const uint64 c_min = uint64(1) << (ff.precision - 1);
+	const uint64 out = c & 1;
+	const uint64 cb = c << 2;
+	const uint64 cbr = cb + 2;
+	uint64 cbl;
+	int k;
+	if (c != c_min || q == ff.q_min) {
+		cbl = cb - 2;
+		k = flog10pow2(q);
+	} else {
+		// the interval below powers of two is half as wide
+		cbl = cb - 1;
+		k = flog10_three_quarters_pow2(q);
+	}
+	const int h = q + flog2pow10(-k) + 2;
+	const uint64 *g = pow10_g[k - pow10_k_min];
+	const uint64 vb = round_to_odd(g, cb << h);
+	const uint64 vbl = round_to_odd(g, cbl << h);
+	const uint64 vbr = round_to_odd(g, cbr << h);
+
+	const uint64 s = vb >> 2;
+	if (s >= 10) {
+		// try one digit less first
+		const uint64 sp10 = s / 10 * 10;
+		const uint64 tp10 = sp10 + 10;
+		const bool upin = vbl + out <= sp10 << 2;
+		const bool wpin = (tp10 << 2) + out <= vbr;
+		if (upin != wpin) {
+			return {upin ? sp10 : tp10, k};
+		}
+	}
+	const uint64 t = s + 1;
+	const bool uin = vbl + out <= s << 2;
+	const bool win = (t << 2) + out <= vbr;
+	if (uin != win) {
+		return {uin ? s : t, k};
+	}
+	// both are in the interval, pick the closest one, or the even one
+	const int64 cmp = vb - ((s + t) << 1);
+	return {cmp < 0 || (cmp == 0 && (s & 1) == 0) ? s : t, k};
+}
+
+// `bits` are the biased exponent and the fraction of a finite non-zero value.
+static int shortest(const float_format &ff, uint64 bits, char *digits, int *exp) {
+	const int mbits = ff.precision - 1;
+	const uint64 t = bits & ((uint64(1) << mbits) - 1);
+	const int bq = bits >> mbits;
+	decimal d;
+	if (bq != 0) {
+		const int mq = -ff.q_min + 1 - bq;
+		const uint64 c = (uint64(1) << mbits) | t;
+		if (0 < mq && mq < ff.precision && (c >> mq << mq) == c) {
+			// an integer
+			d = {c >> mq, 0};
+		} else {
+			d = to_decimal(ff, -mq, c);
+		}
+	} else {
+		d = to_decimal(ff, ff.q_min, t);
+	}
+
+	while (d.f % 10 == 0) {
+		d.f /= 10;
+		d.e++;
+	}
+	char buf[20];
+	char *p = detail::format_uint(buf + sizeof(buf), d.f);
+	const int n = buf + sizeof(buf) - p;
+	std::memcpy(digits, p, n);
+	*exp = d.e + n - 1;
+	return n;
+}
+
+int detail::shortest_digits(double v, char *digits, int *exp) {
+	uint64 bits;
+	std::memcpy(&bits, &v, sizeof(bits));
+	return shortest(double_format, bits & ~(uint64(1) << 63), digits, exp);
+}
+
+int detail::shortest_digits(float v, char *digits, int *exp) {
+	uint32 bits;
+	std::memcpy(&bits, &v, sizeof(bits));
+	return shortest(float_format_, bits & ~(uint32(1) << 31), digits, exp);
+}
+
+// Lays out the digits d.ddd * 10^exp as printf would with the precision which
+// prints all of them and no more.
+template <typename T>
+static int format_shortest_impl(char *buf, T v, char fmt) {
+	char *b = buf;
+	if (std::signbit(v)) {
+		*b++ = '-';
+	}
+	if (std::isnan(v)) {
+		std::memcpy(b, "nan", 3);
+		return b + 3 - buf;
+	}
+	if (std::isinf(v)) {
+		std::memcpy(b, "inf", 3);
+		return b + 3 - buf;
+	}
+
+	char digits[17] = {'0'};
+	int exp = 0;
+	int n = 1;
+	if (v != 0) {
+		n = detail::shortest_digits(v, digits, &exp);
+	}
+	if (fmt == 'g') {
+		fmt = exp < -4 || exp >= n ? 'e' : 'f';
+	}
+
+	if (fmt == 'e') {
+		*b++ = digits[0];
+		if (n > 1) {
+			*b++ = '.';
+			std::memcpy(b, digits + 1, n - 1);
+			b += n - 1;
+		}
+		*b++ = 'e';
+		*b++ = exp < 0 ? '-' : '+';
+		if (exp < 0) {
+			exp = -exp;
+		}
+		if (exp < 10) {
+			*b++ = '0';
+		}
+		char tmp[4];
+		char *p = detail::format_uint(tmp + sizeof(tmp), exp);
+		std::memcpy(b, p, tmp + sizeof(tmp) - p);
+		b += tmp + sizeof(tmp) - p;
+		return b - buf;
+	}
+
+	// digit i has the weight 10^(exp-i)
+	if (exp < 0) {
+		*b++ = '0';
+		*b++ = '.';
+		std::memset(b, '0', -exp - 1);
+		b += -exp - 1;
+		std::memcpy(b, digits, n);
+		b += n;
+		return b - buf;
+	}
+	for (int i = 0; i <= exp; i++) {
+		*b++ = i < n ? digits[i] : '0';
+	}
+	if (n > exp + 1) {
+		*b++ = '.';
+		std::memcpy(b, digits + exp + 1, n - exp - 1);
+		b += n - exp - 1;
+	}
+	return b - buf;
+}
+
+int detail::format_shortest(char *buf, double v, char fmt) {
+	return format_shortest_impl(buf, v, fmt);
+}
+
+int detail::format_shortest(char *buf, float v, char fmt) {
+	return format_shortest_impl(buf, v, fmt);
+}
+
+void append_float(string &s, double v, char fmt, int prec) {
+	_ZBS_ASSERT(fmt == 'e' || fmt == 'f' || fmt == 'g');
+	if (prec >= 0) {
+		const char format[] = {'%', '.', '*', fmt, '\0'};
+		append(s, format, prec, v);
+		return;
+	}
+	char buf[detail::shortest_size];
+	s.append(slice<const char>(buf, detail::format_shortest(buf, v, fmt)));
+}
+
+void append_float(string &s, float v, char fmt, int prec) {
+	_ZBS_ASSERT(fmt == 'e' || fmt == 'f' || fmt == 'g');
+	if (prec >= 0) {
+		append_float(s, double(v), fmt, prec);
+		return;
+	}
+	char buf[detail::shortest_size];
+	s.append(slice<const char>(buf, detail::format_shortest(buf, v, fmt)));
+}
+
+//============================================================================
+// format
+//============================================================================
+
+namespace utf8 = unicode::utf8;
+
+static void write_fill(sink &out, rune fill, int n) {
+	char tmp[utf8::utf_max];
+	const int l = utf8::encode_rune(tmp, fill);
+	for (int i = 0; i < n; i++) {
+		out.write(slice<const char>(tmp, l));
+	}
+}
+
+// Writes a number consisting of `sign` (possibly empty) and `digits`, padding
+// it with zeros after the sign if requested by `s`.
+static void write_number(sink &out, slice<const char> sign, slice<const char> digits, const spec &s) {
+	out.write(sign);
+	if (s.zero && s.align == 0) {
+		write_fill(out, '0', s.width - sign.len() - digits.len());
+	}
+	out.write(digits);
+}
+
+void formatter<bool>::format(sink &out, bool v, const spec &s) {
+	formatter<slice<const char>>::format(out, v ? "true" : "false", s);
+}
+
+void formatter<char>::format(sink &out, char v, const spec&) {
+	out.write(slice<const char>(&v, 1));
+}
+
+void formatter<char32_t>::format(sink &out, char32_t v, const spec&) {
+	char tmp[utf8::utf_max];
+	out.write(slice<const char>(tmp, utf8::encode_rune(tmp, v)));
+}
+
+void formatter<int64>::format(sink &out, int64 v, const spec &s) {
+	if (s.type == 'c') {
+		formatter<char32_t>::format(out, v, s);
+		return;
+	}
+	// negate in the unsigned domain, the most negative value has no positive
+	// counterpart
+	const uint64 abs = v < 0 ? -uint64(v) : uint64(v);
+	if (v >= 0) {
+		formatter<uint64>::format(out, abs, s);
+		return;
+	}
+	spec us = s;
+	us.width = s.width - 1;
+	out.write("-");
+	formatter<uint64>::format(out, abs, us);
+}
+
+void formatter<uint64>::format(sink &out, uint64 v, const spec &s) {
+	if (s.type == 'c') {
+		formatter<char32_t>::format(out, v, s);
+		return;
+	}
+	int base = 10;
+	const char *digits = "0123456789abcdef";
+	switch (s.type) {
+	case 'b': base = 2; break;
+	case 'o': base = 8; break;
+	case 'x': base = 16; break;
+	case 'X': base = 16; digits = "0123456789ABCDEF"; break;
+	}
+	char buf[64];
+	char *p = buf + sizeof(buf);
+	if (base == 10) {
+		p = detail::format_uint(p, v);
+	} else {
+		do {
+			*--p = digits[v % base];
+			v /= base;
+		} while (v != 0);
+	}
+	write_number(out, "", slice<const char>(p, buf + sizeof(buf) - p), s);
+}
+
+template <typename T>
+static void format_float(sink &out, T v, const spec &s) {
+	char type = s.type;
+	bool upper = false;
+	switch (type) {
+	case 'E': case 'F': case 'G':
+		upper = true;
+		type += 'a' - 'A';
+		break;
+	case 'e': case 'f': case 'g':
+		break;
+	default:
+		type = 'g';
+	}
+
+	char buf[detail::shortest_size];
+	string tmp;
+	slice<char> digits;
+	if (s.precision < 0) {
+		digits = slice<char>(buf, detail::format_shortest(buf, v, type));
+	} else {
+		append_float(tmp, v, type, s.precision);
+		digits = tmp.sub();
+	}
+	if (upper) {
+		for (char &c : digits) {
+			if ('a' <= c && c <= 'z') {
+				c -= 'a' - 'A';
+			}
+		}
+	}
+	if (digits.len() > 0 && digits[0] == '-') {
+		write_number(out, "-", digits.sub(1), s);
+	} else {
+		write_number(out, "", digits, s);
+	}
+}
+
+void formatter<double>::format(sink &out, double v, const spec &s) {
+	format_float(out, v, s);
+}
+
+void formatter<float>::format(sink &out, float v, const spec &s) {
+	format_float(out, v, s);
+}
+
+void formatter<slice<const char>>::format(sink &out, slice<const char> v, const spec &s) {
+	if (s.precision >= 0) {
+		// cut to precision runes
+		int i = 0;
+		for (int n = 0; n < s.precision && i < v.len(); n++) {
+			i += uint8(v[i]) < utf8::rune_self ? 1 : utf8::decode_rune(v.sub(i)).size;
+		}
+		v = v.sub(0, i);
+	}
+	out.write(v);
+}
+
+void formatter<const void*>::format(sink &out, const void *v, const spec &s) {
+	spec hs = s;
+	hs.type = 'x';
+	hs.width = s.width - 2;
+	out.write("0x");
+	formatter<uint64>::format(out, uintptr_t(v), hs);
+}
+
+// Parses the decimal number at 'f[*i]', if there is one, advancing '*i' past
+// it. Returns false if it's larger than anything a sane format string needs,
+// so that indices and widths neither overflow nor cause huge allocations.
+static bool parse_number(slice<const char> f, int *i, int *v) {
+	constexpr int max_number = 1 << 20;
+	for (; *i < f.len() && '0' <= f[*i] && f[*i] <= '9'; (*i)++) {
+		*v = *v * 10 + (f[*i] - '0');
+		if (*v > max_number) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Parses the spec of a replacement field (the part after ':').
+static bool parse_spec(slice<const char> f, spec *s) {
+	int i = 0;
+	auto is_align = [](char c) { return c == '<' || c == '>' || c == '^'; };
+	if (f.len() > 0) {
+		sized_rune r = utf8::decode_rune(f);
+		if (r.size < f.len() && is_align(f[r.size])) {
+			s->fill = r.rune;
+			s->align = f[r.size];
+			i = r.size + 1;
+		} else if (is_align(f[0])) {
+			s->align = f[0];
+			i = 1;
+		}
+	}
+	if (i < f.len() && f[i] == '0') {
+		s->zero = true;
+		i++;
+	}
+	if (!parse_number(f, &i, &s->width)) {
+		return false;
+	}
+	if (i < f.len() && f[i] == '.') {
+		i++;
+		if (i == f.len() || f[i] < '0' || f[i] > '9') {
+			return false;
+		}
+		s->precision = 0;
+		if (!parse_number(f, &i, &s->precision)) {
+			return false;
+		}
+	}
+	if (i < f.len()) {
+		if (!strchr("bcdoxXeEfFgGs", f[i])) {
+			return false;
+		}
+		s->type = f[i++];
+	}
+	return i == f.len();
+}
+
+// Writes an argument, padding it to the width from the spec. Formatters only
+// handle zero padding, so padded arguments are formatted into a temporary
+// string first to find out their width.
+static void write_arg(sink &out, const detail::format_arg &a, const spec &s) {
+	if (s.width == 0) {
+		a.format(out, a.value, s);
+		return;
+	}
+
+	string tmp;
+	string_sink ts(&tmp);
+	a.format(ts, a.value, s);
+	const int pad = s.width - utf8::rune_count(tmp);
+	if (pad <= 0) {
+		out.write(tmp);
+		return;
+	}
+	char align = s.align;
+	if (align == 0) {
+		align = s.type != 's' && a.number ? '>' : '<';
+	}
+	const int left = align == '>' ? pad : align == '^' ? pad / 2 : 0;
+	write_fill(out, s.fill, left);
+	out.write(tmp);
+	write_fill(out, s.fill, pad - left);
+}
+
+void detail::vformat(sink &out, slice<const char> f, slice<const detail::format_arg> args) {
+	int next = 0;
+	int i = 0;
+	while (i < f.len()) {
+		// literal text
+		int j = i;
+		while (j < f.len() && f[j] != '{' && f[j] != '}') {
+			j++;
+		}
+		if (j > i) {
+			out.write(f.sub(i, j));
+		}
+		if (j == f.len()) {
+			break;
+		}
+		if (j+1 < f.len() && f[j+1] == f[j]) {
+			out.write(f.sub(j, j+1));
+			i = j + 2;
+			continue;
+		}
+		if (f[j] == '}') {
+			out.write("{!BADFORMAT}");
+			i = j + 1;
+			continue;
+		}
+
+		// replacement field
+		int end = j + 1;
+		while (end < f.len() && f[end] != '}') {
+			end++;
+		}
+		if (end == f.len()) {
+			out.write("{!BADFORMAT}");
+			break;
+		}
+		slice<const char> field = f.sub(j+1, end);
+		i = end + 1;
+
+		int k = 0;
+		int index = 0;
+		if (!parse_number(field, &k, &index)) {
+			out.write("{!BADFORMAT}");
+			continue;
+		}
+		if (k == 0) {
+			index = next++;
+		}
+		spec s;
+		if (k < field.len() && (field[k] != ':' || !parse_spec(field.sub(k+1), &s))) {
+			out.write("{!BADFORMAT}");
+			continue;
+		}
+		if (index >= args.len()) {
+			out.write("{!MISSING}");
+			continue;
+		}
+		write_arg(out, args[index], s);
+	}
+}
+
+void detail::vformat_append(string &out, slice<const char> f, slice<const detail::format_arg> args) {
+	string_sink ss(&out);
+	vformat(ss, f, args);
+}
+
+int detail::vformat_write(io::writer &out, slice<const char> f, slice<const detail::format_arg> args) {
+	if (auto bw = dynamic_cast<io::buffered_writer*>(&out)) {
+		buffered_writer_sink bs(bw);
+		vformat(bs, f, args);
+		return bs.err ? -1 : bs.n;
+	}
+	writer_sink ws(&out);
+	vformat(ws, f, args);
+	return ws.finish();
+}
+
 }} // namespace fmt
@@ -0,0 +1,150 @@
+#include "zbs/interner.hh"
+#include <cstring>
+#include <thread>
+
+namespace zbs {
+
+interner::_shard::~_shard() {
+	for (char *c : chunks) {
+		detail::free(c);
+	}
+}
+
+// Copies `s` into the current chunk, starting a new one if it doesn't fit.
+// Strings larger than a quarter of a chunk get a chunk of their own, so that
+// the space left in the current one isn't wasted.
+slice<const char> interner::_shard::copy(slice<const char> s) {
+	const int n = s.len();
+	if (n == 0) {
+		return {};
+	}
+	if (n > _chunk_size / 4) {
+		char *c = detail::malloc<char>(n);
+		chunks.append(c);
+		std::memcpy(c, s.data(), n);
+		// keep the current chunk at the end
+		if (chunks.len() > 1) {
+			std::swap(chunks[chunks.len()-1], chunks[chunks.len()-2]);
+		}
+		return {c, n};
+	}
+	if (chunk_cap - chunk_len < n) {
+		chunks.append(detail::malloc<char>(_chunk_size));
+		chunk_len = 0;
+		chunk_cap = _chunk_size;
+	}
+	char *p = chunks[chunks.len()-1] + chunk_len;
+	std::memcpy(p, s.data(), n);
+	chunk_len += n;
+	return {p, n};
+}
+
+interner::interner(int shards): _locking(shards > 0), _next(0), _len(0) {
+	int n = 1;
+	while (n < shards) {
+		n *= 2;
+	}
+	_shards.reset(new _shard[n]);
+	_shards_mask = n - 1;
+	for (auto &seg : _segments) {
+		seg.store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+interner::~interner() {
+	for (auto &seg : _segments) {
+		slice<const char> *s = seg.load(std::memory_order_relaxed);
+		if (s != nullptr) {
+			detail::free(s);
+		}
+	}
+}
+
+interner::_shard &interner::_shard_of(slice<const char> s) const {
+	if (_shards_mask == 0) {
+		return _shards[0];
+	}
+	// the map uses the low bits of its own hash, use the high ones here
+	const uint32 h = hash<slice<const char>>()(s, 0);
+	return _shards[(h >> 16) & _shards_mask];
+}
+
+slice<const char> *interner::_entry(uint32 id) const {
+	const uint32 t = (id >> _segment_shift) + 1;
+	const int k = 31 - __builtin_clz(t);
+	const uint32 base = ((uint32(1) << k) - 1) << _segment_shift;
+	slice<const char> *seg = _segments[k].load(std::memory_order_acquire);
+	_ZBS_ASSERT(seg != nullptr);
+	return seg + (id - base);
+}
+
+// Adds `s` to the shard `sh`, which is locked if needed.
+uint32 interner::_insert(_shard &sh, slice<const char> s) {
+	// shards may add strings concurrently, in that case reserve the id first
+	const uint32 id = _locking ?
+		_next.fetch_add(1, std::memory_order_relaxed) :
+		_len.load(std::memory_order_relaxed);
+
+	const uint32 t = (id >> _segment_shift) + 1;
+	const int k = 31 - __builtin_clz(t);
+	_ZBS_ASSERT(k < _max_segments);
+	if (_segments[k].load(std::memory_order_acquire) == nullptr) {
+		std::lock_guard<std::mutex> lock(_segments_mutex);
+		if (_segments[k].load(std::memory_order_relaxed) == nullptr) {
+			const int n = 1 << (k + _segment_shift);
+			_segments[k].store(detail::malloc<slice<const char>>(n),
+				std::memory_order_release);
+		}
+	}
+
+	slice<const char> copy = sh.copy(s);
+	*_entry(id) = copy;
+	sh.ids[copy] = id;
+	if (!_locking) {
+		_len.store(id + 1, std::memory_order_release);
+		return id;
+	}
+
+	// Publish the ids in order, so that every id below len() has its entry
+	// stored. The inserts holding the lower ids are past the point where
+	// they could wait for this one, the wait is short.
+	uint32 expected = id;
+	while (!_len.compare_exchange_weak(expected, id + 1,
+		std::memory_order_release, std::memory_order_relaxed)) {
+		expected = id;
+		std::this_thread::yield();
+	}
+	return id;
+}
+
+uint32 interner::intern(slice<const char> s) {
+	_shard &sh = _shard_of(s);
+	if (!_locking) {
+		const uint32 *id = sh.ids.lookup(s);
+		return id != nullptr ? *id : _insert(sh, s);
+	}
+
+	std::lock_guard<std::mutex> lock(sh.mutex);
+	const uint32 *id = sh.ids.lookup(s);
+	return id != nullptr ? *id : _insert(sh, s);
+}
+
+optional<uint32> interner::find(slice<const char> s) const {
+	_shard &sh = _shard_of(s);
+	std::unique_lock<std::mutex> lock(sh.mutex, std::defer_lock);
+	if (_locking) {
+		lock.lock();
+	}
+	const uint32 *id = sh.ids.lookup(s);
+	if (id == nullptr) {
+		return nullopt;
+	}
+	return *id;
+}
+
+slice<const char> interner::lookup(uint32 id) const {
+	_ZBS_ASSERT(id < _len.load(std::memory_order_acquire));
+	return *_entry(id);
+}
+
+} // namespace zbs
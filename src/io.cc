@@ -0,0 +1,304 @@
+#include "zbs/io.hh"
+#include "zbs/_vector.hh"
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <unistd.h>
+#include <sys/uio.h>
+
+namespace zbs {
+namespace io {
+
+error_domain errno_domain;
+
+static void set_errno_error(error *err, const char *op) {
+	const int e = errno;
+	err->set(error_code(&errno_domain, e), "%s: %s", op, std::strerror(e));
+}
+
+//============================================================================
+// writer
+//============================================================================
+
+int writer::writev(slice<const slice<const char>> bufs, error *err) {
+	int n = 0;
+	for (int i = 0; i < bufs.len(); i++) {
+		if (write(bufs[i], err) < 0) {
+			return -1;
+		}
+		n += bufs[i].len();
+	}
+	return n;
+}
+
+//============================================================================
+// fd_reader, fd_writer
+//============================================================================
+
+int fd_reader::read(slice<char> buf, error *err) {
+	for (;;) {
+		const ssize_t n = ::read(_fd, buf.data(), buf.len());
+		if (n >= 0) {
+			return n;
+		}
+		if (errno != EINTR) {
+			set_errno_error(err, "read");
+			return -1;
+		}
+	}
+}
+
+int fd_writer::write(slice<const char> buf, error *err) {
+	int written = 0;
+	while (written < buf.len()) {
+		const ssize_t n = ::write(_fd, buf.data() + written, buf.len() - written);
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			set_errno_error(err, "write");
+			return -1;
+		}
+		written += n;
+	}
+	return written;
+}
+
+int fd_writer::writev(slice<const slice<const char>> bufs, error *err) {
+	// at most this many buffers per system call, well below IOV_MAX
+	constexpr int max_iov = 64;
+	struct iovec iov[max_iov];
+
+	int total = 0;
+	int i = 0;   // the first buffer not written completely
+	int off = 0; // how much of it was written
+	while (i < bufs.len()) {
+		int n_iov = 0;
+		for (int j = i; j < bufs.len() && n_iov < max_iov; j++) {
+			const slice<const char> b = j == i ? bufs[j].sub(off) : bufs[j];
+			if (b.len() == 0) {
+				continue;
+			}
+			iov[n_iov].iov_base = const_cast<char*>(b.data());
+			iov[n_iov].iov_len = b.len();
+			n_iov++;
+		}
+		if (n_iov == 0) {
+			break;
+		}
+
+		ssize_t n = ::writev(_fd, iov, n_iov);
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			set_errno_error(err, "writev");
+			return -1;
+		}
+		total += n;
+
+		// skip what was written, possibly stopping in the middle of a buffer
+		while (i < bufs.len() && n >= bufs[i].len() - off) {
+			n -= bufs[i].len() - off;
+			off = 0;
+			i++;
+		}
+		off += n;
+	}
+	return total;
+}
+
+//============================================================================
+// buffered_reader
+//============================================================================
+
+buffered_reader::buffered_reader(reader &r, int size):
+	_r(&r), _buf(detail::malloc<char>(size)), _size(size)
+{
+	_ZBS_ASSERT(size > 0);
+}
+
+buffered_reader::~buffered_reader() {
+	detail::free(_buf);
+}
+
+// Reads more data into the free space at the end of the buffer, moving the
+// buffered data to the front first if there is none.
+int buffered_reader::_fill(error *err) {
+	if (_begin == _end) {
+		_begin = _end = 0;
+	} else if (_end == _size) {
+		std::memmove(_buf, _buf + _begin, _end - _begin);
+		_end -= _begin;
+		_begin = 0;
+	}
+	const int n = _r->read(slice<char>(_buf + _end, _size - _end), err);
+	if (n > 0) {
+		_end += n;
+	}
+	return n;
+}
+
+int buffered_reader::read(slice<char> buf, error *err) {
+	if (buf.len() == 0) {
+		return 0;
+	}
+	if (_begin == _end) {
+		if (buf.len() >= _size) {
+			return _r->read(buf, err);
+		}
+		const int n = _fill(err);
+		if (n <= 0) {
+			return n;
+		}
+	}
+	const int n = std::min(buf.len(), _end - _begin);
+	std::memcpy(buf.data(), _buf + _begin, n);
+	_begin += n;
+	return n;
+}
+
+slice<const char> buffered_reader::peek(int n, error *err) {
+	_ZBS_ASSERT(n >= 0 && n <= _size);
+	if (_begin + n > _size) {
+		std::memmove(_buf, _buf + _begin, _end - _begin);
+		_end -= _begin;
+		_begin = 0;
+	}
+	while (_end - _begin < n) {
+		if (_fill(err) <= 0) {
+			break;
+		}
+	}
+	return {_buf + _begin, std::min(n, _end - _begin)};
+}
+
+int buffered_reader::discard(int n, error *err) {
+	int skipped = 0;
+	while (skipped < n) {
+		if (_begin == _end) {
+			const int r = _fill(err);
+			if (r < 0) {
+				return -1;
+			}
+			if (r == 0) {
+				break;
+			}
+		}
+		const int m = std::min(n - skipped, _end - _begin);
+		_begin += m;
+		skipped += m;
+	}
+	return skipped;
+}
+
+int buffered_reader::read_until(char delim, string *out, error *err) {
+	int appended = 0;
+	for (;;) {
+		const char *p = _buf + _begin;
+		const int len = _end - _begin;
+		const char *d = static_cast<const char*>(std::memchr(p, delim, len));
+		const int m = d != nullptr ? d - p + 1 : len;
+		out->append(slice<const char>(p, m));
+		_begin += m;
+		appended += m;
+		if (d != nullptr) {
+			return appended;
+		}
+
+		const int r = _fill(err);
+		if (r < 0) {
+			return -1;
+		}
+		if (r == 0) {
+			return appended;
+		}
+	}
+}
+
+//============================================================================
+// buffered_writer
+//============================================================================
+
+buffered_writer::buffered_writer(writer &w, int size):
+	_w(&w), _buf(detail::malloc<char>(size)), _size(size)
+{
+	_ZBS_ASSERT(size > 0);
+}
+
+buffered_writer::~buffered_writer() {
+	error err(error_verbosity::quiet);
+	flush(&err);
+	detail::free(_buf);
+}
+
+// Passes the buffered data followed by `bufs` (`n` bytes in total) to the
+// underlying writer in one call.
+int buffered_writer::_write_through(slice<const slice<const char>> bufs, int n, error *err) {
+	constexpr int max_inline = 16;
+	slice<const char> inline_all[max_inline];
+	vector<slice<const char>> heap_all;
+	slice<slice<const char>> all;
+	if (bufs.len() < max_inline) {
+		all = slice<slice<const char>>(inline_all, bufs.len() + 1);
+	} else {
+		heap_all.resize(bufs.len() + 1);
+		all = heap_all;
+	}
+	all[0] = slice<const char>(_buf, _len);
+	for (int i = 0; i < bufs.len(); i++) {
+		all[i+1] = bufs[i];
+	}
+
+	_len = 0;
+	if (_w->writev(all, err) < 0) {
+		return -1;
+	}
+	return n;
+}
+
+int buffered_writer::write(slice<const char> buf, error *err) {
+	if (buf.len() <= _size - _len) {
+		std::memcpy(_buf + _len, buf.data(), buf.len());
+		_len += buf.len();
+		return buf.len();
+	}
+	if (_len == 0) {
+		return _w->write(buf, err);
+	}
+	return _write_through(slice<const slice<const char>>(&buf, 1), buf.len(), err);
+}
+
+int buffered_writer::writev(slice<const slice<const char>> bufs, error *err) {
+	int n = 0;
+	for (int i = 0; i < bufs.len(); i++) {
+		n += bufs[i].len();
+	}
+	if (n > _size - _len) {
+		return _write_through(bufs, n, err);
+	}
+	for (int i = 0; i < bufs.len(); i++) {
+		std::memcpy(_buf + _len, bufs[i].data(), bufs[i].len());
+		_len += bufs[i].len();
+	}
+	return n;
+}
+
+int buffered_writer::flush(error *err) {
+	if (_len == 0) {
+		return 0;
+	}
+	const int n = _len;
+	_len = 0;
+	return _w->write(slice<const char>(_buf, n), err) < 0 ? -1 : 0;
+}
+
+slice<char> buffered_writer::reserve(int n, error *err) {
+	_ZBS_ASSERT(n >= 0 && n <= _size);
+	if (_size - _len < n && flush(err) < 0) {
+		return {};
+	}
+	return {_buf + _len, _size - _len};
+}
+
+}} // namespace zbs::io
@@ -15,7 +15,7 @@ static ast_node *_new_node(ast_type type) {
 }
 
 ast_node::~ast_node() {
-	if (type == ast_type::literal || type == ast_type::set) {
+	if (type == ast_type::literal || type == ast_type::set || type == ast_type::call) {
 		if (len > shortbuf_len)
 			delete [] buf;
 	}
@@ -33,30 +33,6 @@ slice<const char> ast_node::buffer() const {
 	return {buf, len};
 }
 
-ast_node *ast_node::clone() const {
-	ast_node *n = _new_node(type);
-	n->len = len;
-	if (left)
-		n->left.reset(left->clone());
-	if (right)
-		n->right.reset(right->clone());
-	switch (type) {
-	case ast_type::literal:
-	case ast_type::set:
-		if (len > shortbuf_len)
-			n->buf = new (or_die) char[len];
-		zbs::copy(n->buffer(), buffer());
-		break;
-	case ast_type::range:
-		n->from = from;
-		n->to = to;
-		break;
-	default:
-		break;
-	}
-	return n;
-}
-
 ast::ast(const char *str): p(P(str).p) {
 }
 
@@ -112,7 +88,7 @@ ast R(const char *range) {
 ast C(const ast &arg) {
 	ast_node *n = _new_node(ast_type::capture);
 	n->len = static_cast<int>(capture_type::simple);
-	n->left.reset(arg.p->clone());
+	n->left = arg.p;
 	return ast{n};
 }
 
@@ -126,7 +102,7 @@ ast C(ast &&arg) {
 ast Cg(const ast &arg) {
 	ast_node *n = _new_node(ast_type::capture);
 	n->len = static_cast<int>(capture_type::group);
-	n->left.reset(arg.p->clone());
+	n->left = arg.p;
 	return ast{n};
 }
 
@@ -141,7 +117,7 @@ ast Cg(ast &&arg) {
 ast operator*(const ast &lhs) {
 	ast_node *n = _new_node(ast_type::repetition);
 	n->len = 0;
-	n->left.reset(lhs.p->clone());
+	n->left = lhs.p;
 	return ast{n};
 }
 
@@ -155,7 +131,7 @@ ast operator*(ast &&lhs) {
 ast operator+(const ast &lhs) {
 	ast_node *n = _new_node(ast_type::repetition);
 	n->len = 1;
-	n->left.reset(lhs.p->clone());
+	n->left = lhs.p;
 	return ast{n};
 }
 
@@ -169,7 +145,7 @@ ast operator+(ast &&lhs) {
 ast operator-(const ast &lhs) {
 	ast_node *n = _new_node(ast_type::repetition);
 	n->len = -1;
-	n->left.reset(lhs.p->clone());
+	n->left = lhs.p;
 	return ast{n};
 }
 
@@ -183,14 +159,14 @@ ast operator-(ast &&lhs) {
 // =========== sequence ===========
 ast operator>>(const ast &lhs, const ast &rhs) {
 	ast_node *n = _new_node(ast_type::sequence);
-	n->left.reset(lhs.p->clone());
-	n->right.reset(rhs.p->clone());
+	n->left = lhs.p;
+	n->right = rhs.p;
 	return ast{n};
 }
 
 ast operator>>(const ast &lhs, ast &&rhs) {
 	ast_node *n = _new_node(ast_type::sequence);
-	n->left.reset(lhs.p->clone());
+	n->left = lhs.p;
 	n->right = std::move(rhs.p);
 	return ast{n};
 }
@@ -198,7 +174,7 @@ ast operator>>(const ast &lhs, ast &&rhs) {
 ast operator>>(ast &&lhs, const ast &rhs) {
 	ast_node *n = _new_node(ast_type::sequence);
 	n->left = std::move(lhs.p);
-	n->right.reset(rhs.p->clone());
+	n->right = rhs.p;
 	return ast{n};
 }
 
@@ -212,14 +188,14 @@ ast operator>>(ast &&lhs, ast &&rhs) {
 // =========== choice ===========
 ast operator|(const ast &lhs, const ast &rhs) {
 	ast_node *n = _new_node(ast_type::choice);
-	n->left.reset(lhs.p->clone());
-	n->right.reset(rhs.p->clone());
+	n->left = lhs.p;
+	n->right = rhs.p;
 	return ast{n};
 }
 
 ast operator|(const ast &lhs, ast &&rhs) {
 	ast_node *n = _new_node(ast_type::choice);
-	n->left.reset(lhs.p->clone());
+	n->left = lhs.p;
 	n->right = std::move(rhs.p);
 	return ast{n};
 }
@@ -227,7 +203,7 @@ ast operator|(const ast &lhs, ast &&rhs) {
 ast operator|(ast &&lhs, const ast &rhs) {
 	ast_node *n = _new_node(ast_type::choice);
 	n->left = std::move(lhs.p);
-	n->right.reset(rhs.p->clone());
+	n->right = rhs.p;
 	return ast{n};
 }
 
@@ -258,7 +234,7 @@ ast operator-(ast &&lhs, ast &&rhs) {
 // =========== and_ ===========
 ast operator&(const ast &arg) {
 	ast_node *n = _new_node(ast_type::and_);
-	n->left.reset(arg.p->clone());
+	n->left = arg.p;
 	return ast{n};
 }
 ast operator&(ast &&arg) {
@@ -270,7 +246,7 @@ ast operator&(ast &&arg) {
 // =========== not_ ===========
 ast operator!(const ast &arg) {
 	ast_node *n = _new_node(ast_type::not_);
-	n->left.reset(arg.p->clone());
+	n->left = arg.p;
 	return ast{n};
 }
 
@@ -280,6 +256,23 @@ ast operator!(ast &&arg) {
 	return ast{n};
 }
 
+// =========== rules ===========
+ast V(const char *name) {
+	return _string_node(ast_type::call, name);
+}
+
+grammar::~grammar() = default;
+
+grammar &grammar::rule(const char *name, const ast &def, bool memoize) {
+	_rules.append({name, def.p, memoize});
+	return *this;
+}
+
+grammar &grammar::rule(const char *name, ast &&def, bool memoize) {
+	_rules.append({name, std::move(def.p), memoize});
+	return *this;
+}
+
 // =========== capturer ===========
 
 capturer::~capturer() {}
@@ -330,7 +323,8 @@ zbs::string recursive_dump(const ast_node *a) {
 		lhs = recursive_dump(a->left.get());
 		return fmt::sprintf("&%s", lhs.c_str());
 	case ast_type::call:
-		return fmt::sprintf("call()");
+		buf = a->buffer();
+		return fmt::sprintf("V(%.*s)", buf.len(), buf.data());
 	case ast_type::capture:
 		lhs = recursive_dump(a->left.get());
 		return fmt::sprintf("C(%s)", lhs.c_str());
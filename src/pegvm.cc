@@ -1,6 +1,14 @@
 #include "zbs/peg.hh"
 #include "zbs/unicode/utf8.hh"
 #include "zbs/_string.hh"
+#include "zbs/_map.hh"
+#include "zbs/fmt.hh"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include "byte_scan.hh"
 
 namespace utf8 = zbs::unicode::utf8;
 
@@ -21,6 +29,16 @@ enum class inst_type : byte {
 	fail_twice,
 	open_capture,
 	close_capture,
+	call,
+	return_,
+	jump,
+	memo_enter,
+	memo_commit,
+	memo_fail,
+	test_char,
+	test_set,
+	span_set,
+	span_range,
 };
 //----------------------------------------------------------------------------
 // capture_type to string
@@ -56,7 +74,7 @@ struct inst_any : inst_base<inst_type::any> {};
 // match string or fail
 struct inst_string : inst_base<inst_type::string> {
 	inst_type type;
-	uint8 len; // length of the 'str' attachment in bytes
+	int len; // length of the 'str' attachment in bytes
 	// utf-8 encoded string, so that you don't need to decode the input in
 	// order to do the matching
 	char str[1];
@@ -68,12 +86,13 @@ struct inst_string : inst_base<inst_type::string> {
 // match set or fail
 struct inst_set : inst_base<inst_type::set> {
 	inst_type type;
-	uint16 len;      // length of the 'uni' attachment
+	int len;         // number of ranges in the 'uni' attachment
 	uint8 ascii[16]; // bitmap for the 7-bit ascii subset of utf-8
-	rune uni[1];     // the rest is attached here in a decoded form, sorted
+	rune uni[1];     // the rest as sorted, disjoint ranges, pairs of from, to
 
 	void set_ascii(rune r) { ascii[r / 8] |= 1 << (r & 7); }
 	bool test_ascii(rune r) const { return ascii[r / 8] & (1 << (r & 7)); }
+	bool test_uni(rune r) const { return matcher::native::in_ranges(uni, len, r); }
 };
 
 // match range or fail
@@ -121,6 +140,83 @@ struct inst_open_capture : inst_base<inst_type::open_capture> {
 
 struct inst_close_capture : inst_base<inst_type::close_capture> {};
 
+// push the return address and jump to a rule
+struct inst_call : inst_base<inst_type::call> {
+	inst_type type;
+	int offset;
+};
+
+// pop the return address and jump to it
+struct inst_return : inst_base<inst_type::return_> {};
+
+struct inst_jump : inst_base<inst_type::jump> {
+	inst_type type;
+	int offset;
+};
+
+// Entry of a memoized rule. If the rule was already applied at the current
+// position, repeats the outcome and returns from the rule. Otherwise pushes a
+// backtrack entry pointing to the memo_fail instruction at 'offset'.
+struct inst_memo_enter : inst_base<inst_type::memo_enter> {
+	inst_type type;
+	int rule;
+	int offset;
+};
+
+// the rule succeeded, pops the memo_enter entry and remembers the outcome
+struct inst_memo_commit : inst_base<inst_type::memo_commit> {
+	inst_type type;
+	int rule;
+};
+
+// the rule failed, remembers that and fails
+struct inst_memo_fail : inst_base<inst_type::memo_fail> {
+	inst_type type;
+	int rule;
+};
+
+// If the input doesn't start with 'c', jumps to 'offset'. Consumes nothing and
+// leaves the stack alone.
+struct inst_test_char : inst_base<inst_type::test_char> {
+	inst_type type;
+	char c;
+	int offset;
+};
+
+// If the input doesn't start with a byte from the bitmap, jumps to 'offset'.
+// Consumes nothing and leaves the stack alone.
+struct inst_test_set : inst_base<inst_type::test_set> {
+	inst_type type;
+	int offset;
+	uint8 bytes[32];
+
+	bool test(uint8 b) const { return bytes[b / 8] & (1 << (b & 7)); }
+};
+
+// consume runes from the set as long as possible, the same as a loop over
+// inst_set without touching the stack
+struct inst_span_set : inst_base<inst_type::span_set> {
+	inst_type type;
+	int len;
+	uint8 ascii[16];
+	rune uni[1];
+
+	void set_ascii(rune r) { ascii[r / 8] |= 1 << (r & 7); }
+	bool test_ascii(rune r) const { return ascii[r / 8] & (1 << (r & 7)); }
+	bool test_uni(rune r) const { return matcher::native::in_ranges(uni, len, r); }
+};
+
+// consume runes from the range as long as possible
+struct inst_span_range : inst_base<inst_type::span_range> {
+	uint32 rune_from;
+	rune rune_to;
+
+	void set_from(rune r) {	rune_from = (rune_from & 0xFF) | r << 8; }
+	void set_to(rune r) { rune_to = r; }
+	rune from() const { return rune_from >> 8; }
+	rune to() const { return rune_to; }
+};
+
 //----------------------------------------------------------------------------
 // Instruction length calculation helpers
 //----------------------------------------------------------------------------
@@ -153,7 +249,74 @@ static int inst_len(const inst_string *p) {
 }
 
 static int inst_len(const inst_set *p) {
-	return multiple_of_4(sizeof(inst_set) + addlen(p->len)*sizeof(rune));
+	return multiple_of_4(sizeof(inst_set) + addlen(p->len*2)*sizeof(rune));
+}
+
+static int inst_len(const inst_span_set *p) {
+	return multiple_of_4(sizeof(inst_span_set) + addlen(p->len*2)*sizeof(rune));
+}
+
+// Returns the length of an instruction of any type.
+static int inst_size(const byte *ip) {
+	switch (reinterpret_cast<const inst_common*>(ip)->type) {
+	case inst_type::string:
+		return inst_len(reinterpret_cast<const inst_string*>(ip));
+	case inst_type::set:
+		return inst_len(reinterpret_cast<const inst_set*>(ip));
+	case inst_type::span_set:
+		return inst_len(reinterpret_cast<const inst_span_set*>(ip));
+	case inst_type::range:
+		return inst_len(reinterpret_cast<const inst_range*>(ip));
+	case inst_type::span_range:
+		return inst_len(reinterpret_cast<const inst_span_range*>(ip));
+	case inst_type::choice:
+	case inst_type::commit:
+	case inst_type::partial_commit:
+	case inst_type::rewind_commit:
+	case inst_type::call:
+	case inst_type::jump:
+		return inst_len(reinterpret_cast<const inst_jump*>(ip));
+	case inst_type::memo_enter:
+		return inst_len(reinterpret_cast<const inst_memo_enter*>(ip));
+	case inst_type::memo_commit:
+	case inst_type::memo_fail:
+		return inst_len(reinterpret_cast<const inst_memo_commit*>(ip));
+	case inst_type::open_capture:
+		return inst_len(reinterpret_cast<const inst_open_capture*>(ip));
+	case inst_type::test_char:
+		return inst_len(reinterpret_cast<const inst_test_char*>(ip));
+	case inst_type::test_set:
+		return inst_len(reinterpret_cast<const inst_test_set*>(ip));
+	case inst_type::any:
+	case inst_type::end:
+	case inst_type::fail:
+	case inst_type::fail_twice:
+	case inst_type::close_capture:
+	case inst_type::return_:
+		return inst_len(reinterpret_cast<const inst_any*>(ip));
+	}
+	return -1;
+}
+
+// Returns the jump target of an instruction, nullptr if it has none.
+static int *inst_target(byte *ip) {
+	switch (reinterpret_cast<const inst_common*>(ip)->type) {
+	case inst_type::choice:
+	case inst_type::commit:
+	case inst_type::partial_commit:
+	case inst_type::rewind_commit:
+	case inst_type::call:
+	case inst_type::jump:
+		return &reinterpret_cast<inst_jump*>(ip)->offset;
+	case inst_type::test_char:
+		return &reinterpret_cast<inst_test_char*>(ip)->offset;
+	case inst_type::test_set:
+		return &reinterpret_cast<inst_test_set*>(ip)->offset;
+	case inst_type::memo_enter:
+		return &reinterpret_cast<inst_memo_enter*>(ip)->offset;
+	default:
+		return nullptr;
+	}
 }
 
 //----------------------------------------------------------------------------
@@ -181,6 +344,7 @@ static inst_ptr<T> inst_new(vector<byte> &instbuf, int add = 0) {
 		size = multiple_of_4(sizeof(T) + addlen(add));
 		break;
 	case inst_type::set:
+	case inst_type::span_set:
 		size = multiple_of_4(sizeof(T) + addlen(add)*sizeof(rune));
 		break;
 	default:
@@ -195,99 +359,724 @@ static inst_ptr<T> inst_new(vector<byte> &instbuf, int add = 0) {
 	return {instbuf, off};
 }
 
+//----------------------------------------------------------------------------
+// Set of bytes, used to describe how a match may start.
+//----------------------------------------------------------------------------
+
+struct charset {
+	uint8 bytes[32] = {};
+
+	void add(int b) { bytes[b / 8] |= 1 << (b & 7); }
+	void add(int from, int to) {
+		for (int b = from; b <= to; b++)
+			add(b);
+	}
+	bool has(int b) const { return bytes[b / 8] & (1 << (b & 7)); }
+
+	// merges 'r' in, returns whether that added anything
+	bool merge(const charset &r) {
+		bool changed = false;
+		for (int i = 0; i < 32; i++) {
+			changed = changed || (bytes[i] | r.bytes[i]) != bytes[i];
+			bytes[i] |= r.bytes[i];
+		}
+		return changed;
+	}
+	bool disjoint(const charset &r) const {
+		for (int i = 0; i < 32; i++) {
+			if (bytes[i] & r.bytes[i])
+				return false;
+		}
+		return true;
+	}
+	int count() const {
+		int n = 0;
+		for (int i = 0; i < 32; i++)
+			n += __builtin_popcount(bytes[i]);
+		return n;
+	}
+	// returns the first byte of the set, -1 if it's empty
+	int min() const {
+		for (int b = 0; b < 256; b++) {
+			if (has(b))
+				return b;
+		}
+		return -1;
+	}
+};
+
+// Adds the first byte of the utf-8 encoding of 'r'. Invalid input decodes as
+// the replacement character, so that one may start with any non-ascii byte.
+static void add_first_byte(charset *cs, rune r) {
+	if (r < utf8::rune_self) {
+		cs->add(r);
+	} else if (r == utf8::rune_error || !utf8::valid_rune(r)) {
+		cs->add(utf8::rune_self, 255);
+	} else {
+		char buf[utf8::utf_max];
+		utf8::encode_rune(buf, r);
+		cs->add(uint8(buf[0]));
+	}
+}
+
+//----------------------------------------------------------------------------
+// Set of runes, compiled into a single instruction for the patterns which
+// match one rune of a set.
+//----------------------------------------------------------------------------
+
+struct rune_class {
+	struct range {
+		rune from;
+		rune to;
+	};
+	// sorted and disjoint after normalize()
+	vector<range> ranges;
+
+	void add(rune from, rune to) {
+		if (from <= to)
+			ranges.append({from, to});
+	}
+
+	// sorts the ranges, merging the ones which overlap or touch
+	void normalize() {
+		std::sort(begin(ranges), end(ranges), [](const range &a, const range &b) {
+			return a.from < b.from;
+		});
+		int n = 0;
+		for (const range &r : ranges) {
+			if (n != 0 && r.from <= ranges[n-1].to + 1) {
+				ranges[n-1].to = std::max(ranges[n-1].to, r.to);
+				continue;
+			}
+			ranges[n++] = r;
+		}
+		ranges.resize(n);
+	}
+
+	// removes the runes of 'r', both must be normalized
+	void subtract(const rune_class &r) {
+		vector<range> out;
+		int j = 0;
+		for (const range &a : ranges) {
+			while (j < r.ranges.len() && r.ranges[j].to < a.from)
+				j++;
+			rune from = a.from;
+			for (int k = j; k < r.ranges.len() && r.ranges[k].from <= a.to; k++) {
+				if (r.ranges[k].from > from)
+					out.append({from, r.ranges[k].from - 1});
+				from = std::max(from, r.ranges[k].to + 1);
+			}
+			if (from <= a.to)
+				out.append({from, a.to});
+		}
+		ranges = std::move(out);
+	}
+};
+
+// Adds the runes 'tree' matches to 'cls' if it matches a single rune of a
+// set: sets, ranges, single runes and choices between them, or such a pattern
+// minus another one. Returns false otherwise.
+static bool charclass(const ast_node *tree, rune_class *cls) {
+	switch (tree->type) {
+	case ast_type::set:
+		for (const auto &it : string_iter(tree->buffer())) {
+			cls->add(it.rune, it.rune);
+		}
+		return true;
+	case ast_type::range:
+		cls->add(tree->from, tree->to);
+		return true;
+	case ast_type::any:
+		cls->add(0, utf8::max_rune);
+		return true;
+	case ast_type::literal: {
+		// invalid input decodes as the replacement character, which a
+		// literal doesn't match
+		if (tree->len == 0)
+			return false;
+		const sized_rune r = utf8::decode_rune(tree->buffer());
+		if (r.size != tree->len || r.rune == utf8::rune_error)
+			return false;
+		cls->add(r.rune, r.rune);
+		return true;
+	}
+	case ast_type::choice:
+		return charclass(tree->left.get(), cls) &&
+			charclass(tree->right.get(), cls);
+	case ast_type::sequence: {
+		// patt1 - patt2
+		if (tree->left->type != ast_type::not_)
+			return false;
+		rune_class sub, c;
+		if (!charclass(tree->left->left.get(), &sub) ||
+			!charclass(tree->right.get(), &c))
+			return false;
+		sub.normalize();
+		c.normalize();
+		c.subtract(sub);
+		cls->ranges.append(c.ranges);
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+//----------------------------------------------------------------------------
+// Grammar rules
+//----------------------------------------------------------------------------
+
+struct rule_info {
+	slice<const char> name;
+	const ast_node *def;
+	bool memoize;
+	bool nullable; // may succeed without consuming input
+	int offset;    // of the rule's code
+	charset first; // bytes a match which consumes input may start with
+};
+
+struct call_fixup {
+	int offset; // of the call instruction
+	int rule;
+};
+
+// Rules of the grammar being compiled and calls waiting for their addresses.
+struct rule_table {
+	vector<rule_info> rules;
+	map<slice<const char>, int> index;
+	vector<call_fixup> fixups;
+
+	int find(const ast_node *call) const {
+		const int *i = index.lookup(call->buffer());
+		return i ? *i : -1;
+	}
+};
+
+// Returns whether 'tree' may succeed without consuming input. Appends the
+// rules it may call before consuming anything to 'calls', unless it's null.
+static bool nullable(const ast_node *tree, const rule_table &rt, vector<int> *calls) {
+	switch (tree->type) {
+	case ast_type::literal:
+		return tree->len == 0;
+	case ast_type::set:
+	case ast_type::range:
+	case ast_type::any:
+	case ast_type::false_:
+		return false;
+	case ast_type::true_:
+		return true;
+	case ast_type::repetition: {
+		const bool n = nullable(tree->left.get(), rt, calls);
+		return tree->len <= 0 || n;
+	}
+	case ast_type::sequence:
+		if (!nullable(tree->left.get(), rt, calls))
+			return false;
+		return nullable(tree->right.get(), rt, calls);
+	case ast_type::choice: {
+		const bool l = nullable(tree->left.get(), rt, calls);
+		const bool r = nullable(tree->right.get(), rt, calls);
+		return l || r;
+	}
+	case ast_type::not_:
+	case ast_type::and_:
+		nullable(tree->left.get(), rt, calls);
+		return true;
+	case ast_type::capture:
+		return nullable(tree->left.get(), rt, calls);
+	case ast_type::call: {
+		const int i = rt.find(tree);
+		if (i == -1)
+			return false;
+		if (calls)
+			calls->append(i);
+		return rt.rules[i].nullable;
+	}
+	}
+	return false;
+}
+
+// Reports a rule which may call itself without consuming input, matching it
+// would never end.
+static void check_left_recursion(rule_table &rt, error *err) {
+	// nullable rules, iterated until nothing changes
+	for (bool changed = true; changed;) {
+		changed = false;
+		for (auto &r : rt.rules) {
+			if (!r.nullable && nullable(r.def, rt, nullptr)) {
+				r.nullable = true;
+				changed = true;
+			}
+		}
+	}
+
+	const int n = rt.rules.len();
+	vector<vector<int>> calls;
+	calls.resize(n);
+	for (int i = 0; i < n; i++) {
+		nullable(rt.rules[i].def, rt, &calls[i]);
+	}
+
+	// depth-first search for a cycle, 1 - on the path, 2 - done
+	vector<int> state;
+	state.resize(n, 0);
+	vector<int> path;
+	vector<int> next;
+	for (int root = 0; root < n; root++) {
+		if (state[root] != 0)
+			continue;
+		path.append(root);
+		next.append(0);
+		state[root] = 1;
+		while (path.len() > 0) {
+			const int r = path[path.len()-1];
+			int &j = next[next.len()-1];
+			if (j == calls[r].len()) {
+				state[r] = 2;
+				path.resize(path.len()-1);
+				next.resize(next.len()-1);
+				continue;
+			}
+			const int c = calls[r][j++];
+			if (state[c] == 1) {
+				const slice<const char> name = rt.rules[c].name;
+				err->set("peg: rule '%.*s' is left recursive",
+					name.len(), name.data());
+				return;
+			}
+			if (state[c] == 0) {
+				state[c] = 1;
+				path.append(c);
+				next.append(0);
+			}
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+// Pattern analysis, used by codegen to avoid backtrack entries.
+//----------------------------------------------------------------------------
+
+// Adds the bytes a match of 'tree' which consumes input may start with to 'cs'
+// (a superset of them). Returns whether 'tree' may succeed without consuming
+// input.
+static bool first(const ast_node *tree, const rule_table *rt, charset *cs) {
+	switch (tree->type) {
+	case ast_type::literal:
+		if (tree->len == 0)
+			return true;
+		cs->add(uint8(tree->buffer()[0]));
+		return false;
+	case ast_type::set:
+		for (const auto &it : string_iter(tree->buffer())) {
+			add_first_byte(cs, it.rune);
+		}
+		return false;
+	case ast_type::range: {
+		const rune from = tree->from;
+		const rune to = tree->to;
+		if (to < from)
+			return false;
+		if (from < utf8::rune_self)
+			cs->add(from, to < utf8::rune_self ? to : utf8::rune_self - 1);
+		if (to < utf8::rune_self)
+			return false;
+		if (to >= 0xD800) {
+			// surrogates and beyond, may include the replacement character
+			cs->add(utf8::rune_self, 255);
+			return false;
+		}
+		char lo[utf8::utf_max], hi[utf8::utf_max];
+		utf8::encode_rune(lo, from < utf8::rune_self ? utf8::rune_self : from);
+		utf8::encode_rune(hi, to);
+		cs->add(uint8(lo[0]), uint8(hi[0]));
+		return false;
+	}
+	case ast_type::any:
+		cs->add(0, 255);
+		return false;
+	case ast_type::true_:
+		return true;
+	case ast_type::false_:
+		return false;
+	case ast_type::repetition: {
+		const bool e = first(tree->left.get(), rt, cs);
+		return tree->len <= 0 || e;
+	}
+	case ast_type::sequence:
+		if (!first(tree->left.get(), rt, cs))
+			return false;
+		return first(tree->right.get(), rt, cs);
+	case ast_type::choice: {
+		const bool l = first(tree->left.get(), rt, cs);
+		const bool r = first(tree->right.get(), rt, cs);
+		return l || r;
+	}
+	case ast_type::not_:
+	case ast_type::and_:
+		return true;
+	case ast_type::capture:
+		return first(tree->left.get(), rt, cs);
+	case ast_type::call: {
+		const int i = rt ? rt->find(tree) : -1;
+		if (i == -1)
+			return true;
+		cs->merge(rt->rules[i].first);
+		return rt->rules[i].nullable;
+	}
+	}
+	return true;
+}
+
+// Returns whether 'tree' can't fail.
+static bool nofail(const ast_node *tree) {
+	switch (tree->type) {
+	case ast_type::literal:
+		return tree->len == 0;
+	case ast_type::true_:
+		return true;
+	case ast_type::repetition:
+		return tree->len <= 0 || nofail(tree->left.get());
+	case ast_type::sequence:
+		return nofail(tree->left.get()) && nofail(tree->right.get());
+	case ast_type::choice:
+		return nofail(tree->left.get()) || nofail(tree->right.get());
+	case ast_type::and_:
+	case ast_type::capture:
+		return nofail(tree->left.get());
+	default:
+		return false;
+	}
+}
+
+// Returns whether 'tree' may fail only on its first byte and 'first' gives
+// exactly the bytes it succeeds on, so that testing that byte is enough.
+static bool headfail(const ast_node *tree) {
+	switch (tree->type) {
+	case ast_type::literal:
+		return tree->len == 1;
+	case ast_type::set:
+		for (const auto &it : string_iter(tree->buffer())) {
+			if (it.rune >= utf8::rune_self)
+				return false;
+		}
+		return true;
+	case ast_type::range:
+		return tree->to < utf8::rune_self;
+	case ast_type::any:
+	case ast_type::false_:
+		return true;
+	case ast_type::sequence:
+		return headfail(tree->left.get()) && nofail(tree->right.get());
+	case ast_type::choice:
+		return headfail(tree->left.get()) && headfail(tree->right.get());
+	case ast_type::capture:
+		return headfail(tree->left.get());
+	default:
+		return false;
+	}
+}
+
+// Computes the first sets of the rules, iterated until nothing changes.
+static void compute_first_sets(rule_table &rt) {
+	for (bool changed = true; changed;) {
+		changed = false;
+		for (auto &r : rt.rules) {
+			charset cs;
+			first(r.def, &rt, &cs);
+			changed = r.first.merge(cs) || changed;
+		}
+	}
+}
+
+// Appends the literal every match of 'tree' starts with to 'prefix'. Returns
+// whether 'tree' matches just that literal, so that what follows it adds to
+// the prefix. Calls are followed at most 'depth' levels deep.
+static bool literal_prefix(const ast_node *tree, const rule_table *rt,
+	int depth, string *prefix)
+{
+	switch (tree->type) {
+	case ast_type::literal:
+		prefix->append(tree->buffer());
+		return true;
+	case ast_type::sequence:
+		return literal_prefix(tree->left.get(), rt, depth, prefix) &&
+			literal_prefix(tree->right.get(), rt, depth, prefix);
+	case ast_type::capture:
+		return literal_prefix(tree->left.get(), rt, depth, prefix);
+	case ast_type::call: {
+		const int i = rt ? rt->find(tree) : -1;
+		if (i == -1 || depth == 0)
+			return false;
+		return literal_prefix(rt->rules[i].def, rt, depth - 1, prefix);
+	}
+	default:
+		return false;
+	}
+}
+
+// Describes what a match of 'tree' starts with, for the searches. Returns
+// false if it may match the empty string, there's nothing to look for then.
+static bool scan_start(const ast_node *tree, const rule_table *rt,
+	string *prefix, uint8 *rows)
+{
+	charset cs;
+	if (first(tree, rt, &cs))
+		return false;
+	literal_prefix(tree, rt, 8, prefix);
+	if (prefix->len() == 0 && cs.count() == 1)
+		prefix->append(char(cs.min()));
+	for (int c = 0; c < 256; c++) {
+		if (cs.has(c))
+			rows[(c & 15) | (c & 128) >> 3] |= 1 << (c >> 4 & 7);
+	}
+	return true;
+}
+
 //----------------------------------------------------------------------------
 // Main recursive compilation routine.
 //----------------------------------------------------------------------------
 static void codegen(vector<byte> &instbuf,
-	const ast_node *tree, error *err)
+	const ast_node *tree, rule_table *rt, error *err);
+
+// inst_set or inst_span_set
+template <typename T>
+static void codegen_set(vector<byte> &instbuf, rune_class &cls) {
+	cls.normalize();
+	int uni_n = 0;
+	// count the ranges beyond ascii
+	for (const auto &r : cls.ranges) {
+		if (r.to >= utf8::rune_self)
+			uni_n++;
+	}
+	auto ins = inst_new<T>(instbuf, uni_n*2);
+	for (int i = 0; i < 16; i++)
+		ins->ascii[i] = 0;
+	ins->len = uni_n;
+
+	int i = 0;
+	for (const auto &r : cls.ranges) {
+		for (rune c = r.from; c <= r.to && c < utf8::rune_self; c++)
+			ins->set_ascii(c);
+		if (r.to >= utf8::rune_self) {
+			ins->uni[i++] = std::max(r.from, utf8::rune_self);
+			ins->uni[i++] = r.to;
+		}
+	}
+}
+
+// inst_range or inst_span_range
+template <typename T>
+static void codegen_range(vector<byte> &instbuf, const ast_node *tree) {
+	auto ins = inst_new<T>(instbuf);
+	ins->set_from(tree->from);
+	ins->set_to(tree->to);
+}
+
+// Emits a test of the next input byte against 'cs', returns its offset for
+// patch_test().
+static int codegen_test(vector<byte> &instbuf, const charset &cs) {
+	if (cs.count() == 1) {
+		auto ins = inst_new<inst_test_char>(instbuf);
+		ins->c = cs.min();
+		return ins.offset;
+	}
+	auto ins = inst_new<inst_test_set>(instbuf);
+	for (int i = 0; i < 32; i++)
+		ins->bytes[i] = cs.bytes[i];
+	return ins.offset;
+}
+
+// Sets the address the test at 'test' jumps to, a no-op if 'test' is -1.
+static void patch_test(vector<byte> &instbuf, int test, int target) {
+	if (test != -1)
+		*inst_target(instbuf.data() + test) = target;
+}
+
+static void codegen_star(vector<byte> &instbuf,
+	const ast_node *p, rule_table *rt, error *err)
+{
+	if (p->type == ast_type::range) {
+		codegen_range<inst_span_range>(instbuf, p);
+		return;
+	}
+	rune_class cls;
+	if (charclass(p, &cls)) {
+		codegen_set<inst_span_set>(instbuf, cls);
+		return;
+	}
+	charset cs;
+	const bool e = first(p, rt, &cs);
+	if (headfail(p)) {
+		// L1: test first(p), L2
+		//     <p>
+		//     jump L1
+		// L2:
+		const int start = instbuf.len();
+		const int test = codegen_test(instbuf, cs);
+		codegen(instbuf, p, rt, err);
+		inst_new<inst_jump>(instbuf)->offset = start;
+		patch_test(instbuf, test, instbuf.len());
+		return;
+	}
+	//     test first(p), L2    (if p can't match empty)
+	//     choice L2
+	// L1: <p>
+	//     partial_commit L1
+	// L2:
+	const int test = e ? -1 : codegen_test(instbuf, cs);
+	auto choice = inst_new<inst_choice>(instbuf);
+	const int start = instbuf.len();
+	codegen(instbuf, p, rt, err);
+	inst_new<inst_partial_commit>(instbuf)->offset = start;
+	choice->offset = instbuf.len();
+	patch_test(instbuf, test, instbuf.len());
+}
+
+static void codegen_optional(vector<byte> &instbuf,
+	const ast_node *p, rule_table *rt, error *err)
+{
+	charset cs;
+	const bool e = first(p, rt, &cs);
+	if (headfail(p)) {
+		//     test first(p), L1
+		//     <p>
+		// L1:
+		const int test = codegen_test(instbuf, cs);
+		codegen(instbuf, p, rt, err);
+		patch_test(instbuf, test, instbuf.len());
+		return;
+	}
+	//     test first(p), L1    (if p can't match empty)
+	//     choice L1
+	//     <p>
+	//     commit L1
+	// L1:
+	const int test = e ? -1 : codegen_test(instbuf, cs);
+	auto choice = inst_new<inst_choice>(instbuf);
+	codegen(instbuf, p, rt, err);
+	auto commit = inst_new<inst_commit>(instbuf);
+	choice->offset = commit->offset = instbuf.len();
+	patch_test(instbuf, test, instbuf.len());
+}
+
+static void codegen(vector<byte> &instbuf,
+	const ast_node *tree, rule_table *rt, error *err)
 {
 	if (*err)
 		return;
 
 	switch (tree->type) {
 	case ast_type::literal: {
+		if (tree->len == 0)
+			break;
 		auto ins = inst_new<inst_string>(instbuf, tree->len);
 		ins->len = tree->len;
 		copy(ins->buffer(), tree->buffer());
 		break;
 	}
 	case ast_type::set: {
-		int uni_n = 0;
-		// count unicode runes
-		for (const auto &it : string_iter(tree->buffer())) {
-			if (it.rune >= utf8::rune_self) {
-				uni_n++;
-			}
-		}
-		auto ins = inst_new<inst_set>(instbuf, uni_n);
-		for (int i = 0; i < 16; i++)
-			ins->ascii[i] = 0;
-		ins->len = uni_n;
-
-		int i = 0;
-		for (const auto &it : string_iter(tree->buffer())) {
-			if (it.rune < utf8::rune_self) {
-				ins->set_ascii(it.rune);
-			} else {
-				ins->uni[i++] = it.rune;
-			}
-		}
+		rune_class cls;
+		charclass(tree, &cls);
+		codegen_set<inst_set>(instbuf, cls);
 		break;
 	}
-	case ast_type::range: {
-		auto ins = inst_new<inst_range>(instbuf);
-		ins->set_from(tree->from);
-		ins->set_to(tree->to);
+	case ast_type::range:
+		codegen_range<inst_range>(instbuf, tree);
 		break;
-	}
 	case ast_type::any: {
 		inst_new<inst_any>(instbuf);
 		break;
 	}
-	case ast_type::repetition: {
+	case ast_type::repetition:
 		if (tree->len < 0) {
 			// patt? - zero or one
-			auto choice = inst_new<inst_choice>(instbuf);
-			codegen(instbuf, tree->left.get(), err);
-			auto commit = inst_new<inst_commit>(instbuf);
-			choice->offset = commit->offset = instbuf.len();
+			codegen_optional(instbuf, tree->left.get(), rt, err);
 		} else {
 			// patt* - zero or more
 			// patt+ - one or more
 			for (int i = 0; i < tree->len; i++) {
-				codegen(instbuf, tree->left.get(), err);
+				codegen(instbuf, tree->left.get(), rt, err);
 			}
-			auto choice = inst_new<inst_choice>(instbuf);
-			int start = instbuf.len();
-			codegen(instbuf, tree->left.get(), err);
-			inst_new<inst_partial_commit>(instbuf)->offset = start;
-			choice->offset = instbuf.len();
+			codegen_star(instbuf, tree->left.get(), rt, err);
 		}
 		break;
-	}
-	case ast_type::sequence:
-		codegen(instbuf, tree->left.get(), err);
-		codegen(instbuf, tree->right.get(), err);
+	case ast_type::sequence: {
+		rune_class cls;
+		if (charclass(tree, &cls)) {
+			codegen_set<inst_set>(instbuf, cls);
+			break;
+		}
+		codegen(instbuf, tree->left.get(), rt, err);
+		codegen(instbuf, tree->right.get(), rt, err);
 		break;
+	}
 	case ast_type::choice: {
+		rune_class cls;
+		if (charclass(tree, &cls)) {
+			codegen_set<inst_set>(instbuf, cls);
+			break;
+		}
+		const ast_node *p1 = tree->left.get();
+		const ast_node *p2 = tree->right.get();
+		charset cs1, cs2;
+		const bool e1 = first(p1, rt, &cs1);
+		if (headfail(p1) || (!e1 && !first(p2, rt, &cs2) && cs1.disjoint(cs2))) {
+			// Once the first byte of p1 matches, p2 can't match, so there
+			// is nothing to backtrack to.
+			//     test first(p1), L1
+			//     <p1>
+			//     jump L2
+			// L1: <p2>
+			// L2:
+			const int test = codegen_test(instbuf, cs1);
+			codegen(instbuf, p1, rt, err);
+			auto jump = inst_new<inst_jump>(instbuf);
+			patch_test(instbuf, test, instbuf.len());
+			codegen(instbuf, p2, rt, err);
+			jump->offset = instbuf.len();
+			break;
+		}
+		//     test first(p1), L1    (if p1 can't match empty)
+		//     choice L1
+		//     <p1>
+		//     commit L2
+		// L1: <p2>
+		// L2:
+		const int test = e1 ? -1 : codegen_test(instbuf, cs1);
 		auto choice = inst_new<inst_choice>(instbuf);
-		codegen(instbuf, tree->left.get(), err);
+		codegen(instbuf, p1, rt, err);
 		auto commit = inst_new<inst_commit>(instbuf);
 		choice->offset = instbuf.len();
-		codegen(instbuf, tree->right.get(), err);
+		patch_test(instbuf, test, instbuf.len());
+		codegen(instbuf, p2, rt, err);
 		commit->offset = instbuf.len();
 		break;
 	}
 	case ast_type::not_: {
+		const ast_node *p = tree->left.get();
+		charset cs;
+		const bool e = first(p, rt, &cs);
+		if (headfail(p)) {
+			//     test first(p), L1
+			//     fail
+			// L1:
+			const int test = codegen_test(instbuf, cs);
+			inst_new<inst_fail>(instbuf);
+			patch_test(instbuf, test, instbuf.len());
+			break;
+		}
+		const int test = e ? -1 : codegen_test(instbuf, cs);
 		auto choice = inst_new<inst_choice>(instbuf);
-		codegen(instbuf, tree->left.get(), err);
+		codegen(instbuf, p, rt, err);
 		inst_new<inst_fail_twice>(instbuf);
 		choice->offset = instbuf.len();
+		patch_test(instbuf, test, instbuf.len());
 		break;
 	}
 	case ast_type::and_: {
 		auto choice = inst_new<inst_choice>(instbuf);
-		codegen(instbuf, tree->left.get(), err);
+		codegen(instbuf, tree->left.get(), rt, err);
 		auto rcommit = inst_new<inst_rewind_commit>(instbuf);
 		choice->offset = instbuf.len();
 		inst_new<inst_fail>(instbuf);
@@ -297,14 +1086,45 @@ static void codegen(vector<byte> &instbuf,
 	case ast_type::capture: {
 		auto open = inst_new<inst_open_capture>(instbuf);
 		open->ctype = static_cast<capture_type>(tree->len);
-		codegen(instbuf, tree->left.get(), err);
+		codegen(instbuf, tree->left.get(), rt, err);
 		inst_new<inst_close_capture>(instbuf);
 		break;
 	}
-	default:
-		printf("oops\n");
+	case ast_type::true_:
+		break;
+	case ast_type::false_:
+		inst_new<inst_fail>(instbuf);
+		break;
+	case ast_type::call: {
+		const slice<const char> name = tree->buffer();
+		if (rt == nullptr) {
+			err->set("peg: rule '%.*s' used outside of a grammar",
+				name.len(), name.data());
+			return;
+		}
+		const int i = rt->find(tree);
+		if (i == -1) {
+			err->set("peg: undefined rule '%.*s'",
+				name.len(), name.data());
+			return;
+		}
+		auto call = inst_new<inst_call>(instbuf);
+		rt->fixups.append({call.offset, i});
 		break;
 	}
+	}
+}
+
+// Appends the ranges of a set beyond ascii as "from-to", single runes as is.
+static void append_ranges(string &s, const rune *uni, int n) {
+	char buf[utf8::utf_max];
+	for (int i = 0; i < n; i++) {
+		s.append({buf, utf8::encode_rune(buf, uni[i*2])});
+		if (uni[i*2] == uni[i*2+1])
+			continue;
+		s.append('-');
+		s.append({buf, utf8::encode_rune(buf, uni[i*2+1])});
+	}
 }
 
 static int print_instruction(int ioff, const byte *ip) {
@@ -328,11 +1148,7 @@ static int print_instruction(int ioff, const byte *ip) {
 			if (is->test_ascii(i))
 				s.append(i);
 		}
-		for (int i = 0; i < is->len; i++) {
-			char buf[utf8::utf_max];
-			int n = utf8::encode_rune(buf, is->uni[i]);
-			s.append({buf, n});
-		}
+		append_ranges(s, is->uni, is->len);
 		printf("%4d: inst_set (\"%s\")\n",
 			ioff, s.c_str());
 		return inst_len(is);
@@ -388,13 +1204,86 @@ static int print_instruction(int ioff, const byte *ip) {
 		printf("%4d: inst_close_capture\n", ioff);
 		return inst_len(icc);
 	}
-	case inst_type::end: {
-		printf("%4d: inst_end\n", ioff);
-		return -1;
+	case inst_type::call: {
+		auto ic = reinterpret_cast<const inst_call*>(ip);
+		printf("%4d: inst_call (%d)\n", ioff, ic->offset);
+		return inst_len(ic);
 	}
-	default:
-		printf("%d: unknown instruction (%d)\n",
-			ioff, type);
+	case inst_type::return_: {
+		auto ir = reinterpret_cast<const inst_return*>(ip);
+		printf("%4d: inst_return\n", ioff);
+		return inst_len(ir);
+	}
+	case inst_type::jump: {
+		auto ij = reinterpret_cast<const inst_jump*>(ip);
+		printf("%4d: inst_jump (%d)\n", ioff, ij->offset);
+		return inst_len(ij);
+	}
+	case inst_type::memo_enter: {
+		auto ime = reinterpret_cast<const inst_memo_enter*>(ip);
+		printf("%4d: inst_memo_enter (%d, %d)\n", ioff, ime->rule, ime->offset);
+		return inst_len(ime);
+	}
+	case inst_type::memo_commit: {
+		auto imc = reinterpret_cast<const inst_memo_commit*>(ip);
+		printf("%4d: inst_memo_commit (%d)\n", ioff, imc->rule);
+		return inst_len(imc);
+	}
+	case inst_type::memo_fail: {
+		auto imf = reinterpret_cast<const inst_memo_fail*>(ip);
+		printf("%4d: inst_memo_fail (%d)\n", ioff, imf->rule);
+		return inst_len(imf);
+	}
+	case inst_type::test_char: {
+		auto itc = reinterpret_cast<const inst_test_char*>(ip);
+		printf("%4d: inst_test_char ('%c', %d)\n", ioff, itc->c, itc->offset);
+		return inst_len(itc);
+	}
+	case inst_type::test_set: {
+		string s;
+		auto its = reinterpret_cast<const inst_test_set*>(ip);
+		for (int i = 0; i < 256; i++) {
+			if (!its->test(i))
+				continue;
+			if (i >= 0x20 && i < 0x7F) {
+				s.append(char(i));
+			} else {
+				char buf[5];
+				snprintf(buf, sizeof(buf), "\\x%02X", i);
+				s.append(buf);
+			}
+		}
+		printf("%4d: inst_test_set (\"%s\", %d)\n", ioff, s.c_str(), its->offset);
+		return inst_len(its);
+	}
+	case inst_type::span_set: {
+		string s;
+		auto iss = reinterpret_cast<const inst_span_set*>(ip);
+		for (int i = 0; i < 128; i++) {
+			if (iss->test_ascii(i))
+				s.append(i);
+		}
+		append_ranges(s, iss->uni, iss->len);
+		printf("%4d: inst_span_set (\"%s\")\n", ioff, s.c_str());
+		return inst_len(iss);
+	}
+	case inst_type::span_range: {
+		char tmpfrom[4+1];
+		char tmpto[4+1];
+		auto isr = reinterpret_cast<const inst_span_range*>(ip);
+		tmpfrom[utf8::encode_rune(tmpfrom, isr->from())] = '\0';
+		tmpto[utf8::encode_rune(tmpto, isr->to())] = '\0';
+		printf("%4d: inst_span_range ('%s' - '%s')\n",
+			ioff, tmpfrom, tmpto);
+		return inst_len(isr);
+	}
+	case inst_type::end: {
+		printf("%4d: inst_end\n", ioff);
+		return -1;
+	}
+	default:
+		printf("%d: unknown instruction (%d)\n",
+			ioff, type);
 		return -1;
 	}
 }
@@ -409,87 +1298,803 @@ static void dump(slice<const byte> code) {
 	}
 }
 
-bytecode compile(const ast &tree, error *err) {
+// Makes the instructions which jump to an unconditional jump go straight to
+// its destination. Nested choices produce chains of those.
+static void thread_jumps(vector<byte> &code) {
+	for (int off = 0; off < code.len(); off += inst_size(code.data() + off)) {
+		int *target = inst_target(code.data() + off);
+		if (target == nullptr)
+			continue;
+		// codegen never produces a cycle of jumps, it would be an endless
+		// loop not consuming any input
+		for (;;) {
+			const byte *ip = code.data() + *target;
+			if (reinterpret_cast<const inst_common*>(ip)->type != inst_type::jump)
+				break;
+			*target = reinterpret_cast<const inst_jump*>(ip)->offset;
+		}
+	}
+}
+
+program compile(const ast &tree, error *err) {
 	vector<byte> instbuf;
-	codegen(instbuf, tree.p.get(), err);
+	codegen(instbuf, tree.p.get(), nullptr, err);
 	inst_new<inst_end>(instbuf);
-	return bytecode{std::move(instbuf)};
+	thread_jumps(instbuf);
+
+	program::scan_t scan;
+	scan.anywhere = !scan_start(tree.p.get(), nullptr, &scan.prefix, scan.rows);
+	return program{std::move(instbuf), std::move(scan)};
 }
 
-bool bytecode::match(slice<const char> input) {
-	initial_input = input;
+// The layout is:
+//
+//         call rule0
+//         jump end
+//  rule0: <rule0>
+//         return
+//         ...
+//  ruleN: memo_enter N, fail    (memoized rules)
+//         <ruleN>
+//         memo_commit N
+//         return
+//   fail: memo_fail N
+//    end: end
+program compile(const grammar &g, error *err) {
+	vector<byte> instbuf;
+	if (g._rules.len() == 0) {
+		err->set("peg: empty grammar");
+		inst_new<inst_end>(instbuf);
+		return program{std::move(instbuf)};
+	}
+
+	rule_table rt;
+	for (const auto &r : g._rules) {
+		if (rt.index.lookup(r.name.sub())) {
+			err->set("peg: rule '%s' defined twice", r.name.c_str());
+		}
+		rt.index[r.name.sub()] = rt.rules.len();
+		rt.rules.append({r.name.sub(), r.def.get(), r.memoize, false, 0, {}});
+	}
+	if (!*err)
+		check_left_recursion(rt, err);
+	if (!*err)
+		compute_first_sets(rt);
+
+	auto start = inst_new<inst_call>(instbuf);
+	rt.fixups.append({start.offset, 0});
+	auto jump = inst_new<inst_jump>(instbuf);
+	for (int i = 0; i < rt.rules.len(); i++) {
+		rule_info &r = rt.rules[i];
+		r.offset = instbuf.len();
+		if (!r.memoize) {
+			codegen(instbuf, r.def, &rt, err);
+			inst_new<inst_return>(instbuf);
+			continue;
+		}
+		auto enter = inst_new<inst_memo_enter>(instbuf);
+		enter->rule = i;
+		codegen(instbuf, r.def, &rt, err);
+		inst_new<inst_memo_commit>(instbuf)->rule = i;
+		inst_new<inst_return>(instbuf);
+		enter->offset = instbuf.len();
+		inst_new<inst_memo_fail>(instbuf)->rule = i;
+	}
+	jump->offset = instbuf.len();
+	inst_new<inst_end>(instbuf);
+
+	for (const auto &f : rt.fixups) {
+		inst_ptr<inst_call>{instbuf, f.offset}->offset = rt.rules[f.rule].offset;
+	}
+	thread_jumps(instbuf);
+
+	program::scan_t scan;
+	if (!*err)
+		scan.anywhere = !scan_start(rt.rules[0].def, &rt, &scan.prefix, scan.rows);
+	return program{std::move(instbuf), std::move(scan)};
+}
+
+//----------------------------------------------------------------------------
+// C++ code generation
+//----------------------------------------------------------------------------
+
+// Appends 'case' labels for the ascii runes in the set.
+static void append_cases(string &out, const char *indent, const uint8 *ascii) {
+	int n = 0;
+	for (int i = 0; i < 128; i++) {
+		if (!(ascii[i / 8] & (1 << (i & 7))))
+			continue;
+		if (n % 8 == 0)
+			fmt::append(out, "%s%scase %d:", n == 0 ? "" : "\n", indent, i);
+		else
+			fmt::append(out, " case %d:", i);
+		n++;
+	}
+	if (n != 0)
+		out.append('\n');
+}
+
+// Appends the definition of the array holding the ranges of a set beyond
+// ascii.
+static void append_ranges_decl(string &out, const char *indent, const rune *uni, int n) {
+	fmt::append(out, "%sstatic const zbs::rune ranges[] = {", indent);
+	for (int i = 0; i < n; i++) {
+		if (i % 4 == 0)
+			fmt::append(out, "\n%s\t", indent);
+		else
+			out.append(' ');
+		fmt::append(out, "%d, %d,", uni[i*2], uni[i*2+1]);
+	}
+	out.append("\n");
+	out.append(indent);
+	out.append("};\n");
+}
+
+// Appends 's' as a C++ string literal.
+static void append_literal(string &out, slice<const char> s) {
+	out.append('"');
+	for (char c : s) {
+		const uint8 b = c;
+		if (b == '"' || b == '\\' || b == '?' || b < 0x20 || b >= 0x7F) {
+			// three octal digits never run into the next character
+			fmt::append(out, "\\%03o", b);
+		} else {
+			out.append(c);
+		}
+	}
+	out.append('"');
+}
+
+// Returns true if the set has ascii runes, without them there are no 'case'
+// labels and a switch would be unreachable code.
+static bool has_ascii(const uint8 *ascii) {
+	for (int i = 0; i < 16; i++) {
+		if (ascii[i] != 0)
+			return true;
+	}
+	return false;
+}
+
+// Appends a block consuming the next rune if it's in the set or jumping to
+// 'fail' otherwise. Ascii runes are tested without decoding, the others are
+// searched for in the ranges.
+static void append_set(string &out, const uint8 *ascii, const rune *uni, int n) {
+	const bool cases = has_ascii(ascii);
+	if (!cases && n == 0) {
+		out.append("\tgoto fail;\n");
+		return;
+	}
+	out.append("\tif (in.len() == 0)\n\t\tgoto fail;\n");
+	if (!cases) {
+		out.append("\tif (zbs::uint8(in[0]) < 128)\n\t\tgoto fail;\n\t{\n");
+	} else {
+		if (n != 0)
+			out.append("\tif (zbs::uint8(in[0]) < 128) {\n");
+		else
+			out.append("\t{\n");
+		out.append("\t\tswitch (zbs::uint8(in[0])) {\n");
+		append_cases(out, "\t\t", ascii);
+		out.append("\t\t\tbreak;\n\t\tdefault:\n\t\t\tgoto fail;\n\t\t}\n"
+			"\t\tin = in.sub(1);\n");
+		if (n != 0)
+			out.append("\t} else {\n");
+	}
+	if (n != 0) {
+		append_ranges_decl(out, "\t\t", uni, n);
+		fmt::append(out, "\t\tconst zbs::sized_rune r = zbs::unicode::utf8::decode_rune(in);\n"
+			"\t\tif (!native::in_ranges(ranges, %d, r.rune))\n\t\t\tgoto fail;\n"
+			"\t\tin = in.sub(r.size);\n", n);
+	}
+	out.append("\t}\n");
+}
+
+// Appends a loop consuming the runes in the set.
+static void append_span_set(string &out, const uint8 *ascii, const rune *uni, int n) {
+	const bool cases = has_ascii(ascii);
+	if (!cases && n == 0)
+		return;
+	out.append("\twhile (in.len() != 0) {\n");
+	if (!cases) {
+		out.append("\t\tif (zbs::uint8(in[0]) < 128)\n\t\t\tbreak;\n");
+	} else {
+		if (n != 0)
+			out.append("\t\tif (zbs::uint8(in[0]) < 128) {\n");
+		const char *indent = n != 0 ? "\t\t\t" : "\t\t";
+		fmt::append(out, "%sswitch (zbs::uint8(in[0])) {\n", indent);
+		append_cases(out, indent, ascii);
+		fmt::append(out, "%s\tin = in.sub(1);\n%s\tcontinue;\n%s}\n%sbreak;\n",
+			indent, indent, indent, indent);
+		if (n != 0)
+			out.append("\t\t}\n");
+	}
+	if (n != 0) {
+		append_ranges_decl(out, "\t\t", uni, n);
+		fmt::append(out, "\t\tconst zbs::sized_rune r = zbs::unicode::utf8::decode_rune(in);\n"
+			"\t\tif (!native::in_ranges(ranges, %d, r.rune))\n\t\t\tbreak;\n"
+			"\t\tin = in.sub(r.size);\n", n);
+	}
+	out.append("\t}\n");
+}
+
+// Declares the value tested against a range ending at 'to', the input is
+// decoded only if the range goes beyond ascii. Returns its name.
+static const char *append_range_decl(string &out, rune to) {
+	if (to < utf8::rune_self) {
+		out.append("\t\tconst zbs::uint8 c = in[0];\n");
+		return "c";
+	}
+	out.append("\t\tconst zbs::sized_rune r = zbs::unicode::utf8::decode_rune(in);\n");
+	return "r.rune";
+}
+
+static void append_range(string &out, rune from, rune to) {
+	out.append("\tif (in.len() == 0)\n\t\tgoto fail;\n\t{\n");
+	const char *v = append_range_decl(out, to);
+	fmt::append(out, "\t\tif (%s < %d || %s > %d)\n\t\t\tgoto fail;\n"
+		"\t\tin = in.sub(%s);\n\t}\n",
+		v, from, v, to, to < utf8::rune_self ? "1" : "r.size");
+}
+
+static void append_span_range(string &out, rune from, rune to) {
+	out.append("\twhile (in.len() != 0) {\n");
+	const char *v = append_range_decl(out, to);
+	fmt::append(out, "\t\tif (%s < %d || %s > %d)\n\t\t\tbreak;\n"
+		"\t\tin = in.sub(%s);\n\t}\n",
+		v, from, v, to, to < utf8::rune_self ? "1" : "r.size");
+}
+
+static bool is_identifier(const char *s) {
+	if (!(*s == '_' || (*s >= 'a' && *s <= 'z') || (*s >= 'A' && *s <= 'Z')))
+		return false;
+	for (s++; *s; s++) {
+		if (!(*s == '_' || (*s >= 'a' && *s <= 'z') ||
+			(*s >= 'A' && *s <= 'Z') || (*s >= '0' && *s <= '9')))
+			return false;
+	}
+	return true;
+}
+
+// Every instruction becomes a block of code labeled with its offset, jumps
+// become gotos. Backtracking and returning from rules go through a switch
+// over the labels they may go to.
+string generate_cpp(const program &p, const char *name, error *err) {
+	if (!is_identifier(name)) {
+		err->set("peg: '%s' is not a C++ identifier", name);
+		return {};
+	}
+	if (p.d->native_match) {
+		err->set("peg: the program is generated code already");
+		return {};
+	}
+
+	const slice<const byte> code = p.d->code;
+	// 1 - goto target, 2 - backtrack target, 4 - return address
+	vector<uint8> labels;
+	labels.resize(code.len() + 1, 0);
+	for (int off = 0; off < code.len(); off += inst_size(code.data() + off)) {
+		byte *ip = const_cast<byte*>(code.data() + off);
+		const int *target = inst_target(ip);
+		if (target == nullptr)
+			continue;
+		switch (reinterpret_cast<const inst_common*>(ip)->type) {
+		case inst_type::choice:
+		case inst_type::memo_enter:
+			labels[*target] |= 2;
+			break;
+		case inst_type::call:
+			labels[*target] |= 1;
+			labels[off + inst_size(ip)] |= 4;
+			break;
+		default:
+			labels[*target] |= 1;
+			break;
+		}
+	}
+
+	string body;
+	bool uses_fail = false;
+	bool uses_ret = false;
+	for (int off = 0; off < code.len(); off += inst_size(code.data() + off)) {
+		const byte *ip = code.data() + off;
+		if (labels[off])
+			fmt::append(body, "L%d:\n", off);
+		switch (reinterpret_cast<const inst_common*>(ip)->type) {
+		case inst_type::any:
+			uses_fail = true;
+			body.append("\tif (in.len() == 0)\n\t\tgoto fail;\n"
+				"\tin = in.sub(zbs::uint8(in[0]) < 128 ? 1 :\n"
+				"\t\tzbs::unicode::utf8::decode_rune(in).size);\n");
+			break;
+		case inst_type::string: {
+			auto is = reinterpret_cast<const inst_string*>(ip);
+			if (is->len == 0)
+				break;
+			uses_fail = true;
+			fmt::append(body, "\tif (in.len() < %d || std::memcmp(in.data(), ", is->len);
+			append_literal(body, is->buffer());
+			fmt::append(body, ", %d) != 0)\n\t\tgoto fail;\n\tin = in.sub(%d);\n",
+				is->len, is->len);
+			break;
+		}
+		case inst_type::set: {
+			auto is = reinterpret_cast<const inst_set*>(ip);
+			uses_fail = true;
+			append_set(body, is->ascii, is->uni, is->len);
+			break;
+		}
+		case inst_type::range: {
+			auto ir = reinterpret_cast<const inst_range*>(ip);
+			uses_fail = true;
+			append_range(body, ir->from(), ir->to());
+			break;
+		}
+		case inst_type::span_set: {
+			auto is = reinterpret_cast<const inst_span_set*>(ip);
+			append_span_set(body, is->ascii, is->uni, is->len);
+			break;
+		}
+		case inst_type::span_range: {
+			auto ir = reinterpret_cast<const inst_span_range*>(ip);
+			append_span_range(body, ir->from(), ir->to());
+			break;
+		}
+		case inst_type::test_char: {
+			auto itc = reinterpret_cast<const inst_test_char*>(ip);
+			fmt::append(body, "\tif (in.len() == 0 || zbs::uint8(in[0]) != %d)\n"
+				"\t\tgoto L%d;\n", uint8(itc->c), itc->offset);
+			break;
+		}
+		case inst_type::test_set: {
+			auto its = reinterpret_cast<const inst_test_set*>(ip);
+			fmt::append(body, "\tif (in.len() == 0)\n\t\tgoto L%d;\n", its->offset);
+			body.append("\tswitch (zbs::uint8(in[0])) {\n");
+			int n = 0;
+			for (int i = 0; i < 256; i++) {
+				if (!its->test(i))
+					continue;
+				if (n % 8 == 0)
+					fmt::append(body, "%s\tcase %d:", n == 0 ? "" : "\n", i);
+				else
+					fmt::append(body, " case %d:", i);
+				n++;
+			}
+			fmt::append(body, "%s\t\tbreak;\n\tdefault:\n\t\tgoto L%d;\n\t}\n",
+				n == 0 ? "" : "\n", its->offset);
+			break;
+		}
+		case inst_type::choice:
+			fmt::append(body, "\tnative::choice(m, in, %d);\n",
+				reinterpret_cast<const inst_choice*>(ip)->offset);
+			break;
+		case inst_type::commit:
+			fmt::append(body, "\tnative::commit(m);\n\tgoto L%d;\n",
+				reinterpret_cast<const inst_commit*>(ip)->offset);
+			break;
+		case inst_type::partial_commit:
+			fmt::append(body, "\tnative::partial_commit(m, in);\n\tgoto L%d;\n",
+				reinterpret_cast<const inst_partial_commit*>(ip)->offset);
+			break;
+		case inst_type::rewind_commit:
+			fmt::append(body, "\tin = native::rewind_commit(m);\n\tgoto L%d;\n",
+				reinterpret_cast<const inst_rewind_commit*>(ip)->offset);
+			break;
+		case inst_type::fail:
+			uses_fail = true;
+			body.append("\tgoto fail;\n");
+			break;
+		case inst_type::fail_twice:
+			uses_fail = true;
+			body.append("\tnative::commit(m);\n\tgoto fail;\n");
+			break;
+		case inst_type::open_capture: {
+			auto ioc = reinterpret_cast<const inst_open_capture*>(ip);
+			fmt::append(body, "\tnative::capture(m, zbs::peg::capture_type(%d), in);\n",
+				int(ioc->ctype));
+			break;
+		}
+		case inst_type::close_capture:
+			body.append("\tnative::capture(m, zbs::peg::capture_type::close, in);\n");
+			break;
+		case inst_type::call: {
+			auto ic = reinterpret_cast<const inst_call*>(ip);
+			fmt::append(body, "\tnative::call(m, %d);\n\tgoto L%d;\n",
+				off + inst_len(ic), ic->offset);
+			break;
+		}
+		case inst_type::return_:
+			uses_ret = true;
+			body.append("\tgoto ret;\n");
+			break;
+		case inst_type::jump:
+			fmt::append(body, "\tgoto L%d;\n",
+				reinterpret_cast<const inst_jump*>(ip)->offset);
+			break;
+		case inst_type::memo_enter: {
+			auto ime = reinterpret_cast<const inst_memo_enter*>(ip);
+			uses_fail = uses_ret = true;
+			fmt::append(body, "\tswitch (native::memo_enter(m, %d, &in, %d)) {\n"
+				"\tcase 0:\n\t\tgoto fail;\n\tcase 1:\n\t\tgoto ret;\n\t}\n",
+				ime->rule, ime->offset);
+			break;
+		}
+		case inst_type::memo_commit:
+			fmt::append(body, "\tnative::memo_commit(m, %d, in);\n",
+				reinterpret_cast<const inst_memo_commit*>(ip)->rule);
+			break;
+		case inst_type::memo_fail:
+			uses_fail = true;
+			fmt::append(body, "\tnative::memo_fail(m, %d, in);\n\tgoto fail;\n",
+				reinterpret_cast<const inst_memo_fail*>(ip)->rule);
+			break;
+		case inst_type::end:
+			body.append("\treturn native::end(m, in);\n");
+			break;
+		}
+	}
+
+	// the labels backtracking and returning go to
+	auto append_dispatch = [&](string &out, uint8 kind) {
+		for (int off = 0; off < labels.len(); off++) {
+			if (labels[off] & kind)
+				fmt::append(out, "\tcase %d:\n\t\tgoto L%d;\n", off, off);
+		}
+	};
+
+	string out;
+	fmt::append(out,
+		"// Generated by zbs::peg::generate_cpp()\n"
+		"// DO NOT EDIT\n"
+		"\n"
+		"#include \"zbs/peg.hh\"\n"
+		"#include \"zbs/unicode/utf8.hh\"\n"
+		"#include <cstring>\n"
+		"\n"
+		"namespace {\n"
+		"\n"
+		"bool %s_match(zbs::peg::matcher &m, zbs::slice<const char> in) {\n"
+		"\tusing native = zbs::peg::matcher::native;\n", name);
+	if (uses_fail)
+		out.append("\tint label;\n");
+	out.append('\n');
+	out.append(body);
+	if (uses_fail) {
+		out.append("fail:\n"
+			"\tif (!native::fail(m, &in, &label))\n"
+			"\t\treturn false;\n"
+			"\tswitch (label) {\n");
+		append_dispatch(out, 2);
+		out.append("\t}\n\treturn false;\n");
+	}
+	if (uses_ret) {
+		out.append("ret:\n\tswitch (native::return_(m)) {\n");
+		append_dispatch(out, 4);
+		out.append("\t}\n\treturn false;\n");
+	}
+	fmt::append(out,
+		"}\n"
+		"\n"
+		"} // anonymous namespace\n"
+		"\n"
+		"zbs::peg::program %s() {\n"
+		"\treturn zbs::peg::program(%s_match);\n"
+		"}\n", name, name);
+	return out;
+}
+
+program::program(vector<byte> code):
+	d(std::make_shared<data>(data{std::move(code), nullptr, {}}))
+{
+}
+
+program::program(vector<byte> code, scan_t scan):
+	d(std::make_shared<data>(data{std::move(code), nullptr, std::move(scan)}))
+{
+}
+
+program::program(native_func f):
+	d(std::make_shared<data>(data{{}, f, {}}))
+{
+}
+
+matcher::matcher(const matcher &r):
+	prog(r.prog), stack(r.stack), captures(r.captures),
+	initial_input(r.initial_input), stream(r.stream)
+{
+	// a streaming match refers to the buffer of 'r'
+	if (r.initial_input.data() == r.stream.buf.data()) {
+		initial_input = stream.buf;
+		rebase(r.stream.buf.data(), initial_input);
+	}
+}
+
+matcher &matcher::operator=(const matcher &r) {
+	prog = r.prog;
+	stack = r.stack;
+	captures = r.captures;
+	initial_input = r.initial_input;
+	stream = r.stream;
+	if (r.initial_input.data() == r.stream.buf.data()) {
+		initial_input = stream.buf;
+		rebase(r.stream.buf.data(), initial_input);
+	}
+	// the memoized results are of the previous input, a copy starts without
+	// them as well
+	if (memo.len() != 0) {
+		memo.clear();
+		memo_captures.clear();
+	}
+	return *this;
+}
+
+int matcher::memo_hash::operator()(uint64 key, int seed) const {
+	uint64 h = (key ^ uint64(seed)) * 0x9E3779B97F4A7C15ULL;
+	return h ^ (h >> 32);
+}
+
+bool matcher::native::fail(matcher &m, slice<const char> *input, int *label) {
+	// unwind the rules which didn't backtrack themselves
+	while (m.stack.len() != 0 && m.stack[m.stack.len()-1].captures_len == -1) {
+		m.stack.resize(m.stack.len()-1);
+	}
+	if (m.stack.len() == 0)
+		return false;
+	const auto &last = m.stack[m.stack.len()-1];
+	*input = last.input;
+	*label = last.offset;
+	m.captures.resize(last.captures_len);
+	m.stack.resize(m.stack.len()-1);
+	return true;
+}
+
+int matcher::native::memo_enter(matcher &m, int rule,
+	slice<const char> *input, int label)
+{
+	const int offset = input->data() - m.initial_input.data();
+	const memo_t *e = m.memo.lookup(uint64(rule) << 32 | offset);
+	if (e == nullptr) {
+		m.stack.append({*input, label, m.captures.len()});
+		return -1;
+	}
+	if (e->end == -1)
+		return 0;
+	m.captures.append(m.memo_captures.sub(
+		e->captures_offset, e->captures_offset + e->captures_len));
+	*input = m.initial_input.sub(e->end);
+	return 1;
+}
+
+void matcher::native::memo_commit(matcher &m, int rule, slice<const char> input) {
+	_ZBS_ASSERT(m.stack.len() > 0);
+	const auto &last = m.stack[m.stack.len()-1];
+	const int start = last.input.data() - m.initial_input.data();
+	const int offset = input.data() - m.initial_input.data();
+	m.memo[uint64(rule) << 32 | start] = {
+		offset,
+		m.memo_captures.len(),
+		m.captures.len() - last.captures_len,
+	};
+	m.memo_captures.append(m.captures.sub(last.captures_len));
+	m.stack.resize(m.stack.len()-1);
+}
+
+void matcher::native::memo_fail(matcher &m, int rule, slice<const char> input) {
+	const int offset = input.data() - m.initial_input.data();
+	m.memo[uint64(rule) << 32 | offset] = {-1, 0, 0};
+}
+
+// The VM dispatches with computed goto (a GNU extension) where available.
+// The type of an instruction is the index of its handler and every handler
+// jumps to the next one on its own, so that the branch predictor keeps a
+// separate history for each of them instead of sharing the one of a switch.
+// Define ZBS_PEG_SWITCH_DISPATCH to use a plain switch.
+#if defined(__GNUC__) && !defined(ZBS_PEG_SWITCH_DISPATCH)
+#define ZBS_PEG_COMPUTED_GOTO
+#define PEG_CASE(t) op_##t:
+#define PEG_NEXT() goto *handlers[int(reinterpret_cast<const inst_common*>(ip)->type)]
+#else
+#define PEG_CASE(t) case inst_type::t:
+#define PEG_NEXT() continue
+#endif
+
+void matcher::reset() {
 	captures.clear();
 	stack.clear();
 	stack.reserve(8);
+	if (memo.len() != 0) {
+		memo.clear();
+		memo_captures.clear();
+	}
+	stream.flushed = 0;
+}
 
-	const byte *ip = code.data();
+bool matcher::match(slice<const char> input) {
+	reset();
+	stream.status = match_status::fail;
+	initial_input = input;
+	if (prog.d->native_match)
+		return prog.d->native_match(*this, input);
+	int pc = 0;
+	return run(&pc, &input, false) == match_status::match;
+}
+
+// Runs the program from 'pc' at 'input'. If 'more' is true, the input may
+// continue past its end. The VM suspends then instead of deciding anything
+// which depends on the input it hasn't seen, storing where to continue in
+// 'pc' and 'input'. The instruction it suspended at runs again when the
+// match resumes, so it must not have changed anything but 'input' yet.
+match_status matcher::run(int *pc, slice<const char> *inputp, bool more) {
+	const vector<byte> &code = prog.d->code;
+	const byte *ip = code.data() + *pc;
+	slice<const char> input = *inputp;
+#ifdef ZBS_PEG_COMPUTED_GOTO
+	// in the order of inst_type
+	static const void *const handlers[] = {
+		&&op_any, &&op_string, &&op_set, &&op_range, &&op_end,
+		&&op_choice, &&op_commit, &&op_partial_commit, &&op_rewind_commit,
+		&&op_fail, &&op_fail_twice, &&op_open_capture, &&op_close_capture,
+		&&op_call, &&op_return_, &&op_jump, &&op_memo_enter,
+		&&op_memo_commit, &&op_memo_fail, &&op_test_char, &&op_test_set,
+		&&op_span_set, &&op_span_range,
+	};
+	static_assert(sizeof(handlers) / sizeof(handlers[0]) ==
+		int(inst_type::span_range) + 1, "a handler for every instruction");
+	PEG_NEXT();
+#else
 	for (;;) {
-		auto type = reinterpret_cast<const inst_common*>(ip)->type;
-		switch (type) {
-		case inst_type::any: {
+		switch (reinterpret_cast<const inst_common*>(ip)->type) {
+#endif
+		PEG_CASE(any) {
 			auto ia = reinterpret_cast<const inst_any*>(ip);
-			if (input.len() == 0)
-				goto fail;
+			if (input.len() != 0 && uint8(input[0]) < utf8::rune_self) {
+				ip += inst_len(ia);
+				input = input.sub(1);
+				PEG_NEXT();
+			}
+			if (input.len() < utf8::utf_max) {
+				// the end or a rune which may continue in the next chunk
+				if (more && !utf8::full_rune(input))
+					goto suspend;
+				if (input.len() == 0)
+					goto fail;
+			}
 			ip += inst_len(ia);
 			input = input.sub(utf8::decode_rune(input).size);
-			break;
+			PEG_NEXT();
 		}
-		case inst_type::string: {
+		PEG_CASE(string) {
 			auto is = reinterpret_cast<const inst_string*>(ip);
-			if (is->len > input.len())
+			if (is->len > input.len()) {
+				if (more && (input.len() == 0 ||
+					std::memcmp(is->str, input.data(), input.len()) == 0))
+					goto suspend;
 				goto fail;
-
-			const char *s = is->str;
-			const char *s2 = input.data();
-			const char *e = is->str + is->len;
-			while (s < e && *s == *s2) {
-				s++;
-				s2++;
 			}
-			if (s != e)
+			if (std::memcmp(is->str, input.data(), is->len) != 0)
 				goto fail;
-
 			ip += inst_len(is);
 			input = input.sub(is->len);
-			break;
+			PEG_NEXT();
 		}
-		case inst_type::set: {
+		PEG_CASE(set) {
 			auto is = reinterpret_cast<const inst_set*>(ip);
-			if (input.len() == 0)
-				goto fail;
-
-			sized_rune r = utf8::decode_rune(input);
-			if (r.rune < utf8::rune_self) {
-				if (!is->test_ascii(r.rune))
+			if (input.len() != 0 && uint8(input[0]) < utf8::rune_self) {
+				if (!is->test_ascii(uint8(input[0])))
 					goto fail;
-			} else {
-				bool found = false;
-				for (int i = 0; i < is->len; i++) {
-					if (is->uni[i] == r.rune) {
-						found = true;
-						break;
-					}
-				}
-				if (!found)
+				ip += inst_len(is);
+				input = input.sub(1);
+				PEG_NEXT();
+			}
+			// nothing beyond ascii in the set, no need to decode
+			if (input.len() != 0 && is->len == 0)
+				goto fail;
+			if (input.len() < utf8::utf_max) {
+				if (more && !utf8::full_rune(input))
+					goto suspend;
+				if (input.len() == 0)
 					goto fail;
 			}
+
+			sized_rune r = utf8::decode_rune(input);
+			if (!is->test_uni(r.rune))
+				goto fail;
 			ip += inst_len(is);
 			input = input.sub(r.size);
-			break;
+			PEG_NEXT();
 		}
-		case inst_type::range: {
+		PEG_CASE(range) {
 			auto ir = reinterpret_cast<const inst_range*>(ip);
-			if (input.len() < 1)
-				goto fail;
+			if (input.len() != 0 && uint8(input[0]) < utf8::rune_self) {
+				const rune c = uint8(input[0]);
+				if (c < ir->from() || ir->to() < c)
+					goto fail;
+				ip += inst_len(ir);
+				input = input.sub(1);
+				PEG_NEXT();
+			}
+			if (input.len() < utf8::utf_max) {
+				if (more && !utf8::full_rune(input))
+					goto suspend;
+				if (input.len() == 0)
+					goto fail;
+			}
 
 			sized_rune r = utf8::decode_rune(input);
 			if (r.rune < ir->from() || ir->to() < r.rune)
 				goto fail;
 			ip += inst_len(ir);
 			input = input.sub(r.size);
-			break;
+			PEG_NEXT();
+		}
+		PEG_CASE(test_char) {
+			auto itc = reinterpret_cast<const inst_test_char*>(ip);
+			if (input.len() == 0 && more)
+				goto suspend;
+			if (input.len() == 0 || input[0] != itc->c)
+				ip = code.data() + itc->offset;
+			else
+				ip += inst_len(itc);
+			PEG_NEXT();
+		}
+		PEG_CASE(test_set) {
+			auto its = reinterpret_cast<const inst_test_set*>(ip);
+			if (input.len() == 0 && more)
+				goto suspend;
+			if (input.len() == 0 || !its->test(input[0]))
+				ip = code.data() + its->offset;
+			else
+				ip += inst_len(its);
+			PEG_NEXT();
+		}
+		PEG_CASE(span_set) {
+			auto iss = reinterpret_cast<const inst_span_set*>(ip);
+			while (input.len() != 0) {
+				const uint8 b = input[0];
+				if (b < utf8::rune_self) {
+					if (!iss->test_ascii(b))
+						break;
+					input = input.sub(1);
+					continue;
+				}
+				if (iss->len == 0)
+					break;
+				if (more && input.len() < utf8::utf_max && !utf8::full_rune(input))
+					goto suspend;
+				sized_rune r = utf8::decode_rune(input);
+				if (!iss->test_uni(r.rune))
+					break;
+				input = input.sub(r.size);
+			}
+			// the span continues where it stopped when it resumes
+			if (input.len() == 0 && more)
+				goto suspend;
+			ip += inst_len(iss);
+			PEG_NEXT();
+		}
+		PEG_CASE(span_range) {
+			auto isr = reinterpret_cast<const inst_span_range*>(ip);
+			const rune from = isr->from();
+			const rune to = isr->to();
+			while (input.len() != 0) {
+				const uint8 b = input[0];
+				if (b < utf8::rune_self) {
+					if (b < from || to < b)
+						break;
+					input = input.sub(1);
+					continue;
+				}
+				if (more && input.len() < utf8::utf_max && !utf8::full_rune(input))
+					goto suspend;
+				sized_rune r = utf8::decode_rune(input);
+				if (r.rune < from || to < r.rune)
+					break;
+				input = input.sub(r.size);
+			}
+			if (input.len() == 0 && more)
+				goto suspend;
+			ip += inst_len(isr);
+			PEG_NEXT();
 		}
-		case inst_type::choice: {
+		PEG_CASE(choice) {
 			auto ic = reinterpret_cast<const inst_choice*>(ip);
 			stack.append({
 				input,
@@ -497,25 +2102,25 @@ bool bytecode::match(slice<const char> input) {
 				captures.len(),
 			});
 			ip += inst_len(ic);
-			break;
+			PEG_NEXT();
 		}
-		case inst_type::commit: {
+		PEG_CASE(commit) {
 			auto ic = reinterpret_cast<const inst_commit*>(ip);
 			_ZBS_ASSERT(stack.len() > 0);
 			stack.resize(stack.len()-1);
 			ip = code.data() + ic->offset;
-			break;
+			PEG_NEXT();
 		}
-		case inst_type::partial_commit: {
+		PEG_CASE(partial_commit) {
 			auto ipc = reinterpret_cast<const inst_partial_commit*>(ip);
 			_ZBS_ASSERT(stack.len() > 0);
 			auto &last = stack[stack.len()-1];
 			last.input = input;
 			last.captures_len = captures.len();
 			ip = code.data() + ipc->offset;
-			break;
+			PEG_NEXT();
 		}
-		case inst_type::rewind_commit: {
+		PEG_CASE(rewind_commit) {
 			auto irc = reinterpret_cast<const inst_rewind_commit*>(ip);
 			_ZBS_ASSERT(stack.len() > 0);
 			const auto &last = stack[stack.len()-1];
@@ -523,27 +2128,84 @@ bool bytecode::match(slice<const char> input) {
 			captures.resize(last.captures_len);
 			stack.resize(stack.len()-1);
 			ip = code.data() + irc->offset;
-			break;
+			PEG_NEXT();
 		}
-		case inst_type::open_capture: {
+		PEG_CASE(open_capture) {
 			auto ioc = reinterpret_cast<const inst_open_capture*>(ip);
 			int offset = input.data() - initial_input.data();
 			captures.append({ioc->ctype, offset});
 			ip += inst_len(ioc);
-			break;
+			PEG_NEXT();
 		}
-		case inst_type::close_capture: {
+		PEG_CASE(close_capture) {
 			auto icc = reinterpret_cast<const inst_close_capture*>(ip);
 			int offset = input.data() - initial_input.data();
 			captures.append({capture_type::close, offset});
 			ip += inst_len(icc);
-			break;
+			PEG_NEXT();
 		}
-		case inst_type::fail_twice:
+		PEG_CASE(call) {
+			auto ic = reinterpret_cast<const inst_call*>(ip);
+			// return addresses are marked with a negative captures_len
+			stack.append({
+				{},
+				int(ip + inst_len(ic) - code.data()),
+				-1,
+			});
+			ip = code.data() + ic->offset;
+			PEG_NEXT();
+		}
+		PEG_CASE(return_) {
+			_ZBS_ASSERT(stack.len() > 0);
+			const auto &last = stack[stack.len()-1];
+			_ZBS_ASSERT(last.captures_len == -1);
+			ip = code.data() + last.offset;
+			stack.resize(stack.len()-1);
+			PEG_NEXT();
+		}
+		PEG_CASE(jump) {
+			auto ij = reinterpret_cast<const inst_jump*>(ip);
+			ip = code.data() + ij->offset;
+			PEG_NEXT();
+		}
+		PEG_CASE(memo_enter) {
+			auto ime = reinterpret_cast<const inst_memo_enter*>(ip);
+			const int r = native::memo_enter(*this, ime->rule, &input, ime->offset);
+			if (r == -1) {
+				ip += inst_len(ime);
+				PEG_NEXT();
+			}
+			if (r == 0)
+				goto fail;
+
+			// return from the rule
+			_ZBS_ASSERT(stack.len() > 0);
+			const auto &last = stack[stack.len()-1];
+			_ZBS_ASSERT(last.captures_len == -1);
+			ip = code.data() + last.offset;
+			stack.resize(stack.len()-1);
+			PEG_NEXT();
+		}
+		PEG_CASE(memo_commit) {
+			auto imc = reinterpret_cast<const inst_memo_commit*>(ip);
+			native::memo_commit(*this, imc->rule, input);
+			ip += inst_len(imc);
+			PEG_NEXT();
+		}
+		PEG_CASE(memo_fail) {
+			auto imf = reinterpret_cast<const inst_memo_fail*>(ip);
+			native::memo_fail(*this, imf->rule, input);
+			goto fail;
+		}
+		PEG_CASE(fail_twice)
 			_ZBS_ASSERT(stack.len() > 0);
 			stack.resize(stack.len()-1);
 			// fallthrough
-		case inst_type::fail: fail:
+		PEG_CASE(fail) fail:
+			// unwind the rules which didn't backtrack themselves
+			while (stack.len() != 0 && stack[stack.len()-1].captures_len == -1) {
+				stack.resize(stack.len()-1);
+			}
 			if (stack.len() != 0) {
 				const auto &last = stack[stack.len()-1];
 				input = last.input;
@@ -551,40 +2213,444 @@ bool bytecode::match(slice<const char> input) {
 				ip = code.data() + last.offset;
 				stack.resize(stack.len()-1);
 			} else {
-				return false;
+				return match_status::fail;
 			}
-			break;
-		case inst_type::end:
-			return true;
+			PEG_NEXT();
+		PEG_CASE(end)
+			*inputp = input;
+			return match_status::match;
+		suspend:
+			*pc = ip - code.data();
+			*inputp = input;
+			return match_status::need_more_input;
+#ifndef ZBS_PEG_COMPUTED_GOTO
 		default:
 			goto fail;
 		}
 	}
+#endif
 }
 
-void bytecode::apply_captures(capturer *cap) const {
-	int pending = -1;
-	for (const auto &c : captures) {
-		switch (c.type) {
+#undef PEG_CASE
+#undef PEG_NEXT
+
+//----------------------------------------------------------------------------
+// captures
+//----------------------------------------------------------------------------
+
+// Stack of the indices of the captures open at some point of the list.
+// Captures are rarely nested deeply, it allocates only then.
+class open_captures {
+	static constexpr int inline_len = 16;
+	int _inline[inline_len];
+	vector<int> _more;
+	int _len = 0;
+
+public:
+	int len() const { return _len; }
+	int operator[](int i) const {
+		return i < inline_len ? _inline[i] : _more[i - inline_len];
+	}
+	void push(int i) {
+		if (_len < inline_len)
+			_inline[_len] = i;
+		else if (_len - inline_len < _more.len())
+			_more[_len - inline_len] = i;
+		else
+			_more.append(i);
+		_len++;
+	}
+	int pop() {
+		_len--;
+		return (*this)[_len];
+	}
+};
+
+void matcher::apply_captures(capturer *cap) const {
+	// a streaming match copies captures out of the input it drops
+	auto data = [this](int i) {
+		return (i < stream.flushed ? stream.captured.data() :
+			initial_input.data()) + captures[i].offset;
+	};
+	// the index of the close of the capture opened at 'i'
+	auto close = [this](int i) {
+		for (int depth = 0;;) {
+			if (captures[++i].type != capture_type::close)
+				depth++;
+			else if (depth-- == 0)
+				return i;
+		}
+	};
+	// simple captures are passed when they are opened, before the ones
+	// nested in them
+	open_captures open;
+	for (int i = 0; i < captures.len(); i++) {
+		switch (captures[i].type) {
 		case capture_type::group:
 			cap->open_group();
+			open.push(i);
+			break;
+		case capture_type::simple: {
+			const char *begin = data(i);
+			cap->capture({begin, int(data(close(i)) - begin)});
+			open.push(i);
 			break;
+		}
+		case capture_type::close:
+			if (captures[open.pop()].type == capture_type::group)
+				cap->close_group();
+			break;
+		}
+	}
+}
+
+capture_tree matcher::captures_tree(slice<capture_node> buf) {
+	_ZBS_ASSERT(stream.flushed == 0);
+	// every capture is closed after a match
+	slice<capture_node> nodes = buf;
+	if (buf.len() < captures.len() / 2) {
+		tree.resize(captures.len() / 2);
+		nodes = tree;
+	}
+
+	// the parents of the open nodes make the stack of the open captures
+	int n = 0;
+	int open = -1;
+	for (const auto &c : captures) {
+		switch (c.type) {
+		case capture_type::group:
 		case capture_type::simple:
-			pending = c.offset;
+			nodes[n] = {c.offset, c.offset, open, c.type == capture_type::group};
+			open = n++;
 			break;
 		case capture_type::close:
-			if (pending != -1) {
-				cap->capture({
-					initial_input.data() + pending,
-					c.offset - pending
-				});
-				pending = -1;
+			nodes[open].end = c.offset;
+			open = nodes[open].parent;
+			break;
+		}
+	}
+	return {initial_input, nodes.sub(0, n)};
+}
+
+optional<capture_tree> matcher::match_tree(slice<const char> input,
+	slice<capture_node> buf)
+{
+	if (!match(input))
+		return nullopt;
+	return captures_tree(buf);
+}
+
+//----------------------------------------------------------------------------
+// search
+//----------------------------------------------------------------------------
+
+// Returns the first position from 'pos' on a match may start at, -1 if there
+// is none.
+int matcher::skip(slice<const char> input, int pos) const {
+	const program::scan_t &scan = prog.d->scan;
+	if (scan.anywhere)
+		return pos;
+
+	const char *p = input.data();
+	const int n = input.len();
+	const int plen = scan.prefix.len();
+	if (plen != 0) {
+		const char *prefix = scan.prefix.data();
+		while (n - pos >= plen) {
+			const void *c = std::memchr(p + pos, prefix[0], n - pos - plen + 1);
+			if (c == nullptr)
+				return -1;
+			pos = static_cast<const char*>(c) - p;
+			if (std::memcmp(p + pos + 1, prefix + 1, plen - 1) == 0)
+				return pos;
+			pos++;
+		}
+		return -1;
+	}
+
+	pos += detail::scan_bytes(input.sub(pos), {scan.rows, true}, true, false);
+	return pos < n ? pos : -1;
+}
+
+// Matches the program at 'pos' of 'input', the captures and the memoized
+// results are relative to 'input'.
+bool matcher::match_at(slice<const char> input, int pos, int *end) {
+	captures.clear();
+	stack.clear();
+	if (prog.d->native_match) {
+		if (!prog.d->native_match(*this, input.sub(pos)))
+			return false;
+		*end = stream.end;
+		return true;
+	}
+	int pc = 0;
+	slice<const char> in = input.sub(pos);
+	if (run(&pc, &in, false) != match_status::match)
+		return false;
+	*end = in.data() - input.data();
+	return true;
+}
+
+// Finds the first match from 'pos' on which isn't an empty one at
+// 'last_end'.
+bool matcher::search(slice<const char> input, int pos, int last_end,
+	int *begin, int *end)
+{
+	for (; pos <= input.len(); pos++) {
+		pos = skip(input, pos);
+		if (pos == -1)
+			return false;
+		if (match_at(input, pos, end) && (*end != pos || pos != last_end)) {
+			*begin = pos;
+			return true;
+		}
+	}
+	return false;
+}
+
+optional<slice<const char>> matcher::find(slice<const char> input) {
+	// the memoized results stay valid from one position to the next
+	reset();
+	stream.status = match_status::fail;
+	initial_input = input;
+	int begin, end;
+	if (!search(input, 0, -1, &begin, &end))
+		return nullopt;
+	return input.sub(begin, end);
+}
+
+int matcher::gmatch(slice<const char> input, func<void (slice<const char> match)> f) {
+	reset();
+	stream.status = match_status::fail;
+	initial_input = input;
+	int n = 0;
+	int begin, end = -1;
+	for (int pos = 0; search(input, pos, end, &begin, &end); n++) {
+		f(input.sub(begin, end));
+		pos = end;
+	}
+	return n;
+}
+
+vector<slice<const char>> matcher::find_all(slice<const char> input) {
+	vector<slice<const char>> matches;
+	gmatch(input, [&matches](slice<const char> m) { matches.append(m); });
+	return matches;
+}
+
+//----------------------------------------------------------------------------
+// streaming
+//----------------------------------------------------------------------------
+
+void matcher::start() {
+	reset();
+	initial_input = {};
+	stream.buf.clear();
+	stream.offset = 0;
+	stream.pc = 0;
+	stream.input = 0;
+	stream.captured.clear();
+	stream.end = 0;
+	stream.status = match_status::need_more_input;
+}
+
+// Moves the backtrack entries from the input at 'from' to the same offsets
+// of 'to'.
+void matcher::rebase(const char *from, slice<const char> to) {
+	for (auto &s : stack) {
+		if (s.captures_len != -1)
+			s.input = to.sub(s.input.data() - from);
+	}
+}
+
+// Copies the data of the captures before 'end' of the input out of it. A
+// simple capture and its close are copied together, 'end' must not be
+// between them.
+void matcher::flush_captures(int end) {
+	// groups may be open since an earlier flush, their closes find the
+	// stack empty
+	open_captures open;
+	int simple = 0; // simple captures on the stack
+	int i = stream.flushed;
+	for (; i < captures.len(); i++) {
+		auto &c = captures[i];
+		if (c.offset >= end && (simple == 0 || c.offset > end))
+			break;
+		switch (c.type) {
+		case capture_type::group:
+			c.offset = stream.captured.len();
+			open.push(i);
+			break;
+		case capture_type::simple:
+			open.push(i);
+			simple++;
+			break;
+		case capture_type::close: {
+			const int o = open.len() != 0 ? open.pop() : -1;
+			if (o != -1 && captures[o].type == capture_type::simple) {
+				// each capture gets a copy of its own, the nested ones
+				// were copied already
+				auto &p = captures[o];
+				const int n = stream.captured.len();
+				stream.captured.append(initial_input.sub(p.offset, c.offset));
+				p.offset = n;
+				c.offset = stream.captured.len();
+				simple--;
 			} else {
-				cap->close_group();
+				c.offset = stream.captured.len();
 			}
 			break;
 		}
+		}
+	}
+	_ZBS_ASSERT(simple == 0);
+	stream.flushed = i;
+}
+
+match_status matcher::resume(slice<const char> chunk, bool more) {
+	if (stream.status != match_status::need_more_input)
+		return stream.status;
+
+	auto &buf = stream.buf;
+	if (prog.d->native_match) {
+		buf.append(chunk);
+		if (more)
+			return match_status::need_more_input;
+		initial_input = buf;
+		const bool ok = prog.d->native_match(*this, buf);
+		stream.status = ok ? match_status::match : match_status::fail;
+		return stream.status;
 	}
+
+	// match the chunk where it is if nothing before it is needed
+	slice<const char> in = chunk;
+	if (buf.len() == 0) {
+		rebase(buf.data(), in);
+	} else {
+		const char *old = buf.data();
+		buf.append(chunk);
+		in = buf;
+		rebase(old, in);
+	}
+	initial_input = in;
+
+	slice<const char> input = in.sub(stream.input);
+	stream.status = run(&stream.pc, &input, more);
+	const int pos = input.data() - in.data();
+	switch (stream.status) {
+	case match_status::fail:
+		break;
+	case match_status::match:
+		stream.end = stream.offset + pos;
+		// the chunk is gone after the call
+		if (in.data() == chunk.data()) {
+			flush_captures(in.len() + 1);
+			initial_input = {};
+		}
+		break;
+	case match_status::need_more_input: {
+		// keep the input from the first position a backtrack entry may
+		// return to, or a capture which isn't complete before it
+		int keep = pos;
+		for (const auto &s : stack) {
+			if (s.captures_len != -1)
+				keep = std::min(keep, int(s.input.data() - in.data()));
+		}
+		open_captures open;
+		for (int i = stream.flushed; i < captures.len() && captures[i].offset < keep; i++) {
+			if (captures[i].type != capture_type::close)
+				open.push(i);
+			else if (open.len() != 0)
+				open.pop();
+		}
+		for (int i = 0; i < open.len(); i++) {
+			if (captures[open[i]].type == capture_type::simple) {
+				keep = captures[open[i]].offset;
+				break;
+			}
+		}
+
+		flush_captures(keep);
+		for (int i = stream.flushed; i < captures.len(); i++)
+			captures[i].offset -= keep;
+		// the memoized results refer to the offsets
+		if (memo.len() != 0) {
+			memo.clear();
+			memo_captures.clear();
+		}
+
+		const slice<const char> rest = in.sub(keep);
+		if (in.data() == buf.data()) {
+			std::memmove(buf.data(), rest.data(), rest.len());
+			buf.resize(rest.len());
+		} else {
+			buf.clear();
+			buf.append(rest);
+		}
+		rebase(rest.data(), buf);
+		initial_input = buf;
+		stream.offset += keep;
+		stream.input = pos - keep;
+		break;
+	}
+	}
+	return stream.status;
+}
+
+match_status matcher::feed(slice<const char> chunk) {
+	return resume(chunk, true);
+}
+
+match_status matcher::finish() {
+	return resume({}, false);
+}
+
+//----------------------------------------------------------------------------
+// match_many
+//----------------------------------------------------------------------------
+
+void match_many(const program &p, slice<const slice<const char>> inputs,
+	func<void (int i, matcher &m, bool ok)> f, int threads)
+{
+	if (threads <= 0)
+		threads = std::thread::hardware_concurrency();
+	threads = std::max(1, std::min(threads, inputs.len()));
+
+	// the inputs are handed out in small batches, the threads which are done
+	// early take more instead of waiting for the others
+	constexpr int batch = 16;
+	std::atomic<int> next(0);
+	auto work = [&]() {
+		matcher m(p);
+		for (;;) {
+			const int begin = next.fetch_add(batch, std::memory_order_relaxed);
+			if (begin >= inputs.len())
+				return;
+			const int end = std::min(begin + batch, inputs.len());
+			for (int i = begin; i < end; i++) {
+				const bool ok = m.match(inputs[i]);
+				f(i, m, ok);
+			}
+		}
+	};
+
+	// the calling thread is one of the workers
+	vector<std::thread> workers;
+	for (int t = 1; t < threads; t++)
+		workers.append(std::thread(work));
+	work();
+	for (auto &w : workers)
+		w.join();
+}
+
+vector<bool> match_many(const program &p, slice<const slice<const char>> inputs,
+	int threads)
+{
+	vector<bool> results;
+	results.resize(inputs.len(), false);
+	auto record = [&results](int i, matcher&, bool ok) { results[i] = ok; };
+	match_many(p, inputs, record, threads);
+	return results;
 }
 
 }} // namespace zbs::peg
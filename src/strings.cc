@@ -5,9 +5,19 @@
 #include "zbs/strings.hh"
 
 #include <utility>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 #include "zbs/slices.hh"
+#include "zbs/fmt.hh"
 #include "zbs/unicode.hh"
 #include "zbs/unicode/utf8.hh"
+#include "byte_scan.hh"
 
 namespace unicode = zbs::unicode;
 namespace utf8 = zbs::unicode::utf8;
@@ -15,6 +25,478 @@ namespace utf8 = zbs::unicode::utf8;
 namespace zbs {
 namespace strings {
 
+//============================================================================
+// char_set
+//============================================================================
+
+char_set::char_set() {
+	std::memset(_ascii, 0, sizeof(_ascii));
+}
+
+char_set::char_set(slice<const char> chars): char_set() {
+	for (int i = 0; i < chars.len();) {
+		if (uint8(chars[i]) < utf8::rune_self) {
+			_add_ascii(chars[i++]);
+			continue;
+		}
+		sized_rune r = utf8::decode_rune(chars.sub(i));
+		_runes.append(r.rune);
+		i += r.size;
+	}
+	if (_runes.len() == 0) {
+		return;
+	}
+
+	slices::sort(_runes.sub());
+	int n = 1;
+	for (int i = 1; i < _runes.len(); i++) {
+		if (_runes[i] != _runes[n-1]) {
+			_runes[n++] = _runes[i];
+		}
+	}
+	_runes.resize(n);
+}
+
+char_set::char_set(const unicode::range_table &table): char_set() {
+	for (rune r = 0; r < utf8::rune_self; r++) {
+		if (unicode::is(table, r)) {
+			_add_ascii(r);
+		}
+	}
+	_table = &table;
+}
+
+bool char_set::contains(rune r) const {
+	if (uint32(r) < uint32(utf8::rune_self)) {
+		return _has_ascii(r);
+	}
+	if (_table != nullptr && unicode::is(*_table, r)) {
+		return true;
+	}
+	return std::binary_search(_runes.data(), _runes.data() + _runes.len(), r);
+}
+
+// Returns the offset of the first byte in `s` which is an ASCII byte with
+// set membership equal to `in`, or a non-ASCII byte (unless `in` is true and
+// the set is ASCII-only, then non-ASCII bytes can't match anything and are
+// skipped). Returns s.len() if there is no such byte.
+int char_set::_scan(slice<const char> s, bool in) const {
+	return detail::scan_bytes(s, {_ascii, false}, in, !in || !is_ascii());
+}
+
+// Same as _scan, but looks for the last such byte. Returns -1 if there is none.
+int char_set::_scan_last(slice<const char> s, bool in) const {
+	return detail::scan_bytes_last(s, {_ascii, false}, in, !in || !is_ascii());
+}
+
+// The ASCII parts are skipped by _scan, non-ASCII runes it stops at are
+// decoded and looked up one by one. Everything _scan skips is ASCII (or, for
+// ASCII-only sets looking for a member, is followed by an ASCII byte), so the
+// offsets it returns are always rune boundaries.
+
+int char_set::span(slice<const char> s) const {
+	int i = 0;
+	for (;;) {
+		i += _scan(s.sub(i), false);
+		if (i == s.len() || uint8(s[i]) < utf8::rune_self) {
+			return i;
+		}
+		sized_rune r = utf8::decode_rune(s.sub(i));
+		if (!contains(r.rune)) {
+			return i;
+		}
+		i += r.size;
+	}
+}
+
+int char_set::cspan(slice<const char> s) const {
+	int i = 0;
+	for (;;) {
+		i += _scan(s.sub(i), true);
+		if (i == s.len() || uint8(s[i]) < utf8::rune_self) {
+			return i;
+		}
+		sized_rune r = utf8::decode_rune(s.sub(i));
+		if (contains(r.rune)) {
+			return i;
+		}
+		i += r.size;
+	}
+}
+
+int char_set::rspan(slice<const char> s) const {
+	int i = s.len();
+	for (;;) {
+		int j = _scan_last(s.sub(0, i), false);
+		if (j == -1) {
+			return 0;
+		}
+		if (uint8(s[j]) < utf8::rune_self) {
+			return j + 1;
+		}
+		sized_rune r = utf8::decode_last_rune(s.sub(0, j + 1));
+		if (!contains(r.rune)) {
+			return j + 1;
+		}
+		i = j + 1 - r.size;
+	}
+}
+
+int char_set::rcspan(slice<const char> s) const {
+	int i = s.len();
+	for (;;) {
+		int j = _scan_last(s.sub(0, i), true);
+		if (j == -1) {
+			return 0;
+		}
+		if (uint8(s[j]) < utf8::rune_self) {
+			return j + 1;
+		}
+		sized_rune r = utf8::decode_last_rune(s.sub(0, j + 1));
+		if (contains(r.rune)) {
+			return j + 1;
+		}
+		i = j + 1 - r.size;
+	}
+}
+
+//============================================================================
+// builder
+//============================================================================
+
+builder::builder(builder &&r): _data(r._data), _len(r._len), _cap(r._cap) {
+	r._data = nullptr;
+	r._len = 0;
+	r._cap = 0;
+}
+
+builder::~builder() {
+	if (_data != nullptr) {
+		detail::free(_data);
+	}
+}
+
+builder &builder::operator=(builder &&r) {
+	if (_data != nullptr) {
+		detail::free(_data);
+	}
+	_data = r._data;
+	_len = r._len;
+	_cap = r._cap;
+	r._data = nullptr;
+	r._len = 0;
+	r._cap = 0;
+	return *this;
+}
+
+void builder::_grow(int n) {
+	int cap = std::max(_cap * 2, _len + n);
+	char *data = detail::malloc<char>(cap + 1);
+	if (_len > 0) {
+		::memcpy(data, _data, _len);
+	}
+	if (_data != nullptr) {
+		detail::free(_data);
+	}
+	_data = data;
+	_cap = cap;
+}
+
+void builder::grow(int n) {
+	_ZBS_ASSERT(n >= 0);
+	if (_len + n > _cap) {
+		_grow(n);
+	}
+}
+
+void builder::write(slice<const char> s) {
+	if (s.len() == 0) {
+		return;
+	}
+	::memcpy(_extend(s.len()), s.data(), s.len());
+}
+
+void builder::write_rune(rune r) {
+	if (uint32(r) < uint32(utf8::rune_self)) {
+		write_byte(r);
+		return;
+	}
+	grow(utf8::utf_max);
+	_len += utf8::encode_rune(slice<char>(_data + _len, utf8::utf_max), r);
+}
+
+void builder::write_int(int64 v, int base) {
+	if (v < 0) {
+		write_byte('-');
+		write_uint(-uint64(v), base);
+		return;
+	}
+	write_uint(v, base);
+}
+
+void builder::write_uint(uint64 v, int base) {
+	_ZBS_ASSERT(base >= 2 && base <= 36);
+	static const char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+	char tmp[64];
+	char *p = tmp + sizeof(tmp);
+	if (base == 10) {
+		p = zbs::fmt::detail::format_uint(p, v);
+	} else {
+		do {
+			*--p = digits[v % base];
+			v /= base;
+		} while (v != 0);
+	}
+	write(slice<const char>(p, tmp + sizeof(tmp) - p));
+}
+
+void builder::write_float(double v, char fmt, int prec) {
+	_ZBS_ASSERT(fmt == 'e' || fmt == 'f' || fmt == 'g');
+	if (prec < 0) {
+		char tmp[zbs::fmt::detail::shortest_size];
+		const int n = zbs::fmt::detail::format_shortest(tmp, v, fmt);
+		write(slice<const char>(tmp, n));
+		return;
+	}
+
+	// the allocation always has room for the terminating zero
+	const char format[] = {'%', '.', '*', fmt, '\0'};
+	const int n = std::snprintf(nullptr, 0, format, prec, v);
+	grow(n);
+	std::snprintf(_data + _len, n + 1, format, prec, v);
+	_len += n;
+}
+
+string builder::take() {
+	string s;
+	if (_len == 0) {
+		return s;
+	}
+	_data[_len] = '\0';
+	s.attach_unsafe(_data, _len, _cap);
+	_data = nullptr;
+	_len = 0;
+	_cap = 0;
+	return s;
+}
+
+//============================================================================
+// replacer
+//============================================================================
+
+replacer::replacer(slice<const slice<const char>> oldnew) {
+	_ZBS_ASSERT(oldnew.len() % 2 == 0);
+	const int n = oldnew.len() / 2;
+	_old.reserve(n);
+	_new.reserve(n);
+	bool all_byte_old = true;
+	bool all_byte_new = true;
+	for (int i = 0; i < n; i++) {
+		_old.append(oldnew[i*2]);
+		_new.append(oldnew[i*2+1]);
+		all_byte_old = all_byte_old && _old[i].len() == 1;
+		all_byte_new = all_byte_new && _new[i].len() == 1;
+	}
+
+	if (n == 1 && _old[0].len() > 1) {
+		_kind = kind::single;
+		return;
+	}
+
+	if (all_byte_old) {
+		_kind = all_byte_new ? kind::byte_map : kind::byte_string;
+		for (int i = 0; i < 256; i++) {
+			_byte_map[i] = i;
+			_byte_pair[i] = -1;
+		}
+		// earlier pairs take precedence
+		for (int i = n-1; i >= 0; i--) {
+			const uint8 c = _old[i][0];
+			_byte_pair[c] = i;
+			if (all_byte_new) {
+				_byte_map[c] = _new[i][0];
+			}
+		}
+		return;
+	}
+
+	_kind = kind::generic;
+	bool used[256] = {};
+	for (const auto &old : _old) {
+		for (int i = 0; i < old.len(); i++) {
+			used[uint8(old[i])] = true;
+		}
+	}
+	for (int i = 0; i < 256; i++) {
+		if (used[i]) {
+			_trie_slot[i] = _trie_width++;
+		}
+	}
+	for (int i = 0; i < 256; i++) {
+		if (!used[i]) {
+			_trie_slot[i] = _trie_width;
+		}
+	}
+
+	_trie_next.resize(_trie_width, 0);
+	_trie_value.append(-1);
+	for (int i = 0; i < n; i++) {
+		int node = 0;
+		for (int j = 0; j < _old[i].len(); j++) {
+			const int idx = node * _trie_width + _trie_slot[uint8(_old[i][j])];
+			if (_trie_next[idx] == 0) {
+				_trie_next[idx] = _trie_value.len();
+				_trie_next.resize(_trie_next.len() + _trie_width, 0);
+				_trie_value.append(-1);
+			}
+			node = _trie_next[idx];
+		}
+		if (_trie_value[node] == -1) {
+			_trie_value[node] = i;
+		}
+	}
+}
+
+// Looks for the old string matching the beginning of `s` which was passed
+// first. Returns the index of the pair and the length of the match in `len`,
+// or -1 if there is no match. The empty old string is not considered if
+// `ignore_root` is true.
+int replacer::_lookup(slice<const char> s, bool ignore_root, int *len) const {
+	int best = ignore_root ? -1 : _trie_value[0];
+	*len = 0;
+	int node = 0;
+	for (int i = 0; i < s.len(); i++) {
+		const int slot = _trie_slot[uint8(s[i])];
+		if (slot == _trie_width) {
+			break;
+		}
+		node = _trie_next[node * _trie_width + slot];
+		if (node == 0) {
+			break;
+		}
+		const int v = _trie_value[node];
+		if (v != -1 && (best == -1 || v < best)) {
+			best = v;
+			*len = i + 1;
+		}
+	}
+	return best;
+}
+
+void replacer::_replace_generic(builder &out, slice<const char> s) const {
+	const bool has_empty = _trie_value[0] != -1;
+	bool prev_empty = false;
+	int last = 0;
+	for (int i = 0; i <= s.len();) {
+		// fast path: s[i] does not start any of the old strings
+		if (i != s.len() && !has_empty) {
+			const int slot = _trie_slot[uint8(s[i])];
+			if (slot == _trie_width || _trie_next[slot] == 0) {
+				i++;
+				continue;
+			}
+		}
+
+		// the empty old string doesn't match twice at the same offset
+		int len;
+		const int v = _lookup(s.sub(i), prev_empty, &len);
+		prev_empty = v != -1 && len == 0;
+		if (v != -1) {
+			out.write(s.sub(last, i));
+			out.write(_new[v]);
+			i += len;
+			last = i;
+			continue;
+		}
+		if (has_empty && i != s.len() && uint8(s[i]) >= utf8::rune_self) {
+			// the empty old string matches between runes, not bytes
+			i += utf8::decode_rune(s.sub(i)).size;
+		} else {
+			i++;
+		}
+	}
+	out.write(s.sub(last));
+}
+
+string replacer::replace(slice<const char> s) const {
+	builder out;
+	replace(out, s);
+	return out.take();
+}
+
+void replacer::replace(builder &out, slice<const char> s) const {
+	switch (_kind) {
+	case kind::byte_map:
+		out.grow(s.len());
+		for (int i = 0; i < s.len(); i++) {
+			out.write_byte(_byte_map[uint8(s[i])]);
+		}
+		break;
+	case kind::byte_string: {
+		int last = 0;
+		for (int i = 0; i < s.len(); i++) {
+			const int p = _byte_pair[uint8(s[i])];
+			if (p != -1) {
+				out.write(s.sub(last, i));
+				out.write(_new[p]);
+				last = i + 1;
+			}
+		}
+		out.write(s.sub(last));
+		break;
+	}
+	case kind::single: {
+		const string &old = _old[0];
+		int i = 0;
+		for (;;) {
+			const int j = index(s.sub(i), old);
+			if (j == -1) {
+				break;
+			}
+			out.write(s.sub(i, i+j));
+			out.write(_new[0]);
+			i += j + old.len();
+		}
+		out.write(s.sub(i));
+		break;
+	}
+	case kind::generic:
+		_replace_generic(out, s);
+		break;
+	}
+}
+
+//============================================================================
+// line_index
+//============================================================================
+
+line_index::line_index(slice<const char> text): _len(text.len()) {
+	index_all_bytes(text, '\n', &_newlines);
+}
+
+line_index::position line_index::position_of(int offset) const {
+	_ZBS_ASSERT(0 <= offset && offset <= _len);
+
+	// the number of newlines before offset
+	int lo = 0;
+	int hi = _newlines.len();
+	while (lo < hi) {
+		int m = lo + (hi-lo) / 2;
+		if (_newlines[m] < offset) {
+			lo = m + 1;
+		} else {
+			hi = m;
+		}
+	}
+	const int start = lo == 0 ? 0 : _newlines[lo-1] + 1;
+	return {lo + 1, offset - start + 1};
+}
+
+int line_index::line_start(int line) const {
+	_ZBS_ASSERT(1 <= line && line <= line_count());
+	return line == 1 ? 0 : _newlines[line-2] + 1;
+}
+
 bool contains(slice<const char> s, slice<const char> substr) {
 	return slices::contains(s, substr);
 }
@@ -23,6 +505,14 @@ bool contains_any(slice<const char> s, slice<const char> chars) {
 	return index_any(s, chars) >= 0;
 }
 
+bool contains_any(slice<const char> s, const char_set &chars) {
+	return index_any(s, chars) >= 0;
+}
+
+bool contains_fold(slice<const char> s, slice<const char> substr) {
+	return index_fold(s, substr) >= 0;
+}
+
 bool contains_rune(slice<const char> s, rune r) {
 	return index_rune(s, r) >= 0;
 }
@@ -31,10 +521,290 @@ int count(slice<const char> s, slice<const char> sep) {
 	if (sep.len() == 0) {
 		return utf8::rune_count(s) + 1;
 	}
+	if (sep.len() == 1) {
+		return count_byte(s, sep[0]);
+	}
 	return slices::count(s, sep);
 }
 
+// With SSE2 the matches in each block of 16 bytes are subtracted from 16
+// byte-sized counters (a match compares to -1). The counters are summed up
+// every 255 blocks, before they can overflow.
+int count_byte(slice<const char> s, char c) {
+	const char *p = s.data();
+	const int n = s.len();
+	int count = 0;
+	int i = 0;
+#ifdef __SSE2__
+	const __m128i v = _mm_set1_epi8(c);
+	while (i + 16 <= n) {
+		__m128i acc = _mm_setzero_si128();
+		const int end = std::min(n - 15, i + 255*16);
+		for (; i < end; i += 16) {
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p+i));
+			acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(x, v));
+		}
+		__m128i sum = _mm_sad_epu8(acc, _mm_setzero_si128());
+		count += _mm_cvtsi128_si32(sum) + _mm_extract_epi16(sum, 4);
+	}
+#endif
+	for (; i < n; i++) {
+		if (p[i] == c) {
+			count++;
+		}
+	}
+	return count;
+}
+
+static inline uint8 ascii_lower(uint8 c) {
+	return ('A' <= c && c <= 'Z') ? c + ('a'-'A') : c;
+}
+
+// Reports whether `p` is equal to the lower case ASCII string `lower` of
+// length `n` after lower casing ASCII letters.
+static bool equal_lower(const char *p, const char *lower, int n) {
+	for (int i = 0; i < n; i++) {
+		if (ascii_lower(p[i]) != uint8(lower[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Reports whether all runes equivalent to `r` under simple case folding are
+// ASCII.
+static bool ascii_fold_orbit(rune r) {
+	for (rune f = unicode::simple_fold(r); f != r; f = unicode::simple_fold(f)) {
+		if (f >= utf8::rune_self) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// A needle prepared for case-insensitive search.
+//
+// If the needle is ASCII and none of its runes is equivalent to a non-ASCII
+// rune (like 'k' and the Kelvin sign), a match is a run of bytes equal to the
+// lower cased needle after lower casing ASCII letters. Candidates are found by
+// comparing the first and the last byte in both cases, 16 positions at a time,
+// and the rest of the text is searched with Horspool skips.
+//
+// Other needles are compared rune by rune using fold_canonical, starting only
+// at bytes which may begin a rune equivalent to the first rune of the needle.
+// The match may differ from the needle in length.
+struct fold_needle {
+	bool ascii = true;
+	slice<const char> lower; // lower cased needle, ASCII needles only
+	char lower_buf[64];      // holds it unless it's longer
+	vector<char> lower_heap;
+	int skip[256];      // Horspool skips by lower cased byte, ASCII needles only
+	vector<rune> runes; // canonical runes of the needle, other needles only
+	bool first[256];    // possible first bytes of a match, other needles only
+
+	explicit fold_needle(slice<const char> sep);
+	fold_needle(const fold_needle&) = delete;
+	fold_needle &operator=(const fold_needle&) = delete;
+
+	// Returns the offset of the first match in `s` and sets `*end` to the
+	// offset right after it. Returns -1 if there is no match.
+	int find(slice<const char> s, int *end) const;
+	int find_ascii(slice<const char> s, int *end) const;
+	int match_at(slice<const char> s, int i) const;
+};
+
+fold_needle::fold_needle(slice<const char> sep) {
+	for (int i = 0; i < sep.len() && ascii; i++) {
+		const uint8 c = sep[i];
+		ascii = c < utf8::rune_self && ascii_fold_orbit(c);
+	}
+
+	if (ascii) {
+		const int n = sep.len();
+		char *l = lower_buf;
+		if (n > int(sizeof(lower_buf))) {
+			lower_heap.resize(n);
+			l = lower_heap.data();
+		}
+		for (int i = 0; i < n; i++) {
+			l[i] = ascii_lower(sep[i]);
+		}
+		lower = slice<const char>(l, n);
+		for (int &s : skip) {
+			s = n;
+		}
+		for (int i = 0; i < n-1; i++) {
+			skip[uint8(l[i])] = n-1-i;
+		}
+		return;
+	}
+
+	for (int i = 0; i < sep.len();) {
+		sized_rune r = utf8::decode_rune(sep.sub(i));
+		runes.append(unicode::fold_canonical(r.rune));
+		i += r.size;
+	}
+
+	std::memset(first, 0, sizeof(first));
+	const rune r0 = runes[0];
+	if (r0 == utf8::rune_error) {
+		// matches invalid bytes as well
+		std::memset(first + 0x80, 1, 0x80);
+	}
+	rune f = r0;
+	do {
+		char tmp[utf8::utf_max];
+		utf8::encode_rune(tmp, f);
+		first[uint8(tmp[0])] = true;
+		f = unicode::simple_fold(f);
+	} while (f != r0);
+}
+
+int fold_needle::find(slice<const char> s, int *end) const {
+	if (ascii) {
+		return find_ascii(s, end);
+	}
+	for (int i = 0; i < s.len();) {
+		const uint8 c = s[i];
+		if (first[c]) {
+			int e = match_at(s, i);
+			if (e >= 0) {
+				*end = e;
+				return i;
+			}
+		}
+		i += c < utf8::rune_self ? 1 : utf8::decode_rune(s.sub(i)).size;
+	}
+	return -1;
+}
+
+int fold_needle::find_ascii(slice<const char> s, int *end) const {
+	const int n = lower.len();
+	const int last = s.len() - n; // the last possible offset of a match
+	const char *p = s.data();
+	const char *l = lower.data();
+	if (n == 0) {
+		*end = 0;
+		return 0;
+	}
+
+	int i = 0;
+#ifdef __SSE2__
+	const uint8 f = l[0];
+	const uint8 b = l[n-1];
+	const __m128i f_lo = _mm_set1_epi8(f);
+	const __m128i f_up = _mm_set1_epi8('a' <= f && f <= 'z' ? f - ('a'-'A') : f);
+	const __m128i b_lo = _mm_set1_epi8(b);
+	const __m128i b_up = _mm_set1_epi8('a' <= b && b <= 'z' ? b - ('a'-'A') : b);
+	for (; i + 15 <= last; i += 16) {
+		__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p+i));
+		__m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p+i+n-1));
+		__m128i fx = _mm_or_si128(_mm_cmpeq_epi8(x, f_lo), _mm_cmpeq_epi8(x, f_up));
+		__m128i by = _mm_or_si128(_mm_cmpeq_epi8(y, b_lo), _mm_cmpeq_epi8(y, b_up));
+		int mask = _mm_movemask_epi8(_mm_and_si128(fx, by));
+		while (mask != 0) {
+			const int j = i + __builtin_ctz(mask);
+			if (equal_lower(p+j+1, l+1, n-2)) {
+				*end = j + n;
+				return j;
+			}
+			mask &= mask - 1;
+		}
+	}
+#endif
+	while (i <= last) {
+		const uint8 c = ascii_lower(p[i+n-1]);
+		if (c == uint8(l[n-1]) && equal_lower(p+i, l, n-1)) {
+			*end = i + n;
+			return i;
+		}
+		i += skip[c];
+	}
+	return -1;
+}
+
+// Returns the offset right after the match starting at `i`, or -1 if there
+// is no match there.
+int fold_needle::match_at(slice<const char> s, int i) const {
+	for (rune want : runes) {
+		if (i >= s.len()) {
+			return -1;
+		}
+		rune r = uint8(s[i]);
+		int size = 1;
+		if (r >= utf8::rune_self) {
+			sized_rune sr = utf8::decode_rune(s.sub(i));
+			r = sr.rune;
+			size = sr.size;
+		}
+		if (r != want && unicode::fold_canonical(r) != want) {
+			return -1;
+		}
+		i += size;
+	}
+	return i;
+}
+
+int count_fold(slice<const char> s, slice<const char> sep) {
+	if (sep.len() == 0) {
+		return utf8::rune_count(s) + 1;
+	}
+	fold_needle needle(sep);
+	int n = 0;
+	for (;;) {
+		int end;
+		if (needle.find(s, &end) < 0) {
+			return n;
+		}
+		n++;
+		s = s.sub(end);
+	}
+}
+
+int index_fold(slice<const char> s, slice<const char> sep) {
+	int end;
+	return fold_needle(sep).find(s, &end);
+}
+
+// Compares the leading ASCII parts of `a` and `b` under case folding, 16 bytes
+// at a time. Returns the number of leading bytes known to be equal, or -1 if
+// a mismatch was found. Stops at the first block containing non-ASCII bytes,
+// the rest is up to the caller.
+static int equal_fold_ascii_prefix(slice<const char> a, slice<const char> b) {
+	const int n = std::min(a.len(), b.len());
+	int i = 0;
+#ifdef __SSE2__
+	const __m128i lo = _mm_set1_epi8('A'-1);
+	const __m128i hi = _mm_set1_epi8('Z'+1);
+	const __m128i bit = _mm_set1_epi8(0x20);
+	for (; i+16 <= n; i += 16) {
+		__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a.data()+i));
+		__m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b.data()+i));
+		if (_mm_movemask_epi8(_mm_or_si128(x, y)) != 0) {
+			break;
+		}
+
+		// bytes are ASCII here, signed comparison is fine
+		__m128i xu = _mm_and_si128(_mm_cmpgt_epi8(x, lo), _mm_cmplt_epi8(x, hi));
+		__m128i yu = _mm_and_si128(_mm_cmpgt_epi8(y, lo), _mm_cmplt_epi8(y, hi));
+		x = _mm_or_si128(x, _mm_and_si128(xu, bit));
+		y = _mm_or_si128(y, _mm_and_si128(yu, bit));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) != 0xFFFF) {
+			return -1;
+		}
+	}
+#endif
+	return i;
+}
+
 bool equal_fold(slice<const char> a, slice<const char> b) {
+	const int n = equal_fold_ascii_prefix(a, b);
+	if (n < 0) {
+		return false;
+	}
+	a = a.sub(n);
+	b = b.sub(n);
+
 	while (a != "" && b != "") {
 		// extract first rune from each string
 		rune ar, br;
@@ -62,27 +832,9 @@ bool equal_fold(slice<const char> a, slice<const char> b) {
 			continue;
 		}
 
-		// make ar < br to simplify what follows
-		if (br < ar) {
-			std::swap(ar, br);
-		}
-
-		// fast check for ASCII
-		if (br < utf8::rune_self && 'A' <= ar && ar <= 'Z') {
-			// ASCII, and ar is upper case; br must be lower case
-			if (br == ar + ('a' - 'A')) {
-				continue;
-			}
-			return false;
-		}
-
-		// General case. simple_fold(x) returns the next equivalent
-		// rune > x or wraps around to smaller values.
-		rune r = unicode::simple_fold(ar);
-		while (r != ar && r < br) {
-			r = unicode::simple_fold(r);
-		}
-		if (r == br) {
+		// General case. Runes are equivalent under simple case folding
+		// if they share the canonical member of the fold orbit.
+		if (unicode::fold_canonical(ar) == unicode::fold_canonical(br)) {
 			continue;
 		}
 		return false;
@@ -93,39 +845,43 @@ bool equal_fold(slice<const char> a, slice<const char> b) {
 }
 
 vector<string> fields(slice<const char> s) {
-	return fields_func(s, unicode::is_space);
+	return fields_if(s, [](rune r) { return unicode::is_space(r); });
 }
 
 vector<string> fields_func(slice<const char> s, func<bool(rune)> f) {
-	int n = 0;
-	bool in_field = false;
-	for (const auto &it : string_iter(s)) {
-		bool was_in_field = in_field;
-		in_field = !f(it.rune);
-		if (in_field && !was_in_field) {
-			n++;
-		}
-	}
+	return fields_if(s, f);
+}
 
-	vector<string> a;
-	a.reserve(n);
+string fold_key(slice<const char> s) {
+	string out;
+	out.reserve(s.len());
 
-	int field_start = -1;
-	for (const auto &it : string_iter(s)) {
-		if (f(it.rune)) {
-			if (field_start >= 0) {
-				a.append(s.sub(field_start, it.offset));
-				field_start = -1;
+	int i = 0;
+	while (i < s.len()) {
+		// copy a run of ASCII bytes at once and lower case it in place
+		int j = i;
+		while (j < s.len() && uint8(s[j]) < utf8::rune_self) {
+			j++;
+		}
+		if (j > i) {
+			int start = out.len();
+			out.append(s.sub(i, j));
+			for (char &c : out.sub(start)) {
+				if ('A' <= c && c <= 'Z') {
+					c += 'a' - 'A';
+				}
 			}
-		} else if (field_start == -1) {
-			field_start = it.offset;
+			i = j;
+			continue;
 		}
+
+		sized_rune r = utf8::decode_rune(s.sub(i));
+		char tmp[utf8::utf_max];
+		int n = utf8::encode_rune(tmp, unicode::fold_canonical(r.rune));
+		out.append(slice<char>(tmp).sub(0, n));
+		i += r.size;
 	}
-	if (field_start >= 0) {
-		// last field might end at EOF
-		a.append(s.sub(field_start));
-	}
-	return a;
+	return out;
 }
 
 bool starts_with(slice<const char> s, slice<const char> prefix) {
@@ -137,50 +893,61 @@ bool ends_with(slice<const char> s, slice<const char> suffix) {
 }
 
 int index(slice<const char> s, slice<const char> sep) {
+	if (sep.len() == 1) {
+		return index_byte(s, sep[0]);
+	}
 	return slices::index(s, sep);
 }
 
-int index_any(slice<const char> s, slice<const char> chars) {
-	if (chars.len() == 0) {
-		return -1;
+void index_all_bytes(slice<const char> s, char c, vector<int> *out) {
+	const char *p = s.data();
+	const int n = s.len();
+	int i = 0;
+#ifdef __SSE2__
+	const __m128i v = _mm_set1_epi8(c);
+	for (; i + 16 <= n; i += 16) {
+		__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p+i));
+		int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(x, v));
+		while (mask != 0) {
+			out->append(i + __builtin_ctz(mask));
+			mask &= mask - 1;
+		}
 	}
-
-	for (const auto &it : string_iter(s)) {
-		for (const auto &it2 : string_iter(chars)) {
-			if (it.rune == it2.rune) {
-				return it.offset;
-			}
+#endif
+	for (; i < n; i++) {
+		if (p[i] == c) {
+			out->append(i);
 		}
 	}
-	return -1;
 }
 
-static int index_func_internal(slice<const char> s, func<bool(rune)> f, bool truth) {
-	int start = 0;
-	while (start < s.len()) {
-		sized_rune r {s[start], 1};
-		if (uint8(r.rune) >= utf8::rune_self) {
-			r = utf8::decode_rune(s.sub(start));
-		}
-		if (f(r.rune) == truth) {
-			return start;
-		}
-		start += r.size;
+int index_any(slice<const char> s, slice<const char> chars) {
+	if (chars.len() == 0) {
+		return -1;
 	}
-	return -1;
+	return index_any(s, char_set(chars));
+}
+
+int index_any(slice<const char> s, const char_set &chars) {
+	int i = chars.cspan(s);
+	return i == s.len() ? -1 : i;
 }
 
 int index_func(slice<const char> s, func<bool(rune)> f) {
-	return index_func_internal(s, f, true);
+	return index_if(s, f);
+}
+
+int index_byte(slice<const char> s, char c) {
+	if (s.len() == 0) {
+		return -1;
+	}
+	const void *p = std::memchr(s.data(), c, s.len());
+	return p == nullptr ? -1 : static_cast<const char*>(p) - s.data();
 }
 
 int index_rune(slice<const char> s, rune r) {
-	if (r < 0x80) {
-		char c = r;
-		for (int i = 0; i < s.len(); i++) {
-			if (s[i] == c)
-				return i;
-		}
+	if (0 <= r && r < 0x80) {
+		return index_byte(s, r);
 	} else {
 		for (const auto &it : string_iter(s)) {
 			if (it.rune == r)
@@ -222,49 +989,23 @@ int last_index_any(slice<const char> s, slice<const char> chars) {
 	if (chars.len() == 0) {
 		return -1;
 	}
-
-	// TODO: use string_reverse_iter when it's ready
-	for (int i = s.len(); i > 0;) {
-		sized_rune r = utf8::decode_last_rune(s.sub(0, i));
-		i -= r.size;
-		for (const auto &it : string_iter(chars)) {
-			if (r.rune == it.rune) {
-				return i;
-			}
-		}
-	}
-	return -1;
+	return last_index_any(s, char_set(chars));
 }
 
-static int last_index_func_internal(slice<const char> s, func<bool(rune)> f, bool truth) {
-	// TODO: use string_reverse_iter when it's ready
-	for (int i = s.len(); i > 0;) {
-		sized_rune r = utf8::decode_last_rune(s.sub(0, i));
-		i -= r.size;
-		if (f(r.rune) == truth) {
-			return i;
-		}
+int last_index_any(slice<const char> s, const char_set &chars) {
+	int i = chars.rcspan(s);
+	if (i == 0) {
+		return -1;
 	}
-	return -1;
+	return i - utf8::decode_last_rune(s.sub(0, i)).size;
 }
 
 int last_index_func(slice<const char> s, func<bool(rune)> f) {
-	return last_index_func_internal(s, f, true);
+	return last_index_if(s, f);
 }
 
 string map(func<rune(rune)> f, slice<const char> s) {
-	string out;
-	out.reserve(s.len());
-
-	for (const auto &it : string_iter(s)) {
-		rune r = f(it.rune);
-		if (r >= 0) {
-			char tmp[utf8::utf_max];
-			int n = utf8::encode_rune(tmp, r);
-			out.append(slice<char>(tmp).sub(0, n));
-		}
-	}
-	return out;
+	return transform(f, s);
 }
 
 string repeat(slice<const char> s, int count) {
@@ -434,50 +1175,49 @@ slice<const char> trim(slice<const char> s, slice<const char> cutset) {
 	if (s == "" || cutset == "") {
 		return s;
 	}
-	auto f = [=](rune r) { return contains_rune(cutset, r); };
-	return trim_func(s, f);
+	return trim(s, char_set(cutset));
+}
+
+slice<const char> trim(slice<const char> s, const char_set &cutset) {
+	return trim_right(trim_left(s, cutset), cutset);
 }
 
 slice<const char> trim_func(slice<const char> s, func<bool(rune)> f) {
-	return trim_right_func(trim_left_func(s, f), f);
+	return trim_if(s, f);
 }
 
 slice<const char> trim_left(slice<const char> s, slice<const char> cutset) {
 	if (s == "" || cutset == "") {
 		return s;
 	}
-	auto f = [=](rune r) { return contains_rune(cutset, r); };
-	return trim_left_func(s, f);
+	return trim_left(s, char_set(cutset));
+}
+
+slice<const char> trim_left(slice<const char> s, const char_set &cutset) {
+	return s.sub(cutset.span(s));
 }
 
 slice<const char> trim_left_func(slice<const char> s, func<bool(rune)> f) {
-	int i = index_func_internal(s, f, false);
-	if (i == -1) {
-		return {};
-	}
-	return s.sub(i);
+	return trim_left_if(s, f);
 }
 
 slice<const char> trim_right(slice<const char> s, slice<const char> cutset) {
 	if (s == "" || cutset == "") {
 		return s;
 	}
-	auto f = [=](rune r) { return contains_rune(cutset, r); };
-	return trim_right_func(s, f);
+	return trim_right(s, char_set(cutset));
+}
+
+slice<const char> trim_right(slice<const char> s, const char_set &cutset) {
+	return s.sub(0, cutset.rspan(s));
 }
 
 slice<const char> trim_right_func(slice<const char> s, func<bool(rune)> f) {
-	int i = last_index_func_internal(s, f, false);
-	if (i >= 0 && uint8(s[i]) >= utf8::rune_self) {
-		i += utf8::decode_rune(s.sub(i)).size;
-	} else {
-		i++;
-	}
-	return s.sub(0, i);
+	return trim_right_if(s, f);
 }
 
 slice<const char> trim_space(slice<const char> s) {
-	return trim_func(s, unicode::is_space);
+	return trim_if(s, [](rune r) { return unicode::is_space(r); });
 }
 
 slice<const char> trim_prefix(slice<const char> s, slice<const char> prefix) {
@@ -4,6 +4,11 @@
 
 #include "zbs/unicode.hh"
 #include "zbs/_slice.hh"
+#include "zbs/_vector.hh"
+#include "zbs/unicode/utf8.hh"
+#include "byte_scan.hh"
+#include <algorithm>
+#include <cstring>
 
 namespace zbs {
 namespace unicode {
@@ -27,6 +32,18 @@ struct fold_pair {
 	uint16 to;
 };
 
+struct decomposition {
+	rune r;
+	uint16 offset; // in decomposition_runes
+	uint8 len;
+};
+
+struct composition {
+	rune first;
+	rune second;
+	rune composite;
+};
+
 #include "unicode_private_tables.inl"
 
 static const int linear_max = 18;
@@ -191,6 +208,10 @@ bool is_upper(rune r) {
 }
 
 rune simple_fold(rune r) {
+	if (uint32(r) <= uint32(max_ascii)) {
+		return ascii_fold[r];
+	}
+
 	// Consult caseOrbit table for special cases.
 	int lo = 0;
 	int hi = case_orbit.len();
@@ -213,6 +234,21 @@ rune simple_fold(rune r) {
 	return (l != r) ? l : to_upper(r);
 }
 
+rune fold_canonical(rune r) {
+	if (uint32(r) <= uint32(max_ascii)) {
+		if ('A' <= r && r <= 'Z') {
+			r += 'a' - 'A';
+		}
+		return r;
+	}
+	if (uint32(r) >= uint32(fold_canonical_max)) {
+		return r;
+	}
+	int block = fold_canonical_index[r >> fold_canonical_shift];
+	int i = (block << fold_canonical_shift) | (r & ((1 << fold_canonical_shift) - 1));
+	return r + fold_canonical_delta[i];
+}
+
 rune to_cr(case_t _case, rune r, slice<const case_range> crs) {
 	if (_case < 0 || max_case <= _case) {
 		return replacement_char;
@@ -286,4 +322,509 @@ rune to_upper(rune r) {
 	return to(upper_case, r);
 }
 
+enum {
+	// normalization properties, must match maketables.go
+	norm_ccc_mask = 0xFF,  // canonical combining class
+	norm_nfd_no = 1 << 8,  // changed by NFD
+	norm_nfkd_no = 1 << 9, // changed by NFKD
+	norm_nfc_no = 1 << 10, // never occurs in NFC
+	norm_nfkc_no = 1 << 11, // never occurs in NFKC
+	norm_maybe = 1 << 12,  // may compose with the previous rune
+
+	hangul_s_base = 0xAC00,
+	hangul_l_base = 0x1100,
+	hangul_v_base = 0x1161,
+	hangul_t_base = 0x11A7,
+	hangul_l_count = 19,
+	hangul_v_count = 21,
+	hangul_t_count = 28,
+	hangul_n_count = hangul_v_count * hangul_t_count,
+	hangul_s_count = hangul_l_count * hangul_n_count,
+};
+
+static uint16 norm_props(rune r) {
+	if (uint32(r) >= uint32(norm_props_max)) {
+		return 0;
+	}
+	int block = norm_props_index[r >> norm_props_shift];
+	return norm_props_block[(block << norm_props_shift) | (r & ((1 << norm_props_shift) - 1))];
+}
+
+static int combining_class(rune r) {
+	return norm_props(r) & norm_ccc_mask;
+}
+
+static bool is_compat(norm_form f) {
+	return f == NFKC || f == NFKD;
+}
+
+static bool is_composing(norm_form f) {
+	return f == NFC || f == NFKC;
+}
+
+static uint16 norm_no(norm_form f) {
+	switch (f) {
+	case NFC: return norm_nfc_no;
+	case NFD: return norm_nfd_no;
+	case NFKC: return norm_nfkc_no;
+	case NFKD: return norm_nfkd_no;
+	}
+	return 0;
+}
+
+// Set if the rune is changed by the decomposition step of `f`.
+static uint16 norm_decomposes(norm_form f) {
+	return is_compat(f) ? norm_nfkd_no : norm_nfd_no;
+}
+
+static bool is_hangul_syllable(rune r) {
+	return hangul_s_base <= r && r < hangul_s_base + hangul_s_count;
+}
+
+static slice<const rune> find_decomposition(slice<const decomposition> table, rune r) {
+	int lo = 0;
+	int hi = table.len();
+	while (lo < hi) {
+		int m = lo + (hi-lo)/2;
+		const auto &d = table[m];
+		if (d.r == r) {
+			return slice<const rune>(decomposition_runes + d.offset, d.len);
+		}
+		if (r < d.r) {
+			hi = m;
+		} else {
+			lo = m + 1;
+		}
+	}
+	return {};
+}
+
+// Returns the full decomposition of `r`, which must not be a Hangul syllable.
+static slice<const rune> decomposition_of(rune r, bool compat) {
+	if (compat) {
+		auto d = find_decomposition(compat_decompositions, r);
+		if (d.len() > 0) {
+			return d;
+		}
+	}
+	return find_decomposition(canonical_decompositions, r);
+}
+
+// Appends the full decomposition of `r` in the form `f` to `out`.
+static void decompose(vector<rune> *out, rune r, norm_form f) {
+	if (!(norm_props(r) & norm_decomposes(f))) {
+		out->append(r);
+		return;
+	}
+	if (is_hangul_syllable(r)) {
+		const int s = r - hangul_s_base;
+		out->append(hangul_l_base + s / hangul_n_count);
+		out->append(hangul_v_base + (s % hangul_n_count) / hangul_t_count);
+		if (s % hangul_t_count != 0) {
+			out->append(hangul_t_base + s % hangul_t_count);
+		}
+		return;
+	}
+	out->append(decomposition_of(r, is_compat(f)));
+}
+
+// Reports whether `r` starts a new normalization segment in the form `f`, in
+// other words none of the runes before it can be reordered or composed with
+// it or the runes after it.
+static bool boundary_before(rune r, norm_form f) {
+	uint16 p = norm_props(r);
+	if (p & norm_decomposes(f)) {
+		if (is_hangul_syllable(r)) {
+			return true;
+		}
+		p = norm_props(decomposition_of(r, is_compat(f))[0]);
+	}
+	return (p & norm_ccc_mask) == 0 && !(is_composing(f) && (p & norm_maybe));
+}
+
+// Returns the length of the longest prefix of `s` known to be in the form `f`
+// which ends at a segment boundary. Returns s.len() if all of `s` is in the
+// form `f`. This is the quick check algorithm from UAX #15, where "maybe" is
+// treated as "no".
+static int quick_span(norm_form f, slice<const char> s) {
+	const uint16 no = norm_no(f) | (is_composing(f) ? norm_maybe : 0);
+	int last_ccc = 0;
+	int boundary = 0;
+	for (int i = 0; i < s.len();) {
+		if (uint8(s[i]) < utf8::rune_self) {
+			boundary = i++;
+			last_ccc = 0;
+			continue;
+		}
+		sized_rune r = utf8::decode_rune(s.sub(i));
+		if (r.rune == utf8::rune_error && r.size == 1) {
+			// invalid bytes are passed through and separate segments
+			boundary = i++;
+			last_ccc = 0;
+			continue;
+		}
+		const uint16 p = norm_props(r.rune);
+		const int ccc = p & norm_ccc_mask;
+		if ((p & no) || (ccc != 0 && last_ccc > ccc)) {
+			return boundary;
+		}
+		if (boundary_before(r.rune, f)) {
+			boundary = i;
+		}
+		last_ccc = ccc;
+		i += r.size;
+	}
+	return s.len();
+}
+
+// Sorts runs of non-starters by their combining class, keeping the order of
+// runes with equal classes.
+static void canonical_order(slice<rune> s) {
+	for (int i = 1; i < s.len(); i++) {
+		const rune r = s[i];
+		const int ccc = combining_class(r);
+		if (ccc == 0) {
+			continue;
+		}
+		int j = i;
+		for (; j > 0; j--) {
+			const int prev = combining_class(s[j-1]);
+			if (prev == 0 || prev <= ccc) {
+				break;
+			}
+			s[j] = s[j-1];
+		}
+		s[j] = r;
+	}
+}
+
+// Returns the primary composite of `a` and `b`, or -1 if there is none.
+static rune compose_pair(rune a, rune b) {
+	if (hangul_l_base <= a && a < hangul_l_base + hangul_l_count &&
+		hangul_v_base <= b && b < hangul_v_base + hangul_v_count) {
+		return hangul_s_base + ((a - hangul_l_base) * hangul_v_count +
+			(b - hangul_v_base)) * hangul_t_count;
+	}
+	if (is_hangul_syllable(a) && (a - hangul_s_base) % hangul_t_count == 0 &&
+		hangul_t_base < b && b < hangul_t_base + hangul_t_count) {
+		return a + (b - hangul_t_base);
+	}
+
+	int lo = 0;
+	int hi = compositions.len();
+	while (lo < hi) {
+		int m = lo + (hi-lo)/2;
+		const auto &c = compositions[m];
+		if (c.first == a && c.second == b) {
+			return c.composite;
+		}
+		if (a < c.first || (a == c.first && b < c.second)) {
+			hi = m;
+		} else {
+			lo = m + 1;
+		}
+	}
+	return -1;
+}
+
+// Applies the canonical composition algorithm to the canonically ordered
+// decomposition `s` in place. Returns the new length.
+static int compose(slice<rune> s) {
+	if (s.len() == 0) {
+		return 0;
+	}
+	int starter = 0;
+	int last_ccc = combining_class(s[0]) == 0 ? 0 : 256;
+	int n = 1;
+	for (int i = 1; i < s.len(); i++) {
+		const rune r = s[i];
+		const int ccc = combining_class(r);
+		// composes only if not blocked from the starter
+		if (last_ccc < ccc || last_ccc == 0) {
+			const rune c = compose_pair(s[starter], r);
+			if (c != -1) {
+				s[starter] = c;
+				continue;
+			}
+		}
+		if (ccc == 0) {
+			starter = n;
+		}
+		last_ccc = ccc;
+		s[n++] = r;
+	}
+	return n;
+}
+
+bool is_normalized(norm_form f, slice<const char> s) {
+	if (quick_span(f, s) == s.len()) {
+		return true;
+	}
+	string buf;
+	return normalize(f, s, &buf) == s;
+}
+
+slice<const char> normalize(norm_form f, slice<const char> s, string *buf) {
+	int i = quick_span(f, s);
+	if (i == s.len()) {
+		return s;
+	}
+
+	buf->clear();
+	buf->reserve(s.len());
+	buf->append(s.sub(0, i));
+	vector<rune> segment;
+	char tmp[utf8::utf_max];
+	while (i < s.len()) {
+		sized_rune r = utf8::decode_rune(s.sub(i));
+		if (r.rune == utf8::rune_error && r.size == 1) {
+			buf->append(s.sub(i, i+1));
+			i++;
+		} else {
+			// decompose the segment, reorder and compose it
+			segment.clear();
+			decompose(&segment, r.rune, f);
+			i += r.size;
+			while (i < s.len()) {
+				r = utf8::decode_rune(s.sub(i));
+				if ((r.rune == utf8::rune_error && r.size == 1) ||
+					boundary_before(r.rune, f)) {
+					break;
+				}
+				decompose(&segment, r.rune, f);
+				i += r.size;
+			}
+			canonical_order(segment.sub());
+			int n = segment.len();
+			if (is_composing(f)) {
+				n = compose(segment.sub());
+			}
+			for (int j = 0; j < n; j++) {
+				buf->append(slice<const char>(tmp, utf8::encode_rune(tmp, segment[j])));
+			}
+		}
+
+		// copy the normalized text which follows as is
+		const int n = quick_span(f, s.sub(i));
+		buf->append(s.sub(i, i+n));
+		i += n;
+	}
+	return buf->sub();
+}
+
+string normalize(norm_form f, slice<const char> s) {
+	string buf;
+	auto out = normalize(f, s, &buf);
+	if (out.data() == s.data()) {
+		return s;
+	}
+	return buf;
+}
+
+static constexpr rune max_bmp = 0xFFFF;
+
+// Sorts the ranges, drops empty ones and merges the ones which overlap or are
+// adjacent.
+static void canonical_ranges(vector<rune_range> *v) {
+	int n = 0;
+	for (int i = 0; i < v->len(); i++) {
+		rune_range rr = (*v)[i];
+		if (rr.lo < 0) {
+			rr.lo = 0;
+		}
+		if (rr.hi > max_rune) {
+			rr.hi = max_rune;
+		}
+		if (rr.lo <= rr.hi) {
+			(*v)[n++] = rr;
+		}
+	}
+	std::sort(v->data(), v->data() + n, [](const rune_range &a, const rune_range &b) {
+		return a.lo < b.lo;
+	});
+	int m = 0;
+	for (int i = 0; i < n; i++) {
+		const rune_range &rr = (*v)[i];
+		if (m > 0 && rr.lo <= (*v)[m-1].hi + 1) {
+			(*v)[m-1].hi = std::max((*v)[m-1].hi, rr.hi);
+		} else {
+			(*v)[m++] = rr;
+		}
+	}
+	v->resize(m);
+}
+
+// T is range16 or range32
+template <typename T>
+static void append_ranges(vector<rune_range> *v, slice<const T> ranges) {
+	for (const auto &range: ranges) {
+		if (range.stride == 1) {
+			v->append({rune(range.lo), rune(range.hi)});
+			continue;
+		}
+		for (uint32 r = range.lo; r <= range.hi; r += range.stride) {
+			v->append({rune(r), rune(r)});
+		}
+	}
+}
+
+rune_set::rune_set() {
+	_compile();
+}
+
+rune_set::rune_set(const range_table &table) {
+	append_ranges(&_ranges, table.r16);
+	append_ranges(&_ranges, table.r32);
+	canonical_ranges(&_ranges);
+	_compile();
+}
+
+rune_set::rune_set(slice<const rune> runes) {
+	_ranges.reserve(runes.len());
+	for (rune r: runes) {
+		_ranges.append({r, r});
+	}
+	canonical_ranges(&_ranges);
+	_compile();
+}
+
+rune_set::rune_set(slice<const rune_range> ranges): _ranges(ranges) {
+	canonical_ranges(&_ranges);
+	_compile();
+}
+
+// Builds the bitmaps from _ranges. Every block of 256 code points in the BMP
+// is a 256-bit bitmap; blocks are shared, so for typical sets most of the
+// index points to the empty or the full block.
+void rune_set::_compile() {
+	std::memset(_bmp_index, 0, sizeof(_bmp_index));
+	_bmp_blocks.clear();
+	_bmp_blocks.resize(4, 0);
+	_bmp_blocks.resize(8, ~uint64(0));
+
+	uint64 block[4];
+	int cur = -1;
+	auto flush = [&]() {
+		if (cur == -1) {
+			return;
+		}
+		int n = _bmp_blocks.len() / 4;
+		int b = 0;
+		while (b < n && std::memcmp(block, _bmp_blocks.data() + b*4, sizeof(block)) != 0) {
+			b++;
+		}
+		if (b == n) {
+			_bmp_blocks.append(slice<const uint64>(block, 4));
+		}
+		_bmp_index[cur] = b;
+		cur = -1;
+	};
+
+	_astral = _ranges.len();
+	for (int i = 0; i < _ranges.len(); i++) {
+		const rune_range rr = _ranges[i];
+		if (rr.hi > max_bmp && _astral == _ranges.len()) {
+			_astral = i;
+		}
+		const rune hi = std::min(rr.hi, max_bmp);
+		for (rune r = rr.lo; r <= hi;) {
+			if ((r & 0xFF) == 0 && r + 0xFF <= hi) {
+				flush();
+				_bmp_index[r >> 8] = 1;
+				r += 0x100;
+				continue;
+			}
+			if (r >> 8 != cur) {
+				flush();
+				cur = r >> 8;
+				std::memset(block, 0, sizeof(block));
+			}
+			block[(r >> 6) & 3] |= uint64(1) << (r & 63);
+			r++;
+		}
+	}
+	flush();
+
+	std::memcpy(_latin1, _bmp_blocks.data() + _bmp_index[0]*4, sizeof(_latin1));
+	std::memset(_ascii, 0, sizeof(_ascii));
+	for (int c = 0; c <= max_ascii; c++) {
+		if (_latin1[c >> 6] & (uint64(1) << (c & 63))) {
+			_ascii[c & 15] |= 1 << (c >> 4);
+		}
+	}
+}
+
+bool rune_set::contains(rune r) const {
+	const uint32 u = r;
+	if (u <= uint32(max_latin1)) {
+		return (_latin1[u >> 6] >> (u & 63)) & 1;
+	}
+	if (u <= uint32(max_bmp)) {
+		const uint64 *block = _bmp_blocks.data() + _bmp_index[u >> 8]*4;
+		return (block[(u >> 6) & 3] >> (u & 63)) & 1;
+	}
+
+	// binary search over ranges above the BMP
+	int lo = _astral;
+	int hi = _ranges.len();
+	while (lo < hi) {
+		int m = lo + (hi-lo) / 2;
+		const rune_range &rr = _ranges[m];
+		if (r < rr.lo) {
+			hi = m;
+		} else if (r > rr.hi) {
+			lo = m + 1;
+		} else {
+			return true;
+		}
+	}
+	return false;
+}
+
+int rune_set::span(slice<const char> s) const {
+	int i = 0;
+	for (;;) {
+		i += detail::scan_bytes(s.sub(i), {_ascii, false}, false, true);
+		if (i == s.len() || uint8(s[i]) < utf8::rune_self) {
+			return i;
+		}
+		sized_rune r = utf8::decode_rune(s.sub(i));
+		if (!contains(r.rune)) {
+			return i;
+		}
+		i += r.size;
+	}
+}
+
+rune_set operator|(const rune_set &a, const rune_set &b) {
+	vector<rune_range> ranges;
+	ranges.reserve(a.ranges().len() + b.ranges().len());
+	ranges.append(a.ranges());
+	ranges.append(b.ranges());
+	return rune_set(ranges);
+}
+
+rune_set operator-(const rune_set &a, const rune_set &b) {
+	slice<const rune_range> ar = a.ranges();
+	slice<const rune_range> br = b.ranges();
+	vector<rune_range> ranges;
+	int j = 0;
+	for (rune_range rr: ar) {
+		// skip the ranges of b which end before this one
+		while (j < br.len() && br[j].hi < rr.lo) {
+			j++;
+		}
+		for (int k = j; k < br.len() && br[k].lo <= rr.hi; k++) {
+			if (br[k].lo > rr.lo) {
+				ranges.append({rr.lo, br[k].lo - 1});
+			}
+			rr.lo = br[k].hi + 1;
+		}
+		if (rr.lo <= rr.hi) {
+			ranges.append(rr);
+		}
+	}
+	return rune_set(ranges);
+}
+
 }} // namespace zbs::unicode
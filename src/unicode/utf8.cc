@@ -4,6 +4,12 @@
 
 #include "zbs/unicode/utf8.hh"
 
+#include <cstring>
+#include <algorithm>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 enum {
 	t1 = 0x00, // 0000 0000
 	tx = 0x80, // 1000 0000
@@ -124,6 +130,25 @@ static decoded_rune decode_rune_internal(slice<const char> s) {
 	return {rune_error, 1, false};
 }
 
+// Returns the length of the leading ASCII part of `s`.
+static int ascii_prefix(slice<const char> s) {
+	const int n = s.len();
+	int i = 0;
+#ifdef __SSE2__
+	for (; i + 16 <= n; i += 16) {
+		__m128i x = _mm_loadu_si128((const __m128i*)(s.data() + i));
+		int mask = _mm_movemask_epi8(x);
+		if (mask != 0) {
+			return i + __builtin_ctz(mask);
+		}
+	}
+#endif
+	while (i < n && uint8(s[i]) < rune_self) {
+		i++;
+	}
+	return i;
+}
+
 bool full_rune(slice<const char> s) {
 	return !decode_rune_internal(s).incomplete;
 }
@@ -243,7 +268,7 @@ bool valid(slice<const char> s) {
 	int i = 0;
 	while (i < s.len()) {
 		if (uint8(s[i]) < rune_self) {
-			i++;
+			i += ascii_prefix(s.sub(i));
 		} else {
 			int size = decode_rune(s.sub(i)).size;
 			if (size == 1) {
@@ -269,4 +294,137 @@ bool valid_rune(rune r) {
 	return true;
 }
 
+//============================================================================
+// decoder
+//============================================================================
+
+void decoder::feed(slice<const char> s) {
+	_ZBS_ASSERT(_pos == _in.len());
+	_in = s;
+	_pos = 0;
+}
+
+void decoder::finish() {
+	_eof = true;
+}
+
+void decoder::reset() {
+	_in = {};
+	_pos = 0;
+	_pending_len = 0;
+	_eof = false;
+}
+
+// Moves the incomplete sequence at the end of the input to _pending.
+void decoder::_carry() {
+	const int n = _in.len() - _pos;
+	std::memcpy(_pending + _pending_len, _in.data() + _pos, n);
+	_pending_len += n;
+	_pos = _in.len();
+}
+
+// Decodes the rune which starts with the carried over bytes, copying its bytes
+// to _joined. Returns false if the rune is still incomplete, in which case the
+// whole input is carried over.
+bool decoder::_decode_pending(sized_rune *r) {
+	const int n = _pending_len;
+	const int extra = std::min(utf_max - n, _in.len() - _pos);
+	char tmp[utf_max];
+	std::memcpy(tmp, _pending, n);
+	std::memcpy(tmp + n, _in.data() + _pos, extra);
+
+	decoded_rune d = decode_rune_internal(slice<const char>(tmp, n + extra));
+	if (d.incomplete && !_eof) {
+		_carry();
+		return false;
+	}
+
+	std::memcpy(_joined, tmp, d.size);
+	if (d.size < n) {
+		// invalid sequence, the rest of the carried over bytes is
+		// decoded on its own
+		std::memmove(_pending, _pending + d.size, n - d.size);
+		_pending_len -= d.size;
+	} else {
+		_pos += d.size - n;
+		_pending_len = 0;
+	}
+	*r = {d.r, d.size};
+	return true;
+}
+
+bool decoder::next(rune *r) {
+	if (_pending_len > 0) {
+		sized_rune sr;
+		if (!_decode_pending(&sr)) {
+			return false;
+		}
+		*r = sr.rune;
+		return true;
+	}
+	if (_pos == _in.len()) {
+		return false;
+	}
+
+	const byte c = _in[_pos];
+	if (c < rune_self) {
+		_pos++;
+		*r = c;
+		return true;
+	}
+
+	decoded_rune d = decode_rune_internal(_in.sub(_pos));
+	if (d.incomplete && !_eof) {
+		_carry();
+		return false;
+	}
+	_pos += d.size;
+	*r = d.r;
+	return true;
+}
+
+bool decoder::next_span(span *s) {
+	if (_pending_len > 0) {
+		sized_rune sr;
+		if (!_decode_pending(&sr)) {
+			return false;
+		}
+		const bool valid = sr.rune != rune_error || sr.size > 1;
+		*s = {slice<const char>(_joined, sr.size), valid};
+		return true;
+	}
+
+	const int n = _in.len();
+	int i = _pos;
+	while (i < n) {
+		i += ascii_prefix(_in.sub(i));
+		if (i == n) {
+			break;
+		}
+		decoded_rune d = decode_rune_internal(_in.sub(i));
+		if (d.incomplete || (d.r == rune_error && d.size == 1)) {
+			break;
+		}
+		i += d.size;
+	}
+	if (i > _pos) {
+		*s = {_in.sub(_pos, i), true};
+		_pos = i;
+		return true;
+	}
+	if (_pos == n) {
+		return false;
+	}
+
+	// an invalid byte or an incomplete sequence at the end of the input
+	decoded_rune d = decode_rune_internal(_in.sub(_pos));
+	if (d.incomplete && !_eof) {
+		_carry();
+		return false;
+	}
+	*s = {_in.sub(_pos, _pos+1), false};
+	_pos++;
+	return true;
+}
+
 }}} // namespace zbs::unicode::utf8
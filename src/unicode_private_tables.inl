@@ -324,3 +324,9871 @@ const fold_pair _case_orbit[] = {
 };
 const slice<const fold_pair> case_orbit(_case_orbit);
 
+const uint16 ascii_fold[max_ascii+1] = {
+	0x0000,
+	0x0001,
+	0x0002,
+	0x0003,
+	0x0004,
+	0x0005,
+	0x0006,
+	0x0007,
+	0x0008,
+	0x0009,
+	0x000A,
+	0x000B,
+	0x000C,
+	0x000D,
+	0x000E,
+	0x000F,
+	0x0010,
+	0x0011,
+	0x0012,
+	0x0013,
+	0x0014,
+	0x0015,
+	0x0016,
+	0x0017,
+	0x0018,
+	0x0019,
+	0x001A,
+	0x001B,
+	0x001C,
+	0x001D,
+	0x001E,
+	0x001F,
+	0x0020,
+	0x0021,
+	0x0022,
+	0x0023,
+	0x0024,
+	0x0025,
+	0x0026,
+	0x0027,
+	0x0028,
+	0x0029,
+	0x002A,
+	0x002B,
+	0x002C,
+	0x002D,
+	0x002E,
+	0x002F,
+	0x0030,
+	0x0031,
+	0x0032,
+	0x0033,
+	0x0034,
+	0x0035,
+	0x0036,
+	0x0037,
+	0x0038,
+	0x0039,
+	0x003A,
+	0x003B,
+	0x003C,
+	0x003D,
+	0x003E,
+	0x003F,
+	0x0040,
+	0x0061,
+	0x0062,
+	0x0063,
+	0x0064,
+	0x0065,
+	0x0066,
+	0x0067,
+	0x0068,
+	0x0069,
+	0x006A,
+	0x006B,
+	0x006C,
+	0x006D,
+	0x006E,
+	0x006F,
+	0x0070,
+	0x0071,
+	0x0072,
+	0x0073,
+	0x0074,
+	0x0075,
+	0x0076,
+	0x0077,
+	0x0078,
+	0x0079,
+	0x007A,
+	0x005B,
+	0x005C,
+	0x005D,
+	0x005E,
+	0x005F,
+	0x0060,
+	0x0041,
+	0x0042,
+	0x0043,
+	0x0044,
+	0x0045,
+	0x0046,
+	0x0047,
+	0x0048,
+	0x0049,
+	0x004A,
+	0x212A,
+	0x004C,
+	0x004D,
+	0x004E,
+	0x004F,
+	0x0050,
+	0x0051,
+	0x0052,
+	0x017F,
+	0x0054,
+	0x0055,
+	0x0056,
+	0x0057,
+	0x0058,
+	0x0059,
+	0x005A,
+	0x007B,
+	0x007C,
+	0x007D,
+	0x007E,
+	0x007F,
+};
+
+const int fold_canonical_shift = 5;
+const rune fold_canonical_max = 0x10440;
+const uint8 fold_canonical_index[fold_canonical_max >> fold_canonical_shift] = {
+	0, 0, 1, 0, 0, 2, 3, 0, 4, 5, 6, 7, 8, 9, 10, 11,
+	4, 12, 13, 0, 0, 0, 0, 0, 0, 0, 14, 15, 16, 17, 18, 19,
+	20, 21, 0, 4, 22, 4, 23, 4, 4, 24, 25, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 26, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 4, 4, 28, 4, 4, 4, 29, 30, 31, 32, 30, 33, 34, 35,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 37, 38, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 39, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	41, 42, 0, 43, 4, 4, 4, 44, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 45, 46, 0, 0, 0, 0, 47, 4, 48, 49, 50, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	51, 52,
+};
+const int32 fold_canonical_delta[] = {
+	// block 0
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 1
+	0, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 0, 0, 0, 0, 0,
+	// block 2
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 775, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 3
+	32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 0,
+	32, 32, 32, 32, 32, 32, 32, 0,
+	// block 4
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	// block 5
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	0, 0, 1, 0, 1, 0, 1, 0,
+	0, 1, 0, 1, 0, 1, 0, 1,
+	// block 6
+	0, 1, 0, 1, 0, 1, 0, 1,
+	0, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	// block 7
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	-121, 1, 0, 1, 0, 1, 0, -268,
+	// block 8
+	0, 210, 1, 0, 1, 0, 206, 1,
+	0, 205, 205, 1, 0, 0, 79, 202,
+	203, 1, 0, 205, 207, 0, 211, 209,
+	1, 0, 0, 0, 211, 213, 0, 214,
+	// block 9
+	1, 0, 1, 0, 1, 0, 218, 1,
+	0, 218, 0, 0, 1, 0, 218, 1,
+	0, 217, 217, 1, 0, 1, 0, 219,
+	1, 0, 0, 0, 1, 0, 0, 0,
+	// block 10
+	0, 0, 0, 0, 2, 1, 0, 2,
+	1, 0, 2, 1, 0, 1, 0, 1,
+	0, 1, 0, 1, 0, 1, 0, 1,
+	0, 1, 0, 1, 0, 0, 1, 0,
+	// block 11
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	0, 2, 1, 0, 1, 0, -97, -56,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	// block 12
+	-130, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 10795, 1, 0, -163, 10792, 0,
+	// block 13
+	0, 1, 0, -195, 69, 71, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 14
+	0, 0, 0, 0, 0, 116, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 15
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	1, 0, 1, 0, 0, 0, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 16
+	0, 0, 0, 0, 0, 0, 38, 0,
+	37, 37, 37, 0, 64, 0, 63, 63,
+	0, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32,
+	// block 17
+	32, 32, 0, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 18
+	0, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 8,
+	-30, -25, 0, 0, 0, -15, -22, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	// block 19
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	-54, -48, 0, 0, -60, -64, 0, 1,
+	0, -7, 1, 0, 0, -130, -130, -130,
+	// block 20
+	80, 80, 80, 80, 80, 80, 80, 80,
+	80, 80, 80, 80, 80, 80, 80, 80,
+	32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32,
+	// block 21
+	32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 22
+	1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	// block 23
+	15, 1, 0, 1, 0, 1, 0, 1,
+	0, 1, 0, 1, 0, 1, 0, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	// block 24
+	1, 0, 1, 0, 1, 0, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48,
+	// block 25
+	48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 26
+	7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264,
+	7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264,
+	7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264,
+	7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264,
+	// block 27
+	7264, 7264, 7264, 7264, 7264, 7264, 0, 7264,
+	0, 0, 0, 0, 0, 7264, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 28
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 0, 0,
+	0, 0, 0, -58, 0, 0, -7615, 0,
+	// block 29
+	0, 0, 0, 0, 0, 0, 0, 0,
+	-8, -8, -8, -8, -8, -8, -8, -8,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	-8, -8, -8, -8, -8, -8, 0, 0,
+	// block 30
+	0, 0, 0, 0, 0, 0, 0, 0,
+	-8, -8, -8, -8, -8, -8, -8, -8,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	-8, -8, -8, -8, -8, -8, -8, -8,
+	// block 31
+	0, 0, 0, 0, 0, 0, 0, 0,
+	-8, -8, -8, -8, -8, -8, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, -8, 0, -8, 0, -8, 0, -8,
+	// block 32
+	0, 0, 0, 0, 0, 0, 0, 0,
+	-8, -8, -8, -8, -8, -8, -8, -8,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 33
+	0, 0, 0, 0, 0, 0, 0, 0,
+	-8, -8, -8, -8, -8, -8, -8, -8,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	-8, -8, -74, -74, -9, 0, -7173, 0,
+	// block 34
+	0, 0, 0, 0, 0, 0, 0, 0,
+	-86, -86, -86, -86, -9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	-8, -8, -100, -100, 0, 0, 0, 0,
+	// block 35
+	0, 0, 0, 0, 0, 0, 0, 0,
+	-8, -8, -112, -112, -7, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	-128, -128, -126, -126, -9, 0, 0, 0,
+	// block 36
+	0, 0, 0, 0, 0, 0, -7517, 0,
+	0, 0, -8383, -8262, 0, 0, 0, 0,
+	0, 0, 28, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 37
+	16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 38
+	0, 0, 0, 1, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 39
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26,
+	// block 40
+	26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 41
+	48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48,
+	// block 42
+	48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 43
+	1, 0, -10743, -3814, -10727, 0, 0, 1,
+	0, 1, 0, 1, 0, -10780, -10749, -10783,
+	-10782, 0, 1, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, -10815, -10815,
+	// block 44
+	1, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 1, 0, 1, 0, 0,
+	0, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 45
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 46
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 47
+	0, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	0, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	// block 48
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, 1, 0, 1, 0, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 0, 1, 0, -35332, 1, 0,
+	// block 49
+	1, 0, 1, 0, 1, 0, 1, 0,
+	0, 0, 0, 1, 0, -42280, 0, 0,
+	1, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 50
+	1, 0, 1, 0, 1, 0, 1, 0,
+	1, 0, -42308, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	// block 51
+	40, 40, 40, 40, 40, 40, 40, 40,
+	40, 40, 40, 40, 40, 40, 40, 40,
+	40, 40, 40, 40, 40, 40, 40, 40,
+	40, 40, 40, 40, 40, 40, 40, 40,
+	// block 52
+	40, 40, 40, 40, 40, 40, 40, 40,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const int norm_props_shift = 5;
+const rune norm_props_max = 0x2FA20;
+const uint8 norm_props_index[norm_props_max >> norm_props_shift] = {
+	0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 0, 8, 9, 10,
+	11, 12, 0, 0, 0, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+	24, 25, 26, 27, 28, 0, 29, 30, 0, 0, 0, 0, 31, 32, 33, 0,
+	34, 35, 36, 37, 0, 0, 38, 39, 40, 41, 42, 0, 0, 0, 0, 43,
+	44, 45, 46, 0, 0, 0, 0, 47, 0, 48, 49, 0, 0, 50, 51, 0,
+	0, 52, 53, 0, 0, 54, 55, 0, 0, 50, 56, 0, 57, 58, 59, 0,
+	0, 0, 60, 0, 0, 54, 61, 0, 0, 58, 59, 0, 0, 0, 62, 0,
+	0, 63, 64, 0, 0, 65, 66, 0, 67, 68, 69, 70, 71, 72, 73, 0,
+	0, 74, 0, 0, 75, 0, 0, 76, 0, 0, 0, 77, 0, 78, 79, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 81, 81, 0, 0, 0, 0, 82, 0,
+	0, 0, 0, 0, 0, 83, 0, 0, 0, 84, 0, 0, 0, 0, 0, 0,
+	85, 0, 0, 86, 0, 0, 0, 0, 87, 88, 89, 90, 0, 91, 0, 92,
+	0, 93, 0, 0, 0, 0, 94, 95, 0, 96, 97, 98, 99, 100, 101, 102,
+	103, 103, 103, 103, 104, 103, 103, 105, 106, 103, 107, 108, 103, 109, 110, 111,
+	112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 100, 123, 124, 125, 0,
+	126, 127, 128, 129, 130, 131, 0, 132, 0, 133, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 100, 100, 100, 100, 134, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	135, 0, 0, 136, 0, 0, 137, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 138, 0, 0, 0, 139, 0, 0, 0, 140, 0, 0, 0, 141,
+	0, 0, 0, 0, 142, 0, 0, 143, 100, 100, 100, 100, 100, 100, 144, 0,
+	145, 146, 147, 148, 149, 147, 148, 150, 0, 151, 100, 100, 152, 0, 0, 0,
+	153, 100, 154, 153, 100, 100, 100, 153, 100, 100, 100, 100, 100, 100, 100, 100,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 155, 156, 0, 0, 157, 0, 0, 0, 158, 0, 0, 0, 159,
+	160, 0, 0, 0, 0, 0, 161, 162, 0, 163, 164, 0, 0, 165, 166, 0,
+	0, 0, 0, 0, 0, 167, 168, 169, 0, 0, 0, 0, 0, 0, 0, 55,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 170, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 171, 171, 171, 171, 171, 171, 171, 171,
+	172, 173, 171, 174, 171, 171, 175, 0, 176, 177, 178, 100, 100, 179, 180, 100,
+	100, 100, 100, 100, 100, 100, 100, 100, 100, 181, 182, 100, 183, 100, 184, 185,
+	186, 187, 188, 189, 100, 100, 100, 190, 191, 100, 100, 100, 100, 153, 192, 193,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 194,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	195, 196, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 160, 0, 197, 198, 0, 0, 199, 200, 0, 0, 0, 0, 166, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 202, 203, 204, 205, 206, 0,
+	0, 0, 207, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	100, 100, 208, 100, 209, 210, 211, 100, 212, 213, 214, 100, 100, 100, 100, 100,
+	100, 100, 100, 100, 100, 215, 100, 100, 100, 100, 100, 100, 100, 100, 216, 100,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	211, 217, 218, 219, 220, 221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 222, 223, 224, 225, 158, 0, 0, 0,
+	226, 227, 228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+	229,
+};
+const uint16 norm_props_block[] = {
+	// block 0
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 1
+	0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0000, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A00,
+	0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0000,
+	// block 2
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000,
+	0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000,
+	// block 3
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000,
+	0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0300,
+	// block 4
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	// block 5
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0000, 0x0A00, 0x0A00, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0A00,
+	// block 6
+	0x0A00, 0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0A00, 0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	// block 7
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0A00,
+	// block 8
+	0x0300, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300,
+	0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 9
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0300, 0x0300,
+	// block 10
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0A00, 0x0A00, 0x0A00, 0x0300, 0x0300, 0x0000, 0x0000,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	// block 11
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000, 0x0300, 0x0300,
+	// block 12
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 13
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 14
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000,
+	// block 15
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 16
+	0x10E6, 0x10E6, 0x10E6, 0x10E6, 0x10E6, 0x00E6, 0x10E6, 0x10E6,
+	0x10E6, 0x10E6, 0x10E6, 0x10E6, 0x10E6, 0x00E6, 0x00E6, 0x10E6,
+	0x00E6, 0x10E6, 0x00E6, 0x10E6, 0x10E6, 0x00E8, 0x00DC, 0x00DC,
+	0x00DC, 0x00DC, 0x00E8, 0x10D8, 0x00DC, 0x00DC, 0x00DC, 0x00DC,
+	// block 17
+	0x00DC, 0x00CA, 0x00CA, 0x10DC, 0x10DC, 0x10DC, 0x10DC, 0x10CA,
+	0x10CA, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x10DC, 0x10DC, 0x00DC,
+	0x10DC, 0x10DC, 0x00DC, 0x00DC, 0x0001, 0x0001, 0x0001, 0x0001,
+	0x1001, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00E6, 0x00E6, 0x00E6,
+	// block 18
+	0x0FE6, 0x0FE6, 0x10E6, 0x0FE6, 0x0FE6, 0x10F0, 0x00E6, 0x00DC,
+	0x00DC, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x0000,
+	0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00E6,
+	0x00E8, 0x00DC, 0x00DC, 0x00E6, 0x00E9, 0x00EA, 0x00EA, 0x00E9,
+	// block 19
+	0x00EA, 0x00EA, 0x00E9, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0F00, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0F00, 0x0000,
+	// block 20
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0B00, 0x0300, 0x0F00,
+	0x0300, 0x0300, 0x0300, 0x0000, 0x0300, 0x0000, 0x0300, 0x0300,
+	0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 21
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 22
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0B00, 0x0B00, 0x0A00, 0x0A00, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 23
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0000, 0x0000,
+	0x0000, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 24
+	0x0300, 0x0300, 0x0000, 0x0300, 0x0000, 0x0000, 0x0000, 0x0300,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 25
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 26
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0300, 0x0300, 0x0000, 0x0300, 0x0000, 0x0000, 0x0000, 0x0300,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0000,
+	// block 27
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0300,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 28
+	0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 29
+	0x0000, 0x0300, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000, 0x0300, 0x0300,
+	0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	// block 30
+	0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000,
+	0x0300, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 31
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A00,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00E6,
+	0x00E6, 0x00E6, 0x00DE, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	// block 32
+	0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC,
+	0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00DE, 0x00E4, 0x00E6,
+	0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011,
+	0x0012, 0x0013, 0x0013, 0x0014, 0x0015, 0x0016, 0x0000, 0x0017,
+	// block 33
+	0x0000, 0x0018, 0x0019, 0x0000, 0x00E6, 0x00DC, 0x0000, 0x0012,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 34
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	0x001E, 0x001F, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 35
+	0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 36
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x10E6, 0x10E6, 0x10DC, 0x00DC, 0x00E6,
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00DC,
+	// block 37
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0023, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 38
+	0x0300, 0x0000, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0300, 0x0000, 0x0000, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x00E6,
+	// block 39
+	0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x0000, 0x0000, 0x00E6,
+	0x00E6, 0x0000, 0x00DC, 0x00E6, 0x00E6, 0x00DC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 40
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 41
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00DC,
+	0x00DC, 0x00DC, 0x00E6, 0x00DC, 0x00DC, 0x00E6, 0x00DC, 0x00E6,
+	// block 42
+	0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00DC, 0x00E6, 0x00DC, 0x00E6,
+	0x00DC, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 43
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 44
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	// block 45
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x00E6, 0x00E6, 0x00E6,
+	0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 46
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x00DC, 0x00DC, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 47
+	0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00DC, 0x00E6,
+	0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x00DC,
+	0x001B, 0x001C, 0x001D, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00E6,
+	0x00E6, 0x00DC, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000,
+	// block 48
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0300, 0x0000, 0x0000, 0x0300, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1007, 0x0000, 0x0000, 0x0000,
+	// block 49
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000,
+	0x0000, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	// block 50
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x1000, 0x0000,
+	// block 51
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0300, 0x0300, 0x0009, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0F00, 0x0F00, 0x0000, 0x0F00,
+	// block 52
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0F00, 0x0000, 0x0000, 0x0F00, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000,
+	// block 53
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0F00, 0x0F00, 0x0F00, 0x0000, 0x0000, 0x0F00, 0x0000,
+	// block 54
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000,
+	// block 55
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 56
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0300, 0x0000, 0x0000, 0x0300, 0x0300, 0x0009, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0F00, 0x0F00, 0x0000, 0x0000,
+	// block 57
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 58
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000,
+	// block 59
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0009, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 60
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x105B, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 61
+	0x0300, 0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300,
+	0x0300, 0x0000, 0x0300, 0x0300, 0x0000, 0x0009, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 62
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x1009, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0300, 0x0000, 0x0300, 0x0300, 0x0300, 0x1000,
+	// block 63
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0067, 0x0067, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 64
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x006B, 0x006B, 0x006B, 0x006B, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 65
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0076, 0x0076, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 66
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x007A, 0x007A, 0x007A, 0x007A, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0000, 0x0000,
+	// block 67
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x00DC, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 68
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x0000, 0x00DC,
+	0x0000, 0x00D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 69
+	0x0000, 0x0000, 0x0000, 0x0F00, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F00, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0F00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F00,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0F00, 0x0000, 0x0000, 0x0000,
+	// block 70
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0F00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0081, 0x0082, 0x0F00, 0x0084, 0x0F00, 0x0F00, 0x0A00,
+	0x0F00, 0x0A00, 0x0082, 0x0082, 0x0082, 0x0082, 0x0000, 0x0000,
+	// block 71
+	0x0082, 0x0F00, 0x00E6, 0x00E6, 0x0009, 0x0000, 0x00E6, 0x00E6,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0F00, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F00, 0x0000, 0x0000,
+	// block 72
+	0x0000, 0x0000, 0x0F00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F00,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0F00, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0F00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 73
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 74
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007,
+	0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 75
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 76
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0000, 0x0000, 0x0000,
+	// block 77
+	0x0000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+	0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+	0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 78
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+	0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+	0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+	// block 79
+	0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 80
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6,
+	// block 81
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 82
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x0000, 0x0000,
+	// block 83
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x00E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 84
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x00DE, 0x00E6, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 85
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6,
+	0x00DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 86
+	0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x00DC,
+	// block 87
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0000,
+	0x0300, 0x0000, 0x0300, 0x0000, 0x0300, 0x0000, 0x0300, 0x0000,
+	0x0000, 0x0000, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 88
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x1000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0300, 0x0000, 0x0300, 0x0000, 0x0000,
+	// block 89
+	0x0300, 0x0300, 0x0000, 0x0300, 0x0009, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 90
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 91
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 92
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 93
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 94
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0001, 0x00DC, 0x00DC, 0x00DC,
+	0x00DC, 0x00DC, 0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x00DC, 0x00DC,
+	// block 95
+	0x00E6, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+	0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 96
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 97
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 98
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 99
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 100
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 101
+	0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00EA, 0x00D6, 0x00DC,
+	0x00CA, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	// block 102
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x00E9, 0x00DC, 0x00E6, 0x00DC,
+	// block 103
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	// block 104
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0A00, 0x0B00, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 105
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 106
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000,
+	// block 107
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0000, 0x0300, 0x0000, 0x0300, 0x0000, 0x0300, 0x0000, 0x0300,
+	// block 108
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0F00, 0x0300, 0x0F00, 0x0300, 0x0F00, 0x0300, 0x0F00,
+	0x0300, 0x0F00, 0x0300, 0x0F00, 0x0300, 0x0F00, 0x0000, 0x0000,
+	// block 109
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0F00, 0x0300, 0x0A00, 0x0F00, 0x0A00,
+	// block 110
+	0x0A00, 0x0B00, 0x0300, 0x0300, 0x0300, 0x0000, 0x0300, 0x0300,
+	0x0300, 0x0F00, 0x0300, 0x0F00, 0x0300, 0x0B00, 0x0B00, 0x0B00,
+	0x0300, 0x0300, 0x0300, 0x0F00, 0x0000, 0x0000, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0F00, 0x0000, 0x0B00, 0x0B00, 0x0B00,
+	// block 111
+	0x0300, 0x0300, 0x0300, 0x0F00, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0F00, 0x0300, 0x0B00, 0x0F00, 0x0F00,
+	0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0000, 0x0300, 0x0300,
+	0x0300, 0x0F00, 0x0300, 0x0F00, 0x0300, 0x0F00, 0x0A00, 0x0000,
+	// block 112
+	0x0F00, 0x0F00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A00,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 113
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A00,
+	0x0000, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0000, 0x0A00, 0x0000,
+	// block 114
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A00,
+	0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A00,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A00,
+	// block 115
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 116
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000,
+	// block 117
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 118
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x00E6, 0x00E6, 0x0001, 0x0001, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	0x0001, 0x0001, 0x0001, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000,
+	// block 119
+	0x0000, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x00E6,
+	0x00DC, 0x00E6, 0x0001, 0x0001, 0x00DC, 0x00DC, 0x00DC, 0x00DC,
+	0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 120
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00,
+	0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0000,
+	0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000,
+	// block 121
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0000, 0x0F00, 0x0000,
+	0x0A00, 0x0000, 0x0F00, 0x0F00, 0x0A00, 0x0A00, 0x0000, 0x0A00,
+	0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 122
+	0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 123
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0300, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 124
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 125
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0300, 0x0300,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 126
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0300, 0x0000, 0x0000, 0x0300, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 127
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0000, 0x0300, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0000, 0x0A00,
+	0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 128
+	0x0000, 0x0300, 0x0000, 0x0000, 0x0300, 0x0000, 0x0000, 0x0300,
+	0x0000, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 129
+	0x0300, 0x0000, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0000, 0x0000, 0x0300, 0x0300, 0x0000, 0x0000,
+	0x0300, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 130
+	0x0300, 0x0300, 0x0000, 0x0000, 0x0300, 0x0300, 0x0000, 0x0000,
+	0x0300, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 131
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 132
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 133
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0F00, 0x0F00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 134
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 135
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 136
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 137
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0F00, 0x0000, 0x0000, 0x0000,
+	// block 138
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0000, 0x0000,
+	// block 139
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6,
+	0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 140
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A00,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009,
+	// block 141
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	// block 142
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A00,
+	// block 143
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 144
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 145
+	0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 146
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x00DA, 0x00E4, 0x00E8, 0x00DE, 0x00E0, 0x00E0,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A00, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 147
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0000, 0x0300, 0x0000,
+	0x0300, 0x0000, 0x0300, 0x0000, 0x0300, 0x0000, 0x0300, 0x0000,
+	0x0300, 0x0000, 0x0300, 0x0000, 0x0300, 0x0000, 0x0300, 0x0000,
+	// block 148
+	0x0300, 0x0000, 0x0300, 0x0000, 0x0000, 0x0300, 0x0000, 0x0300,
+	0x0000, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0300, 0x0300, 0x0000, 0x0300, 0x0300, 0x0000, 0x0300, 0x0300,
+	0x0000, 0x0300, 0x0300, 0x0000, 0x0300, 0x0300, 0x0000, 0x0000,
+	// block 149
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x1008, 0x1008, 0x0A00, 0x0A00, 0x0000, 0x0300, 0x0A00,
+	// block 150
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0000, 0x0000, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0000, 0x0000, 0x0000, 0x0300, 0x0A00,
+	// block 151
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 152
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000,
+	0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 153
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000,
+	// block 154
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 155
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000,
+	// block 156
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6,
+	// block 157
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 158
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 159
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 160
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 161
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 162
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 163
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x00DC, 0x00DC, 0x00DC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 164
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 165
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 166
+	0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 167
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x00E6, 0x0000, 0x00E6, 0x00E6, 0x00DC, 0x0000, 0x0000, 0x00E6,
+	0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6,
+	// block 168
+	0x0000, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 169
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 170
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 171
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	// block 172
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0000, 0x0000,
+	0x0F00, 0x0000, 0x0F00, 0x0000, 0x0000, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0000,
+	// block 173
+	0x0F00, 0x0000, 0x0F00, 0x0000, 0x0000, 0x0F00, 0x0F00, 0x0000,
+	0x0000, 0x0000, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	// block 174
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0000, 0x0000,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	// block 175
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 176
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F00, 0x001A, 0x0F00,
+	// block 177
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0000,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0000, 0x0F00, 0x0000,
+	// block 178
+	0x0F00, 0x0F00, 0x0000, 0x0F00, 0x0F00, 0x0000, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 179
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 180
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 181
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000,
+	// block 182
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 183
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 184
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 185
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000,
+	// block 186
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 187
+	0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 188
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 189
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0000, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 190
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000,
+	// block 191
+	0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 192
+	0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000,
+	// block 193
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 194
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x0000, 0x0000,
+	// block 195
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x0000, 0x00E6,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 196
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x00E6, 0x0001, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009,
+	// block 197
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0300, 0x0000, 0x0300, 0x0000, 0x0000, 0x0000,
+	// block 198
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0009, 0x1007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 199
+	0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 200
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0300,
+	0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 201
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0007,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 202
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F00, 0x0F00,
+	// block 203
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x00D8, 0x00D8, 0x0001,
+	0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x00E2, 0x00D8, 0x00D8,
+	0x00D8, 0x00D8, 0x00D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC,
+	// block 204
+	0x00DC, 0x00DC, 0x00DC, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6,
+	0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 205
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	// block 206
+	0x0F00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 207
+	0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 208
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 209
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00,
+	// block 210
+	0x0000, 0x0000, 0x0A00, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0000,
+	0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00,
+	// block 211
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 212
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00,
+	// block 213
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000,
+	// block 214
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0000,
+	0x0000, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 215
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 216
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 217
+	0x0000, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0000, 0x0000, 0x0A00,
+	0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0000, 0x0A00, 0x0000, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 218
+	0x0000, 0x0000, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A00,
+	0x0000, 0x0A00, 0x0000, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00,
+	0x0000, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0000, 0x0000, 0x0A00,
+	0x0000, 0x0A00, 0x0000, 0x0A00, 0x0000, 0x0A00, 0x0000, 0x0A00,
+	// block 219
+	0x0000, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0000, 0x0000, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0000,
+	// block 220
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 221
+	0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0000, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 222
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 223
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 224
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 225
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 226
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	// block 227
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 228
+	0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+	0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	// block 229
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00,
+	0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0F00, 0x0000, 0x0000,
+};
+
+const decomposition _canonical_decompositions[] = {
+	{0x00C0, 0, 2},
+	{0x00C1, 2, 2},
+	{0x00C2, 4, 2},
+	{0x00C3, 6, 2},
+	{0x00C4, 8, 2},
+	{0x00C5, 10, 2},
+	{0x00C7, 12, 2},
+	{0x00C8, 14, 2},
+	{0x00C9, 16, 2},
+	{0x00CA, 18, 2},
+	{0x00CB, 20, 2},
+	{0x00CC, 22, 2},
+	{0x00CD, 24, 2},
+	{0x00CE, 26, 2},
+	{0x00CF, 28, 2},
+	{0x00D1, 30, 2},
+	{0x00D2, 32, 2},
+	{0x00D3, 34, 2},
+	{0x00D4, 36, 2},
+	{0x00D5, 38, 2},
+	{0x00D6, 40, 2},
+	{0x00D9, 42, 2},
+	{0x00DA, 44, 2},
+	{0x00DB, 46, 2},
+	{0x00DC, 48, 2},
+	{0x00DD, 50, 2},
+	{0x00E0, 52, 2},
+	{0x00E1, 54, 2},
+	{0x00E2, 56, 2},
+	{0x00E3, 58, 2},
+	{0x00E4, 60, 2},
+	{0x00E5, 62, 2},
+	{0x00E7, 64, 2},
+	{0x00E8, 66, 2},
+	{0x00E9, 68, 2},
+	{0x00EA, 70, 2},
+	{0x00EB, 72, 2},
+	{0x00EC, 74, 2},
+	{0x00ED, 76, 2},
+	{0x00EE, 78, 2},
+	{0x00EF, 80, 2},
+	{0x00F1, 82, 2},
+	{0x00F2, 84, 2},
+	{0x00F3, 86, 2},
+	{0x00F4, 88, 2},
+	{0x00F5, 90, 2},
+	{0x00F6, 92, 2},
+	{0x00F9, 94, 2},
+	{0x00FA, 96, 2},
+	{0x00FB, 98, 2},
+	{0x00FC, 100, 2},
+	{0x00FD, 102, 2},
+	{0x00FF, 104, 2},
+	{0x0100, 106, 2},
+	{0x0101, 108, 2},
+	{0x0102, 110, 2},
+	{0x0103, 112, 2},
+	{0x0104, 114, 2},
+	{0x0105, 116, 2},
+	{0x0106, 118, 2},
+	{0x0107, 120, 2},
+	{0x0108, 122, 2},
+	{0x0109, 124, 2},
+	{0x010A, 126, 2},
+	{0x010B, 128, 2},
+	{0x010C, 130, 2},
+	{0x010D, 132, 2},
+	{0x010E, 134, 2},
+	{0x010F, 136, 2},
+	{0x0112, 138, 2},
+	{0x0113, 140, 2},
+	{0x0114, 142, 2},
+	{0x0115, 144, 2},
+	{0x0116, 146, 2},
+	{0x0117, 148, 2},
+	{0x0118, 150, 2},
+	{0x0119, 152, 2},
+	{0x011A, 154, 2},
+	{0x011B, 156, 2},
+	{0x011C, 158, 2},
+	{0x011D, 160, 2},
+	{0x011E, 162, 2},
+	{0x011F, 164, 2},
+	{0x0120, 166, 2},
+	{0x0121, 168, 2},
+	{0x0122, 170, 2},
+	{0x0123, 172, 2},
+	{0x0124, 174, 2},
+	{0x0125, 176, 2},
+	{0x0128, 178, 2},
+	{0x0129, 180, 2},
+	{0x012A, 182, 2},
+	{0x012B, 184, 2},
+	{0x012C, 186, 2},
+	{0x012D, 188, 2},
+	{0x012E, 190, 2},
+	{0x012F, 192, 2},
+	{0x0130, 194, 2},
+	{0x0134, 196, 2},
+	{0x0135, 198, 2},
+	{0x0136, 200, 2},
+	{0x0137, 202, 2},
+	{0x0139, 204, 2},
+	{0x013A, 206, 2},
+	{0x013B, 208, 2},
+	{0x013C, 210, 2},
+	{0x013D, 212, 2},
+	{0x013E, 214, 2},
+	{0x0143, 216, 2},
+	{0x0144, 218, 2},
+	{0x0145, 220, 2},
+	{0x0146, 222, 2},
+	{0x0147, 224, 2},
+	{0x0148, 226, 2},
+	{0x014C, 228, 2},
+	{0x014D, 230, 2},
+	{0x014E, 232, 2},
+	{0x014F, 234, 2},
+	{0x0150, 236, 2},
+	{0x0151, 238, 2},
+	{0x0154, 240, 2},
+	{0x0155, 242, 2},
+	{0x0156, 244, 2},
+	{0x0157, 246, 2},
+	{0x0158, 248, 2},
+	{0x0159, 250, 2},
+	{0x015A, 252, 2},
+	{0x015B, 254, 2},
+	{0x015C, 256, 2},
+	{0x015D, 258, 2},
+	{0x015E, 260, 2},
+	{0x015F, 262, 2},
+	{0x0160, 264, 2},
+	{0x0161, 266, 2},
+	{0x0162, 268, 2},
+	{0x0163, 270, 2},
+	{0x0164, 272, 2},
+	{0x0165, 274, 2},
+	{0x0168, 276, 2},
+	{0x0169, 278, 2},
+	{0x016A, 280, 2},
+	{0x016B, 282, 2},
+	{0x016C, 284, 2},
+	{0x016D, 286, 2},
+	{0x016E, 288, 2},
+	{0x016F, 290, 2},
+	{0x0170, 292, 2},
+	{0x0171, 294, 2},
+	{0x0172, 296, 2},
+	{0x0173, 298, 2},
+	{0x0174, 300, 2},
+	{0x0175, 302, 2},
+	{0x0176, 304, 2},
+	{0x0177, 306, 2},
+	{0x0178, 308, 2},
+	{0x0179, 310, 2},
+	{0x017A, 312, 2},
+	{0x017B, 314, 2},
+	{0x017C, 316, 2},
+	{0x017D, 318, 2},
+	{0x017E, 320, 2},
+	{0x01A0, 322, 2},
+	{0x01A1, 324, 2},
+	{0x01AF, 326, 2},
+	{0x01B0, 328, 2},
+	{0x01CD, 330, 2},
+	{0x01CE, 332, 2},
+	{0x01CF, 334, 2},
+	{0x01D0, 336, 2},
+	{0x01D1, 338, 2},
+	{0x01D2, 340, 2},
+	{0x01D3, 342, 2},
+	{0x01D4, 344, 2},
+	{0x01D5, 346, 3},
+	{0x01D6, 349, 3},
+	{0x01D7, 352, 3},
+	{0x01D8, 355, 3},
+	{0x01D9, 358, 3},
+	{0x01DA, 361, 3},
+	{0x01DB, 364, 3},
+	{0x01DC, 367, 3},
+	{0x01DE, 370, 3},
+	{0x01DF, 373, 3},
+	{0x01E0, 376, 3},
+	{0x01E1, 379, 3},
+	{0x01E2, 382, 2},
+	{0x01E3, 384, 2},
+	{0x01E6, 386, 2},
+	{0x01E7, 388, 2},
+	{0x01E8, 390, 2},
+	{0x01E9, 392, 2},
+	{0x01EA, 394, 2},
+	{0x01EB, 396, 2},
+	{0x01EC, 398, 3},
+	{0x01ED, 401, 3},
+	{0x01EE, 404, 2},
+	{0x01EF, 406, 2},
+	{0x01F0, 408, 2},
+	{0x01F4, 410, 2},
+	{0x01F5, 412, 2},
+	{0x01F8, 414, 2},
+	{0x01F9, 416, 2},
+	{0x01FA, 418, 3},
+	{0x01FB, 421, 3},
+	{0x01FC, 424, 2},
+	{0x01FD, 426, 2},
+	{0x01FE, 428, 2},
+	{0x01FF, 430, 2},
+	{0x0200, 432, 2},
+	{0x0201, 434, 2},
+	{0x0202, 436, 2},
+	{0x0203, 438, 2},
+	{0x0204, 440, 2},
+	{0x0205, 442, 2},
+	{0x0206, 444, 2},
+	{0x0207, 446, 2},
+	{0x0208, 448, 2},
+	{0x0209, 450, 2},
+	{0x020A, 452, 2},
+	{0x020B, 454, 2},
+	{0x020C, 456, 2},
+	{0x020D, 458, 2},
+	{0x020E, 460, 2},
+	{0x020F, 462, 2},
+	{0x0210, 464, 2},
+	{0x0211, 466, 2},
+	{0x0212, 468, 2},
+	{0x0213, 470, 2},
+	{0x0214, 472, 2},
+	{0x0215, 474, 2},
+	{0x0216, 476, 2},
+	{0x0217, 478, 2},
+	{0x0218, 480, 2},
+	{0x0219, 482, 2},
+	{0x021A, 484, 2},
+	{0x021B, 486, 2},
+	{0x021E, 488, 2},
+	{0x021F, 490, 2},
+	{0x0226, 492, 2},
+	{0x0227, 494, 2},
+	{0x0228, 496, 2},
+	{0x0229, 498, 2},
+	{0x022A, 500, 3},
+	{0x022B, 503, 3},
+	{0x022C, 506, 3},
+	{0x022D, 509, 3},
+	{0x022E, 512, 2},
+	{0x022F, 514, 2},
+	{0x0230, 516, 3},
+	{0x0231, 519, 3},
+	{0x0232, 522, 2},
+	{0x0233, 524, 2},
+	{0x0340, 526, 1},
+	{0x0341, 527, 1},
+	{0x0343, 528, 1},
+	{0x0344, 529, 2},
+	{0x0374, 531, 1},
+	{0x037E, 532, 1},
+	{0x0385, 533, 2},
+	{0x0386, 535, 2},
+	{0x0387, 537, 1},
+	{0x0388, 538, 2},
+	{0x0389, 540, 2},
+	{0x038A, 542, 2},
+	{0x038C, 544, 2},
+	{0x038E, 546, 2},
+	{0x038F, 548, 2},
+	{0x0390, 550, 3},
+	{0x03AA, 553, 2},
+	{0x03AB, 555, 2},
+	{0x03AC, 557, 2},
+	{0x03AD, 559, 2},
+	{0x03AE, 561, 2},
+	{0x03AF, 563, 2},
+	{0x03B0, 565, 3},
+	{0x03CA, 568, 2},
+	{0x03CB, 570, 2},
+	{0x03CC, 572, 2},
+	{0x03CD, 574, 2},
+	{0x03CE, 576, 2},
+	{0x03D3, 578, 2},
+	{0x03D4, 580, 2},
+	{0x0400, 582, 2},
+	{0x0401, 584, 2},
+	{0x0403, 586, 2},
+	{0x0407, 588, 2},
+	{0x040C, 590, 2},
+	{0x040D, 592, 2},
+	{0x040E, 594, 2},
+	{0x0419, 596, 2},
+	{0x0439, 598, 2},
+	{0x0450, 600, 2},
+	{0x0451, 602, 2},
+	{0x0453, 604, 2},
+	{0x0457, 606, 2},
+	{0x045C, 608, 2},
+	{0x045D, 610, 2},
+	{0x045E, 612, 2},
+	{0x0476, 614, 2},
+	{0x0477, 616, 2},
+	{0x04C1, 618, 2},
+	{0x04C2, 620, 2},
+	{0x04D0, 622, 2},
+	{0x04D1, 624, 2},
+	{0x04D2, 626, 2},
+	{0x04D3, 628, 2},
+	{0x04D6, 630, 2},
+	{0x04D7, 632, 2},
+	{0x04DA, 634, 2},
+	{0x04DB, 636, 2},
+	{0x04DC, 638, 2},
+	{0x04DD, 640, 2},
+	{0x04DE, 642, 2},
+	{0x04DF, 644, 2},
+	{0x04E2, 646, 2},
+	{0x04E3, 648, 2},
+	{0x04E4, 650, 2},
+	{0x04E5, 652, 2},
+	{0x04E6, 654, 2},
+	{0x04E7, 656, 2},
+	{0x04EA, 658, 2},
+	{0x04EB, 660, 2},
+	{0x04EC, 662, 2},
+	{0x04ED, 664, 2},
+	{0x04EE, 666, 2},
+	{0x04EF, 668, 2},
+	{0x04F0, 670, 2},
+	{0x04F1, 672, 2},
+	{0x04F2, 674, 2},
+	{0x04F3, 676, 2},
+	{0x04F4, 678, 2},
+	{0x04F5, 680, 2},
+	{0x04F8, 682, 2},
+	{0x04F9, 684, 2},
+	{0x0622, 686, 2},
+	{0x0623, 688, 2},
+	{0x0624, 690, 2},
+	{0x0625, 692, 2},
+	{0x0626, 694, 2},
+	{0x06C0, 696, 2},
+	{0x06C2, 698, 2},
+	{0x06D3, 700, 2},
+	{0x0929, 702, 2},
+	{0x0931, 704, 2},
+	{0x0934, 706, 2},
+	{0x0958, 708, 2},
+	{0x0959, 710, 2},
+	{0x095A, 712, 2},
+	{0x095B, 714, 2},
+	{0x095C, 716, 2},
+	{0x095D, 718, 2},
+	{0x095E, 720, 2},
+	{0x095F, 722, 2},
+	{0x09CB, 724, 2},
+	{0x09CC, 726, 2},
+	{0x09DC, 728, 2},
+	{0x09DD, 730, 2},
+	{0x09DF, 732, 2},
+	{0x0A33, 734, 2},
+	{0x0A36, 736, 2},
+	{0x0A59, 738, 2},
+	{0x0A5A, 740, 2},
+	{0x0A5B, 742, 2},
+	{0x0A5E, 744, 2},
+	{0x0B48, 746, 2},
+	{0x0B4B, 748, 2},
+	{0x0B4C, 750, 2},
+	{0x0B5C, 752, 2},
+	{0x0B5D, 754, 2},
+	{0x0B94, 756, 2},
+	{0x0BCA, 758, 2},
+	{0x0BCB, 760, 2},
+	{0x0BCC, 762, 2},
+	{0x0C48, 764, 2},
+	{0x0CC0, 766, 2},
+	{0x0CC7, 768, 2},
+	{0x0CC8, 770, 2},
+	{0x0CCA, 772, 2},
+	{0x0CCB, 774, 3},
+	{0x0D4A, 777, 2},
+	{0x0D4B, 779, 2},
+	{0x0D4C, 781, 2},
+	{0x0DDA, 783, 2},
+	{0x0DDC, 785, 2},
+	{0x0DDD, 787, 3},
+	{0x0DDE, 790, 2},
+	{0x0F43, 792, 2},
+	{0x0F4D, 794, 2},
+	{0x0F52, 796, 2},
+	{0x0F57, 798, 2},
+	{0x0F5C, 800, 2},
+	{0x0F69, 802, 2},
+	{0x0F73, 804, 2},
+	{0x0F75, 806, 2},
+	{0x0F76, 808, 2},
+	{0x0F78, 810, 2},
+	{0x0F81, 812, 2},
+	{0x0F93, 814, 2},
+	{0x0F9D, 816, 2},
+	{0x0FA2, 818, 2},
+	{0x0FA7, 820, 2},
+	{0x0FAC, 822, 2},
+	{0x0FB9, 824, 2},
+	{0x1026, 826, 2},
+	{0x1B06, 828, 2},
+	{0x1B08, 830, 2},
+	{0x1B0A, 832, 2},
+	{0x1B0C, 834, 2},
+	{0x1B0E, 836, 2},
+	{0x1B12, 838, 2},
+	{0x1B3B, 840, 2},
+	{0x1B3D, 842, 2},
+	{0x1B40, 844, 2},
+	{0x1B41, 846, 2},
+	{0x1B43, 848, 2},
+	{0x1E00, 850, 2},
+	{0x1E01, 852, 2},
+	{0x1E02, 854, 2},
+	{0x1E03, 856, 2},
+	{0x1E04, 858, 2},
+	{0x1E05, 860, 2},
+	{0x1E06, 862, 2},
+	{0x1E07, 864, 2},
+	{0x1E08, 866, 3},
+	{0x1E09, 869, 3},
+	{0x1E0A, 872, 2},
+	{0x1E0B, 874, 2},
+	{0x1E0C, 876, 2},
+	{0x1E0D, 878, 2},
+	{0x1E0E, 880, 2},
+	{0x1E0F, 882, 2},
+	{0x1E10, 884, 2},
+	{0x1E11, 886, 2},
+	{0x1E12, 888, 2},
+	{0x1E13, 890, 2},
+	{0x1E14, 892, 3},
+	{0x1E15, 895, 3},
+	{0x1E16, 898, 3},
+	{0x1E17, 901, 3},
+	{0x1E18, 904, 2},
+	{0x1E19, 906, 2},
+	{0x1E1A, 908, 2},
+	{0x1E1B, 910, 2},
+	{0x1E1C, 912, 3},
+	{0x1E1D, 915, 3},
+	{0x1E1E, 918, 2},
+	{0x1E1F, 920, 2},
+	{0x1E20, 922, 2},
+	{0x1E21, 924, 2},
+	{0x1E22, 926, 2},
+	{0x1E23, 928, 2},
+	{0x1E24, 930, 2},
+	{0x1E25, 932, 2},
+	{0x1E26, 934, 2},
+	{0x1E27, 936, 2},
+	{0x1E28, 938, 2},
+	{0x1E29, 940, 2},
+	{0x1E2A, 942, 2},
+	{0x1E2B, 944, 2},
+	{0x1E2C, 946, 2},
+	{0x1E2D, 948, 2},
+	{0x1E2E, 950, 3},
+	{0x1E2F, 953, 3},
+	{0x1E30, 956, 2},
+	{0x1E31, 958, 2},
+	{0x1E32, 960, 2},
+	{0x1E33, 962, 2},
+	{0x1E34, 964, 2},
+	{0x1E35, 966, 2},
+	{0x1E36, 968, 2},
+	{0x1E37, 970, 2},
+	{0x1E38, 972, 3},
+	{0x1E39, 975, 3},
+	{0x1E3A, 978, 2},
+	{0x1E3B, 980, 2},
+	{0x1E3C, 982, 2},
+	{0x1E3D, 984, 2},
+	{0x1E3E, 986, 2},
+	{0x1E3F, 988, 2},
+	{0x1E40, 990, 2},
+	{0x1E41, 992, 2},
+	{0x1E42, 994, 2},
+	{0x1E43, 996, 2},
+	{0x1E44, 998, 2},
+	{0x1E45, 1000, 2},
+	{0x1E46, 1002, 2},
+	{0x1E47, 1004, 2},
+	{0x1E48, 1006, 2},
+	{0x1E49, 1008, 2},
+	{0x1E4A, 1010, 2},
+	{0x1E4B, 1012, 2},
+	{0x1E4C, 1014, 3},
+	{0x1E4D, 1017, 3},
+	{0x1E4E, 1020, 3},
+	{0x1E4F, 1023, 3},
+	{0x1E50, 1026, 3},
+	{0x1E51, 1029, 3},
+	{0x1E52, 1032, 3},
+	{0x1E53, 1035, 3},
+	{0x1E54, 1038, 2},
+	{0x1E55, 1040, 2},
+	{0x1E56, 1042, 2},
+	{0x1E57, 1044, 2},
+	{0x1E58, 1046, 2},
+	{0x1E59, 1048, 2},
+	{0x1E5A, 1050, 2},
+	{0x1E5B, 1052, 2},
+	{0x1E5C, 1054, 3},
+	{0x1E5D, 1057, 3},
+	{0x1E5E, 1060, 2},
+	{0x1E5F, 1062, 2},
+	{0x1E60, 1064, 2},
+	{0x1E61, 1066, 2},
+	{0x1E62, 1068, 2},
+	{0x1E63, 1070, 2},
+	{0x1E64, 1072, 3},
+	{0x1E65, 1075, 3},
+	{0x1E66, 1078, 3},
+	{0x1E67, 1081, 3},
+	{0x1E68, 1084, 3},
+	{0x1E69, 1087, 3},
+	{0x1E6A, 1090, 2},
+	{0x1E6B, 1092, 2},
+	{0x1E6C, 1094, 2},
+	{0x1E6D, 1096, 2},
+	{0x1E6E, 1098, 2},
+	{0x1E6F, 1100, 2},
+	{0x1E70, 1102, 2},
+	{0x1E71, 1104, 2},
+	{0x1E72, 1106, 2},
+	{0x1E73, 1108, 2},
+	{0x1E74, 1110, 2},
+	{0x1E75, 1112, 2},
+	{0x1E76, 1114, 2},
+	{0x1E77, 1116, 2},
+	{0x1E78, 1118, 3},
+	{0x1E79, 1121, 3},
+	{0x1E7A, 1124, 3},
+	{0x1E7B, 1127, 3},
+	{0x1E7C, 1130, 2},
+	{0x1E7D, 1132, 2},
+	{0x1E7E, 1134, 2},
+	{0x1E7F, 1136, 2},
+	{0x1E80, 1138, 2},
+	{0x1E81, 1140, 2},
+	{0x1E82, 1142, 2},
+	{0x1E83, 1144, 2},
+	{0x1E84, 1146, 2},
+	{0x1E85, 1148, 2},
+	{0x1E86, 1150, 2},
+	{0x1E87, 1152, 2},
+	{0x1E88, 1154, 2},
+	{0x1E89, 1156, 2},
+	{0x1E8A, 1158, 2},
+	{0x1E8B, 1160, 2},
+	{0x1E8C, 1162, 2},
+	{0x1E8D, 1164, 2},
+	{0x1E8E, 1166, 2},
+	{0x1E8F, 1168, 2},
+	{0x1E90, 1170, 2},
+	{0x1E91, 1172, 2},
+	{0x1E92, 1174, 2},
+	{0x1E93, 1176, 2},
+	{0x1E94, 1178, 2},
+	{0x1E95, 1180, 2},
+	{0x1E96, 1182, 2},
+	{0x1E97, 1184, 2},
+	{0x1E98, 1186, 2},
+	{0x1E99, 1188, 2},
+	{0x1E9B, 1190, 2},
+	{0x1EA0, 1192, 2},
+	{0x1EA1, 1194, 2},
+	{0x1EA2, 1196, 2},
+	{0x1EA3, 1198, 2},
+	{0x1EA4, 1200, 3},
+	{0x1EA5, 1203, 3},
+	{0x1EA6, 1206, 3},
+	{0x1EA7, 1209, 3},
+	{0x1EA8, 1212, 3},
+	{0x1EA9, 1215, 3},
+	{0x1EAA, 1218, 3},
+	{0x1EAB, 1221, 3},
+	{0x1EAC, 1224, 3},
+	{0x1EAD, 1227, 3},
+	{0x1EAE, 1230, 3},
+	{0x1EAF, 1233, 3},
+	{0x1EB0, 1236, 3},
+	{0x1EB1, 1239, 3},
+	{0x1EB2, 1242, 3},
+	{0x1EB3, 1245, 3},
+	{0x1EB4, 1248, 3},
+	{0x1EB5, 1251, 3},
+	{0x1EB6, 1254, 3},
+	{0x1EB7, 1257, 3},
+	{0x1EB8, 1260, 2},
+	{0x1EB9, 1262, 2},
+	{0x1EBA, 1264, 2},
+	{0x1EBB, 1266, 2},
+	{0x1EBC, 1268, 2},
+	{0x1EBD, 1270, 2},
+	{0x1EBE, 1272, 3},
+	{0x1EBF, 1275, 3},
+	{0x1EC0, 1278, 3},
+	{0x1EC1, 1281, 3},
+	{0x1EC2, 1284, 3},
+	{0x1EC3, 1287, 3},
+	{0x1EC4, 1290, 3},
+	{0x1EC5, 1293, 3},
+	{0x1EC6, 1296, 3},
+	{0x1EC7, 1299, 3},
+	{0x1EC8, 1302, 2},
+	{0x1EC9, 1304, 2},
+	{0x1ECA, 1306, 2},
+	{0x1ECB, 1308, 2},
+	{0x1ECC, 1310, 2},
+	{0x1ECD, 1312, 2},
+	{0x1ECE, 1314, 2},
+	{0x1ECF, 1316, 2},
+	{0x1ED0, 1318, 3},
+	{0x1ED1, 1321, 3},
+	{0x1ED2, 1324, 3},
+	{0x1ED3, 1327, 3},
+	{0x1ED4, 1330, 3},
+	{0x1ED5, 1333, 3},
+	{0x1ED6, 1336, 3},
+	{0x1ED7, 1339, 3},
+	{0x1ED8, 1342, 3},
+	{0x1ED9, 1345, 3},
+	{0x1EDA, 1348, 3},
+	{0x1EDB, 1351, 3},
+	{0x1EDC, 1354, 3},
+	{0x1EDD, 1357, 3},
+	{0x1EDE, 1360, 3},
+	{0x1EDF, 1363, 3},
+	{0x1EE0, 1366, 3},
+	{0x1EE1, 1369, 3},
+	{0x1EE2, 1372, 3},
+	{0x1EE3, 1375, 3},
+	{0x1EE4, 1378, 2},
+	{0x1EE5, 1380, 2},
+	{0x1EE6, 1382, 2},
+	{0x1EE7, 1384, 2},
+	{0x1EE8, 1386, 3},
+	{0x1EE9, 1389, 3},
+	{0x1EEA, 1392, 3},
+	{0x1EEB, 1395, 3},
+	{0x1EEC, 1398, 3},
+	{0x1EED, 1401, 3},
+	{0x1EEE, 1404, 3},
+	{0x1EEF, 1407, 3},
+	{0x1EF0, 1410, 3},
+	{0x1EF1, 1413, 3},
+	{0x1EF2, 1416, 2},
+	{0x1EF3, 1418, 2},
+	{0x1EF4, 1420, 2},
+	{0x1EF5, 1422, 2},
+	{0x1EF6, 1424, 2},
+	{0x1EF7, 1426, 2},
+	{0x1EF8, 1428, 2},
+	{0x1EF9, 1430, 2},
+	{0x1F00, 1432, 2},
+	{0x1F01, 1434, 2},
+	{0x1F02, 1436, 3},
+	{0x1F03, 1439, 3},
+	{0x1F04, 1442, 3},
+	{0x1F05, 1445, 3},
+	{0x1F06, 1448, 3},
+	{0x1F07, 1451, 3},
+	{0x1F08, 1454, 2},
+	{0x1F09, 1456, 2},
+	{0x1F0A, 1458, 3},
+	{0x1F0B, 1461, 3},
+	{0x1F0C, 1464, 3},
+	{0x1F0D, 1467, 3},
+	{0x1F0E, 1470, 3},
+	{0x1F0F, 1473, 3},
+	{0x1F10, 1476, 2},
+	{0x1F11, 1478, 2},
+	{0x1F12, 1480, 3},
+	{0x1F13, 1483, 3},
+	{0x1F14, 1486, 3},
+	{0x1F15, 1489, 3},
+	{0x1F18, 1492, 2},
+	{0x1F19, 1494, 2},
+	{0x1F1A, 1496, 3},
+	{0x1F1B, 1499, 3},
+	{0x1F1C, 1502, 3},
+	{0x1F1D, 1505, 3},
+	{0x1F20, 1508, 2},
+	{0x1F21, 1510, 2},
+	{0x1F22, 1512, 3},
+	{0x1F23, 1515, 3},
+	{0x1F24, 1518, 3},
+	{0x1F25, 1521, 3},
+	{0x1F26, 1524, 3},
+	{0x1F27, 1527, 3},
+	{0x1F28, 1530, 2},
+	{0x1F29, 1532, 2},
+	{0x1F2A, 1534, 3},
+	{0x1F2B, 1537, 3},
+	{0x1F2C, 1540, 3},
+	{0x1F2D, 1543, 3},
+	{0x1F2E, 1546, 3},
+	{0x1F2F, 1549, 3},
+	{0x1F30, 1552, 2},
+	{0x1F31, 1554, 2},
+	{0x1F32, 1556, 3},
+	{0x1F33, 1559, 3},
+	{0x1F34, 1562, 3},
+	{0x1F35, 1565, 3},
+	{0x1F36, 1568, 3},
+	{0x1F37, 1571, 3},
+	{0x1F38, 1574, 2},
+	{0x1F39, 1576, 2},
+	{0x1F3A, 1578, 3},
+	{0x1F3B, 1581, 3},
+	{0x1F3C, 1584, 3},
+	{0x1F3D, 1587, 3},
+	{0x1F3E, 1590, 3},
+	{0x1F3F, 1593, 3},
+	{0x1F40, 1596, 2},
+	{0x1F41, 1598, 2},
+	{0x1F42, 1600, 3},
+	{0x1F43, 1603, 3},
+	{0x1F44, 1606, 3},
+	{0x1F45, 1609, 3},
+	{0x1F48, 1612, 2},
+	{0x1F49, 1614, 2},
+	{0x1F4A, 1616, 3},
+	{0x1F4B, 1619, 3},
+	{0x1F4C, 1622, 3},
+	{0x1F4D, 1625, 3},
+	{0x1F50, 1628, 2},
+	{0x1F51, 1630, 2},
+	{0x1F52, 1632, 3},
+	{0x1F53, 1635, 3},
+	{0x1F54, 1638, 3},
+	{0x1F55, 1641, 3},
+	{0x1F56, 1644, 3},
+	{0x1F57, 1647, 3},
+	{0x1F59, 1650, 2},
+	{0x1F5B, 1652, 3},
+	{0x1F5D, 1655, 3},
+	{0x1F5F, 1658, 3},
+	{0x1F60, 1661, 2},
+	{0x1F61, 1663, 2},
+	{0x1F62, 1665, 3},
+	{0x1F63, 1668, 3},
+	{0x1F64, 1671, 3},
+	{0x1F65, 1674, 3},
+	{0x1F66, 1677, 3},
+	{0x1F67, 1680, 3},
+	{0x1F68, 1683, 2},
+	{0x1F69, 1685, 2},
+	{0x1F6A, 1687, 3},
+	{0x1F6B, 1690, 3},
+	{0x1F6C, 1693, 3},
+	{0x1F6D, 1696, 3},
+	{0x1F6E, 1699, 3},
+	{0x1F6F, 1702, 3},
+	{0x1F70, 1705, 2},
+	{0x1F71, 1707, 2},
+	{0x1F72, 1709, 2},
+	{0x1F73, 1711, 2},
+	{0x1F74, 1713, 2},
+	{0x1F75, 1715, 2},
+	{0x1F76, 1717, 2},
+	{0x1F77, 1719, 2},
+	{0x1F78, 1721, 2},
+	{0x1F79, 1723, 2},
+	{0x1F7A, 1725, 2},
+	{0x1F7B, 1727, 2},
+	{0x1F7C, 1729, 2},
+	{0x1F7D, 1731, 2},
+	{0x1F80, 1733, 3},
+	{0x1F81, 1736, 3},
+	{0x1F82, 1739, 4},
+	{0x1F83, 1743, 4},
+	{0x1F84, 1747, 4},
+	{0x1F85, 1751, 4},
+	{0x1F86, 1755, 4},
+	{0x1F87, 1759, 4},
+	{0x1F88, 1763, 3},
+	{0x1F89, 1766, 3},
+	{0x1F8A, 1769, 4},
+	{0x1F8B, 1773, 4},
+	{0x1F8C, 1777, 4},
+	{0x1F8D, 1781, 4},
+	{0x1F8E, 1785, 4},
+	{0x1F8F, 1789, 4},
+	{0x1F90, 1793, 3},
+	{0x1F91, 1796, 3},
+	{0x1F92, 1799, 4},
+	{0x1F93, 1803, 4},
+	{0x1F94, 1807, 4},
+	{0x1F95, 1811, 4},
+	{0x1F96, 1815, 4},
+	{0x1F97, 1819, 4},
+	{0x1F98, 1823, 3},
+	{0x1F99, 1826, 3},
+	{0x1F9A, 1829, 4},
+	{0x1F9B, 1833, 4},
+	{0x1F9C, 1837, 4},
+	{0x1F9D, 1841, 4},
+	{0x1F9E, 1845, 4},
+	{0x1F9F, 1849, 4},
+	{0x1FA0, 1853, 3},
+	{0x1FA1, 1856, 3},
+	{0x1FA2, 1859, 4},
+	{0x1FA3, 1863, 4},
+	{0x1FA4, 1867, 4},
+	{0x1FA5, 1871, 4},
+	{0x1FA6, 1875, 4},
+	{0x1FA7, 1879, 4},
+	{0x1FA8, 1883, 3},
+	{0x1FA9, 1886, 3},
+	{0x1FAA, 1889, 4},
+	{0x1FAB, 1893, 4},
+	{0x1FAC, 1897, 4},
+	{0x1FAD, 1901, 4},
+	{0x1FAE, 1905, 4},
+	{0x1FAF, 1909, 4},
+	{0x1FB0, 1913, 2},
+	{0x1FB1, 1915, 2},
+	{0x1FB2, 1917, 3},
+	{0x1FB3, 1920, 2},
+	{0x1FB4, 1922, 3},
+	{0x1FB6, 1925, 2},
+	{0x1FB7, 1927, 3},
+	{0x1FB8, 1930, 2},
+	{0x1FB9, 1932, 2},
+	{0x1FBA, 1934, 2},
+	{0x1FBB, 1936, 2},
+	{0x1FBC, 1938, 2},
+	{0x1FBE, 1940, 1},
+	{0x1FC1, 1941, 2},
+	{0x1FC2, 1943, 3},
+	{0x1FC3, 1946, 2},
+	{0x1FC4, 1948, 3},
+	{0x1FC6, 1951, 2},
+	{0x1FC7, 1953, 3},
+	{0x1FC8, 1956, 2},
+	{0x1FC9, 1958, 2},
+	{0x1FCA, 1960, 2},
+	{0x1FCB, 1962, 2},
+	{0x1FCC, 1964, 2},
+	{0x1FCD, 1966, 2},
+	{0x1FCE, 1968, 2},
+	{0x1FCF, 1970, 2},
+	{0x1FD0, 1972, 2},
+	{0x1FD1, 1974, 2},
+	{0x1FD2, 1976, 3},
+	{0x1FD3, 1979, 3},
+	{0x1FD6, 1982, 2},
+	{0x1FD7, 1984, 3},
+	{0x1FD8, 1987, 2},
+	{0x1FD9, 1989, 2},
+	{0x1FDA, 1991, 2},
+	{0x1FDB, 1993, 2},
+	{0x1FDD, 1995, 2},
+	{0x1FDE, 1997, 2},
+	{0x1FDF, 1999, 2},
+	{0x1FE0, 2001, 2},
+	{0x1FE1, 2003, 2},
+	{0x1FE2, 2005, 3},
+	{0x1FE3, 2008, 3},
+	{0x1FE4, 2011, 2},
+	{0x1FE5, 2013, 2},
+	{0x1FE6, 2015, 2},
+	{0x1FE7, 2017, 3},
+	{0x1FE8, 2020, 2},
+	{0x1FE9, 2022, 2},
+	{0x1FEA, 2024, 2},
+	{0x1FEB, 2026, 2},
+	{0x1FEC, 2028, 2},
+	{0x1FED, 2030, 2},
+	{0x1FEE, 2032, 2},
+	{0x1FEF, 2034, 1},
+	{0x1FF2, 2035, 3},
+	{0x1FF3, 2038, 2},
+	{0x1FF4, 2040, 3},
+	{0x1FF6, 2043, 2},
+	{0x1FF7, 2045, 3},
+	{0x1FF8, 2048, 2},
+	{0x1FF9, 2050, 2},
+	{0x1FFA, 2052, 2},
+	{0x1FFB, 2054, 2},
+	{0x1FFC, 2056, 2},
+	{0x1FFD, 2058, 1},
+	{0x2000, 2059, 1},
+	{0x2001, 2060, 1},
+	{0x2126, 2061, 1},
+	{0x212A, 2062, 1},
+	{0x212B, 2063, 2},
+	{0x219A, 2065, 2},
+	{0x219B, 2067, 2},
+	{0x21AE, 2069, 2},
+	{0x21CD, 2071, 2},
+	{0x21CE, 2073, 2},
+	{0x21CF, 2075, 2},
+	{0x2204, 2077, 2},
+	{0x2209, 2079, 2},
+	{0x220C, 2081, 2},
+	{0x2224, 2083, 2},
+	{0x2226, 2085, 2},
+	{0x2241, 2087, 2},
+	{0x2244, 2089, 2},
+	{0x2247, 2091, 2},
+	{0x2249, 2093, 2},
+	{0x2260, 2095, 2},
+	{0x2262, 2097, 2},
+	{0x226D, 2099, 2},
+	{0x226E, 2101, 2},
+	{0x226F, 2103, 2},
+	{0x2270, 2105, 2},
+	{0x2271, 2107, 2},
+	{0x2274, 2109, 2},
+	{0x2275, 2111, 2},
+	{0x2278, 2113, 2},
+	{0x2279, 2115, 2},
+	{0x2280, 2117, 2},
+	{0x2281, 2119, 2},
+	{0x2284, 2121, 2},
+	{0x2285, 2123, 2},
+	{0x2288, 2125, 2},
+	{0x2289, 2127, 2},
+	{0x22AC, 2129, 2},
+	{0x22AD, 2131, 2},
+	{0x22AE, 2133, 2},
+	{0x22AF, 2135, 2},
+	{0x22E0, 2137, 2},
+	{0x22E1, 2139, 2},
+	{0x22E2, 2141, 2},
+	{0x22E3, 2143, 2},
+	{0x22EA, 2145, 2},
+	{0x22EB, 2147, 2},
+	{0x22EC, 2149, 2},
+	{0x22ED, 2151, 2},
+	{0x2329, 2153, 1},
+	{0x232A, 2154, 1},
+	{0x2ADC, 2155, 2},
+	{0x304C, 2157, 2},
+	{0x304E, 2159, 2},
+	{0x3050, 2161, 2},
+	{0x3052, 2163, 2},
+	{0x3054, 2165, 2},
+	{0x3056, 2167, 2},
+	{0x3058, 2169, 2},
+	{0x305A, 2171, 2},
+	{0x305C, 2173, 2},
+	{0x305E, 2175, 2},
+	{0x3060, 2177, 2},
+	{0x3062, 2179, 2},
+	{0x3065, 2181, 2},
+	{0x3067, 2183, 2},
+	{0x3069, 2185, 2},
+	{0x3070, 2187, 2},
+	{0x3071, 2189, 2},
+	{0x3073, 2191, 2},
+	{0x3074, 2193, 2},
+	{0x3076, 2195, 2},
+	{0x3077, 2197, 2},
+	{0x3079, 2199, 2},
+	{0x307A, 2201, 2},
+	{0x307C, 2203, 2},
+	{0x307D, 2205, 2},
+	{0x3094, 2207, 2},
+	{0x309E, 2209, 2},
+	{0x30AC, 2211, 2},
+	{0x30AE, 2213, 2},
+	{0x30B0, 2215, 2},
+	{0x30B2, 2217, 2},
+	{0x30B4, 2219, 2},
+	{0x30B6, 2221, 2},
+	{0x30B8, 2223, 2},
+	{0x30BA, 2225, 2},
+	{0x30BC, 2227, 2},
+	{0x30BE, 2229, 2},
+	{0x30C0, 2231, 2},
+	{0x30C2, 2233, 2},
+	{0x30C5, 2235, 2},
+	{0x30C7, 2237, 2},
+	{0x30C9, 2239, 2},
+	{0x30D0, 2241, 2},
+	{0x30D1, 2243, 2},
+	{0x30D3, 2245, 2},
+	{0x30D4, 2247, 2},
+	{0x30D6, 2249, 2},
+	{0x30D7, 2251, 2},
+	{0x30D9, 2253, 2},
+	{0x30DA, 2255, 2},
+	{0x30DC, 2257, 2},
+	{0x30DD, 2259, 2},
+	{0x30F4, 2261, 2},
+	{0x30F7, 2263, 2},
+	{0x30F8, 2265, 2},
+	{0x30F9, 2267, 2},
+	{0x30FA, 2269, 2},
+	{0x30FE, 2271, 2},
+	{0xF900, 2273, 1},
+	{0xF901, 2274, 1},
+	{0xF902, 2275, 1},
+	{0xF903, 2276, 1},
+	{0xF904, 2277, 1},
+	{0xF905, 2278, 1},
+	{0xF906, 2279, 1},
+	{0xF907, 2280, 1},
+	{0xF908, 2281, 1},
+	{0xF909, 2282, 1},
+	{0xF90A, 2283, 1},
+	{0xF90B, 2284, 1},
+	{0xF90C, 2285, 1},
+	{0xF90D, 2286, 1},
+	{0xF90E, 2287, 1},
+	{0xF90F, 2288, 1},
+	{0xF910, 2289, 1},
+	{0xF911, 2290, 1},
+	{0xF912, 2291, 1},
+	{0xF913, 2292, 1},
+	{0xF914, 2293, 1},
+	{0xF915, 2294, 1},
+	{0xF916, 2295, 1},
+	{0xF917, 2296, 1},
+	{0xF918, 2297, 1},
+	{0xF919, 2298, 1},
+	{0xF91A, 2299, 1},
+	{0xF91B, 2300, 1},
+	{0xF91C, 2301, 1},
+	{0xF91D, 2302, 1},
+	{0xF91E, 2303, 1},
+	{0xF91F, 2304, 1},
+	{0xF920, 2305, 1},
+	{0xF921, 2306, 1},
+	{0xF922, 2307, 1},
+	{0xF923, 2308, 1},
+	{0xF924, 2309, 1},
+	{0xF925, 2310, 1},
+	{0xF926, 2311, 1},
+	{0xF927, 2312, 1},
+	{0xF928, 2313, 1},
+	{0xF929, 2314, 1},
+	{0xF92A, 2315, 1},
+	{0xF92B, 2316, 1},
+	{0xF92C, 2317, 1},
+	{0xF92D, 2318, 1},
+	{0xF92E, 2319, 1},
+	{0xF92F, 2320, 1},
+	{0xF930, 2321, 1},
+	{0xF931, 2322, 1},
+	{0xF932, 2323, 1},
+	{0xF933, 2324, 1},
+	{0xF934, 2325, 1},
+	{0xF935, 2326, 1},
+	{0xF936, 2327, 1},
+	{0xF937, 2328, 1},
+	{0xF938, 2329, 1},
+	{0xF939, 2330, 1},
+	{0xF93A, 2331, 1},
+	{0xF93B, 2332, 1},
+	{0xF93C, 2333, 1},
+	{0xF93D, 2334, 1},
+	{0xF93E, 2335, 1},
+	{0xF93F, 2336, 1},
+	{0xF940, 2337, 1},
+	{0xF941, 2338, 1},
+	{0xF942, 2339, 1},
+	{0xF943, 2340, 1},
+	{0xF944, 2341, 1},
+	{0xF945, 2342, 1},
+	{0xF946, 2343, 1},
+	{0xF947, 2344, 1},
+	{0xF948, 2345, 1},
+	{0xF949, 2346, 1},
+	{0xF94A, 2347, 1},
+	{0xF94B, 2348, 1},
+	{0xF94C, 2349, 1},
+	{0xF94D, 2350, 1},
+	{0xF94E, 2351, 1},
+	{0xF94F, 2352, 1},
+	{0xF950, 2353, 1},
+	{0xF951, 2354, 1},
+	{0xF952, 2355, 1},
+	{0xF953, 2356, 1},
+	{0xF954, 2357, 1},
+	{0xF955, 2358, 1},
+	{0xF956, 2359, 1},
+	{0xF957, 2360, 1},
+	{0xF958, 2361, 1},
+	{0xF959, 2362, 1},
+	{0xF95A, 2363, 1},
+	{0xF95B, 2364, 1},
+	{0xF95C, 2365, 1},
+	{0xF95D, 2366, 1},
+	{0xF95E, 2367, 1},
+	{0xF95F, 2368, 1},
+	{0xF960, 2369, 1},
+	{0xF961, 2370, 1},
+	{0xF962, 2371, 1},
+	{0xF963, 2372, 1},
+	{0xF964, 2373, 1},
+	{0xF965, 2374, 1},
+	{0xF966, 2375, 1},
+	{0xF967, 2376, 1},
+	{0xF968, 2377, 1},
+	{0xF969, 2378, 1},
+	{0xF96A, 2379, 1},
+	{0xF96B, 2380, 1},
+	{0xF96C, 2381, 1},
+	{0xF96D, 2382, 1},
+	{0xF96E, 2383, 1},
+	{0xF96F, 2384, 1},
+	{0xF970, 2385, 1},
+	{0xF971, 2386, 1},
+	{0xF972, 2387, 1},
+	{0xF973, 2388, 1},
+	{0xF974, 2389, 1},
+	{0xF975, 2390, 1},
+	{0xF976, 2391, 1},
+	{0xF977, 2392, 1},
+	{0xF978, 2393, 1},
+	{0xF979, 2394, 1},
+	{0xF97A, 2395, 1},
+	{0xF97B, 2396, 1},
+	{0xF97C, 2397, 1},
+	{0xF97D, 2398, 1},
+	{0xF97E, 2399, 1},
+	{0xF97F, 2400, 1},
+	{0xF980, 2401, 1},
+	{0xF981, 2402, 1},
+	{0xF982, 2403, 1},
+	{0xF983, 2404, 1},
+	{0xF984, 2405, 1},
+	{0xF985, 2406, 1},
+	{0xF986, 2407, 1},
+	{0xF987, 2408, 1},
+	{0xF988, 2409, 1},
+	{0xF989, 2410, 1},
+	{0xF98A, 2411, 1},
+	{0xF98B, 2412, 1},
+	{0xF98C, 2413, 1},
+	{0xF98D, 2414, 1},
+	{0xF98E, 2415, 1},
+	{0xF98F, 2416, 1},
+	{0xF990, 2417, 1},
+	{0xF991, 2418, 1},
+	{0xF992, 2419, 1},
+	{0xF993, 2420, 1},
+	{0xF994, 2421, 1},
+	{0xF995, 2422, 1},
+	{0xF996, 2423, 1},
+	{0xF997, 2424, 1},
+	{0xF998, 2425, 1},
+	{0xF999, 2426, 1},
+	{0xF99A, 2427, 1},
+	{0xF99B, 2428, 1},
+	{0xF99C, 2429, 1},
+	{0xF99D, 2430, 1},
+	{0xF99E, 2431, 1},
+	{0xF99F, 2432, 1},
+	{0xF9A0, 2433, 1},
+	{0xF9A1, 2434, 1},
+	{0xF9A2, 2435, 1},
+	{0xF9A3, 2436, 1},
+	{0xF9A4, 2437, 1},
+	{0xF9A5, 2438, 1},
+	{0xF9A6, 2439, 1},
+	{0xF9A7, 2440, 1},
+	{0xF9A8, 2441, 1},
+	{0xF9A9, 2442, 1},
+	{0xF9AA, 2443, 1},
+	{0xF9AB, 2444, 1},
+	{0xF9AC, 2445, 1},
+	{0xF9AD, 2446, 1},
+	{0xF9AE, 2447, 1},
+	{0xF9AF, 2448, 1},
+	{0xF9B0, 2449, 1},
+	{0xF9B1, 2450, 1},
+	{0xF9B2, 2451, 1},
+	{0xF9B3, 2452, 1},
+	{0xF9B4, 2453, 1},
+	{0xF9B5, 2454, 1},
+	{0xF9B6, 2455, 1},
+	{0xF9B7, 2456, 1},
+	{0xF9B8, 2457, 1},
+	{0xF9B9, 2458, 1},
+	{0xF9BA, 2459, 1},
+	{0xF9BB, 2460, 1},
+	{0xF9BC, 2461, 1},
+	{0xF9BD, 2462, 1},
+	{0xF9BE, 2463, 1},
+	{0xF9BF, 2464, 1},
+	{0xF9C0, 2465, 1},
+	{0xF9C1, 2466, 1},
+	{0xF9C2, 2467, 1},
+	{0xF9C3, 2468, 1},
+	{0xF9C4, 2469, 1},
+	{0xF9C5, 2470, 1},
+	{0xF9C6, 2471, 1},
+	{0xF9C7, 2472, 1},
+	{0xF9C8, 2473, 1},
+	{0xF9C9, 2474, 1},
+	{0xF9CA, 2475, 1},
+	{0xF9CB, 2476, 1},
+	{0xF9CC, 2477, 1},
+	{0xF9CD, 2478, 1},
+	{0xF9CE, 2479, 1},
+	{0xF9CF, 2480, 1},
+	{0xF9D0, 2481, 1},
+	{0xF9D1, 2482, 1},
+	{0xF9D2, 2483, 1},
+	{0xF9D3, 2484, 1},
+	{0xF9D4, 2485, 1},
+	{0xF9D5, 2486, 1},
+	{0xF9D6, 2487, 1},
+	{0xF9D7, 2488, 1},
+	{0xF9D8, 2489, 1},
+	{0xF9D9, 2490, 1},
+	{0xF9DA, 2491, 1},
+	{0xF9DB, 2492, 1},
+	{0xF9DC, 2493, 1},
+	{0xF9DD, 2494, 1},
+	{0xF9DE, 2495, 1},
+	{0xF9DF, 2496, 1},
+	{0xF9E0, 2497, 1},
+	{0xF9E1, 2498, 1},
+	{0xF9E2, 2499, 1},
+	{0xF9E3, 2500, 1},
+	{0xF9E4, 2501, 1},
+	{0xF9E5, 2502, 1},
+	{0xF9E6, 2503, 1},
+	{0xF9E7, 2504, 1},
+	{0xF9E8, 2505, 1},
+	{0xF9E9, 2506, 1},
+	{0xF9EA, 2507, 1},
+	{0xF9EB, 2508, 1},
+	{0xF9EC, 2509, 1},
+	{0xF9ED, 2510, 1},
+	{0xF9EE, 2511, 1},
+	{0xF9EF, 2512, 1},
+	{0xF9F0, 2513, 1},
+	{0xF9F1, 2514, 1},
+	{0xF9F2, 2515, 1},
+	{0xF9F3, 2516, 1},
+	{0xF9F4, 2517, 1},
+	{0xF9F5, 2518, 1},
+	{0xF9F6, 2519, 1},
+	{0xF9F7, 2520, 1},
+	{0xF9F8, 2521, 1},
+	{0xF9F9, 2522, 1},
+	{0xF9FA, 2523, 1},
+	{0xF9FB, 2524, 1},
+	{0xF9FC, 2525, 1},
+	{0xF9FD, 2526, 1},
+	{0xF9FE, 2527, 1},
+	{0xF9FF, 2528, 1},
+	{0xFA00, 2529, 1},
+	{0xFA01, 2530, 1},
+	{0xFA02, 2531, 1},
+	{0xFA03, 2532, 1},
+	{0xFA04, 2533, 1},
+	{0xFA05, 2534, 1},
+	{0xFA06, 2535, 1},
+	{0xFA07, 2536, 1},
+	{0xFA08, 2537, 1},
+	{0xFA09, 2538, 1},
+	{0xFA0A, 2539, 1},
+	{0xFA0B, 2540, 1},
+	{0xFA0C, 2541, 1},
+	{0xFA0D, 2542, 1},
+	{0xFA10, 2543, 1},
+	{0xFA12, 2544, 1},
+	{0xFA15, 2545, 1},
+	{0xFA16, 2546, 1},
+	{0xFA17, 2547, 1},
+	{0xFA18, 2548, 1},
+	{0xFA19, 2549, 1},
+	{0xFA1A, 2550, 1},
+	{0xFA1B, 2551, 1},
+	{0xFA1C, 2552, 1},
+	{0xFA1D, 2553, 1},
+	{0xFA1E, 2554, 1},
+	{0xFA20, 2555, 1},
+	{0xFA22, 2556, 1},
+	{0xFA25, 2557, 1},
+	{0xFA26, 2558, 1},
+	{0xFA2A, 2559, 1},
+	{0xFA2B, 2560, 1},
+	{0xFA2C, 2561, 1},
+	{0xFA2D, 2562, 1},
+	{0xFA2E, 2563, 1},
+	{0xFA2F, 2564, 1},
+	{0xFA30, 2565, 1},
+	{0xFA31, 2566, 1},
+	{0xFA32, 2567, 1},
+	{0xFA33, 2568, 1},
+	{0xFA34, 2569, 1},
+	{0xFA35, 2570, 1},
+	{0xFA36, 2571, 1},
+	{0xFA37, 2572, 1},
+	{0xFA38, 2573, 1},
+	{0xFA39, 2574, 1},
+	{0xFA3A, 2575, 1},
+	{0xFA3B, 2576, 1},
+	{0xFA3C, 2577, 1},
+	{0xFA3D, 2578, 1},
+	{0xFA3E, 2579, 1},
+	{0xFA3F, 2580, 1},
+	{0xFA40, 2581, 1},
+	{0xFA41, 2582, 1},
+	{0xFA42, 2583, 1},
+	{0xFA43, 2584, 1},
+	{0xFA44, 2585, 1},
+	{0xFA45, 2586, 1},
+	{0xFA46, 2587, 1},
+	{0xFA47, 2588, 1},
+	{0xFA48, 2589, 1},
+	{0xFA49, 2590, 1},
+	{0xFA4A, 2591, 1},
+	{0xFA4B, 2592, 1},
+	{0xFA4C, 2593, 1},
+	{0xFA4D, 2594, 1},
+	{0xFA4E, 2595, 1},
+	{0xFA4F, 2596, 1},
+	{0xFA50, 2597, 1},
+	{0xFA51, 2598, 1},
+	{0xFA52, 2599, 1},
+	{0xFA53, 2600, 1},
+	{0xFA54, 2601, 1},
+	{0xFA55, 2602, 1},
+	{0xFA56, 2603, 1},
+	{0xFA57, 2604, 1},
+	{0xFA58, 2605, 1},
+	{0xFA59, 2606, 1},
+	{0xFA5A, 2607, 1},
+	{0xFA5B, 2608, 1},
+	{0xFA5C, 2609, 1},
+	{0xFA5D, 2610, 1},
+	{0xFA5E, 2611, 1},
+	{0xFA5F, 2612, 1},
+	{0xFA60, 2613, 1},
+	{0xFA61, 2614, 1},
+	{0xFA62, 2615, 1},
+	{0xFA63, 2616, 1},
+	{0xFA64, 2617, 1},
+	{0xFA65, 2618, 1},
+	{0xFA66, 2619, 1},
+	{0xFA67, 2620, 1},
+	{0xFA68, 2621, 1},
+	{0xFA69, 2622, 1},
+	{0xFA6A, 2623, 1},
+	{0xFA6B, 2624, 1},
+	{0xFA6C, 2625, 1},
+	{0xFA6D, 2626, 1},
+	{0xFA70, 2627, 1},
+	{0xFA71, 2628, 1},
+	{0xFA72, 2629, 1},
+	{0xFA73, 2630, 1},
+	{0xFA74, 2631, 1},
+	{0xFA75, 2632, 1},
+	{0xFA76, 2633, 1},
+	{0xFA77, 2634, 1},
+	{0xFA78, 2635, 1},
+	{0xFA79, 2636, 1},
+	{0xFA7A, 2637, 1},
+	{0xFA7B, 2638, 1},
+	{0xFA7C, 2639, 1},
+	{0xFA7D, 2640, 1},
+	{0xFA7E, 2641, 1},
+	{0xFA7F, 2642, 1},
+	{0xFA80, 2643, 1},
+	{0xFA81, 2644, 1},
+	{0xFA82, 2645, 1},
+	{0xFA83, 2646, 1},
+	{0xFA84, 2647, 1},
+	{0xFA85, 2648, 1},
+	{0xFA86, 2649, 1},
+	{0xFA87, 2650, 1},
+	{0xFA88, 2651, 1},
+	{0xFA89, 2652, 1},
+	{0xFA8A, 2653, 1},
+	{0xFA8B, 2654, 1},
+	{0xFA8C, 2655, 1},
+	{0xFA8D, 2656, 1},
+	{0xFA8E, 2657, 1},
+	{0xFA8F, 2658, 1},
+	{0xFA90, 2659, 1},
+	{0xFA91, 2660, 1},
+	{0xFA92, 2661, 1},
+	{0xFA93, 2662, 1},
+	{0xFA94, 2663, 1},
+	{0xFA95, 2664, 1},
+	{0xFA96, 2665, 1},
+	{0xFA97, 2666, 1},
+	{0xFA98, 2667, 1},
+	{0xFA99, 2668, 1},
+	{0xFA9A, 2669, 1},
+	{0xFA9B, 2670, 1},
+	{0xFA9C, 2671, 1},
+	{0xFA9D, 2672, 1},
+	{0xFA9E, 2673, 1},
+	{0xFA9F, 2674, 1},
+	{0xFAA0, 2675, 1},
+	{0xFAA1, 2676, 1},
+	{0xFAA2, 2677, 1},
+	{0xFAA3, 2678, 1},
+	{0xFAA4, 2679, 1},
+	{0xFAA5, 2680, 1},
+	{0xFAA6, 2681, 1},
+	{0xFAA7, 2682, 1},
+	{0xFAA8, 2683, 1},
+	{0xFAA9, 2684, 1},
+	{0xFAAA, 2685, 1},
+	{0xFAAB, 2686, 1},
+	{0xFAAC, 2687, 1},
+	{0xFAAD, 2688, 1},
+	{0xFAAE, 2689, 1},
+	{0xFAAF, 2690, 1},
+	{0xFAB0, 2691, 1},
+	{0xFAB1, 2692, 1},
+	{0xFAB2, 2693, 1},
+	{0xFAB3, 2694, 1},
+	{0xFAB4, 2695, 1},
+	{0xFAB5, 2696, 1},
+	{0xFAB6, 2697, 1},
+	{0xFAB7, 2698, 1},
+	{0xFAB8, 2699, 1},
+	{0xFAB9, 2700, 1},
+	{0xFABA, 2701, 1},
+	{0xFABB, 2702, 1},
+	{0xFABC, 2703, 1},
+	{0xFABD, 2704, 1},
+	{0xFABE, 2705, 1},
+	{0xFABF, 2706, 1},
+	{0xFAC0, 2707, 1},
+	{0xFAC1, 2708, 1},
+	{0xFAC2, 2709, 1},
+	{0xFAC3, 2710, 1},
+	{0xFAC4, 2711, 1},
+	{0xFAC5, 2712, 1},
+	{0xFAC6, 2713, 1},
+	{0xFAC7, 2714, 1},
+	{0xFAC8, 2715, 1},
+	{0xFAC9, 2716, 1},
+	{0xFACA, 2717, 1},
+	{0xFACB, 2718, 1},
+	{0xFACC, 2719, 1},
+	{0xFACD, 2720, 1},
+	{0xFACE, 2721, 1},
+	{0xFACF, 2722, 1},
+	{0xFAD0, 2723, 1},
+	{0xFAD1, 2724, 1},
+	{0xFAD2, 2725, 1},
+	{0xFAD3, 2726, 1},
+	{0xFAD4, 2727, 1},
+	{0xFAD5, 2728, 1},
+	{0xFAD6, 2729, 1},
+	{0xFAD7, 2730, 1},
+	{0xFAD8, 2731, 1},
+	{0xFAD9, 2732, 1},
+	{0xFB1D, 2733, 2},
+	{0xFB1F, 2735, 2},
+	{0xFB2A, 2737, 2},
+	{0xFB2B, 2739, 2},
+	{0xFB2C, 2741, 3},
+	{0xFB2D, 2744, 3},
+	{0xFB2E, 2747, 2},
+	{0xFB2F, 2749, 2},
+	{0xFB30, 2751, 2},
+	{0xFB31, 2753, 2},
+	{0xFB32, 2755, 2},
+	{0xFB33, 2757, 2},
+	{0xFB34, 2759, 2},
+	{0xFB35, 2761, 2},
+	{0xFB36, 2763, 2},
+	{0xFB38, 2765, 2},
+	{0xFB39, 2767, 2},
+	{0xFB3A, 2769, 2},
+	{0xFB3B, 2771, 2},
+	{0xFB3C, 2773, 2},
+	{0xFB3E, 2775, 2},
+	{0xFB40, 2777, 2},
+	{0xFB41, 2779, 2},
+	{0xFB43, 2781, 2},
+	{0xFB44, 2783, 2},
+	{0xFB46, 2785, 2},
+	{0xFB47, 2787, 2},
+	{0xFB48, 2789, 2},
+	{0xFB49, 2791, 2},
+	{0xFB4A, 2793, 2},
+	{0xFB4B, 2795, 2},
+	{0xFB4C, 2797, 2},
+	{0xFB4D, 2799, 2},
+	{0xFB4E, 2801, 2},
+	{0x1109A, 2803, 2},
+	{0x1109C, 2805, 2},
+	{0x110AB, 2807, 2},
+	{0x1112E, 2809, 2},
+	{0x1112F, 2811, 2},
+	{0x1D15E, 2813, 2},
+	{0x1D15F, 2815, 2},
+	{0x1D160, 2817, 3},
+	{0x1D161, 2820, 3},
+	{0x1D162, 2823, 3},
+	{0x1D163, 2826, 3},
+	{0x1D164, 2829, 3},
+	{0x1D1BB, 2832, 2},
+	{0x1D1BC, 2834, 2},
+	{0x1D1BD, 2836, 3},
+	{0x1D1BE, 2839, 3},
+	{0x1D1BF, 2842, 3},
+	{0x1D1C0, 2845, 3},
+	{0x2F800, 2848, 1},
+	{0x2F801, 2849, 1},
+	{0x2F802, 2850, 1},
+	{0x2F803, 2851, 1},
+	{0x2F804, 2852, 1},
+	{0x2F805, 2853, 1},
+	{0x2F806, 2854, 1},
+	{0x2F807, 2855, 1},
+	{0x2F808, 2856, 1},
+	{0x2F809, 2857, 1},
+	{0x2F80A, 2858, 1},
+	{0x2F80B, 2859, 1},
+	{0x2F80C, 2860, 1},
+	{0x2F80D, 2861, 1},
+	{0x2F80E, 2862, 1},
+	{0x2F80F, 2863, 1},
+	{0x2F810, 2864, 1},
+	{0x2F811, 2865, 1},
+	{0x2F812, 2866, 1},
+	{0x2F813, 2867, 1},
+	{0x2F814, 2868, 1},
+	{0x2F815, 2869, 1},
+	{0x2F816, 2870, 1},
+	{0x2F817, 2871, 1},
+	{0x2F818, 2872, 1},
+	{0x2F819, 2873, 1},
+	{0x2F81A, 2874, 1},
+	{0x2F81B, 2875, 1},
+	{0x2F81C, 2876, 1},
+	{0x2F81D, 2877, 1},
+	{0x2F81E, 2878, 1},
+	{0x2F81F, 2879, 1},
+	{0x2F820, 2880, 1},
+	{0x2F821, 2881, 1},
+	{0x2F822, 2882, 1},
+	{0x2F823, 2883, 1},
+	{0x2F824, 2884, 1},
+	{0x2F825, 2885, 1},
+	{0x2F826, 2886, 1},
+	{0x2F827, 2887, 1},
+	{0x2F828, 2888, 1},
+	{0x2F829, 2889, 1},
+	{0x2F82A, 2890, 1},
+	{0x2F82B, 2891, 1},
+	{0x2F82C, 2892, 1},
+	{0x2F82D, 2893, 1},
+	{0x2F82E, 2894, 1},
+	{0x2F82F, 2895, 1},
+	{0x2F830, 2896, 1},
+	{0x2F831, 2897, 1},
+	{0x2F832, 2898, 1},
+	{0x2F833, 2899, 1},
+	{0x2F834, 2900, 1},
+	{0x2F835, 2901, 1},
+	{0x2F836, 2902, 1},
+	{0x2F837, 2903, 1},
+	{0x2F838, 2904, 1},
+	{0x2F839, 2905, 1},
+	{0x2F83A, 2906, 1},
+	{0x2F83B, 2907, 1},
+	{0x2F83C, 2908, 1},
+	{0x2F83D, 2909, 1},
+	{0x2F83E, 2910, 1},
+	{0x2F83F, 2911, 1},
+	{0x2F840, 2912, 1},
+	{0x2F841, 2913, 1},
+	{0x2F842, 2914, 1},
+	{0x2F843, 2915, 1},
+	{0x2F844, 2916, 1},
+	{0x2F845, 2917, 1},
+	{0x2F846, 2918, 1},
+	{0x2F847, 2919, 1},
+	{0x2F848, 2920, 1},
+	{0x2F849, 2921, 1},
+	{0x2F84A, 2922, 1},
+	{0x2F84B, 2923, 1},
+	{0x2F84C, 2924, 1},
+	{0x2F84D, 2925, 1},
+	{0x2F84E, 2926, 1},
+	{0x2F84F, 2927, 1},
+	{0x2F850, 2928, 1},
+	{0x2F851, 2929, 1},
+	{0x2F852, 2930, 1},
+	{0x2F853, 2931, 1},
+	{0x2F854, 2932, 1},
+	{0x2F855, 2933, 1},
+	{0x2F856, 2934, 1},
+	{0x2F857, 2935, 1},
+	{0x2F858, 2936, 1},
+	{0x2F859, 2937, 1},
+	{0x2F85A, 2938, 1},
+	{0x2F85B, 2939, 1},
+	{0x2F85C, 2940, 1},
+	{0x2F85D, 2941, 1},
+	{0x2F85E, 2942, 1},
+	{0x2F85F, 2943, 1},
+	{0x2F860, 2944, 1},
+	{0x2F861, 2945, 1},
+	{0x2F862, 2946, 1},
+	{0x2F863, 2947, 1},
+	{0x2F864, 2948, 1},
+	{0x2F865, 2949, 1},
+	{0x2F866, 2950, 1},
+	{0x2F867, 2951, 1},
+	{0x2F868, 2952, 1},
+	{0x2F869, 2953, 1},
+	{0x2F86A, 2954, 1},
+	{0x2F86B, 2955, 1},
+	{0x2F86C, 2956, 1},
+	{0x2F86D, 2957, 1},
+	{0x2F86E, 2958, 1},
+	{0x2F86F, 2959, 1},
+	{0x2F870, 2960, 1},
+	{0x2F871, 2961, 1},
+	{0x2F872, 2962, 1},
+	{0x2F873, 2963, 1},
+	{0x2F874, 2964, 1},
+	{0x2F875, 2965, 1},
+	{0x2F876, 2966, 1},
+	{0x2F877, 2967, 1},
+	{0x2F878, 2968, 1},
+	{0x2F879, 2969, 1},
+	{0x2F87A, 2970, 1},
+	{0x2F87B, 2971, 1},
+	{0x2F87C, 2972, 1},
+	{0x2F87D, 2973, 1},
+	{0x2F87E, 2974, 1},
+	{0x2F87F, 2975, 1},
+	{0x2F880, 2976, 1},
+	{0x2F881, 2977, 1},
+	{0x2F882, 2978, 1},
+	{0x2F883, 2979, 1},
+	{0x2F884, 2980, 1},
+	{0x2F885, 2981, 1},
+	{0x2F886, 2982, 1},
+	{0x2F887, 2983, 1},
+	{0x2F888, 2984, 1},
+	{0x2F889, 2985, 1},
+	{0x2F88A, 2986, 1},
+	{0x2F88B, 2987, 1},
+	{0x2F88C, 2988, 1},
+	{0x2F88D, 2989, 1},
+	{0x2F88E, 2990, 1},
+	{0x2F88F, 2991, 1},
+	{0x2F890, 2992, 1},
+	{0x2F891, 2993, 1},
+	{0x2F892, 2994, 1},
+	{0x2F893, 2995, 1},
+	{0x2F894, 2996, 1},
+	{0x2F895, 2997, 1},
+	{0x2F896, 2998, 1},
+	{0x2F897, 2999, 1},
+	{0x2F898, 3000, 1},
+	{0x2F899, 3001, 1},
+	{0x2F89A, 3002, 1},
+	{0x2F89B, 3003, 1},
+	{0x2F89C, 3004, 1},
+	{0x2F89D, 3005, 1},
+	{0x2F89E, 3006, 1},
+	{0x2F89F, 3007, 1},
+	{0x2F8A0, 3008, 1},
+	{0x2F8A1, 3009, 1},
+	{0x2F8A2, 3010, 1},
+	{0x2F8A3, 3011, 1},
+	{0x2F8A4, 3012, 1},
+	{0x2F8A5, 3013, 1},
+	{0x2F8A6, 3014, 1},
+	{0x2F8A7, 3015, 1},
+	{0x2F8A8, 3016, 1},
+	{0x2F8A9, 3017, 1},
+	{0x2F8AA, 3018, 1},
+	{0x2F8AB, 3019, 1},
+	{0x2F8AC, 3020, 1},
+	{0x2F8AD, 3021, 1},
+	{0x2F8AE, 3022, 1},
+	{0x2F8AF, 3023, 1},
+	{0x2F8B0, 3024, 1},
+	{0x2F8B1, 3025, 1},
+	{0x2F8B2, 3026, 1},
+	{0x2F8B3, 3027, 1},
+	{0x2F8B4, 3028, 1},
+	{0x2F8B5, 3029, 1},
+	{0x2F8B6, 3030, 1},
+	{0x2F8B7, 3031, 1},
+	{0x2F8B8, 3032, 1},
+	{0x2F8B9, 3033, 1},
+	{0x2F8BA, 3034, 1},
+	{0x2F8BB, 3035, 1},
+	{0x2F8BC, 3036, 1},
+	{0x2F8BD, 3037, 1},
+	{0x2F8BE, 3038, 1},
+	{0x2F8BF, 3039, 1},
+	{0x2F8C0, 3040, 1},
+	{0x2F8C1, 3041, 1},
+	{0x2F8C2, 3042, 1},
+	{0x2F8C3, 3043, 1},
+	{0x2F8C4, 3044, 1},
+	{0x2F8C5, 3045, 1},
+	{0x2F8C6, 3046, 1},
+	{0x2F8C7, 3047, 1},
+	{0x2F8C8, 3048, 1},
+	{0x2F8C9, 3049, 1},
+	{0x2F8CA, 3050, 1},
+	{0x2F8CB, 3051, 1},
+	{0x2F8CC, 3052, 1},
+	{0x2F8CD, 3053, 1},
+	{0x2F8CE, 3054, 1},
+	{0x2F8CF, 3055, 1},
+	{0x2F8D0, 3056, 1},
+	{0x2F8D1, 3057, 1},
+	{0x2F8D2, 3058, 1},
+	{0x2F8D3, 3059, 1},
+	{0x2F8D4, 3060, 1},
+	{0x2F8D5, 3061, 1},
+	{0x2F8D6, 3062, 1},
+	{0x2F8D7, 3063, 1},
+	{0x2F8D8, 3064, 1},
+	{0x2F8D9, 3065, 1},
+	{0x2F8DA, 3066, 1},
+	{0x2F8DB, 3067, 1},
+	{0x2F8DC, 3068, 1},
+	{0x2F8DD, 3069, 1},
+	{0x2F8DE, 3070, 1},
+	{0x2F8DF, 3071, 1},
+	{0x2F8E0, 3072, 1},
+	{0x2F8E1, 3073, 1},
+	{0x2F8E2, 3074, 1},
+	{0x2F8E3, 3075, 1},
+	{0x2F8E4, 3076, 1},
+	{0x2F8E5, 3077, 1},
+	{0x2F8E6, 3078, 1},
+	{0x2F8E7, 3079, 1},
+	{0x2F8E8, 3080, 1},
+	{0x2F8E9, 3081, 1},
+	{0x2F8EA, 3082, 1},
+	{0x2F8EB, 3083, 1},
+	{0x2F8EC, 3084, 1},
+	{0x2F8ED, 3085, 1},
+	{0x2F8EE, 3086, 1},
+	{0x2F8EF, 3087, 1},
+	{0x2F8F0, 3088, 1},
+	{0x2F8F1, 3089, 1},
+	{0x2F8F2, 3090, 1},
+	{0x2F8F3, 3091, 1},
+	{0x2F8F4, 3092, 1},
+	{0x2F8F5, 3093, 1},
+	{0x2F8F6, 3094, 1},
+	{0x2F8F7, 3095, 1},
+	{0x2F8F8, 3096, 1},
+	{0x2F8F9, 3097, 1},
+	{0x2F8FA, 3098, 1},
+	{0x2F8FB, 3099, 1},
+	{0x2F8FC, 3100, 1},
+	{0x2F8FD, 3101, 1},
+	{0x2F8FE, 3102, 1},
+	{0x2F8FF, 3103, 1},
+	{0x2F900, 3104, 1},
+	{0x2F901, 3105, 1},
+	{0x2F902, 3106, 1},
+	{0x2F903, 3107, 1},
+	{0x2F904, 3108, 1},
+	{0x2F905, 3109, 1},
+	{0x2F906, 3110, 1},
+	{0x2F907, 3111, 1},
+	{0x2F908, 3112, 1},
+	{0x2F909, 3113, 1},
+	{0x2F90A, 3114, 1},
+	{0x2F90B, 3115, 1},
+	{0x2F90C, 3116, 1},
+	{0x2F90D, 3117, 1},
+	{0x2F90E, 3118, 1},
+	{0x2F90F, 3119, 1},
+	{0x2F910, 3120, 1},
+	{0x2F911, 3121, 1},
+	{0x2F912, 3122, 1},
+	{0x2F913, 3123, 1},
+	{0x2F914, 3124, 1},
+	{0x2F915, 3125, 1},
+	{0x2F916, 3126, 1},
+	{0x2F917, 3127, 1},
+	{0x2F918, 3128, 1},
+	{0x2F919, 3129, 1},
+	{0x2F91A, 3130, 1},
+	{0x2F91B, 3131, 1},
+	{0x2F91C, 3132, 1},
+	{0x2F91D, 3133, 1},
+	{0x2F91E, 3134, 1},
+	{0x2F91F, 3135, 1},
+	{0x2F920, 3136, 1},
+	{0x2F921, 3137, 1},
+	{0x2F922, 3138, 1},
+	{0x2F923, 3139, 1},
+	{0x2F924, 3140, 1},
+	{0x2F925, 3141, 1},
+	{0x2F926, 3142, 1},
+	{0x2F927, 3143, 1},
+	{0x2F928, 3144, 1},
+	{0x2F929, 3145, 1},
+	{0x2F92A, 3146, 1},
+	{0x2F92B, 3147, 1},
+	{0x2F92C, 3148, 1},
+	{0x2F92D, 3149, 1},
+	{0x2F92E, 3150, 1},
+	{0x2F92F, 3151, 1},
+	{0x2F930, 3152, 1},
+	{0x2F931, 3153, 1},
+	{0x2F932, 3154, 1},
+	{0x2F933, 3155, 1},
+	{0x2F934, 3156, 1},
+	{0x2F935, 3157, 1},
+	{0x2F936, 3158, 1},
+	{0x2F937, 3159, 1},
+	{0x2F938, 3160, 1},
+	{0x2F939, 3161, 1},
+	{0x2F93A, 3162, 1},
+	{0x2F93B, 3163, 1},
+	{0x2F93C, 3164, 1},
+	{0x2F93D, 3165, 1},
+	{0x2F93E, 3166, 1},
+	{0x2F93F, 3167, 1},
+	{0x2F940, 3168, 1},
+	{0x2F941, 3169, 1},
+	{0x2F942, 3170, 1},
+	{0x2F943, 3171, 1},
+	{0x2F944, 3172, 1},
+	{0x2F945, 3173, 1},
+	{0x2F946, 3174, 1},
+	{0x2F947, 3175, 1},
+	{0x2F948, 3176, 1},
+	{0x2F949, 3177, 1},
+	{0x2F94A, 3178, 1},
+	{0x2F94B, 3179, 1},
+	{0x2F94C, 3180, 1},
+	{0x2F94D, 3181, 1},
+	{0x2F94E, 3182, 1},
+	{0x2F94F, 3183, 1},
+	{0x2F950, 3184, 1},
+	{0x2F951, 3185, 1},
+	{0x2F952, 3186, 1},
+	{0x2F953, 3187, 1},
+	{0x2F954, 3188, 1},
+	{0x2F955, 3189, 1},
+	{0x2F956, 3190, 1},
+	{0x2F957, 3191, 1},
+	{0x2F958, 3192, 1},
+	{0x2F959, 3193, 1},
+	{0x2F95A, 3194, 1},
+	{0x2F95B, 3195, 1},
+	{0x2F95C, 3196, 1},
+	{0x2F95D, 3197, 1},
+	{0x2F95E, 3198, 1},
+	{0x2F95F, 3199, 1},
+	{0x2F960, 3200, 1},
+	{0x2F961, 3201, 1},
+	{0x2F962, 3202, 1},
+	{0x2F963, 3203, 1},
+	{0x2F964, 3204, 1},
+	{0x2F965, 3205, 1},
+	{0x2F966, 3206, 1},
+	{0x2F967, 3207, 1},
+	{0x2F968, 3208, 1},
+	{0x2F969, 3209, 1},
+	{0x2F96A, 3210, 1},
+	{0x2F96B, 3211, 1},
+	{0x2F96C, 3212, 1},
+	{0x2F96D, 3213, 1},
+	{0x2F96E, 3214, 1},
+	{0x2F96F, 3215, 1},
+	{0x2F970, 3216, 1},
+	{0x2F971, 3217, 1},
+	{0x2F972, 3218, 1},
+	{0x2F973, 3219, 1},
+	{0x2F974, 3220, 1},
+	{0x2F975, 3221, 1},
+	{0x2F976, 3222, 1},
+	{0x2F977, 3223, 1},
+	{0x2F978, 3224, 1},
+	{0x2F979, 3225, 1},
+	{0x2F97A, 3226, 1},
+	{0x2F97B, 3227, 1},
+	{0x2F97C, 3228, 1},
+	{0x2F97D, 3229, 1},
+	{0x2F97E, 3230, 1},
+	{0x2F97F, 3231, 1},
+	{0x2F980, 3232, 1},
+	{0x2F981, 3233, 1},
+	{0x2F982, 3234, 1},
+	{0x2F983, 3235, 1},
+	{0x2F984, 3236, 1},
+	{0x2F985, 3237, 1},
+	{0x2F986, 3238, 1},
+	{0x2F987, 3239, 1},
+	{0x2F988, 3240, 1},
+	{0x2F989, 3241, 1},
+	{0x2F98A, 3242, 1},
+	{0x2F98B, 3243, 1},
+	{0x2F98C, 3244, 1},
+	{0x2F98D, 3245, 1},
+	{0x2F98E, 3246, 1},
+	{0x2F98F, 3247, 1},
+	{0x2F990, 3248, 1},
+	{0x2F991, 3249, 1},
+	{0x2F992, 3250, 1},
+	{0x2F993, 3251, 1},
+	{0x2F994, 3252, 1},
+	{0x2F995, 3253, 1},
+	{0x2F996, 3254, 1},
+	{0x2F997, 3255, 1},
+	{0x2F998, 3256, 1},
+	{0x2F999, 3257, 1},
+	{0x2F99A, 3258, 1},
+	{0x2F99B, 3259, 1},
+	{0x2F99C, 3260, 1},
+	{0x2F99D, 3261, 1},
+	{0x2F99E, 3262, 1},
+	{0x2F99F, 3263, 1},
+	{0x2F9A0, 3264, 1},
+	{0x2F9A1, 3265, 1},
+	{0x2F9A2, 3266, 1},
+	{0x2F9A3, 3267, 1},
+	{0x2F9A4, 3268, 1},
+	{0x2F9A5, 3269, 1},
+	{0x2F9A6, 3270, 1},
+	{0x2F9A7, 3271, 1},
+	{0x2F9A8, 3272, 1},
+	{0x2F9A9, 3273, 1},
+	{0x2F9AA, 3274, 1},
+	{0x2F9AB, 3275, 1},
+	{0x2F9AC, 3276, 1},
+	{0x2F9AD, 3277, 1},
+	{0x2F9AE, 3278, 1},
+	{0x2F9AF, 3279, 1},
+	{0x2F9B0, 3280, 1},
+	{0x2F9B1, 3281, 1},
+	{0x2F9B2, 3282, 1},
+	{0x2F9B3, 3283, 1},
+	{0x2F9B4, 3284, 1},
+	{0x2F9B5, 3285, 1},
+	{0x2F9B6, 3286, 1},
+	{0x2F9B7, 3287, 1},
+	{0x2F9B8, 3288, 1},
+	{0x2F9B9, 3289, 1},
+	{0x2F9BA, 3290, 1},
+	{0x2F9BB, 3291, 1},
+	{0x2F9BC, 3292, 1},
+	{0x2F9BD, 3293, 1},
+	{0x2F9BE, 3294, 1},
+	{0x2F9BF, 3295, 1},
+	{0x2F9C0, 3296, 1},
+	{0x2F9C1, 3297, 1},
+	{0x2F9C2, 3298, 1},
+	{0x2F9C3, 3299, 1},
+	{0x2F9C4, 3300, 1},
+	{0x2F9C5, 3301, 1},
+	{0x2F9C6, 3302, 1},
+	{0x2F9C7, 3303, 1},
+	{0x2F9C8, 3304, 1},
+	{0x2F9C9, 3305, 1},
+	{0x2F9CA, 3306, 1},
+	{0x2F9CB, 3307, 1},
+	{0x2F9CC, 3308, 1},
+	{0x2F9CD, 3309, 1},
+	{0x2F9CE, 3310, 1},
+	{0x2F9CF, 3311, 1},
+	{0x2F9D0, 3312, 1},
+	{0x2F9D1, 3313, 1},
+	{0x2F9D2, 3314, 1},
+	{0x2F9D3, 3315, 1},
+	{0x2F9D4, 3316, 1},
+	{0x2F9D5, 3317, 1},
+	{0x2F9D6, 3318, 1},
+	{0x2F9D7, 3319, 1},
+	{0x2F9D8, 3320, 1},
+	{0x2F9D9, 3321, 1},
+	{0x2F9DA, 3322, 1},
+	{0x2F9DB, 3323, 1},
+	{0x2F9DC, 3324, 1},
+	{0x2F9DD, 3325, 1},
+	{0x2F9DE, 3326, 1},
+	{0x2F9DF, 3327, 1},
+	{0x2F9E0, 3328, 1},
+	{0x2F9E1, 3329, 1},
+	{0x2F9E2, 3330, 1},
+	{0x2F9E3, 3331, 1},
+	{0x2F9E4, 3332, 1},
+	{0x2F9E5, 3333, 1},
+	{0x2F9E6, 3334, 1},
+	{0x2F9E7, 3335, 1},
+	{0x2F9E8, 3336, 1},
+	{0x2F9E9, 3337, 1},
+	{0x2F9EA, 3338, 1},
+	{0x2F9EB, 3339, 1},
+	{0x2F9EC, 3340, 1},
+	{0x2F9ED, 3341, 1},
+	{0x2F9EE, 3342, 1},
+	{0x2F9EF, 3343, 1},
+	{0x2F9F0, 3344, 1},
+	{0x2F9F1, 3345, 1},
+	{0x2F9F2, 3346, 1},
+	{0x2F9F3, 3347, 1},
+	{0x2F9F4, 3348, 1},
+	{0x2F9F5, 3349, 1},
+	{0x2F9F6, 3350, 1},
+	{0x2F9F7, 3351, 1},
+	{0x2F9F8, 3352, 1},
+	{0x2F9F9, 3353, 1},
+	{0x2F9FA, 3354, 1},
+	{0x2F9FB, 3355, 1},
+	{0x2F9FC, 3356, 1},
+	{0x2F9FD, 3357, 1},
+	{0x2F9FE, 3358, 1},
+	{0x2F9FF, 3359, 1},
+	{0x2FA00, 3360, 1},
+	{0x2FA01, 3361, 1},
+	{0x2FA02, 3362, 1},
+	{0x2FA03, 3363, 1},
+	{0x2FA04, 3364, 1},
+	{0x2FA05, 3365, 1},
+	{0x2FA06, 3366, 1},
+	{0x2FA07, 3367, 1},
+	{0x2FA08, 3368, 1},
+	{0x2FA09, 3369, 1},
+	{0x2FA0A, 3370, 1},
+	{0x2FA0B, 3371, 1},
+	{0x2FA0C, 3372, 1},
+	{0x2FA0D, 3373, 1},
+	{0x2FA0E, 3374, 1},
+	{0x2FA0F, 3375, 1},
+	{0x2FA10, 3376, 1},
+	{0x2FA11, 3377, 1},
+	{0x2FA12, 3378, 1},
+	{0x2FA13, 3379, 1},
+	{0x2FA14, 3380, 1},
+	{0x2FA15, 3381, 1},
+	{0x2FA16, 3382, 1},
+	{0x2FA17, 3383, 1},
+	{0x2FA18, 3384, 1},
+	{0x2FA19, 3385, 1},
+	{0x2FA1A, 3386, 1},
+	{0x2FA1B, 3387, 1},
+	{0x2FA1C, 3388, 1},
+	{0x2FA1D, 3389, 1},
+};
+const slice<const decomposition> canonical_decompositions(_canonical_decompositions);
+
+const decomposition _compat_decompositions[] = {
+	{0x00A0, 3390, 1},
+	{0x00A8, 3391, 2},
+	{0x00AA, 3393, 1},
+	{0x00AF, 3394, 2},
+	{0x00B2, 3396, 1},
+	{0x00B3, 3397, 1},
+	{0x00B4, 3398, 2},
+	{0x00B5, 3400, 1},
+	{0x00B8, 3401, 2},
+	{0x00B9, 3403, 1},
+	{0x00BA, 3404, 1},
+	{0x00BC, 3405, 3},
+	{0x00BD, 3408, 3},
+	{0x00BE, 3411, 3},
+	{0x0132, 3414, 2},
+	{0x0133, 3416, 2},
+	{0x013F, 3418, 2},
+	{0x0140, 3420, 2},
+	{0x0149, 3422, 2},
+	{0x017F, 3424, 1},
+	{0x01C4, 3425, 3},
+	{0x01C5, 3428, 3},
+	{0x01C6, 3431, 3},
+	{0x01C7, 3434, 2},
+	{0x01C8, 3436, 2},
+	{0x01C9, 3438, 2},
+	{0x01CA, 3440, 2},
+	{0x01CB, 3442, 2},
+	{0x01CC, 3444, 2},
+	{0x01F1, 3446, 2},
+	{0x01F2, 3448, 2},
+	{0x01F3, 3450, 2},
+	{0x02B0, 3452, 1},
+	{0x02B1, 3453, 1},
+	{0x02B2, 3454, 1},
+	{0x02B3, 3455, 1},
+	{0x02B4, 3456, 1},
+	{0x02B5, 3457, 1},
+	{0x02B6, 3458, 1},
+	{0x02B7, 3459, 1},
+	{0x02B8, 3460, 1},
+	{0x02D8, 3461, 2},
+	{0x02D9, 3463, 2},
+	{0x02DA, 3465, 2},
+	{0x02DB, 3467, 2},
+	{0x02DC, 3469, 2},
+	{0x02DD, 3471, 2},
+	{0x02E0, 3473, 1},
+	{0x02E1, 3474, 1},
+	{0x02E2, 3475, 1},
+	{0x02E3, 3476, 1},
+	{0x02E4, 3477, 1},
+	{0x037A, 3478, 2},
+	{0x0384, 3480, 2},
+	{0x0385, 3482, 3},
+	{0x03D0, 3485, 1},
+	{0x03D1, 3486, 1},
+	{0x03D2, 3487, 1},
+	{0x03D3, 3488, 2},
+	{0x03D4, 3490, 2},
+	{0x03D5, 3492, 1},
+	{0x03D6, 3493, 1},
+	{0x03F0, 3494, 1},
+	{0x03F1, 3495, 1},
+	{0x03F2, 3496, 1},
+	{0x03F4, 3497, 1},
+	{0x03F5, 3498, 1},
+	{0x03F9, 3499, 1},
+	{0x0587, 3500, 2},
+	{0x0675, 3502, 2},
+	{0x0676, 3504, 2},
+	{0x0677, 3506, 2},
+	{0x0678, 3508, 2},
+	{0x0E33, 3510, 2},
+	{0x0EB3, 3512, 2},
+	{0x0EDC, 3514, 2},
+	{0x0EDD, 3516, 2},
+	{0x0F0C, 3518, 1},
+	{0x0F77, 3519, 3},
+	{0x0F79, 3522, 3},
+	{0x10FC, 3525, 1},
+	{0x1D2C, 3526, 1},
+	{0x1D2D, 3527, 1},
+	{0x1D2E, 3528, 1},
+	{0x1D30, 3529, 1},
+	{0x1D31, 3530, 1},
+	{0x1D32, 3531, 1},
+	{0x1D33, 3532, 1},
+	{0x1D34, 3533, 1},
+	{0x1D35, 3534, 1},
+	{0x1D36, 3535, 1},
+	{0x1D37, 3536, 1},
+	{0x1D38, 3537, 1},
+	{0x1D39, 3538, 1},
+	{0x1D3A, 3539, 1},
+	{0x1D3C, 3540, 1},
+	{0x1D3D, 3541, 1},
+	{0x1D3E, 3542, 1},
+	{0x1D3F, 3543, 1},
+	{0x1D40, 3544, 1},
+	{0x1D41, 3545, 1},
+	{0x1D42, 3546, 1},
+	{0x1D43, 3547, 1},
+	{0x1D44, 3548, 1},
+	{0x1D45, 3549, 1},
+	{0x1D46, 3550, 1},
+	{0x1D47, 3551, 1},
+	{0x1D48, 3552, 1},
+	{0x1D49, 3553, 1},
+	{0x1D4A, 3554, 1},
+	{0x1D4B, 3555, 1},
+	{0x1D4C, 3556, 1},
+	{0x1D4D, 3557, 1},
+	{0x1D4F, 3558, 1},
+	{0x1D50, 3559, 1},
+	{0x1D51, 3560, 1},
+	{0x1D52, 3561, 1},
+	{0x1D53, 3562, 1},
+	{0x1D54, 3563, 1},
+	{0x1D55, 3564, 1},
+	{0x1D56, 3565, 1},
+	{0x1D57, 3566, 1},
+	{0x1D58, 3567, 1},
+	{0x1D59, 3568, 1},
+	{0x1D5A, 3569, 1},
+	{0x1D5B, 3570, 1},
+	{0x1D5C, 3571, 1},
+	{0x1D5D, 3572, 1},
+	{0x1D5E, 3573, 1},
+	{0x1D5F, 3574, 1},
+	{0x1D60, 3575, 1},
+	{0x1D61, 3576, 1},
+	{0x1D62, 3577, 1},
+	{0x1D63, 3578, 1},
+	{0x1D64, 3579, 1},
+	{0x1D65, 3580, 1},
+	{0x1D66, 3581, 1},
+	{0x1D67, 3582, 1},
+	{0x1D68, 3583, 1},
+	{0x1D69, 3584, 1},
+	{0x1D6A, 3585, 1},
+	{0x1D78, 3586, 1},
+	{0x1D9B, 3587, 1},
+	{0x1D9C, 3588, 1},
+	{0x1D9D, 3589, 1},
+	{0x1D9E, 3590, 1},
+	{0x1D9F, 3591, 1},
+	{0x1DA0, 3592, 1},
+	{0x1DA1, 3593, 1},
+	{0x1DA2, 3594, 1},
+	{0x1DA3, 3595, 1},
+	{0x1DA4, 3596, 1},
+	{0x1DA5, 3597, 1},
+	{0x1DA6, 3598, 1},
+	{0x1DA7, 3599, 1},
+	{0x1DA8, 3600, 1},
+	{0x1DA9, 3601, 1},
+	{0x1DAA, 3602, 1},
+	{0x1DAB, 3603, 1},
+	{0x1DAC, 3604, 1},
+	{0x1DAD, 3605, 1},
+	{0x1DAE, 3606, 1},
+	{0x1DAF, 3607, 1},
+	{0x1DB0, 3608, 1},
+	{0x1DB1, 3609, 1},
+	{0x1DB2, 3610, 1},
+	{0x1DB3, 3611, 1},
+	{0x1DB4, 3612, 1},
+	{0x1DB5, 3613, 1},
+	{0x1DB6, 3614, 1},
+	{0x1DB7, 3615, 1},
+	{0x1DB8, 3616, 1},
+	{0x1DB9, 3617, 1},
+	{0x1DBA, 3618, 1},
+	{0x1DBB, 3619, 1},
+	{0x1DBC, 3620, 1},
+	{0x1DBD, 3621, 1},
+	{0x1DBE, 3622, 1},
+	{0x1DBF, 3623, 1},
+	{0x1E9A, 3624, 2},
+	{0x1E9B, 3626, 2},
+	{0x1FBD, 3628, 2},
+	{0x1FBF, 3630, 2},
+	{0x1FC0, 3632, 2},
+	{0x1FC1, 3634, 3},
+	{0x1FCD, 3637, 3},
+	{0x1FCE, 3640, 3},
+	{0x1FCF, 3643, 3},
+	{0x1FDD, 3646, 3},
+	{0x1FDE, 3649, 3},
+	{0x1FDF, 3652, 3},
+	{0x1FED, 3655, 3},
+	{0x1FEE, 3658, 3},
+	{0x1FFD, 3661, 2},
+	{0x1FFE, 3663, 2},
+	{0x2000, 3665, 1},
+	{0x2001, 3666, 1},
+	{0x2002, 3667, 1},
+	{0x2003, 3668, 1},
+	{0x2004, 3669, 1},
+	{0x2005, 3670, 1},
+	{0x2006, 3671, 1},
+	{0x2007, 3672, 1},
+	{0x2008, 3673, 1},
+	{0x2009, 3674, 1},
+	{0x200A, 3675, 1},
+	{0x2011, 3676, 1},
+	{0x2017, 3677, 2},
+	{0x2024, 3679, 1},
+	{0x2025, 3680, 2},
+	{0x2026, 3682, 3},
+	{0x202F, 3685, 1},
+	{0x2033, 3686, 2},
+	{0x2034, 3688, 3},
+	{0x2036, 3691, 2},
+	{0x2037, 3693, 3},
+	{0x203C, 3696, 2},
+	{0x203E, 3698, 2},
+	{0x2047, 3700, 2},
+	{0x2048, 3702, 2},
+	{0x2049, 3704, 2},
+	{0x2057, 3706, 4},
+	{0x205F, 3710, 1},
+	{0x2070, 3711, 1},
+	{0x2071, 3712, 1},
+	{0x2074, 3713, 1},
+	{0x2075, 3714, 1},
+	{0x2076, 3715, 1},
+	{0x2077, 3716, 1},
+	{0x2078, 3717, 1},
+	{0x2079, 3718, 1},
+	{0x207A, 3719, 1},
+	{0x207B, 3720, 1},
+	{0x207C, 3721, 1},
+	{0x207D, 3722, 1},
+	{0x207E, 3723, 1},
+	{0x207F, 3724, 1},
+	{0x2080, 3725, 1},
+	{0x2081, 3726, 1},
+	{0x2082, 3727, 1},
+	{0x2083, 3728, 1},
+	{0x2084, 3729, 1},
+	{0x2085, 3730, 1},
+	{0x2086, 3731, 1},
+	{0x2087, 3732, 1},
+	{0x2088, 3733, 1},
+	{0x2089, 3734, 1},
+	{0x208A, 3735, 1},
+	{0x208B, 3736, 1},
+	{0x208C, 3737, 1},
+	{0x208D, 3738, 1},
+	{0x208E, 3739, 1},
+	{0x2090, 3740, 1},
+	{0x2091, 3741, 1},
+	{0x2092, 3742, 1},
+	{0x2093, 3743, 1},
+	{0x2094, 3744, 1},
+	{0x2095, 3745, 1},
+	{0x2096, 3746, 1},
+	{0x2097, 3747, 1},
+	{0x2098, 3748, 1},
+	{0x2099, 3749, 1},
+	{0x209A, 3750, 1},
+	{0x209B, 3751, 1},
+	{0x209C, 3752, 1},
+	{0x20A8, 3753, 2},
+	{0x2100, 3755, 3},
+	{0x2101, 3758, 3},
+	{0x2102, 3761, 1},
+	{0x2103, 3762, 2},
+	{0x2105, 3764, 3},
+	{0x2106, 3767, 3},
+	{0x2107, 3770, 1},
+	{0x2109, 3771, 2},
+	{0x210A, 3773, 1},
+	{0x210B, 3774, 1},
+	{0x210C, 3775, 1},
+	{0x210D, 3776, 1},
+	{0x210E, 3777, 1},
+	{0x210F, 3778, 1},
+	{0x2110, 3779, 1},
+	{0x2111, 3780, 1},
+	{0x2112, 3781, 1},
+	{0x2113, 3782, 1},
+	{0x2115, 3783, 1},
+	{0x2116, 3784, 2},
+	{0x2119, 3786, 1},
+	{0x211A, 3787, 1},
+	{0x211B, 3788, 1},
+	{0x211C, 3789, 1},
+	{0x211D, 3790, 1},
+	{0x2120, 3791, 2},
+	{0x2121, 3793, 3},
+	{0x2122, 3796, 2},
+	{0x2124, 3798, 1},
+	{0x2128, 3799, 1},
+	{0x212C, 3800, 1},
+	{0x212D, 3801, 1},
+	{0x212F, 3802, 1},
+	{0x2130, 3803, 1},
+	{0x2131, 3804, 1},
+	{0x2133, 3805, 1},
+	{0x2134, 3806, 1},
+	{0x2135, 3807, 1},
+	{0x2136, 3808, 1},
+	{0x2137, 3809, 1},
+	{0x2138, 3810, 1},
+	{0x2139, 3811, 1},
+	{0x213B, 3812, 3},
+	{0x213C, 3815, 1},
+	{0x213D, 3816, 1},
+	{0x213E, 3817, 1},
+	{0x213F, 3818, 1},
+	{0x2140, 3819, 1},
+	{0x2145, 3820, 1},
+	{0x2146, 3821, 1},
+	{0x2147, 3822, 1},
+	{0x2148, 3823, 1},
+	{0x2149, 3824, 1},
+	{0x2150, 3825, 3},
+	{0x2151, 3828, 3},
+	{0x2152, 3831, 4},
+	{0x2153, 3835, 3},
+	{0x2154, 3838, 3},
+	{0x2155, 3841, 3},
+	{0x2156, 3844, 3},
+	{0x2157, 3847, 3},
+	{0x2158, 3850, 3},
+	{0x2159, 3853, 3},
+	{0x215A, 3856, 3},
+	{0x215B, 3859, 3},
+	{0x215C, 3862, 3},
+	{0x215D, 3865, 3},
+	{0x215E, 3868, 3},
+	{0x215F, 3871, 2},
+	{0x2160, 3873, 1},
+	{0x2161, 3874, 2},
+	{0x2162, 3876, 3},
+	{0x2163, 3879, 2},
+	{0x2164, 3881, 1},
+	{0x2165, 3882, 2},
+	{0x2166, 3884, 3},
+	{0x2167, 3887, 4},
+	{0x2168, 3891, 2},
+	{0x2169, 3893, 1},
+	{0x216A, 3894, 2},
+	{0x216B, 3896, 3},
+	{0x216C, 3899, 1},
+	{0x216D, 3900, 1},
+	{0x216E, 3901, 1},
+	{0x216F, 3902, 1},
+	{0x2170, 3903, 1},
+	{0x2171, 3904, 2},
+	{0x2172, 3906, 3},
+	{0x2173, 3909, 2},
+	{0x2174, 3911, 1},
+	{0x2175, 3912, 2},
+	{0x2176, 3914, 3},
+	{0x2177, 3917, 4},
+	{0x2178, 3921, 2},
+	{0x2179, 3923, 1},
+	{0x217A, 3924, 2},
+	{0x217B, 3926, 3},
+	{0x217C, 3929, 1},
+	{0x217D, 3930, 1},
+	{0x217E, 3931, 1},
+	{0x217F, 3932, 1},
+	{0x2189, 3933, 3},
+	{0x222C, 3936, 2},
+	{0x222D, 3938, 3},
+	{0x222F, 3941, 2},
+	{0x2230, 3943, 3},
+	{0x2460, 3946, 1},
+	{0x2461, 3947, 1},
+	{0x2462, 3948, 1},
+	{0x2463, 3949, 1},
+	{0x2464, 3950, 1},
+	{0x2465, 3951, 1},
+	{0x2466, 3952, 1},
+	{0x2467, 3953, 1},
+	{0x2468, 3954, 1},
+	{0x2469, 3955, 2},
+	{0x246A, 3957, 2},
+	{0x246B, 3959, 2},
+	{0x246C, 3961, 2},
+	{0x246D, 3963, 2},
+	{0x246E, 3965, 2},
+	{0x246F, 3967, 2},
+	{0x2470, 3969, 2},
+	{0x2471, 3971, 2},
+	{0x2472, 3973, 2},
+	{0x2473, 3975, 2},
+	{0x2474, 3977, 3},
+	{0x2475, 3980, 3},
+	{0x2476, 3983, 3},
+	{0x2477, 3986, 3},
+	{0x2478, 3989, 3},
+	{0x2479, 3992, 3},
+	{0x247A, 3995, 3},
+	{0x247B, 3998, 3},
+	{0x247C, 4001, 3},
+	{0x247D, 4004, 4},
+	{0x247E, 4008, 4},
+	{0x247F, 4012, 4},
+	{0x2480, 4016, 4},
+	{0x2481, 4020, 4},
+	{0x2482, 4024, 4},
+	{0x2483, 4028, 4},
+	{0x2484, 4032, 4},
+	{0x2485, 4036, 4},
+	{0x2486, 4040, 4},
+	{0x2487, 4044, 4},
+	{0x2488, 4048, 2},
+	{0x2489, 4050, 2},
+	{0x248A, 4052, 2},
+	{0x248B, 4054, 2},
+	{0x248C, 4056, 2},
+	{0x248D, 4058, 2},
+	{0x248E, 4060, 2},
+	{0x248F, 4062, 2},
+	{0x2490, 4064, 2},
+	{0x2491, 4066, 3},
+	{0x2492, 4069, 3},
+	{0x2493, 4072, 3},
+	{0x2494, 4075, 3},
+	{0x2495, 4078, 3},
+	{0x2496, 4081, 3},
+	{0x2497, 4084, 3},
+	{0x2498, 4087, 3},
+	{0x2499, 4090, 3},
+	{0x249A, 4093, 3},
+	{0x249B, 4096, 3},
+	{0x249C, 4099, 3},
+	{0x249D, 4102, 3},
+	{0x249E, 4105, 3},
+	{0x249F, 4108, 3},
+	{0x24A0, 4111, 3},
+	{0x24A1, 4114, 3},
+	{0x24A2, 4117, 3},
+	{0x24A3, 4120, 3},
+	{0x24A4, 4123, 3},
+	{0x24A5, 4126, 3},
+	{0x24A6, 4129, 3},
+	{0x24A7, 4132, 3},
+	{0x24A8, 4135, 3},
+	{0x24A9, 4138, 3},
+	{0x24AA, 4141, 3},
+	{0x24AB, 4144, 3},
+	{0x24AC, 4147, 3},
+	{0x24AD, 4150, 3},
+	{0x24AE, 4153, 3},
+	{0x24AF, 4156, 3},
+	{0x24B0, 4159, 3},
+	{0x24B1, 4162, 3},
+	{0x24B2, 4165, 3},
+	{0x24B3, 4168, 3},
+	{0x24B4, 4171, 3},
+	{0x24B5, 4174, 3},
+	{0x24B6, 4177, 1},
+	{0x24B7, 4178, 1},
+	{0x24B8, 4179, 1},
+	{0x24B9, 4180, 1},
+	{0x24BA, 4181, 1},
+	{0x24BB, 4182, 1},
+	{0x24BC, 4183, 1},
+	{0x24BD, 4184, 1},
+	{0x24BE, 4185, 1},
+	{0x24BF, 4186, 1},
+	{0x24C0, 4187, 1},
+	{0x24C1, 4188, 1},
+	{0x24C2, 4189, 1},
+	{0x24C3, 4190, 1},
+	{0x24C4, 4191, 1},
+	{0x24C5, 4192, 1},
+	{0x24C6, 4193, 1},
+	{0x24C7, 4194, 1},
+	{0x24C8, 4195, 1},
+	{0x24C9, 4196, 1},
+	{0x24CA, 4197, 1},
+	{0x24CB, 4198, 1},
+	{0x24CC, 4199, 1},
+	{0x24CD, 4200, 1},
+	{0x24CE, 4201, 1},
+	{0x24CF, 4202, 1},
+	{0x24D0, 4203, 1},
+	{0x24D1, 4204, 1},
+	{0x24D2, 4205, 1},
+	{0x24D3, 4206, 1},
+	{0x24D4, 4207, 1},
+	{0x24D5, 4208, 1},
+	{0x24D6, 4209, 1},
+	{0x24D7, 4210, 1},
+	{0x24D8, 4211, 1},
+	{0x24D9, 4212, 1},
+	{0x24DA, 4213, 1},
+	{0x24DB, 4214, 1},
+	{0x24DC, 4215, 1},
+	{0x24DD, 4216, 1},
+	{0x24DE, 4217, 1},
+	{0x24DF, 4218, 1},
+	{0x24E0, 4219, 1},
+	{0x24E1, 4220, 1},
+	{0x24E2, 4221, 1},
+	{0x24E3, 4222, 1},
+	{0x24E4, 4223, 1},
+	{0x24E5, 4224, 1},
+	{0x24E6, 4225, 1},
+	{0x24E7, 4226, 1},
+	{0x24E8, 4227, 1},
+	{0x24E9, 4228, 1},
+	{0x24EA, 4229, 1},
+	{0x2A0C, 4230, 4},
+	{0x2A74, 4234, 3},
+	{0x2A75, 4237, 2},
+	{0x2A76, 4239, 3},
+	{0x2C7C, 4242, 1},
+	{0x2C7D, 4243, 1},
+	{0x2D6F, 4244, 1},
+	{0x2E9F, 4245, 1},
+	{0x2EF3, 4246, 1},
+	{0x2F00, 4247, 1},
+	{0x2F01, 4248, 1},
+	{0x2F02, 4249, 1},
+	{0x2F03, 4250, 1},
+	{0x2F04, 4251, 1},
+	{0x2F05, 4252, 1},
+	{0x2F06, 4253, 1},
+	{0x2F07, 4254, 1},
+	{0x2F08, 4255, 1},
+	{0x2F09, 4256, 1},
+	{0x2F0A, 4257, 1},
+	{0x2F0B, 4258, 1},
+	{0x2F0C, 4259, 1},
+	{0x2F0D, 4260, 1},
+	{0x2F0E, 4261, 1},
+	{0x2F0F, 4262, 1},
+	{0x2F10, 4263, 1},
+	{0x2F11, 4264, 1},
+	{0x2F12, 4265, 1},
+	{0x2F13, 4266, 1},
+	{0x2F14, 4267, 1},
+	{0x2F15, 4268, 1},
+	{0x2F16, 4269, 1},
+	{0x2F17, 4270, 1},
+	{0x2F18, 4271, 1},
+	{0x2F19, 4272, 1},
+	{0x2F1A, 4273, 1},
+	{0x2F1B, 4274, 1},
+	{0x2F1C, 4275, 1},
+	{0x2F1D, 4276, 1},
+	{0x2F1E, 4277, 1},
+	{0x2F1F, 4278, 1},
+	{0x2F20, 4279, 1},
+	{0x2F21, 4280, 1},
+	{0x2F22, 4281, 1},
+	{0x2F23, 4282, 1},
+	{0x2F24, 4283, 1},
+	{0x2F25, 4284, 1},
+	{0x2F26, 4285, 1},
+	{0x2F27, 4286, 1},
+	{0x2F28, 4287, 1},
+	{0x2F29, 4288, 1},
+	{0x2F2A, 4289, 1},
+	{0x2F2B, 4290, 1},
+	{0x2F2C, 4291, 1},
+	{0x2F2D, 4292, 1},
+	{0x2F2E, 4293, 1},
+	{0x2F2F, 4294, 1},
+	{0x2F30, 4295, 1},
+	{0x2F31, 4296, 1},
+	{0x2F32, 4297, 1},
+	{0x2F33, 4298, 1},
+	{0x2F34, 4299, 1},
+	{0x2F35, 4300, 1},
+	{0x2F36, 4301, 1},
+	{0x2F37, 4302, 1},
+	{0x2F38, 4303, 1},
+	{0x2F39, 4304, 1},
+	{0x2F3A, 4305, 1},
+	{0x2F3B, 4306, 1},
+	{0x2F3C, 4307, 1},
+	{0x2F3D, 4308, 1},
+	{0x2F3E, 4309, 1},
+	{0x2F3F, 4310, 1},
+	{0x2F40, 4311, 1},
+	{0x2F41, 4312, 1},
+	{0x2F42, 4313, 1},
+	{0x2F43, 4314, 1},
+	{0x2F44, 4315, 1},
+	{0x2F45, 4316, 1},
+	{0x2F46, 4317, 1},
+	{0x2F47, 4318, 1},
+	{0x2F48, 4319, 1},
+	{0x2F49, 4320, 1},
+	{0x2F4A, 4321, 1},
+	{0x2F4B, 4322, 1},
+	{0x2F4C, 4323, 1},
+	{0x2F4D, 4324, 1},
+	{0x2F4E, 4325, 1},
+	{0x2F4F, 4326, 1},
+	{0x2F50, 4327, 1},
+	{0x2F51, 4328, 1},
+	{0x2F52, 4329, 1},
+	{0x2F53, 4330, 1},
+	{0x2F54, 4331, 1},
+	{0x2F55, 4332, 1},
+	{0x2F56, 4333, 1},
+	{0x2F57, 4334, 1},
+	{0x2F58, 4335, 1},
+	{0x2F59, 4336, 1},
+	{0x2F5A, 4337, 1},
+	{0x2F5B, 4338, 1},
+	{0x2F5C, 4339, 1},
+	{0x2F5D, 4340, 1},
+	{0x2F5E, 4341, 1},
+	{0x2F5F, 4342, 1},
+	{0x2F60, 4343, 1},
+	{0x2F61, 4344, 1},
+	{0x2F62, 4345, 1},
+	{0x2F63, 4346, 1},
+	{0x2F64, 4347, 1},
+	{0x2F65, 4348, 1},
+	{0x2F66, 4349, 1},
+	{0x2F67, 4350, 1},
+	{0x2F68, 4351, 1},
+	{0x2F69, 4352, 1},
+	{0x2F6A, 4353, 1},
+	{0x2F6B, 4354, 1},
+	{0x2F6C, 4355, 1},
+	{0x2F6D, 4356, 1},
+	{0x2F6E, 4357, 1},
+	{0x2F6F, 4358, 1},
+	{0x2F70, 4359, 1},
+	{0x2F71, 4360, 1},
+	{0x2F72, 4361, 1},
+	{0x2F73, 4362, 1},
+	{0x2F74, 4363, 1},
+	{0x2F75, 4364, 1},
+	{0x2F76, 4365, 1},
+	{0x2F77, 4366, 1},
+	{0x2F78, 4367, 1},
+	{0x2F79, 4368, 1},
+	{0x2F7A, 4369, 1},
+	{0x2F7B, 4370, 1},
+	{0x2F7C, 4371, 1},
+	{0x2F7D, 4372, 1},
+	{0x2F7E, 4373, 1},
+	{0x2F7F, 4374, 1},
+	{0x2F80, 4375, 1},
+	{0x2F81, 4376, 1},
+	{0x2F82, 4377, 1},
+	{0x2F83, 4378, 1},
+	{0x2F84, 4379, 1},
+	{0x2F85, 4380, 1},
+	{0x2F86, 4381, 1},
+	{0x2F87, 4382, 1},
+	{0x2F88, 4383, 1},
+	{0x2F89, 4384, 1},
+	{0x2F8A, 4385, 1},
+	{0x2F8B, 4386, 1},
+	{0x2F8C, 4387, 1},
+	{0x2F8D, 4388, 1},
+	{0x2F8E, 4389, 1},
+	{0x2F8F, 4390, 1},
+	{0x2F90, 4391, 1},
+	{0x2F91, 4392, 1},
+	{0x2F92, 4393, 1},
+	{0x2F93, 4394, 1},
+	{0x2F94, 4395, 1},
+	{0x2F95, 4396, 1},
+	{0x2F96, 4397, 1},
+	{0x2F97, 4398, 1},
+	{0x2F98, 4399, 1},
+	{0x2F99, 4400, 1},
+	{0x2F9A, 4401, 1},
+	{0x2F9B, 4402, 1},
+	{0x2F9C, 4403, 1},
+	{0x2F9D, 4404, 1},
+	{0x2F9E, 4405, 1},
+	{0x2F9F, 4406, 1},
+	{0x2FA0, 4407, 1},
+	{0x2FA1, 4408, 1},
+	{0x2FA2, 4409, 1},
+	{0x2FA3, 4410, 1},
+	{0x2FA4, 4411, 1},
+	{0x2FA5, 4412, 1},
+	{0x2FA6, 4413, 1},
+	{0x2FA7, 4414, 1},
+	{0x2FA8, 4415, 1},
+	{0x2FA9, 4416, 1},
+	{0x2FAA, 4417, 1},
+	{0x2FAB, 4418, 1},
+	{0x2FAC, 4419, 1},
+	{0x2FAD, 4420, 1},
+	{0x2FAE, 4421, 1},
+	{0x2FAF, 4422, 1},
+	{0x2FB0, 4423, 1},
+	{0x2FB1, 4424, 1},
+	{0x2FB2, 4425, 1},
+	{0x2FB3, 4426, 1},
+	{0x2FB4, 4427, 1},
+	{0x2FB5, 4428, 1},
+	{0x2FB6, 4429, 1},
+	{0x2FB7, 4430, 1},
+	{0x2FB8, 4431, 1},
+	{0x2FB9, 4432, 1},
+	{0x2FBA, 4433, 1},
+	{0x2FBB, 4434, 1},
+	{0x2FBC, 4435, 1},
+	{0x2FBD, 4436, 1},
+	{0x2FBE, 4437, 1},
+	{0x2FBF, 4438, 1},
+	{0x2FC0, 4439, 1},
+	{0x2FC1, 4440, 1},
+	{0x2FC2, 4441, 1},
+	{0x2FC3, 4442, 1},
+	{0x2FC4, 4443, 1},
+	{0x2FC5, 4444, 1},
+	{0x2FC6, 4445, 1},
+	{0x2FC7, 4446, 1},
+	{0x2FC8, 4447, 1},
+	{0x2FC9, 4448, 1},
+	{0x2FCA, 4449, 1},
+	{0x2FCB, 4450, 1},
+	{0x2FCC, 4451, 1},
+	{0x2FCD, 4452, 1},
+	{0x2FCE, 4453, 1},
+	{0x2FCF, 4454, 1},
+	{0x2FD0, 4455, 1},
+	{0x2FD1, 4456, 1},
+	{0x2FD2, 4457, 1},
+	{0x2FD3, 4458, 1},
+	{0x2FD4, 4459, 1},
+	{0x2FD5, 4460, 1},
+	{0x3000, 4461, 1},
+	{0x3036, 4462, 1},
+	{0x3038, 4463, 1},
+	{0x3039, 4464, 1},
+	{0x303A, 4465, 1},
+	{0x309B, 4466, 2},
+	{0x309C, 4468, 2},
+	{0x309F, 4470, 2},
+	{0x30FF, 4472, 2},
+	{0x3131, 4474, 1},
+	{0x3132, 4475, 1},
+	{0x3133, 4476, 1},
+	{0x3134, 4477, 1},
+	{0x3135, 4478, 1},
+	{0x3136, 4479, 1},
+	{0x3137, 4480, 1},
+	{0x3138, 4481, 1},
+	{0x3139, 4482, 1},
+	{0x313A, 4483, 1},
+	{0x313B, 4484, 1},
+	{0x313C, 4485, 1},
+	{0x313D, 4486, 1},
+	{0x313E, 4487, 1},
+	{0x313F, 4488, 1},
+	{0x3140, 4489, 1},
+	{0x3141, 4490, 1},
+	{0x3142, 4491, 1},
+	{0x3143, 4492, 1},
+	{0x3144, 4493, 1},
+	{0x3145, 4494, 1},
+	{0x3146, 4495, 1},
+	{0x3147, 4496, 1},
+	{0x3148, 4497, 1},
+	{0x3149, 4498, 1},
+	{0x314A, 4499, 1},
+	{0x314B, 4500, 1},
+	{0x314C, 4501, 1},
+	{0x314D, 4502, 1},
+	{0x314E, 4503, 1},
+	{0x314F, 4504, 1},
+	{0x3150, 4505, 1},
+	{0x3151, 4506, 1},
+	{0x3152, 4507, 1},
+	{0x3153, 4508, 1},
+	{0x3154, 4509, 1},
+	{0x3155, 4510, 1},
+	{0x3156, 4511, 1},
+	{0x3157, 4512, 1},
+	{0x3158, 4513, 1},
+	{0x3159, 4514, 1},
+	{0x315A, 4515, 1},
+	{0x315B, 4516, 1},
+	{0x315C, 4517, 1},
+	{0x315D, 4518, 1},
+	{0x315E, 4519, 1},
+	{0x315F, 4520, 1},
+	{0x3160, 4521, 1},
+	{0x3161, 4522, 1},
+	{0x3162, 4523, 1},
+	{0x3163, 4524, 1},
+	{0x3164, 4525, 1},
+	{0x3165, 4526, 1},
+	{0x3166, 4527, 1},
+	{0x3167, 4528, 1},
+	{0x3168, 4529, 1},
+	{0x3169, 4530, 1},
+	{0x316A, 4531, 1},
+	{0x316B, 4532, 1},
+	{0x316C, 4533, 1},
+	{0x316D, 4534, 1},
+	{0x316E, 4535, 1},
+	{0x316F, 4536, 1},
+	{0x3170, 4537, 1},
+	{0x3171, 4538, 1},
+	{0x3172, 4539, 1},
+	{0x3173, 4540, 1},
+	{0x3174, 4541, 1},
+	{0x3175, 4542, 1},
+	{0x3176, 4543, 1},
+	{0x3177, 4544, 1},
+	{0x3178, 4545, 1},
+	{0x3179, 4546, 1},
+	{0x317A, 4547, 1},
+	{0x317B, 4548, 1},
+	{0x317C, 4549, 1},
+	{0x317D, 4550, 1},
+	{0x317E, 4551, 1},
+	{0x317F, 4552, 1},
+	{0x3180, 4553, 1},
+	{0x3181, 4554, 1},
+	{0x3182, 4555, 1},
+	{0x3183, 4556, 1},
+	{0x3184, 4557, 1},
+	{0x3185, 4558, 1},
+	{0x3186, 4559, 1},
+	{0x3187, 4560, 1},
+	{0x3188, 4561, 1},
+	{0x3189, 4562, 1},
+	{0x318A, 4563, 1},
+	{0x318B, 4564, 1},
+	{0x318C, 4565, 1},
+	{0x318D, 4566, 1},
+	{0x318E, 4567, 1},
+	{0x3192, 4568, 1},
+	{0x3193, 4569, 1},
+	{0x3194, 4570, 1},
+	{0x3195, 4571, 1},
+	{0x3196, 4572, 1},
+	{0x3197, 4573, 1},
+	{0x3198, 4574, 1},
+	{0x3199, 4575, 1},
+	{0x319A, 4576, 1},
+	{0x319B, 4577, 1},
+	{0x319C, 4578, 1},
+	{0x319D, 4579, 1},
+	{0x319E, 4580, 1},
+	{0x319F, 4581, 1},
+	{0x3200, 4582, 3},
+	{0x3201, 4585, 3},
+	{0x3202, 4588, 3},
+	{0x3203, 4591, 3},
+	{0x3204, 4594, 3},
+	{0x3205, 4597, 3},
+	{0x3206, 4600, 3},
+	{0x3207, 4603, 3},
+	{0x3208, 4606, 3},
+	{0x3209, 4609, 3},
+	{0x320A, 4612, 3},
+	{0x320B, 4615, 3},
+	{0x320C, 4618, 3},
+	{0x320D, 4621, 3},
+	{0x320E, 4624, 4},
+	{0x320F, 4628, 4},
+	{0x3210, 4632, 4},
+	{0x3211, 4636, 4},
+	{0x3212, 4640, 4},
+	{0x3213, 4644, 4},
+	{0x3214, 4648, 4},
+	{0x3215, 4652, 4},
+	{0x3216, 4656, 4},
+	{0x3217, 4660, 4},
+	{0x3218, 4664, 4},
+	{0x3219, 4668, 4},
+	{0x321A, 4672, 4},
+	{0x321B, 4676, 4},
+	{0x321C, 4680, 4},
+	{0x321D, 4684, 7},
+	{0x321E, 4691, 6},
+	{0x3220, 4697, 3},
+	{0x3221, 4700, 3},
+	{0x3222, 4703, 3},
+	{0x3223, 4706, 3},
+	{0x3224, 4709, 3},
+	{0x3225, 4712, 3},
+	{0x3226, 4715, 3},
+	{0x3227, 4718, 3},
+	{0x3228, 4721, 3},
+	{0x3229, 4724, 3},
+	{0x322A, 4727, 3},
+	{0x322B, 4730, 3},
+	{0x322C, 4733, 3},
+	{0x322D, 4736, 3},
+	{0x322E, 4739, 3},
+	{0x322F, 4742, 3},
+	{0x3230, 4745, 3},
+	{0x3231, 4748, 3},
+	{0x3232, 4751, 3},
+	{0x3233, 4754, 3},
+	{0x3234, 4757, 3},
+	{0x3235, 4760, 3},
+	{0x3236, 4763, 3},
+	{0x3237, 4766, 3},
+	{0x3238, 4769, 3},
+	{0x3239, 4772, 3},
+	{0x323A, 4775, 3},
+	{0x323B, 4778, 3},
+	{0x323C, 4781, 3},
+	{0x323D, 4784, 3},
+	{0x323E, 4787, 3},
+	{0x323F, 4790, 3},
+	{0x3240, 4793, 3},
+	{0x3241, 4796, 3},
+	{0x3242, 4799, 3},
+	{0x3243, 4802, 3},
+	{0x3244, 4805, 1},
+	{0x3245, 4806, 1},
+	{0x3246, 4807, 1},
+	{0x3247, 4808, 1},
+	{0x3250, 4809, 3},
+	{0x3251, 4812, 2},
+	{0x3252, 4814, 2},
+	{0x3253, 4816, 2},
+	{0x3254, 4818, 2},
+	{0x3255, 4820, 2},
+	{0x3256, 4822, 2},
+	{0x3257, 4824, 2},
+	{0x3258, 4826, 2},
+	{0x3259, 4828, 2},
+	{0x325A, 4830, 2},
+	{0x325B, 4832, 2},
+	{0x325C, 4834, 2},
+	{0x325D, 4836, 2},
+	{0x325E, 4838, 2},
+	{0x325F, 4840, 2},
+	{0x3260, 4842, 1},
+	{0x3261, 4843, 1},
+	{0x3262, 4844, 1},
+	{0x3263, 4845, 1},
+	{0x3264, 4846, 1},
+	{0x3265, 4847, 1},
+	{0x3266, 4848, 1},
+	{0x3267, 4849, 1},
+	{0x3268, 4850, 1},
+	{0x3269, 4851, 1},
+	{0x326A, 4852, 1},
+	{0x326B, 4853, 1},
+	{0x326C, 4854, 1},
+	{0x326D, 4855, 1},
+	{0x326E, 4856, 2},
+	{0x326F, 4858, 2},
+	{0x3270, 4860, 2},
+	{0x3271, 4862, 2},
+	{0x3272, 4864, 2},
+	{0x3273, 4866, 2},
+	{0x3274, 4868, 2},
+	{0x3275, 4870, 2},
+	{0x3276, 4872, 2},
+	{0x3277, 4874, 2},
+	{0x3278, 4876, 2},
+	{0x3279, 4878, 2},
+	{0x327A, 4880, 2},
+	{0x327B, 4882, 2},
+	{0x327C, 4884, 5},
+	{0x327D, 4889, 4},
+	{0x327E, 4893, 2},
+	{0x3280, 4895, 1},
+	{0x3281, 4896, 1},
+	{0x3282, 4897, 1},
+	{0x3283, 4898, 1},
+	{0x3284, 4899, 1},
+	{0x3285, 4900, 1},
+	{0x3286, 4901, 1},
+	{0x3287, 4902, 1},
+	{0x3288, 4903, 1},
+	{0x3289, 4904, 1},
+	{0x328A, 4905, 1},
+	{0x328B, 4906, 1},
+	{0x328C, 4907, 1},
+	{0x328D, 4908, 1},
+	{0x328E, 4909, 1},
+	{0x328F, 4910, 1},
+	{0x3290, 4911, 1},
+	{0x3291, 4912, 1},
+	{0x3292, 4913, 1},
+	{0x3293, 4914, 1},
+	{0x3294, 4915, 1},
+	{0x3295, 4916, 1},
+	{0x3296, 4917, 1},
+	{0x3297, 4918, 1},
+	{0x3298, 4919, 1},
+	{0x3299, 4920, 1},
+	{0x329A, 4921, 1},
+	{0x329B, 4922, 1},
+	{0x329C, 4923, 1},
+	{0x329D, 4924, 1},
+	{0x329E, 4925, 1},
+	{0x329F, 4926, 1},
+	{0x32A0, 4927, 1},
+	{0x32A1, 4928, 1},
+	{0x32A2, 4929, 1},
+	{0x32A3, 4930, 1},
+	{0x32A4, 4931, 1},
+	{0x32A5, 4932, 1},
+	{0x32A6, 4933, 1},
+	{0x32A7, 4934, 1},
+	{0x32A8, 4935, 1},
+	{0x32A9, 4936, 1},
+	{0x32AA, 4937, 1},
+	{0x32AB, 4938, 1},
+	{0x32AC, 4939, 1},
+	{0x32AD, 4940, 1},
+	{0x32AE, 4941, 1},
+	{0x32AF, 4942, 1},
+	{0x32B0, 4943, 1},
+	{0x32B1, 4944, 2},
+	{0x32B2, 4946, 2},
+	{0x32B3, 4948, 2},
+	{0x32B4, 4950, 2},
+	{0x32B5, 4952, 2},
+	{0x32B6, 4954, 2},
+	{0x32B7, 4956, 2},
+	{0x32B8, 4958, 2},
+	{0x32B9, 4960, 2},
+	{0x32BA, 4962, 2},
+	{0x32BB, 4964, 2},
+	{0x32BC, 4966, 2},
+	{0x32BD, 4968, 2},
+	{0x32BE, 4970, 2},
+	{0x32BF, 4972, 2},
+	{0x32C0, 4974, 2},
+	{0x32C1, 4976, 2},
+	{0x32C2, 4978, 2},
+	{0x32C3, 4980, 2},
+	{0x32C4, 4982, 2},
+	{0x32C5, 4984, 2},
+	{0x32C6, 4986, 2},
+	{0x32C7, 4988, 2},
+	{0x32C8, 4990, 2},
+	{0x32C9, 4992, 3},
+	{0x32CA, 4995, 3},
+	{0x32CB, 4998, 3},
+	{0x32CC, 5001, 2},
+	{0x32CD, 5003, 3},
+	{0x32CE, 5006, 2},
+	{0x32CF, 5008, 3},
+	{0x32D0, 5011, 1},
+	{0x32D1, 5012, 1},
+	{0x32D2, 5013, 1},
+	{0x32D3, 5014, 1},
+	{0x32D4, 5015, 1},
+	{0x32D5, 5016, 1},
+	{0x32D6, 5017, 1},
+	{0x32D7, 5018, 1},
+	{0x32D8, 5019, 1},
+	{0x32D9, 5020, 1},
+	{0x32DA, 5021, 1},
+	{0x32DB, 5022, 1},
+	{0x32DC, 5023, 1},
+	{0x32DD, 5024, 1},
+	{0x32DE, 5025, 1},
+	{0x32DF, 5026, 1},
+	{0x32E0, 5027, 1},
+	{0x32E1, 5028, 1},
+	{0x32E2, 5029, 1},
+	{0x32E3, 5030, 1},
+	{0x32E4, 5031, 1},
+	{0x32E5, 5032, 1},
+	{0x32E6, 5033, 1},
+	{0x32E7, 5034, 1},
+	{0x32E8, 5035, 1},
+	{0x32E9, 5036, 1},
+	{0x32EA, 5037, 1},
+	{0x32EB, 5038, 1},
+	{0x32EC, 5039, 1},
+	{0x32ED, 5040, 1},
+	{0x32EE, 5041, 1},
+	{0x32EF, 5042, 1},
+	{0x32F0, 5043, 1},
+	{0x32F1, 5044, 1},
+	{0x32F2, 5045, 1},
+	{0x32F3, 5046, 1},
+	{0x32F4, 5047, 1},
+	{0x32F5, 5048, 1},
+	{0x32F6, 5049, 1},
+	{0x32F7, 5050, 1},
+	{0x32F8, 5051, 1},
+	{0x32F9, 5052, 1},
+	{0x32FA, 5053, 1},
+	{0x32FB, 5054, 1},
+	{0x32FC, 5055, 1},
+	{0x32FD, 5056, 1},
+	{0x32FE, 5057, 1},
+	{0x3300, 5058, 5},
+	{0x3301, 5063, 4},
+	{0x3302, 5067, 5},
+	{0x3303, 5072, 3},
+	{0x3304, 5075, 5},
+	{0x3305, 5080, 3},
+	{0x3306, 5083, 3},
+	{0x3307, 5086, 6},
+	{0x3308, 5092, 4},
+	{0x3309, 5096, 3},
+	{0x330A, 5099, 3},
+	{0x330B, 5102, 3},
+	{0x330C, 5105, 4},
+	{0x330D, 5109, 4},
+	{0x330E, 5113, 4},
+	{0x330F, 5117, 4},
+	{0x3310, 5121, 4},
+	{0x3311, 5125, 4},
+	{0x3312, 5129, 4},
+	{0x3313, 5133, 6},
+	{0x3314, 5139, 2},
+	{0x3315, 5141, 6},
+	{0x3316, 5147, 6},
+	{0x3317, 5153, 5},
+	{0x3318, 5158, 4},
+	{0x3319, 5162, 6},
+	{0x331A, 5168, 6},
+	{0x331B, 5174, 4},
+	{0x331C, 5178, 3},
+	{0x331D, 5181, 3},
+	{0x331E, 5184, 4},
+	{0x331F, 5188, 4},
+	{0x3320, 5192, 5},
+	{0x3321, 5197, 5},
+	{0x3322, 5202, 3},
+	{0x3323, 5205, 3},
+	{0x3324, 5208, 4},
+	{0x3325, 5212, 3},
+	{0x3326, 5215, 3},
+	{0x3327, 5218, 2},
+	{0x3328, 5220, 2},
+	{0x3329, 5222, 3},
+	{0x332A, 5225, 3},
+	{0x332B, 5228, 6},
+	{0x332C, 5234, 4},
+	{0x332D, 5238, 5},
+	{0x332E, 5243, 6},
+	{0x332F, 5249, 4},
+	{0x3330, 5253, 3},
+	{0x3331, 5256, 3},
+	{0x3332, 5259, 6},
+	{0x3333, 5265, 4},
+	{0x3334, 5269, 6},
+	{0x3335, 5275, 3},
+	{0x3336, 5278, 5},
+	{0x3337, 5283, 3},
+	{0x3338, 5286, 4},
+	{0x3339, 5290, 3},
+	{0x333A, 5293, 4},
+	{0x333B, 5297, 5},
+	{0x333C, 5302, 4},
+	{0x333D, 5306, 5},
+	{0x333E, 5311, 4},
+	{0x333F, 5315, 2},
+	{0x3340, 5317, 5},
+	{0x3341, 5322, 3},
+	{0x3342, 5325, 3},
+	{0x3343, 5328, 4},
+	{0x3344, 5332, 3},
+	{0x3345, 5335, 3},
+	{0x3346, 5338, 3},
+	{0x3347, 5341, 5},
+	{0x3348, 5346, 4},
+	{0x3349, 5350, 2},
+	{0x334A, 5352, 6},
+	{0x334B, 5358, 3},
+	{0x334C, 5361, 5},
+	{0x334D, 5366, 4},
+	{0x334E, 5370, 4},
+	{0x334F, 5374, 3},
+	{0x3350, 5377, 3},
+	{0x3351, 5380, 4},
+	{0x3352, 5384, 2},
+	{0x3353, 5386, 4},
+	{0x3354, 5390, 5},
+	{0x3355, 5395, 2},
+	{0x3356, 5397, 6},
+	{0x3357, 5403, 3},
+	{0x3358, 5406, 2},
+	{0x3359, 5408, 2},
+	{0x335A, 5410, 2},
+	{0x335B, 5412, 2},
+	{0x335C, 5414, 2},
+	{0x335D, 5416, 2},
+	{0x335E, 5418, 2},
+	{0x335F, 5420, 2},
+	{0x3360, 5422, 2},
+	{0x3361, 5424, 2},
+	{0x3362, 5426, 3},
+	{0x3363, 5429, 3},
+	{0x3364, 5432, 3},
+	{0x3365, 5435, 3},
+	{0x3366, 5438, 3},
+	{0x3367, 5441, 3},
+	{0x3368, 5444, 3},
+	{0x3369, 5447, 3},
+	{0x336A, 5450, 3},
+	{0x336B, 5453, 3},
+	{0x336C, 5456, 3},
+	{0x336D, 5459, 3},
+	{0x336E, 5462, 3},
+	{0x336F, 5465, 3},
+	{0x3370, 5468, 3},
+	{0x3371, 5471, 3},
+	{0x3372, 5474, 2},
+	{0x3373, 5476, 2},
+	{0x3374, 5478, 3},
+	{0x3375, 5481, 2},
+	{0x3376, 5483, 2},
+	{0x3377, 5485, 2},
+	{0x3378, 5487, 3},
+	{0x3379, 5490, 3},
+	{0x337A, 5493, 2},
+	{0x337B, 5495, 2},
+	{0x337C, 5497, 2},
+	{0x337D, 5499, 2},
+	{0x337E, 5501, 2},
+	{0x337F, 5503, 4},
+	{0x3380, 5507, 2},
+	{0x3381, 5509, 2},
+	{0x3382, 5511, 2},
+	{0x3383, 5513, 2},
+	{0x3384, 5515, 2},
+	{0x3385, 5517, 2},
+	{0x3386, 5519, 2},
+	{0x3387, 5521, 2},
+	{0x3388, 5523, 3},
+	{0x3389, 5526, 4},
+	{0x338A, 5530, 2},
+	{0x338B, 5532, 2},
+	{0x338C, 5534, 2},
+	{0x338D, 5536, 2},
+	{0x338E, 5538, 2},
+	{0x338F, 5540, 2},
+	{0x3390, 5542, 2},
+	{0x3391, 5544, 3},
+	{0x3392, 5547, 3},
+	{0x3393, 5550, 3},
+	{0x3394, 5553, 3},
+	{0x3395, 5556, 2},
+	{0x3396, 5558, 2},
+	{0x3397, 5560, 2},
+	{0x3398, 5562, 2},
+	{0x3399, 5564, 2},
+	{0x339A, 5566, 2},
+	{0x339B, 5568, 2},
+	{0x339C, 5570, 2},
+	{0x339D, 5572, 2},
+	{0x339E, 5574, 2},
+	{0x339F, 5576, 3},
+	{0x33A0, 5579, 3},
+	{0x33A1, 5582, 2},
+	{0x33A2, 5584, 3},
+	{0x33A3, 5587, 3},
+	{0x33A4, 5590, 3},
+	{0x33A5, 5593, 2},
+	{0x33A6, 5595, 3},
+	{0x33A7, 5598, 3},
+	{0x33A8, 5601, 4},
+	{0x33A9, 5605, 2},
+	{0x33AA, 5607, 3},
+	{0x33AB, 5610, 3},
+	{0x33AC, 5613, 3},
+	{0x33AD, 5616, 3},
+	{0x33AE, 5619, 5},
+	{0x33AF, 5624, 6},
+	{0x33B0, 5630, 2},
+	{0x33B1, 5632, 2},
+	{0x33B2, 5634, 2},
+	{0x33B3, 5636, 2},
+	{0x33B4, 5638, 2},
+	{0x33B5, 5640, 2},
+	{0x33B6, 5642, 2},
+	{0x33B7, 5644, 2},
+	{0x33B8, 5646, 2},
+	{0x33B9, 5648, 2},
+	{0x33BA, 5650, 2},
+	{0x33BB, 5652, 2},
+	{0x33BC, 5654, 2},
+	{0x33BD, 5656, 2},
+	{0x33BE, 5658, 2},
+	{0x33BF, 5660, 2},
+	{0x33C0, 5662, 2},
+	{0x33C1, 5664, 2},
+	{0x33C2, 5666, 4},
+	{0x33C3, 5670, 2},
+	{0x33C4, 5672, 2},
+	{0x33C5, 5674, 2},
+	{0x33C6, 5676, 4},
+	{0x33C7, 5680, 3},
+	{0x33C8, 5683, 2},
+	{0x33C9, 5685, 2},
+	{0x33CA, 5687, 2},
+	{0x33CB, 5689, 2},
+	{0x33CC, 5691, 2},
+	{0x33CD, 5693, 2},
+	{0x33CE, 5695, 2},
+	{0x33CF, 5697, 2},
+	{0x33D0, 5699, 2},
+	{0x33D1, 5701, 2},
+	{0x33D2, 5703, 3},
+	{0x33D3, 5706, 2},
+	{0x33D4, 5708, 2},
+	{0x33D5, 5710, 3},
+	{0x33D6, 5713, 3},
+	{0x33D7, 5716, 2},
+	{0x33D8, 5718, 4},
+	{0x33D9, 5722, 3},
+	{0x33DA, 5725, 2},
+	{0x33DB, 5727, 2},
+	{0x33DC, 5729, 2},
+	{0x33DD, 5731, 2},
+	{0x33DE, 5733, 3},
+	{0x33DF, 5736, 3},
+	{0x33E0, 5739, 2},
+	{0x33E1, 5741, 2},
+	{0x33E2, 5743, 2},
+	{0x33E3, 5745, 2},
+	{0x33E4, 5747, 2},
+	{0x33E5, 5749, 2},
+	{0x33E6, 5751, 2},
+	{0x33E7, 5753, 2},
+	{0x33E8, 5755, 2},
+	{0x33E9, 5757, 3},
+	{0x33EA, 5760, 3},
+	{0x33EB, 5763, 3},
+	{0x33EC, 5766, 3},
+	{0x33ED, 5769, 3},
+	{0x33EE, 5772, 3},
+	{0x33EF, 5775, 3},
+	{0x33F0, 5778, 3},
+	{0x33F1, 5781, 3},
+	{0x33F2, 5784, 3},
+	{0x33F3, 5787, 3},
+	{0x33F4, 5790, 3},
+	{0x33F5, 5793, 3},
+	{0x33F6, 5796, 3},
+	{0x33F7, 5799, 3},
+	{0x33F8, 5802, 3},
+	{0x33F9, 5805, 3},
+	{0x33FA, 5808, 3},
+	{0x33FB, 5811, 3},
+	{0x33FC, 5814, 3},
+	{0x33FD, 5817, 3},
+	{0x33FE, 5820, 3},
+	{0x33FF, 5823, 3},
+	{0xA770, 5826, 1},
+	{0xA7F8, 5827, 1},
+	{0xA7F9, 5828, 1},
+	{0xFB00, 5829, 2},
+	{0xFB01, 5831, 2},
+	{0xFB02, 5833, 2},
+	{0xFB03, 5835, 3},
+	{0xFB04, 5838, 3},
+	{0xFB05, 5841, 2},
+	{0xFB06, 5843, 2},
+	{0xFB13, 5845, 2},
+	{0xFB14, 5847, 2},
+	{0xFB15, 5849, 2},
+	{0xFB16, 5851, 2},
+	{0xFB17, 5853, 2},
+	{0xFB20, 5855, 1},
+	{0xFB21, 5856, 1},
+	{0xFB22, 5857, 1},
+	{0xFB23, 5858, 1},
+	{0xFB24, 5859, 1},
+	{0xFB25, 5860, 1},
+	{0xFB26, 5861, 1},
+	{0xFB27, 5862, 1},
+	{0xFB28, 5863, 1},
+	{0xFB29, 5864, 1},
+	{0xFB4F, 5865, 2},
+	{0xFB50, 5867, 1},
+	{0xFB51, 5868, 1},
+	{0xFB52, 5869, 1},
+	{0xFB53, 5870, 1},
+	{0xFB54, 5871, 1},
+	{0xFB55, 5872, 1},
+	{0xFB56, 5873, 1},
+	{0xFB57, 5874, 1},
+	{0xFB58, 5875, 1},
+	{0xFB59, 5876, 1},
+	{0xFB5A, 5877, 1},
+	{0xFB5B, 5878, 1},
+	{0xFB5C, 5879, 1},
+	{0xFB5D, 5880, 1},
+	{0xFB5E, 5881, 1},
+	{0xFB5F, 5882, 1},
+	{0xFB60, 5883, 1},
+	{0xFB61, 5884, 1},
+	{0xFB62, 5885, 1},
+	{0xFB63, 5886, 1},
+	{0xFB64, 5887, 1},
+	{0xFB65, 5888, 1},
+	{0xFB66, 5889, 1},
+	{0xFB67, 5890, 1},
+	{0xFB68, 5891, 1},
+	{0xFB69, 5892, 1},
+	{0xFB6A, 5893, 1},
+	{0xFB6B, 5894, 1},
+	{0xFB6C, 5895, 1},
+	{0xFB6D, 5896, 1},
+	{0xFB6E, 5897, 1},
+	{0xFB6F, 5898, 1},
+	{0xFB70, 5899, 1},
+	{0xFB71, 5900, 1},
+	{0xFB72, 5901, 1},
+	{0xFB73, 5902, 1},
+	{0xFB74, 5903, 1},
+	{0xFB75, 5904, 1},
+	{0xFB76, 5905, 1},
+	{0xFB77, 5906, 1},
+	{0xFB78, 5907, 1},
+	{0xFB79, 5908, 1},
+	{0xFB7A, 5909, 1},
+	{0xFB7B, 5910, 1},
+	{0xFB7C, 5911, 1},
+	{0xFB7D, 5912, 1},
+	{0xFB7E, 5913, 1},
+	{0xFB7F, 5914, 1},
+	{0xFB80, 5915, 1},
+	{0xFB81, 5916, 1},
+	{0xFB82, 5917, 1},
+	{0xFB83, 5918, 1},
+	{0xFB84, 5919, 1},
+	{0xFB85, 5920, 1},
+	{0xFB86, 5921, 1},
+	{0xFB87, 5922, 1},
+	{0xFB88, 5923, 1},
+	{0xFB89, 5924, 1},
+	{0xFB8A, 5925, 1},
+	{0xFB8B, 5926, 1},
+	{0xFB8C, 5927, 1},
+	{0xFB8D, 5928, 1},
+	{0xFB8E, 5929, 1},
+	{0xFB8F, 5930, 1},
+	{0xFB90, 5931, 1},
+	{0xFB91, 5932, 1},
+	{0xFB92, 5933, 1},
+	{0xFB93, 5934, 1},
+	{0xFB94, 5935, 1},
+	{0xFB95, 5936, 1},
+	{0xFB96, 5937, 1},
+	{0xFB97, 5938, 1},
+	{0xFB98, 5939, 1},
+	{0xFB99, 5940, 1},
+	{0xFB9A, 5941, 1},
+	{0xFB9B, 5942, 1},
+	{0xFB9C, 5943, 1},
+	{0xFB9D, 5944, 1},
+	{0xFB9E, 5945, 1},
+	{0xFB9F, 5946, 1},
+	{0xFBA0, 5947, 1},
+	{0xFBA1, 5948, 1},
+	{0xFBA2, 5949, 1},
+	{0xFBA3, 5950, 1},
+	{0xFBA4, 5951, 2},
+	{0xFBA5, 5953, 2},
+	{0xFBA6, 5955, 1},
+	{0xFBA7, 5956, 1},
+	{0xFBA8, 5957, 1},
+	{0xFBA9, 5958, 1},
+	{0xFBAA, 5959, 1},
+	{0xFBAB, 5960, 1},
+	{0xFBAC, 5961, 1},
+	{0xFBAD, 5962, 1},
+	{0xFBAE, 5963, 1},
+	{0xFBAF, 5964, 1},
+	{0xFBB0, 5965, 2},
+	{0xFBB1, 5967, 2},
+	{0xFBD3, 5969, 1},
+	{0xFBD4, 5970, 1},
+	{0xFBD5, 5971, 1},
+	{0xFBD6, 5972, 1},
+	{0xFBD7, 5973, 1},
+	{0xFBD8, 5974, 1},
+	{0xFBD9, 5975, 1},
+	{0xFBDA, 5976, 1},
+	{0xFBDB, 5977, 1},
+	{0xFBDC, 5978, 1},
+	{0xFBDD, 5979, 2},
+	{0xFBDE, 5981, 1},
+	{0xFBDF, 5982, 1},
+	{0xFBE0, 5983, 1},
+	{0xFBE1, 5984, 1},
+	{0xFBE2, 5985, 1},
+	{0xFBE3, 5986, 1},
+	{0xFBE4, 5987, 1},
+	{0xFBE5, 5988, 1},
+	{0xFBE6, 5989, 1},
+	{0xFBE7, 5990, 1},
+	{0xFBE8, 5991, 1},
+	{0xFBE9, 5992, 1},
+	{0xFBEA, 5993, 3},
+	{0xFBEB, 5996, 3},
+	{0xFBEC, 5999, 3},
+	{0xFBED, 6002, 3},
+	{0xFBEE, 6005, 3},
+	{0xFBEF, 6008, 3},
+	{0xFBF0, 6011, 3},
+	{0xFBF1, 6014, 3},
+	{0xFBF2, 6017, 3},
+	{0xFBF3, 6020, 3},
+	{0xFBF4, 6023, 3},
+	{0xFBF5, 6026, 3},
+	{0xFBF6, 6029, 3},
+	{0xFBF7, 6032, 3},
+	{0xFBF8, 6035, 3},
+	{0xFBF9, 6038, 3},
+	{0xFBFA, 6041, 3},
+	{0xFBFB, 6044, 3},
+	{0xFBFC, 6047, 1},
+	{0xFBFD, 6048, 1},
+	{0xFBFE, 6049, 1},
+	{0xFBFF, 6050, 1},
+	{0xFC00, 6051, 3},
+	{0xFC01, 6054, 3},
+	{0xFC02, 6057, 3},
+	{0xFC03, 6060, 3},
+	{0xFC04, 6063, 3},
+	{0xFC05, 6066, 2},
+	{0xFC06, 6068, 2},
+	{0xFC07, 6070, 2},
+	{0xFC08, 6072, 2},
+	{0xFC09, 6074, 2},
+	{0xFC0A, 6076, 2},
+	{0xFC0B, 6078, 2},
+	{0xFC0C, 6080, 2},
+	{0xFC0D, 6082, 2},
+	{0xFC0E, 6084, 2},
+	{0xFC0F, 6086, 2},
+	{0xFC10, 6088, 2},
+	{0xFC11, 6090, 2},
+	{0xFC12, 6092, 2},
+	{0xFC13, 6094, 2},
+	{0xFC14, 6096, 2},
+	{0xFC15, 6098, 2},
+	{0xFC16, 6100, 2},
+	{0xFC17, 6102, 2},
+	{0xFC18, 6104, 2},
+	{0xFC19, 6106, 2},
+	{0xFC1A, 6108, 2},
+	{0xFC1B, 6110, 2},
+	{0xFC1C, 6112, 2},
+	{0xFC1D, 6114, 2},
+	{0xFC1E, 6116, 2},
+	{0xFC1F, 6118, 2},
+	{0xFC20, 6120, 2},
+	{0xFC21, 6122, 2},
+	{0xFC22, 6124, 2},
+	{0xFC23, 6126, 2},
+	{0xFC24, 6128, 2},
+	{0xFC25, 6130, 2},
+	{0xFC26, 6132, 2},
+	{0xFC27, 6134, 2},
+	{0xFC28, 6136, 2},
+	{0xFC29, 6138, 2},
+	{0xFC2A, 6140, 2},
+	{0xFC2B, 6142, 2},
+	{0xFC2C, 6144, 2},
+	{0xFC2D, 6146, 2},
+	{0xFC2E, 6148, 2},
+	{0xFC2F, 6150, 2},
+	{0xFC30, 6152, 2},
+	{0xFC31, 6154, 2},
+	{0xFC32, 6156, 2},
+	{0xFC33, 6158, 2},
+	{0xFC34, 6160, 2},
+	{0xFC35, 6162, 2},
+	{0xFC36, 6164, 2},
+	{0xFC37, 6166, 2},
+	{0xFC38, 6168, 2},
+	{0xFC39, 6170, 2},
+	{0xFC3A, 6172, 2},
+	{0xFC3B, 6174, 2},
+	{0xFC3C, 6176, 2},
+	{0xFC3D, 6178, 2},
+	{0xFC3E, 6180, 2},
+	{0xFC3F, 6182, 2},
+	{0xFC40, 6184, 2},
+	{0xFC41, 6186, 2},
+	{0xFC42, 6188, 2},
+	{0xFC43, 6190, 2},
+	{0xFC44, 6192, 2},
+	{0xFC45, 6194, 2},
+	{0xFC46, 6196, 2},
+	{0xFC47, 6198, 2},
+	{0xFC48, 6200, 2},
+	{0xFC49, 6202, 2},
+	{0xFC4A, 6204, 2},
+	{0xFC4B, 6206, 2},
+	{0xFC4C, 6208, 2},
+	{0xFC4D, 6210, 2},
+	{0xFC4E, 6212, 2},
+	{0xFC4F, 6214, 2},
+	{0xFC50, 6216, 2},
+	{0xFC51, 6218, 2},
+	{0xFC52, 6220, 2},
+	{0xFC53, 6222, 2},
+	{0xFC54, 6224, 2},
+	{0xFC55, 6226, 2},
+	{0xFC56, 6228, 2},
+	{0xFC57, 6230, 2},
+	{0xFC58, 6232, 2},
+	{0xFC59, 6234, 2},
+	{0xFC5A, 6236, 2},
+	{0xFC5B, 6238, 2},
+	{0xFC5C, 6240, 2},
+	{0xFC5D, 6242, 2},
+	{0xFC5E, 6244, 3},
+	{0xFC5F, 6247, 3},
+	{0xFC60, 6250, 3},
+	{0xFC61, 6253, 3},
+	{0xFC62, 6256, 3},
+	{0xFC63, 6259, 3},
+	{0xFC64, 6262, 3},
+	{0xFC65, 6265, 3},
+	{0xFC66, 6268, 3},
+	{0xFC67, 6271, 3},
+	{0xFC68, 6274, 3},
+	{0xFC69, 6277, 3},
+	{0xFC6A, 6280, 2},
+	{0xFC6B, 6282, 2},
+	{0xFC6C, 6284, 2},
+	{0xFC6D, 6286, 2},
+	{0xFC6E, 6288, 2},
+	{0xFC6F, 6290, 2},
+	{0xFC70, 6292, 2},
+	{0xFC71, 6294, 2},
+	{0xFC72, 6296, 2},
+	{0xFC73, 6298, 2},
+	{0xFC74, 6300, 2},
+	{0xFC75, 6302, 2},
+	{0xFC76, 6304, 2},
+	{0xFC77, 6306, 2},
+	{0xFC78, 6308, 2},
+	{0xFC79, 6310, 2},
+	{0xFC7A, 6312, 2},
+	{0xFC7B, 6314, 2},
+	{0xFC7C, 6316, 2},
+	{0xFC7D, 6318, 2},
+	{0xFC7E, 6320, 2},
+	{0xFC7F, 6322, 2},
+	{0xFC80, 6324, 2},
+	{0xFC81, 6326, 2},
+	{0xFC82, 6328, 2},
+	{0xFC83, 6330, 2},
+	{0xFC84, 6332, 2},
+	{0xFC85, 6334, 2},
+	{0xFC86, 6336, 2},
+	{0xFC87, 6338, 2},
+	{0xFC88, 6340, 2},
+	{0xFC89, 6342, 2},
+	{0xFC8A, 6344, 2},
+	{0xFC8B, 6346, 2},
+	{0xFC8C, 6348, 2},
+	{0xFC8D, 6350, 2},
+	{0xFC8E, 6352, 2},
+	{0xFC8F, 6354, 2},
+	{0xFC90, 6356, 2},
+	{0xFC91, 6358, 2},
+	{0xFC92, 6360, 2},
+	{0xFC93, 6362, 2},
+	{0xFC94, 6364, 2},
+	{0xFC95, 6366, 2},
+	{0xFC96, 6368, 2},
+	{0xFC97, 6370, 3},
+	{0xFC98, 6373, 3},
+	{0xFC99, 6376, 3},
+	{0xFC9A, 6379, 3},
+	{0xFC9B, 6382, 3},
+	{0xFC9C, 6385, 2},
+	{0xFC9D, 6387, 2},
+	{0xFC9E, 6389, 2},
+	{0xFC9F, 6391, 2},
+	{0xFCA0, 6393, 2},
+	{0xFCA1, 6395, 2},
+	{0xFCA2, 6397, 2},
+	{0xFCA3, 6399, 2},
+	{0xFCA4, 6401, 2},
+	{0xFCA5, 6403, 2},
+	{0xFCA6, 6405, 2},
+	{0xFCA7, 6407, 2},
+	{0xFCA8, 6409, 2},
+	{0xFCA9, 6411, 2},
+	{0xFCAA, 6413, 2},
+	{0xFCAB, 6415, 2},
+	{0xFCAC, 6417, 2},
+	{0xFCAD, 6419, 2},
+	{0xFCAE, 6421, 2},
+	{0xFCAF, 6423, 2},
+	{0xFCB0, 6425, 2},
+	{0xFCB1, 6427, 2},
+	{0xFCB2, 6429, 2},
+	{0xFCB3, 6431, 2},
+	{0xFCB4, 6433, 2},
+	{0xFCB5, 6435, 2},
+	{0xFCB6, 6437, 2},
+	{0xFCB7, 6439, 2},
+	{0xFCB8, 6441, 2},
+	{0xFCB9, 6443, 2},
+	{0xFCBA, 6445, 2},
+	{0xFCBB, 6447, 2},
+	{0xFCBC, 6449, 2},
+	{0xFCBD, 6451, 2},
+	{0xFCBE, 6453, 2},
+	{0xFCBF, 6455, 2},
+	{0xFCC0, 6457, 2},
+	{0xFCC1, 6459, 2},
+	{0xFCC2, 6461, 2},
+	{0xFCC3, 6463, 2},
+	{0xFCC4, 6465, 2},
+	{0xFCC5, 6467, 2},
+	{0xFCC6, 6469, 2},
+	{0xFCC7, 6471, 2},
+	{0xFCC8, 6473, 2},
+	{0xFCC9, 6475, 2},
+	{0xFCCA, 6477, 2},
+	{0xFCCB, 6479, 2},
+	{0xFCCC, 6481, 2},
+	{0xFCCD, 6483, 2},
+	{0xFCCE, 6485, 2},
+	{0xFCCF, 6487, 2},
+	{0xFCD0, 6489, 2},
+	{0xFCD1, 6491, 2},
+	{0xFCD2, 6493, 2},
+	{0xFCD3, 6495, 2},
+	{0xFCD4, 6497, 2},
+	{0xFCD5, 6499, 2},
+	{0xFCD6, 6501, 2},
+	{0xFCD7, 6503, 2},
+	{0xFCD8, 6505, 2},
+	{0xFCD9, 6507, 2},
+	{0xFCDA, 6509, 2},
+	{0xFCDB, 6511, 2},
+	{0xFCDC, 6513, 2},
+	{0xFCDD, 6515, 2},
+	{0xFCDE, 6517, 2},
+	{0xFCDF, 6519, 3},
+	{0xFCE0, 6522, 3},
+	{0xFCE1, 6525, 2},
+	{0xFCE2, 6527, 2},
+	{0xFCE3, 6529, 2},
+	{0xFCE4, 6531, 2},
+	{0xFCE5, 6533, 2},
+	{0xFCE6, 6535, 2},
+	{0xFCE7, 6537, 2},
+	{0xFCE8, 6539, 2},
+	{0xFCE9, 6541, 2},
+	{0xFCEA, 6543, 2},
+	{0xFCEB, 6545, 2},
+	{0xFCEC, 6547, 2},
+	{0xFCED, 6549, 2},
+	{0xFCEE, 6551, 2},
+	{0xFCEF, 6553, 2},
+	{0xFCF0, 6555, 2},
+	{0xFCF1, 6557, 2},
+	{0xFCF2, 6559, 3},
+	{0xFCF3, 6562, 3},
+	{0xFCF4, 6565, 3},
+	{0xFCF5, 6568, 2},
+	{0xFCF6, 6570, 2},
+	{0xFCF7, 6572, 2},
+	{0xFCF8, 6574, 2},
+	{0xFCF9, 6576, 2},
+	{0xFCFA, 6578, 2},
+	{0xFCFB, 6580, 2},
+	{0xFCFC, 6582, 2},
+	{0xFCFD, 6584, 2},
+	{0xFCFE, 6586, 2},
+	{0xFCFF, 6588, 2},
+	{0xFD00, 6590, 2},
+	{0xFD01, 6592, 2},
+	{0xFD02, 6594, 2},
+	{0xFD03, 6596, 2},
+	{0xFD04, 6598, 2},
+	{0xFD05, 6600, 2},
+	{0xFD06, 6602, 2},
+	{0xFD07, 6604, 2},
+	{0xFD08, 6606, 2},
+	{0xFD09, 6608, 2},
+	{0xFD0A, 6610, 2},
+	{0xFD0B, 6612, 2},
+	{0xFD0C, 6614, 2},
+	{0xFD0D, 6616, 2},
+	{0xFD0E, 6618, 2},
+	{0xFD0F, 6620, 2},
+	{0xFD10, 6622, 2},
+	{0xFD11, 6624, 2},
+	{0xFD12, 6626, 2},
+	{0xFD13, 6628, 2},
+	{0xFD14, 6630, 2},
+	{0xFD15, 6632, 2},
+	{0xFD16, 6634, 2},
+	{0xFD17, 6636, 2},
+	{0xFD18, 6638, 2},
+	{0xFD19, 6640, 2},
+	{0xFD1A, 6642, 2},
+	{0xFD1B, 6644, 2},
+	{0xFD1C, 6646, 2},
+	{0xFD1D, 6648, 2},
+	{0xFD1E, 6650, 2},
+	{0xFD1F, 6652, 2},
+	{0xFD20, 6654, 2},
+	{0xFD21, 6656, 2},
+	{0xFD22, 6658, 2},
+	{0xFD23, 6660, 2},
+	{0xFD24, 6662, 2},
+	{0xFD25, 6664, 2},
+	{0xFD26, 6666, 2},
+	{0xFD27, 6668, 2},
+	{0xFD28, 6670, 2},
+	{0xFD29, 6672, 2},
+	{0xFD2A, 6674, 2},
+	{0xFD2B, 6676, 2},
+	{0xFD2C, 6678, 2},
+	{0xFD2D, 6680, 2},
+	{0xFD2E, 6682, 2},
+	{0xFD2F, 6684, 2},
+	{0xFD30, 6686, 2},
+	{0xFD31, 6688, 2},
+	{0xFD32, 6690, 2},
+	{0xFD33, 6692, 2},
+	{0xFD34, 6694, 2},
+	{0xFD35, 6696, 2},
+	{0xFD36, 6698, 2},
+	{0xFD37, 6700, 2},
+	{0xFD38, 6702, 2},
+	{0xFD39, 6704, 2},
+	{0xFD3A, 6706, 2},
+	{0xFD3B, 6708, 2},
+	{0xFD3C, 6710, 2},
+	{0xFD3D, 6712, 2},
+	{0xFD50, 6714, 3},
+	{0xFD51, 6717, 3},
+	{0xFD52, 6720, 3},
+	{0xFD53, 6723, 3},
+	{0xFD54, 6726, 3},
+	{0xFD55, 6729, 3},
+	{0xFD56, 6732, 3},
+	{0xFD57, 6735, 3},
+	{0xFD58, 6738, 3},
+	{0xFD59, 6741, 3},
+	{0xFD5A, 6744, 3},
+	{0xFD5B, 6747, 3},
+	{0xFD5C, 6750, 3},
+	{0xFD5D, 6753, 3},
+	{0xFD5E, 6756, 3},
+	{0xFD5F, 6759, 3},
+	{0xFD60, 6762, 3},
+	{0xFD61, 6765, 3},
+	{0xFD62, 6768, 3},
+	{0xFD63, 6771, 3},
+	{0xFD64, 6774, 3},
+	{0xFD65, 6777, 3},
+	{0xFD66, 6780, 3},
+	{0xFD67, 6783, 3},
+	{0xFD68, 6786, 3},
+	{0xFD69, 6789, 3},
+	{0xFD6A, 6792, 3},
+	{0xFD6B, 6795, 3},
+	{0xFD6C, 6798, 3},
+	{0xFD6D, 6801, 3},
+	{0xFD6E, 6804, 3},
+	{0xFD6F, 6807, 3},
+	{0xFD70, 6810, 3},
+	{0xFD71, 6813, 3},
+	{0xFD72, 6816, 3},
+	{0xFD73, 6819, 3},
+	{0xFD74, 6822, 3},
+	{0xFD75, 6825, 3},
+	{0xFD76, 6828, 3},
+	{0xFD77, 6831, 3},
+	{0xFD78, 6834, 3},
+	{0xFD79, 6837, 3},
+	{0xFD7A, 6840, 3},
+	{0xFD7B, 6843, 3},
+	{0xFD7C, 6846, 3},
+	{0xFD7D, 6849, 3},
+	{0xFD7E, 6852, 3},
+	{0xFD7F, 6855, 3},
+	{0xFD80, 6858, 3},
+	{0xFD81, 6861, 3},
+	{0xFD82, 6864, 3},
+	{0xFD83, 6867, 3},
+	{0xFD84, 6870, 3},
+	{0xFD85, 6873, 3},
+	{0xFD86, 6876, 3},
+	{0xFD87, 6879, 3},
+	{0xFD88, 6882, 3},
+	{0xFD89, 6885, 3},
+	{0xFD8A, 6888, 3},
+	{0xFD8B, 6891, 3},
+	{0xFD8C, 6894, 3},
+	{0xFD8D, 6897, 3},
+	{0xFD8E, 6900, 3},
+	{0xFD8F, 6903, 3},
+	{0xFD92, 6906, 3},
+	{0xFD93, 6909, 3},
+	{0xFD94, 6912, 3},
+	{0xFD95, 6915, 3},
+	{0xFD96, 6918, 3},
+	{0xFD97, 6921, 3},
+	{0xFD98, 6924, 3},
+	{0xFD99, 6927, 3},
+	{0xFD9A, 6930, 3},
+	{0xFD9B, 6933, 3},
+	{0xFD9C, 6936, 3},
+	{0xFD9D, 6939, 3},
+	{0xFD9E, 6942, 3},
+	{0xFD9F, 6945, 3},
+	{0xFDA0, 6948, 3},
+	{0xFDA1, 6951, 3},
+	{0xFDA2, 6954, 3},
+	{0xFDA3, 6957, 3},
+	{0xFDA4, 6960, 3},
+	{0xFDA5, 6963, 3},
+	{0xFDA6, 6966, 3},
+	{0xFDA7, 6969, 3},
+	{0xFDA8, 6972, 3},
+	{0xFDA9, 6975, 3},
+	{0xFDAA, 6978, 3},
+	{0xFDAB, 6981, 3},
+	{0xFDAC, 6984, 3},
+	{0xFDAD, 6987, 3},
+	{0xFDAE, 6990, 3},
+	{0xFDAF, 6993, 3},
+	{0xFDB0, 6996, 3},
+	{0xFDB1, 6999, 3},
+	{0xFDB2, 7002, 3},
+	{0xFDB3, 7005, 3},
+	{0xFDB4, 7008, 3},
+	{0xFDB5, 7011, 3},
+	{0xFDB6, 7014, 3},
+	{0xFDB7, 7017, 3},
+	{0xFDB8, 7020, 3},
+	{0xFDB9, 7023, 3},
+	{0xFDBA, 7026, 3},
+	{0xFDBB, 7029, 3},
+	{0xFDBC, 7032, 3},
+	{0xFDBD, 7035, 3},
+	{0xFDBE, 7038, 3},
+	{0xFDBF, 7041, 3},
+	{0xFDC0, 7044, 3},
+	{0xFDC1, 7047, 3},
+	{0xFDC2, 7050, 3},
+	{0xFDC3, 7053, 3},
+	{0xFDC4, 7056, 3},
+	{0xFDC5, 7059, 3},
+	{0xFDC6, 7062, 3},
+	{0xFDC7, 7065, 3},
+	{0xFDF0, 7068, 3},
+	{0xFDF1, 7071, 3},
+	{0xFDF2, 7074, 4},
+	{0xFDF3, 7078, 4},
+	{0xFDF4, 7082, 4},
+	{0xFDF5, 7086, 4},
+	{0xFDF6, 7090, 4},
+	{0xFDF7, 7094, 4},
+	{0xFDF8, 7098, 4},
+	{0xFDF9, 7102, 3},
+	{0xFDFA, 7105, 18},
+	{0xFDFB, 7123, 8},
+	{0xFDFC, 7131, 4},
+	{0xFE10, 7135, 1},
+	{0xFE11, 7136, 1},
+	{0xFE12, 7137, 1},
+	{0xFE13, 7138, 1},
+	{0xFE14, 7139, 1},
+	{0xFE15, 7140, 1},
+	{0xFE16, 7141, 1},
+	{0xFE17, 7142, 1},
+	{0xFE18, 7143, 1},
+	{0xFE19, 7144, 3},
+	{0xFE30, 7147, 2},
+	{0xFE31, 7149, 1},
+	{0xFE32, 7150, 1},
+	{0xFE33, 7151, 1},
+	{0xFE34, 7152, 1},
+	{0xFE35, 7153, 1},
+	{0xFE36, 7154, 1},
+	{0xFE37, 7155, 1},
+	{0xFE38, 7156, 1},
+	{0xFE39, 7157, 1},
+	{0xFE3A, 7158, 1},
+	{0xFE3B, 7159, 1},
+	{0xFE3C, 7160, 1},
+	{0xFE3D, 7161, 1},
+	{0xFE3E, 7162, 1},
+	{0xFE3F, 7163, 1},
+	{0xFE40, 7164, 1},
+	{0xFE41, 7165, 1},
+	{0xFE42, 7166, 1},
+	{0xFE43, 7167, 1},
+	{0xFE44, 7168, 1},
+	{0xFE47, 7169, 1},
+	{0xFE48, 7170, 1},
+	{0xFE49, 7171, 2},
+	{0xFE4A, 7173, 2},
+	{0xFE4B, 7175, 2},
+	{0xFE4C, 7177, 2},
+	{0xFE4D, 7179, 1},
+	{0xFE4E, 7180, 1},
+	{0xFE4F, 7181, 1},
+	{0xFE50, 7182, 1},
+	{0xFE51, 7183, 1},
+	{0xFE52, 7184, 1},
+	{0xFE54, 7185, 1},
+	{0xFE55, 7186, 1},
+	{0xFE56, 7187, 1},
+	{0xFE57, 7188, 1},
+	{0xFE58, 7189, 1},
+	{0xFE59, 7190, 1},
+	{0xFE5A, 7191, 1},
+	{0xFE5B, 7192, 1},
+	{0xFE5C, 7193, 1},
+	{0xFE5D, 7194, 1},
+	{0xFE5E, 7195, 1},
+	{0xFE5F, 7196, 1},
+	{0xFE60, 7197, 1},
+	{0xFE61, 7198, 1},
+	{0xFE62, 7199, 1},
+	{0xFE63, 7200, 1},
+	{0xFE64, 7201, 1},
+	{0xFE65, 7202, 1},
+	{0xFE66, 7203, 1},
+	{0xFE68, 7204, 1},
+	{0xFE69, 7205, 1},
+	{0xFE6A, 7206, 1},
+	{0xFE6B, 7207, 1},
+	{0xFE70, 7208, 2},
+	{0xFE71, 7210, 2},
+	{0xFE72, 7212, 2},
+	{0xFE74, 7214, 2},
+	{0xFE76, 7216, 2},
+	{0xFE77, 7218, 2},
+	{0xFE78, 7220, 2},
+	{0xFE79, 7222, 2},
+	{0xFE7A, 7224, 2},
+	{0xFE7B, 7226, 2},
+	{0xFE7C, 7228, 2},
+	{0xFE7D, 7230, 2},
+	{0xFE7E, 7232, 2},
+	{0xFE7F, 7234, 2},
+	{0xFE80, 7236, 1},
+	{0xFE81, 7237, 2},
+	{0xFE82, 7239, 2},
+	{0xFE83, 7241, 2},
+	{0xFE84, 7243, 2},
+	{0xFE85, 7245, 2},
+	{0xFE86, 7247, 2},
+	{0xFE87, 7249, 2},
+	{0xFE88, 7251, 2},
+	{0xFE89, 7253, 2},
+	{0xFE8A, 7255, 2},
+	{0xFE8B, 7257, 2},
+	{0xFE8C, 7259, 2},
+	{0xFE8D, 7261, 1},
+	{0xFE8E, 7262, 1},
+	{0xFE8F, 7263, 1},
+	{0xFE90, 7264, 1},
+	{0xFE91, 7265, 1},
+	{0xFE92, 7266, 1},
+	{0xFE93, 7267, 1},
+	{0xFE94, 7268, 1},
+	{0xFE95, 7269, 1},
+	{0xFE96, 7270, 1},
+	{0xFE97, 7271, 1},
+	{0xFE98, 7272, 1},
+	{0xFE99, 7273, 1},
+	{0xFE9A, 7274, 1},
+	{0xFE9B, 7275, 1},
+	{0xFE9C, 7276, 1},
+	{0xFE9D, 7277, 1},
+	{0xFE9E, 7278, 1},
+	{0xFE9F, 7279, 1},
+	{0xFEA0, 7280, 1},
+	{0xFEA1, 7281, 1},
+	{0xFEA2, 7282, 1},
+	{0xFEA3, 7283, 1},
+	{0xFEA4, 7284, 1},
+	{0xFEA5, 7285, 1},
+	{0xFEA6, 7286, 1},
+	{0xFEA7, 7287, 1},
+	{0xFEA8, 7288, 1},
+	{0xFEA9, 7289, 1},
+	{0xFEAA, 7290, 1},
+	{0xFEAB, 7291, 1},
+	{0xFEAC, 7292, 1},
+	{0xFEAD, 7293, 1},
+	{0xFEAE, 7294, 1},
+	{0xFEAF, 7295, 1},
+	{0xFEB0, 7296, 1},
+	{0xFEB1, 7297, 1},
+	{0xFEB2, 7298, 1},
+	{0xFEB3, 7299, 1},
+	{0xFEB4, 7300, 1},
+	{0xFEB5, 7301, 1},
+	{0xFEB6, 7302, 1},
+	{0xFEB7, 7303, 1},
+	{0xFEB8, 7304, 1},
+	{0xFEB9, 7305, 1},
+	{0xFEBA, 7306, 1},
+	{0xFEBB, 7307, 1},
+	{0xFEBC, 7308, 1},
+	{0xFEBD, 7309, 1},
+	{0xFEBE, 7310, 1},
+	{0xFEBF, 7311, 1},
+	{0xFEC0, 7312, 1},
+	{0xFEC1, 7313, 1},
+	{0xFEC2, 7314, 1},
+	{0xFEC3, 7315, 1},
+	{0xFEC4, 7316, 1},
+	{0xFEC5, 7317, 1},
+	{0xFEC6, 7318, 1},
+	{0xFEC7, 7319, 1},
+	{0xFEC8, 7320, 1},
+	{0xFEC9, 7321, 1},
+	{0xFECA, 7322, 1},
+	{0xFECB, 7323, 1},
+	{0xFECC, 7324, 1},
+	{0xFECD, 7325, 1},
+	{0xFECE, 7326, 1},
+	{0xFECF, 7327, 1},
+	{0xFED0, 7328, 1},
+	{0xFED1, 7329, 1},
+	{0xFED2, 7330, 1},
+	{0xFED3, 7331, 1},
+	{0xFED4, 7332, 1},
+	{0xFED5, 7333, 1},
+	{0xFED6, 7334, 1},
+	{0xFED7, 7335, 1},
+	{0xFED8, 7336, 1},
+	{0xFED9, 7337, 1},
+	{0xFEDA, 7338, 1},
+	{0xFEDB, 7339, 1},
+	{0xFEDC, 7340, 1},
+	{0xFEDD, 7341, 1},
+	{0xFEDE, 7342, 1},
+	{0xFEDF, 7343, 1},
+	{0xFEE0, 7344, 1},
+	{0xFEE1, 7345, 1},
+	{0xFEE2, 7346, 1},
+	{0xFEE3, 7347, 1},
+	{0xFEE4, 7348, 1},
+	{0xFEE5, 7349, 1},
+	{0xFEE6, 7350, 1},
+	{0xFEE7, 7351, 1},
+	{0xFEE8, 7352, 1},
+	{0xFEE9, 7353, 1},
+	{0xFEEA, 7354, 1},
+	{0xFEEB, 7355, 1},
+	{0xFEEC, 7356, 1},
+	{0xFEED, 7357, 1},
+	{0xFEEE, 7358, 1},
+	{0xFEEF, 7359, 1},
+	{0xFEF0, 7360, 1},
+	{0xFEF1, 7361, 1},
+	{0xFEF2, 7362, 1},
+	{0xFEF3, 7363, 1},
+	{0xFEF4, 7364, 1},
+	{0xFEF5, 7365, 3},
+	{0xFEF6, 7368, 3},
+	{0xFEF7, 7371, 3},
+	{0xFEF8, 7374, 3},
+	{0xFEF9, 7377, 3},
+	{0xFEFA, 7380, 3},
+	{0xFEFB, 7383, 2},
+	{0xFEFC, 7385, 2},
+	{0xFF01, 7387, 1},
+	{0xFF02, 7388, 1},
+	{0xFF03, 7389, 1},
+	{0xFF04, 7390, 1},
+	{0xFF05, 7391, 1},
+	{0xFF06, 7392, 1},
+	{0xFF07, 7393, 1},
+	{0xFF08, 7394, 1},
+	{0xFF09, 7395, 1},
+	{0xFF0A, 7396, 1},
+	{0xFF0B, 7397, 1},
+	{0xFF0C, 7398, 1},
+	{0xFF0D, 7399, 1},
+	{0xFF0E, 7400, 1},
+	{0xFF0F, 7401, 1},
+	{0xFF10, 7402, 1},
+	{0xFF11, 7403, 1},
+	{0xFF12, 7404, 1},
+	{0xFF13, 7405, 1},
+	{0xFF14, 7406, 1},
+	{0xFF15, 7407, 1},
+	{0xFF16, 7408, 1},
+	{0xFF17, 7409, 1},
+	{0xFF18, 7410, 1},
+	{0xFF19, 7411, 1},
+	{0xFF1A, 7412, 1},
+	{0xFF1B, 7413, 1},
+	{0xFF1C, 7414, 1},
+	{0xFF1D, 7415, 1},
+	{0xFF1E, 7416, 1},
+	{0xFF1F, 7417, 1},
+	{0xFF20, 7418, 1},
+	{0xFF21, 7419, 1},
+	{0xFF22, 7420, 1},
+	{0xFF23, 7421, 1},
+	{0xFF24, 7422, 1},
+	{0xFF25, 7423, 1},
+	{0xFF26, 7424, 1},
+	{0xFF27, 7425, 1},
+	{0xFF28, 7426, 1},
+	{0xFF29, 7427, 1},
+	{0xFF2A, 7428, 1},
+	{0xFF2B, 7429, 1},
+	{0xFF2C, 7430, 1},
+	{0xFF2D, 7431, 1},
+	{0xFF2E, 7432, 1},
+	{0xFF2F, 7433, 1},
+	{0xFF30, 7434, 1},
+	{0xFF31, 7435, 1},
+	{0xFF32, 7436, 1},
+	{0xFF33, 7437, 1},
+	{0xFF34, 7438, 1},
+	{0xFF35, 7439, 1},
+	{0xFF36, 7440, 1},
+	{0xFF37, 7441, 1},
+	{0xFF38, 7442, 1},
+	{0xFF39, 7443, 1},
+	{0xFF3A, 7444, 1},
+	{0xFF3B, 7445, 1},
+	{0xFF3C, 7446, 1},
+	{0xFF3D, 7447, 1},
+	{0xFF3E, 7448, 1},
+	{0xFF3F, 7449, 1},
+	{0xFF40, 7450, 1},
+	{0xFF41, 7451, 1},
+	{0xFF42, 7452, 1},
+	{0xFF43, 7453, 1},
+	{0xFF44, 7454, 1},
+	{0xFF45, 7455, 1},
+	{0xFF46, 7456, 1},
+	{0xFF47, 7457, 1},
+	{0xFF48, 7458, 1},
+	{0xFF49, 7459, 1},
+	{0xFF4A, 7460, 1},
+	{0xFF4B, 7461, 1},
+	{0xFF4C, 7462, 1},
+	{0xFF4D, 7463, 1},
+	{0xFF4E, 7464, 1},
+	{0xFF4F, 7465, 1},
+	{0xFF50, 7466, 1},
+	{0xFF51, 7467, 1},
+	{0xFF52, 7468, 1},
+	{0xFF53, 7469, 1},
+	{0xFF54, 7470, 1},
+	{0xFF55, 7471, 1},
+	{0xFF56, 7472, 1},
+	{0xFF57, 7473, 1},
+	{0xFF58, 7474, 1},
+	{0xFF59, 7475, 1},
+	{0xFF5A, 7476, 1},
+	{0xFF5B, 7477, 1},
+	{0xFF5C, 7478, 1},
+	{0xFF5D, 7479, 1},
+	{0xFF5E, 7480, 1},
+	{0xFF5F, 7481, 1},
+	{0xFF60, 7482, 1},
+	{0xFF61, 7483, 1},
+	{0xFF62, 7484, 1},
+	{0xFF63, 7485, 1},
+	{0xFF64, 7486, 1},
+	{0xFF65, 7487, 1},
+	{0xFF66, 7488, 1},
+	{0xFF67, 7489, 1},
+	{0xFF68, 7490, 1},
+	{0xFF69, 7491, 1},
+	{0xFF6A, 7492, 1},
+	{0xFF6B, 7493, 1},
+	{0xFF6C, 7494, 1},
+	{0xFF6D, 7495, 1},
+	{0xFF6E, 7496, 1},
+	{0xFF6F, 7497, 1},
+	{0xFF70, 7498, 1},
+	{0xFF71, 7499, 1},
+	{0xFF72, 7500, 1},
+	{0xFF73, 7501, 1},
+	{0xFF74, 7502, 1},
+	{0xFF75, 7503, 1},
+	{0xFF76, 7504, 1},
+	{0xFF77, 7505, 1},
+	{0xFF78, 7506, 1},
+	{0xFF79, 7507, 1},
+	{0xFF7A, 7508, 1},
+	{0xFF7B, 7509, 1},
+	{0xFF7C, 7510, 1},
+	{0xFF7D, 7511, 1},
+	{0xFF7E, 7512, 1},
+	{0xFF7F, 7513, 1},
+	{0xFF80, 7514, 1},
+	{0xFF81, 7515, 1},
+	{0xFF82, 7516, 1},
+	{0xFF83, 7517, 1},
+	{0xFF84, 7518, 1},
+	{0xFF85, 7519, 1},
+	{0xFF86, 7520, 1},
+	{0xFF87, 7521, 1},
+	{0xFF88, 7522, 1},
+	{0xFF89, 7523, 1},
+	{0xFF8A, 7524, 1},
+	{0xFF8B, 7525, 1},
+	{0xFF8C, 7526, 1},
+	{0xFF8D, 7527, 1},
+	{0xFF8E, 7528, 1},
+	{0xFF8F, 7529, 1},
+	{0xFF90, 7530, 1},
+	{0xFF91, 7531, 1},
+	{0xFF92, 7532, 1},
+	{0xFF93, 7533, 1},
+	{0xFF94, 7534, 1},
+	{0xFF95, 7535, 1},
+	{0xFF96, 7536, 1},
+	{0xFF97, 7537, 1},
+	{0xFF98, 7538, 1},
+	{0xFF99, 7539, 1},
+	{0xFF9A, 7540, 1},
+	{0xFF9B, 7541, 1},
+	{0xFF9C, 7542, 1},
+	{0xFF9D, 7543, 1},
+	{0xFF9E, 7544, 1},
+	{0xFF9F, 7545, 1},
+	{0xFFA0, 7546, 1},
+	{0xFFA1, 7547, 1},
+	{0xFFA2, 7548, 1},
+	{0xFFA3, 7549, 1},
+	{0xFFA4, 7550, 1},
+	{0xFFA5, 7551, 1},
+	{0xFFA6, 7552, 1},
+	{0xFFA7, 7553, 1},
+	{0xFFA8, 7554, 1},
+	{0xFFA9, 7555, 1},
+	{0xFFAA, 7556, 1},
+	{0xFFAB, 7557, 1},
+	{0xFFAC, 7558, 1},
+	{0xFFAD, 7559, 1},
+	{0xFFAE, 7560, 1},
+	{0xFFAF, 7561, 1},
+	{0xFFB0, 7562, 1},
+	{0xFFB1, 7563, 1},
+	{0xFFB2, 7564, 1},
+	{0xFFB3, 7565, 1},
+	{0xFFB4, 7566, 1},
+	{0xFFB5, 7567, 1},
+	{0xFFB6, 7568, 1},
+	{0xFFB7, 7569, 1},
+	{0xFFB8, 7570, 1},
+	{0xFFB9, 7571, 1},
+	{0xFFBA, 7572, 1},
+	{0xFFBB, 7573, 1},
+	{0xFFBC, 7574, 1},
+	{0xFFBD, 7575, 1},
+	{0xFFBE, 7576, 1},
+	{0xFFC2, 7577, 1},
+	{0xFFC3, 7578, 1},
+	{0xFFC4, 7579, 1},
+	{0xFFC5, 7580, 1},
+	{0xFFC6, 7581, 1},
+	{0xFFC7, 7582, 1},
+	{0xFFCA, 7583, 1},
+	{0xFFCB, 7584, 1},
+	{0xFFCC, 7585, 1},
+	{0xFFCD, 7586, 1},
+	{0xFFCE, 7587, 1},
+	{0xFFCF, 7588, 1},
+	{0xFFD2, 7589, 1},
+	{0xFFD3, 7590, 1},
+	{0xFFD4, 7591, 1},
+	{0xFFD5, 7592, 1},
+	{0xFFD6, 7593, 1},
+	{0xFFD7, 7594, 1},
+	{0xFFDA, 7595, 1},
+	{0xFFDB, 7596, 1},
+	{0xFFDC, 7597, 1},
+	{0xFFE0, 7598, 1},
+	{0xFFE1, 7599, 1},
+	{0xFFE2, 7600, 1},
+	{0xFFE3, 7601, 2},
+	{0xFFE4, 7603, 1},
+	{0xFFE5, 7604, 1},
+	{0xFFE6, 7605, 1},
+	{0xFFE8, 7606, 1},
+	{0xFFE9, 7607, 1},
+	{0xFFEA, 7608, 1},
+	{0xFFEB, 7609, 1},
+	{0xFFEC, 7610, 1},
+	{0xFFED, 7611, 1},
+	{0xFFEE, 7612, 1},
+	{0x1D400, 7613, 1},
+	{0x1D401, 7614, 1},
+	{0x1D402, 7615, 1},
+	{0x1D403, 7616, 1},
+	{0x1D404, 7617, 1},
+	{0x1D405, 7618, 1},
+	{0x1D406, 7619, 1},
+	{0x1D407, 7620, 1},
+	{0x1D408, 7621, 1},
+	{0x1D409, 7622, 1},
+	{0x1D40A, 7623, 1},
+	{0x1D40B, 7624, 1},
+	{0x1D40C, 7625, 1},
+	{0x1D40D, 7626, 1},
+	{0x1D40E, 7627, 1},
+	{0x1D40F, 7628, 1},
+	{0x1D410, 7629, 1},
+	{0x1D411, 7630, 1},
+	{0x1D412, 7631, 1},
+	{0x1D413, 7632, 1},
+	{0x1D414, 7633, 1},
+	{0x1D415, 7634, 1},
+	{0x1D416, 7635, 1},
+	{0x1D417, 7636, 1},
+	{0x1D418, 7637, 1},
+	{0x1D419, 7638, 1},
+	{0x1D41A, 7639, 1},
+	{0x1D41B, 7640, 1},
+	{0x1D41C, 7641, 1},
+	{0x1D41D, 7642, 1},
+	{0x1D41E, 7643, 1},
+	{0x1D41F, 7644, 1},
+	{0x1D420, 7645, 1},
+	{0x1D421, 7646, 1},
+	{0x1D422, 7647, 1},
+	{0x1D423, 7648, 1},
+	{0x1D424, 7649, 1},
+	{0x1D425, 7650, 1},
+	{0x1D426, 7651, 1},
+	{0x1D427, 7652, 1},
+	{0x1D428, 7653, 1},
+	{0x1D429, 7654, 1},
+	{0x1D42A, 7655, 1},
+	{0x1D42B, 7656, 1},
+	{0x1D42C, 7657, 1},
+	{0x1D42D, 7658, 1},
+	{0x1D42E, 7659, 1},
+	{0x1D42F, 7660, 1},
+	{0x1D430, 7661, 1},
+	{0x1D431, 7662, 1},
+	{0x1D432, 7663, 1},
+	{0x1D433, 7664, 1},
+	{0x1D434, 7665, 1},
+	{0x1D435, 7666, 1},
+	{0x1D436, 7667, 1},
+	{0x1D437, 7668, 1},
+	{0x1D438, 7669, 1},
+	{0x1D439, 7670, 1},
+	{0x1D43A, 7671, 1},
+	{0x1D43B, 7672, 1},
+	{0x1D43C, 7673, 1},
+	{0x1D43D, 7674, 1},
+	{0x1D43E, 7675, 1},
+	{0x1D43F, 7676, 1},
+	{0x1D440, 7677, 1},
+	{0x1D441, 7678, 1},
+	{0x1D442, 7679, 1},
+	{0x1D443, 7680, 1},
+	{0x1D444, 7681, 1},
+	{0x1D445, 7682, 1},
+	{0x1D446, 7683, 1},
+	{0x1D447, 7684, 1},
+	{0x1D448, 7685, 1},
+	{0x1D449, 7686, 1},
+	{0x1D44A, 7687, 1},
+	{0x1D44B, 7688, 1},
+	{0x1D44C, 7689, 1},
+	{0x1D44D, 7690, 1},
+	{0x1D44E, 7691, 1},
+	{0x1D44F, 7692, 1},
+	{0x1D450, 7693, 1},
+	{0x1D451, 7694, 1},
+	{0x1D452, 7695, 1},
+	{0x1D453, 7696, 1},
+	{0x1D454, 7697, 1},
+	{0x1D456, 7698, 1},
+	{0x1D457, 7699, 1},
+	{0x1D458, 7700, 1},
+	{0x1D459, 7701, 1},
+	{0x1D45A, 7702, 1},
+	{0x1D45B, 7703, 1},
+	{0x1D45C, 7704, 1},
+	{0x1D45D, 7705, 1},
+	{0x1D45E, 7706, 1},
+	{0x1D45F, 7707, 1},
+	{0x1D460, 7708, 1},
+	{0x1D461, 7709, 1},
+	{0x1D462, 7710, 1},
+	{0x1D463, 7711, 1},
+	{0x1D464, 7712, 1},
+	{0x1D465, 7713, 1},
+	{0x1D466, 7714, 1},
+	{0x1D467, 7715, 1},
+	{0x1D468, 7716, 1},
+	{0x1D469, 7717, 1},
+	{0x1D46A, 7718, 1},
+	{0x1D46B, 7719, 1},
+	{0x1D46C, 7720, 1},
+	{0x1D46D, 7721, 1},
+	{0x1D46E, 7722, 1},
+	{0x1D46F, 7723, 1},
+	{0x1D470, 7724, 1},
+	{0x1D471, 7725, 1},
+	{0x1D472, 7726, 1},
+	{0x1D473, 7727, 1},
+	{0x1D474, 7728, 1},
+	{0x1D475, 7729, 1},
+	{0x1D476, 7730, 1},
+	{0x1D477, 7731, 1},
+	{0x1D478, 7732, 1},
+	{0x1D479, 7733, 1},
+	{0x1D47A, 7734, 1},
+	{0x1D47B, 7735, 1},
+	{0x1D47C, 7736, 1},
+	{0x1D47D, 7737, 1},
+	{0x1D47E, 7738, 1},
+	{0x1D47F, 7739, 1},
+	{0x1D480, 7740, 1},
+	{0x1D481, 7741, 1},
+	{0x1D482, 7742, 1},
+	{0x1D483, 7743, 1},
+	{0x1D484, 7744, 1},
+	{0x1D485, 7745, 1},
+	{0x1D486, 7746, 1},
+	{0x1D487, 7747, 1},
+	{0x1D488, 7748, 1},
+	{0x1D489, 7749, 1},
+	{0x1D48A, 7750, 1},
+	{0x1D48B, 7751, 1},
+	{0x1D48C, 7752, 1},
+	{0x1D48D, 7753, 1},
+	{0x1D48E, 7754, 1},
+	{0x1D48F, 7755, 1},
+	{0x1D490, 7756, 1},
+	{0x1D491, 7757, 1},
+	{0x1D492, 7758, 1},
+	{0x1D493, 7759, 1},
+	{0x1D494, 7760, 1},
+	{0x1D495, 7761, 1},
+	{0x1D496, 7762, 1},
+	{0x1D497, 7763, 1},
+	{0x1D498, 7764, 1},
+	{0x1D499, 7765, 1},
+	{0x1D49A, 7766, 1},
+	{0x1D49B, 7767, 1},
+	{0x1D49C, 7768, 1},
+	{0x1D49E, 7769, 1},
+	{0x1D49F, 7770, 1},
+	{0x1D4A2, 7771, 1},
+	{0x1D4A5, 7772, 1},
+	{0x1D4A6, 7773, 1},
+	{0x1D4A9, 7774, 1},
+	{0x1D4AA, 7775, 1},
+	{0x1D4AB, 7776, 1},
+	{0x1D4AC, 7777, 1},
+	{0x1D4AE, 7778, 1},
+	{0x1D4AF, 7779, 1},
+	{0x1D4B0, 7780, 1},
+	{0x1D4B1, 7781, 1},
+	{0x1D4B2, 7782, 1},
+	{0x1D4B3, 7783, 1},
+	{0x1D4B4, 7784, 1},
+	{0x1D4B5, 7785, 1},
+	{0x1D4B6, 7786, 1},
+	{0x1D4B7, 7787, 1},
+	{0x1D4B8, 7788, 1},
+	{0x1D4B9, 7789, 1},
+	{0x1D4BB, 7790, 1},
+	{0x1D4BD, 7791, 1},
+	{0x1D4BE, 7792, 1},
+	{0x1D4BF, 7793, 1},
+	{0x1D4C0, 7794, 1},
+	{0x1D4C1, 7795, 1},
+	{0x1D4C2, 7796, 1},
+	{0x1D4C3, 7797, 1},
+	{0x1D4C5, 7798, 1},
+	{0x1D4C6, 7799, 1},
+	{0x1D4C7, 7800, 1},
+	{0x1D4C8, 7801, 1},
+	{0x1D4C9, 7802, 1},
+	{0x1D4CA, 7803, 1},
+	{0x1D4CB, 7804, 1},
+	{0x1D4CC, 7805, 1},
+	{0x1D4CD, 7806, 1},
+	{0x1D4CE, 7807, 1},
+	{0x1D4CF, 7808, 1},
+	{0x1D4D0, 7809, 1},
+	{0x1D4D1, 7810, 1},
+	{0x1D4D2, 7811, 1},
+	{0x1D4D3, 7812, 1},
+	{0x1D4D4, 7813, 1},
+	{0x1D4D5, 7814, 1},
+	{0x1D4D6, 7815, 1},
+	{0x1D4D7, 7816, 1},
+	{0x1D4D8, 7817, 1},
+	{0x1D4D9, 7818, 1},
+	{0x1D4DA, 7819, 1},
+	{0x1D4DB, 7820, 1},
+	{0x1D4DC, 7821, 1},
+	{0x1D4DD, 7822, 1},
+	{0x1D4DE, 7823, 1},
+	{0x1D4DF, 7824, 1},
+	{0x1D4E0, 7825, 1},
+	{0x1D4E1, 7826, 1},
+	{0x1D4E2, 7827, 1},
+	{0x1D4E3, 7828, 1},
+	{0x1D4E4, 7829, 1},
+	{0x1D4E5, 7830, 1},
+	{0x1D4E6, 7831, 1},
+	{0x1D4E7, 7832, 1},
+	{0x1D4E8, 7833, 1},
+	{0x1D4E9, 7834, 1},
+	{0x1D4EA, 7835, 1},
+	{0x1D4EB, 7836, 1},
+	{0x1D4EC, 7837, 1},
+	{0x1D4ED, 7838, 1},
+	{0x1D4EE, 7839, 1},
+	{0x1D4EF, 7840, 1},
+	{0x1D4F0, 7841, 1},
+	{0x1D4F1, 7842, 1},
+	{0x1D4F2, 7843, 1},
+	{0x1D4F3, 7844, 1},
+	{0x1D4F4, 7845, 1},
+	{0x1D4F5, 7846, 1},
+	{0x1D4F6, 7847, 1},
+	{0x1D4F7, 7848, 1},
+	{0x1D4F8, 7849, 1},
+	{0x1D4F9, 7850, 1},
+	{0x1D4FA, 7851, 1},
+	{0x1D4FB, 7852, 1},
+	{0x1D4FC, 7853, 1},
+	{0x1D4FD, 7854, 1},
+	{0x1D4FE, 7855, 1},
+	{0x1D4FF, 7856, 1},
+	{0x1D500, 7857, 1},
+	{0x1D501, 7858, 1},
+	{0x1D502, 7859, 1},
+	{0x1D503, 7860, 1},
+	{0x1D504, 7861, 1},
+	{0x1D505, 7862, 1},
+	{0x1D507, 7863, 1},
+	{0x1D508, 7864, 1},
+	{0x1D509, 7865, 1},
+	{0x1D50A, 7866, 1},
+	{0x1D50D, 7867, 1},
+	{0x1D50E, 7868, 1},
+	{0x1D50F, 7869, 1},
+	{0x1D510, 7870, 1},
+	{0x1D511, 7871, 1},
+	{0x1D512, 7872, 1},
+	{0x1D513, 7873, 1},
+	{0x1D514, 7874, 1},
+	{0x1D516, 7875, 1},
+	{0x1D517, 7876, 1},
+	{0x1D518, 7877, 1},
+	{0x1D519, 7878, 1},
+	{0x1D51A, 7879, 1},
+	{0x1D51B, 7880, 1},
+	{0x1D51C, 7881, 1},
+	{0x1D51E, 7882, 1},
+	{0x1D51F, 7883, 1},
+	{0x1D520, 7884, 1},
+	{0x1D521, 7885, 1},
+	{0x1D522, 7886, 1},
+	{0x1D523, 7887, 1},
+	{0x1D524, 7888, 1},
+	{0x1D525, 7889, 1},
+	{0x1D526, 7890, 1},
+	{0x1D527, 7891, 1},
+	{0x1D528, 7892, 1},
+	{0x1D529, 7893, 1},
+	{0x1D52A, 7894, 1},
+	{0x1D52B, 7895, 1},
+	{0x1D52C, 7896, 1},
+	{0x1D52D, 7897, 1},
+	{0x1D52E, 7898, 1},
+	{0x1D52F, 7899, 1},
+	{0x1D530, 7900, 1},
+	{0x1D531, 7901, 1},
+	{0x1D532, 7902, 1},
+	{0x1D533, 7903, 1},
+	{0x1D534, 7904, 1},
+	{0x1D535, 7905, 1},
+	{0x1D536, 7906, 1},
+	{0x1D537, 7907, 1},
+	{0x1D538, 7908, 1},
+	{0x1D539, 7909, 1},
+	{0x1D53B, 7910, 1},
+	{0x1D53C, 7911, 1},
+	{0x1D53D, 7912, 1},
+	{0x1D53E, 7913, 1},
+	{0x1D540, 7914, 1},
+	{0x1D541, 7915, 1},
+	{0x1D542, 7916, 1},
+	{0x1D543, 7917, 1},
+	{0x1D544, 7918, 1},
+	{0x1D546, 7919, 1},
+	{0x1D54A, 7920, 1},
+	{0x1D54B, 7921, 1},
+	{0x1D54C, 7922, 1},
+	{0x1D54D, 7923, 1},
+	{0x1D54E, 7924, 1},
+	{0x1D54F, 7925, 1},
+	{0x1D550, 7926, 1},
+	{0x1D552, 7927, 1},
+	{0x1D553, 7928, 1},
+	{0x1D554, 7929, 1},
+	{0x1D555, 7930, 1},
+	{0x1D556, 7931, 1},
+	{0x1D557, 7932, 1},
+	{0x1D558, 7933, 1},
+	{0x1D559, 7934, 1},
+	{0x1D55A, 7935, 1},
+	{0x1D55B, 7936, 1},
+	{0x1D55C, 7937, 1},
+	{0x1D55D, 7938, 1},
+	{0x1D55E, 7939, 1},
+	{0x1D55F, 7940, 1},
+	{0x1D560, 7941, 1},
+	{0x1D561, 7942, 1},
+	{0x1D562, 7943, 1},
+	{0x1D563, 7944, 1},
+	{0x1D564, 7945, 1},
+	{0x1D565, 7946, 1},
+	{0x1D566, 7947, 1},
+	{0x1D567, 7948, 1},
+	{0x1D568, 7949, 1},
+	{0x1D569, 7950, 1},
+	{0x1D56A, 7951, 1},
+	{0x1D56B, 7952, 1},
+	{0x1D56C, 7953, 1},
+	{0x1D56D, 7954, 1},
+	{0x1D56E, 7955, 1},
+	{0x1D56F, 7956, 1},
+	{0x1D570, 7957, 1},
+	{0x1D571, 7958, 1},
+	{0x1D572, 7959, 1},
+	{0x1D573, 7960, 1},
+	{0x1D574, 7961, 1},
+	{0x1D575, 7962, 1},
+	{0x1D576, 7963, 1},
+	{0x1D577, 7964, 1},
+	{0x1D578, 7965, 1},
+	{0x1D579, 7966, 1},
+	{0x1D57A, 7967, 1},
+	{0x1D57B, 7968, 1},
+	{0x1D57C, 7969, 1},
+	{0x1D57D, 7970, 1},
+	{0x1D57E, 7971, 1},
+	{0x1D57F, 7972, 1},
+	{0x1D580, 7973, 1},
+	{0x1D581, 7974, 1},
+	{0x1D582, 7975, 1},
+	{0x1D583, 7976, 1},
+	{0x1D584, 7977, 1},
+	{0x1D585, 7978, 1},
+	{0x1D586, 7979, 1},
+	{0x1D587, 7980, 1},
+	{0x1D588, 7981, 1},
+	{0x1D589, 7982, 1},
+	{0x1D58A, 7983, 1},
+	{0x1D58B, 7984, 1},
+	{0x1D58C, 7985, 1},
+	{0x1D58D, 7986, 1},
+	{0x1D58E, 7987, 1},
+	{0x1D58F, 7988, 1},
+	{0x1D590, 7989, 1},
+	{0x1D591, 7990, 1},
+	{0x1D592, 7991, 1},
+	{0x1D593, 7992, 1},
+	{0x1D594, 7993, 1},
+	{0x1D595, 7994, 1},
+	{0x1D596, 7995, 1},
+	{0x1D597, 7996, 1},
+	{0x1D598, 7997, 1},
+	{0x1D599, 7998, 1},
+	{0x1D59A, 7999, 1},
+	{0x1D59B, 8000, 1},
+	{0x1D59C, 8001, 1},
+	{0x1D59D, 8002, 1},
+	{0x1D59E, 8003, 1},
+	{0x1D59F, 8004, 1},
+	{0x1D5A0, 8005, 1},
+	{0x1D5A1, 8006, 1},
+	{0x1D5A2, 8007, 1},
+	{0x1D5A3, 8008, 1},
+	{0x1D5A4, 8009, 1},
+	{0x1D5A5, 8010, 1},
+	{0x1D5A6, 8011, 1},
+	{0x1D5A7, 8012, 1},
+	{0x1D5A8, 8013, 1},
+	{0x1D5A9, 8014, 1},
+	{0x1D5AA, 8015, 1},
+	{0x1D5AB, 8016, 1},
+	{0x1D5AC, 8017, 1},
+	{0x1D5AD, 8018, 1},
+	{0x1D5AE, 8019, 1},
+	{0x1D5AF, 8020, 1},
+	{0x1D5B0, 8021, 1},
+	{0x1D5B1, 8022, 1},
+	{0x1D5B2, 8023, 1},
+	{0x1D5B3, 8024, 1},
+	{0x1D5B4, 8025, 1},
+	{0x1D5B5, 8026, 1},
+	{0x1D5B6, 8027, 1},
+	{0x1D5B7, 8028, 1},
+	{0x1D5B8, 8029, 1},
+	{0x1D5B9, 8030, 1},
+	{0x1D5BA, 8031, 1},
+	{0x1D5BB, 8032, 1},
+	{0x1D5BC, 8033, 1},
+	{0x1D5BD, 8034, 1},
+	{0x1D5BE, 8035, 1},
+	{0x1D5BF, 8036, 1},
+	{0x1D5C0, 8037, 1},
+	{0x1D5C1, 8038, 1},
+	{0x1D5C2, 8039, 1},
+	{0x1D5C3, 8040, 1},
+	{0x1D5C4, 8041, 1},
+	{0x1D5C5, 8042, 1},
+	{0x1D5C6, 8043, 1},
+	{0x1D5C7, 8044, 1},
+	{0x1D5C8, 8045, 1},
+	{0x1D5C9, 8046, 1},
+	{0x1D5CA, 8047, 1},
+	{0x1D5CB, 8048, 1},
+	{0x1D5CC, 8049, 1},
+	{0x1D5CD, 8050, 1},
+	{0x1D5CE, 8051, 1},
+	{0x1D5CF, 8052, 1},
+	{0x1D5D0, 8053, 1},
+	{0x1D5D1, 8054, 1},
+	{0x1D5D2, 8055, 1},
+	{0x1D5D3, 8056, 1},
+	{0x1D5D4, 8057, 1},
+	{0x1D5D5, 8058, 1},
+	{0x1D5D6, 8059, 1},
+	{0x1D5D7, 8060, 1},
+	{0x1D5D8, 8061, 1},
+	{0x1D5D9, 8062, 1},
+	{0x1D5DA, 8063, 1},
+	{0x1D5DB, 8064, 1},
+	{0x1D5DC, 8065, 1},
+	{0x1D5DD, 8066, 1},
+	{0x1D5DE, 8067, 1},
+	{0x1D5DF, 8068, 1},
+	{0x1D5E0, 8069, 1},
+	{0x1D5E1, 8070, 1},
+	{0x1D5E2, 8071, 1},
+	{0x1D5E3, 8072, 1},
+	{0x1D5E4, 8073, 1},
+	{0x1D5E5, 8074, 1},
+	{0x1D5E6, 8075, 1},
+	{0x1D5E7, 8076, 1},
+	{0x1D5E8, 8077, 1},
+	{0x1D5E9, 8078, 1},
+	{0x1D5EA, 8079, 1},
+	{0x1D5EB, 8080, 1},
+	{0x1D5EC, 8081, 1},
+	{0x1D5ED, 8082, 1},
+	{0x1D5EE, 8083, 1},
+	{0x1D5EF, 8084, 1},
+	{0x1D5F0, 8085, 1},
+	{0x1D5F1, 8086, 1},
+	{0x1D5F2, 8087, 1},
+	{0x1D5F3, 8088, 1},
+	{0x1D5F4, 8089, 1},
+	{0x1D5F5, 8090, 1},
+	{0x1D5F6, 8091, 1},
+	{0x1D5F7, 8092, 1},
+	{0x1D5F8, 8093, 1},
+	{0x1D5F9, 8094, 1},
+	{0x1D5FA, 8095, 1},
+	{0x1D5FB, 8096, 1},
+	{0x1D5FC, 8097, 1},
+	{0x1D5FD, 8098, 1},
+	{0x1D5FE, 8099, 1},
+	{0x1D5FF, 8100, 1},
+	{0x1D600, 8101, 1},
+	{0x1D601, 8102, 1},
+	{0x1D602, 8103, 1},
+	{0x1D603, 8104, 1},
+	{0x1D604, 8105, 1},
+	{0x1D605, 8106, 1},
+	{0x1D606, 8107, 1},
+	{0x1D607, 8108, 1},
+	{0x1D608, 8109, 1},
+	{0x1D609, 8110, 1},
+	{0x1D60A, 8111, 1},
+	{0x1D60B, 8112, 1},
+	{0x1D60C, 8113, 1},
+	{0x1D60D, 8114, 1},
+	{0x1D60E, 8115, 1},
+	{0x1D60F, 8116, 1},
+	{0x1D610, 8117, 1},
+	{0x1D611, 8118, 1},
+	{0x1D612, 8119, 1},
+	{0x1D613, 8120, 1},
+	{0x1D614, 8121, 1},
+	{0x1D615, 8122, 1},
+	{0x1D616, 8123, 1},
+	{0x1D617, 8124, 1},
+	{0x1D618, 8125, 1},
+	{0x1D619, 8126, 1},
+	{0x1D61A, 8127, 1},
+	{0x1D61B, 8128, 1},
+	{0x1D61C, 8129, 1},
+	{0x1D61D, 8130, 1},
+	{0x1D61E, 8131, 1},
+	{0x1D61F, 8132, 1},
+	{0x1D620, 8133, 1},
+	{0x1D621, 8134, 1},
+	{0x1D622, 8135, 1},
+	{0x1D623, 8136, 1},
+	{0x1D624, 8137, 1},
+	{0x1D625, 8138, 1},
+	{0x1D626, 8139, 1},
+	{0x1D627, 8140, 1},
+	{0x1D628, 8141, 1},
+	{0x1D629, 8142, 1},
+	{0x1D62A, 8143, 1},
+	{0x1D62B, 8144, 1},
+	{0x1D62C, 8145, 1},
+	{0x1D62D, 8146, 1},
+	{0x1D62E, 8147, 1},
+	{0x1D62F, 8148, 1},
+	{0x1D630, 8149, 1},
+	{0x1D631, 8150, 1},
+	{0x1D632, 8151, 1},
+	{0x1D633, 8152, 1},
+	{0x1D634, 8153, 1},
+	{0x1D635, 8154, 1},
+	{0x1D636, 8155, 1},
+	{0x1D637, 8156, 1},
+	{0x1D638, 8157, 1},
+	{0x1D639, 8158, 1},
+	{0x1D63A, 8159, 1},
+	{0x1D63B, 8160, 1},
+	{0x1D63C, 8161, 1},
+	{0x1D63D, 8162, 1},
+	{0x1D63E, 8163, 1},
+	{0x1D63F, 8164, 1},
+	{0x1D640, 8165, 1},
+	{0x1D641, 8166, 1},
+	{0x1D642, 8167, 1},
+	{0x1D643, 8168, 1},
+	{0x1D644, 8169, 1},
+	{0x1D645, 8170, 1},
+	{0x1D646, 8171, 1},
+	{0x1D647, 8172, 1},
+	{0x1D648, 8173, 1},
+	{0x1D649, 8174, 1},
+	{0x1D64A, 8175, 1},
+	{0x1D64B, 8176, 1},
+	{0x1D64C, 8177, 1},
+	{0x1D64D, 8178, 1},
+	{0x1D64E, 8179, 1},
+	{0x1D64F, 8180, 1},
+	{0x1D650, 8181, 1},
+	{0x1D651, 8182, 1},
+	{0x1D652, 8183, 1},
+	{0x1D653, 8184, 1},
+	{0x1D654, 8185, 1},
+	{0x1D655, 8186, 1},
+	{0x1D656, 8187, 1},
+	{0x1D657, 8188, 1},
+	{0x1D658, 8189, 1},
+	{0x1D659, 8190, 1},
+	{0x1D65A, 8191, 1},
+	{0x1D65B, 8192, 1},
+	{0x1D65C, 8193, 1},
+	{0x1D65D, 8194, 1},
+	{0x1D65E, 8195, 1},
+	{0x1D65F, 8196, 1},
+	{0x1D660, 8197, 1},
+	{0x1D661, 8198, 1},
+	{0x1D662, 8199, 1},
+	{0x1D663, 8200, 1},
+	{0x1D664, 8201, 1},
+	{0x1D665, 8202, 1},
+	{0x1D666, 8203, 1},
+	{0x1D667, 8204, 1},
+	{0x1D668, 8205, 1},
+	{0x1D669, 8206, 1},
+	{0x1D66A, 8207, 1},
+	{0x1D66B, 8208, 1},
+	{0x1D66C, 8209, 1},
+	{0x1D66D, 8210, 1},
+	{0x1D66E, 8211, 1},
+	{0x1D66F, 8212, 1},
+	{0x1D670, 8213, 1},
+	{0x1D671, 8214, 1},
+	{0x1D672, 8215, 1},
+	{0x1D673, 8216, 1},
+	{0x1D674, 8217, 1},
+	{0x1D675, 8218, 1},
+	{0x1D676, 8219, 1},
+	{0x1D677, 8220, 1},
+	{0x1D678, 8221, 1},
+	{0x1D679, 8222, 1},
+	{0x1D67A, 8223, 1},
+	{0x1D67B, 8224, 1},
+	{0x1D67C, 8225, 1},
+	{0x1D67D, 8226, 1},
+	{0x1D67E, 8227, 1},
+	{0x1D67F, 8228, 1},
+	{0x1D680, 8229, 1},
+	{0x1D681, 8230, 1},
+	{0x1D682, 8231, 1},
+	{0x1D683, 8232, 1},
+	{0x1D684, 8233, 1},
+	{0x1D685, 8234, 1},
+	{0x1D686, 8235, 1},
+	{0x1D687, 8236, 1},
+	{0x1D688, 8237, 1},
+	{0x1D689, 8238, 1},
+	{0x1D68A, 8239, 1},
+	{0x1D68B, 8240, 1},
+	{0x1D68C, 8241, 1},
+	{0x1D68D, 8242, 1},
+	{0x1D68E, 8243, 1},
+	{0x1D68F, 8244, 1},
+	{0x1D690, 8245, 1},
+	{0x1D691, 8246, 1},
+	{0x1D692, 8247, 1},
+	{0x1D693, 8248, 1},
+	{0x1D694, 8249, 1},
+	{0x1D695, 8250, 1},
+	{0x1D696, 8251, 1},
+	{0x1D697, 8252, 1},
+	{0x1D698, 8253, 1},
+	{0x1D699, 8254, 1},
+	{0x1D69A, 8255, 1},
+	{0x1D69B, 8256, 1},
+	{0x1D69C, 8257, 1},
+	{0x1D69D, 8258, 1},
+	{0x1D69E, 8259, 1},
+	{0x1D69F, 8260, 1},
+	{0x1D6A0, 8261, 1},
+	{0x1D6A1, 8262, 1},
+	{0x1D6A2, 8263, 1},
+	{0x1D6A3, 8264, 1},
+	{0x1D6A4, 8265, 1},
+	{0x1D6A5, 8266, 1},
+	{0x1D6A8, 8267, 1},
+	{0x1D6A9, 8268, 1},
+	{0x1D6AA, 8269, 1},
+	{0x1D6AB, 8270, 1},
+	{0x1D6AC, 8271, 1},
+	{0x1D6AD, 8272, 1},
+	{0x1D6AE, 8273, 1},
+	{0x1D6AF, 8274, 1},
+	{0x1D6B0, 8275, 1},
+	{0x1D6B1, 8276, 1},
+	{0x1D6B2, 8277, 1},
+	{0x1D6B3, 8278, 1},
+	{0x1D6B4, 8279, 1},
+	{0x1D6B5, 8280, 1},
+	{0x1D6B6, 8281, 1},
+	{0x1D6B7, 8282, 1},
+	{0x1D6B8, 8283, 1},
+	{0x1D6B9, 8284, 1},
+	{0x1D6BA, 8285, 1},
+	{0x1D6BB, 8286, 1},
+	{0x1D6BC, 8287, 1},
+	{0x1D6BD, 8288, 1},
+	{0x1D6BE, 8289, 1},
+	{0x1D6BF, 8290, 1},
+	{0x1D6C0, 8291, 1},
+	{0x1D6C1, 8292, 1},
+	{0x1D6C2, 8293, 1},
+	{0x1D6C3, 8294, 1},
+	{0x1D6C4, 8295, 1},
+	{0x1D6C5, 8296, 1},
+	{0x1D6C6, 8297, 1},
+	{0x1D6C7, 8298, 1},
+	{0x1D6C8, 8299, 1},
+	{0x1D6C9, 8300, 1},
+	{0x1D6CA, 8301, 1},
+	{0x1D6CB, 8302, 1},
+	{0x1D6CC, 8303, 1},
+	{0x1D6CD, 8304, 1},
+	{0x1D6CE, 8305, 1},
+	{0x1D6CF, 8306, 1},
+	{0x1D6D0, 8307, 1},
+	{0x1D6D1, 8308, 1},
+	{0x1D6D2, 8309, 1},
+	{0x1D6D3, 8310, 1},
+	{0x1D6D4, 8311, 1},
+	{0x1D6D5, 8312, 1},
+	{0x1D6D6, 8313, 1},
+	{0x1D6D7, 8314, 1},
+	{0x1D6D8, 8315, 1},
+	{0x1D6D9, 8316, 1},
+	{0x1D6DA, 8317, 1},
+	{0x1D6DB, 8318, 1},
+	{0x1D6DC, 8319, 1},
+	{0x1D6DD, 8320, 1},
+	{0x1D6DE, 8321, 1},
+	{0x1D6DF, 8322, 1},
+	{0x1D6E0, 8323, 1},
+	{0x1D6E1, 8324, 1},
+	{0x1D6E2, 8325, 1},
+	{0x1D6E3, 8326, 1},
+	{0x1D6E4, 8327, 1},
+	{0x1D6E5, 8328, 1},
+	{0x1D6E6, 8329, 1},
+	{0x1D6E7, 8330, 1},
+	{0x1D6E8, 8331, 1},
+	{0x1D6E9, 8332, 1},
+	{0x1D6EA, 8333, 1},
+	{0x1D6EB, 8334, 1},
+	{0x1D6EC, 8335, 1},
+	{0x1D6ED, 8336, 1},
+	{0x1D6EE, 8337, 1},
+	{0x1D6EF, 8338, 1},
+	{0x1D6F0, 8339, 1},
+	{0x1D6F1, 8340, 1},
+	{0x1D6F2, 8341, 1},
+	{0x1D6F3, 8342, 1},
+	{0x1D6F4, 8343, 1},
+	{0x1D6F5, 8344, 1},
+	{0x1D6F6, 8345, 1},
+	{0x1D6F7, 8346, 1},
+	{0x1D6F8, 8347, 1},
+	{0x1D6F9, 8348, 1},
+	{0x1D6FA, 8349, 1},
+	{0x1D6FB, 8350, 1},
+	{0x1D6FC, 8351, 1},
+	{0x1D6FD, 8352, 1},
+	{0x1D6FE, 8353, 1},
+	{0x1D6FF, 8354, 1},
+	{0x1D700, 8355, 1},
+	{0x1D701, 8356, 1},
+	{0x1D702, 8357, 1},
+	{0x1D703, 8358, 1},
+	{0x1D704, 8359, 1},
+	{0x1D705, 8360, 1},
+	{0x1D706, 8361, 1},
+	{0x1D707, 8362, 1},
+	{0x1D708, 8363, 1},
+	{0x1D709, 8364, 1},
+	{0x1D70A, 8365, 1},
+	{0x1D70B, 8366, 1},
+	{0x1D70C, 8367, 1},
+	{0x1D70D, 8368, 1},
+	{0x1D70E, 8369, 1},
+	{0x1D70F, 8370, 1},
+	{0x1D710, 8371, 1},
+	{0x1D711, 8372, 1},
+	{0x1D712, 8373, 1},
+	{0x1D713, 8374, 1},
+	{0x1D714, 8375, 1},
+	{0x1D715, 8376, 1},
+	{0x1D716, 8377, 1},
+	{0x1D717, 8378, 1},
+	{0x1D718, 8379, 1},
+	{0x1D719, 8380, 1},
+	{0x1D71A, 8381, 1},
+	{0x1D71B, 8382, 1},
+	{0x1D71C, 8383, 1},
+	{0x1D71D, 8384, 1},
+	{0x1D71E, 8385, 1},
+	{0x1D71F, 8386, 1},
+	{0x1D720, 8387, 1},
+	{0x1D721, 8388, 1},
+	{0x1D722, 8389, 1},
+	{0x1D723, 8390, 1},
+	{0x1D724, 8391, 1},
+	{0x1D725, 8392, 1},
+	{0x1D726, 8393, 1},
+	{0x1D727, 8394, 1},
+	{0x1D728, 8395, 1},
+	{0x1D729, 8396, 1},
+	{0x1D72A, 8397, 1},
+	{0x1D72B, 8398, 1},
+	{0x1D72C, 8399, 1},
+	{0x1D72D, 8400, 1},
+	{0x1D72E, 8401, 1},
+	{0x1D72F, 8402, 1},
+	{0x1D730, 8403, 1},
+	{0x1D731, 8404, 1},
+	{0x1D732, 8405, 1},
+	{0x1D733, 8406, 1},
+	{0x1D734, 8407, 1},
+	{0x1D735, 8408, 1},
+	{0x1D736, 8409, 1},
+	{0x1D737, 8410, 1},
+	{0x1D738, 8411, 1},
+	{0x1D739, 8412, 1},
+	{0x1D73A, 8413, 1},
+	{0x1D73B, 8414, 1},
+	{0x1D73C, 8415, 1},
+	{0x1D73D, 8416, 1},
+	{0x1D73E, 8417, 1},
+	{0x1D73F, 8418, 1},
+	{0x1D740, 8419, 1},
+	{0x1D741, 8420, 1},
+	{0x1D742, 8421, 1},
+	{0x1D743, 8422, 1},
+	{0x1D744, 8423, 1},
+	{0x1D745, 8424, 1},
+	{0x1D746, 8425, 1},
+	{0x1D747, 8426, 1},
+	{0x1D748, 8427, 1},
+	{0x1D749, 8428, 1},
+	{0x1D74A, 8429, 1},
+	{0x1D74B, 8430, 1},
+	{0x1D74C, 8431, 1},
+	{0x1D74D, 8432, 1},
+	{0x1D74E, 8433, 1},
+	{0x1D74F, 8434, 1},
+	{0x1D750, 8435, 1},
+	{0x1D751, 8436, 1},
+	{0x1D752, 8437, 1},
+	{0x1D753, 8438, 1},
+	{0x1D754, 8439, 1},
+	{0x1D755, 8440, 1},
+	{0x1D756, 8441, 1},
+	{0x1D757, 8442, 1},
+	{0x1D758, 8443, 1},
+	{0x1D759, 8444, 1},
+	{0x1D75A, 8445, 1},
+	{0x1D75B, 8446, 1},
+	{0x1D75C, 8447, 1},
+	{0x1D75D, 8448, 1},
+	{0x1D75E, 8449, 1},
+	{0x1D75F, 8450, 1},
+	{0x1D760, 8451, 1},
+	{0x1D761, 8452, 1},
+	{0x1D762, 8453, 1},
+	{0x1D763, 8454, 1},
+	{0x1D764, 8455, 1},
+	{0x1D765, 8456, 1},
+	{0x1D766, 8457, 1},
+	{0x1D767, 8458, 1},
+	{0x1D768, 8459, 1},
+	{0x1D769, 8460, 1},
+	{0x1D76A, 8461, 1},
+	{0x1D76B, 8462, 1},
+	{0x1D76C, 8463, 1},
+	{0x1D76D, 8464, 1},
+	{0x1D76E, 8465, 1},
+	{0x1D76F, 8466, 1},
+	{0x1D770, 8467, 1},
+	{0x1D771, 8468, 1},
+	{0x1D772, 8469, 1},
+	{0x1D773, 8470, 1},
+	{0x1D774, 8471, 1},
+	{0x1D775, 8472, 1},
+	{0x1D776, 8473, 1},
+	{0x1D777, 8474, 1},
+	{0x1D778, 8475, 1},
+	{0x1D779, 8476, 1},
+	{0x1D77A, 8477, 1},
+	{0x1D77B, 8478, 1},
+	{0x1D77C, 8479, 1},
+	{0x1D77D, 8480, 1},
+	{0x1D77E, 8481, 1},
+	{0x1D77F, 8482, 1},
+	{0x1D780, 8483, 1},
+	{0x1D781, 8484, 1},
+	{0x1D782, 8485, 1},
+	{0x1D783, 8486, 1},
+	{0x1D784, 8487, 1},
+	{0x1D785, 8488, 1},
+	{0x1D786, 8489, 1},
+	{0x1D787, 8490, 1},
+	{0x1D788, 8491, 1},
+	{0x1D789, 8492, 1},
+	{0x1D78A, 8493, 1},
+	{0x1D78B, 8494, 1},
+	{0x1D78C, 8495, 1},
+	{0x1D78D, 8496, 1},
+	{0x1D78E, 8497, 1},
+	{0x1D78F, 8498, 1},
+	{0x1D790, 8499, 1},
+	{0x1D791, 8500, 1},
+	{0x1D792, 8501, 1},
+	{0x1D793, 8502, 1},
+	{0x1D794, 8503, 1},
+	{0x1D795, 8504, 1},
+	{0x1D796, 8505, 1},
+	{0x1D797, 8506, 1},
+	{0x1D798, 8507, 1},
+	{0x1D799, 8508, 1},
+	{0x1D79A, 8509, 1},
+	{0x1D79B, 8510, 1},
+	{0x1D79C, 8511, 1},
+	{0x1D79D, 8512, 1},
+	{0x1D79E, 8513, 1},
+	{0x1D79F, 8514, 1},
+	{0x1D7A0, 8515, 1},
+	{0x1D7A1, 8516, 1},
+	{0x1D7A2, 8517, 1},
+	{0x1D7A3, 8518, 1},
+	{0x1D7A4, 8519, 1},
+	{0x1D7A5, 8520, 1},
+	{0x1D7A6, 8521, 1},
+	{0x1D7A7, 8522, 1},
+	{0x1D7A8, 8523, 1},
+	{0x1D7A9, 8524, 1},
+	{0x1D7AA, 8525, 1},
+	{0x1D7AB, 8526, 1},
+	{0x1D7AC, 8527, 1},
+	{0x1D7AD, 8528, 1},
+	{0x1D7AE, 8529, 1},
+	{0x1D7AF, 8530, 1},
+	{0x1D7B0, 8531, 1},
+	{0x1D7B1, 8532, 1},
+	{0x1D7B2, 8533, 1},
+	{0x1D7B3, 8534, 1},
+	{0x1D7B4, 8535, 1},
+	{0x1D7B5, 8536, 1},
+	{0x1D7B6, 8537, 1},
+	{0x1D7B7, 8538, 1},
+	{0x1D7B8, 8539, 1},
+	{0x1D7B9, 8540, 1},
+	{0x1D7BA, 8541, 1},
+	{0x1D7BB, 8542, 1},
+	{0x1D7BC, 8543, 1},
+	{0x1D7BD, 8544, 1},
+	{0x1D7BE, 8545, 1},
+	{0x1D7BF, 8546, 1},
+	{0x1D7C0, 8547, 1},
+	{0x1D7C1, 8548, 1},
+	{0x1D7C2, 8549, 1},
+	{0x1D7C3, 8550, 1},
+	{0x1D7C4, 8551, 1},
+	{0x1D7C5, 8552, 1},
+	{0x1D7C6, 8553, 1},
+	{0x1D7C7, 8554, 1},
+	{0x1D7C8, 8555, 1},
+	{0x1D7C9, 8556, 1},
+	{0x1D7CA, 8557, 1},
+	{0x1D7CB, 8558, 1},
+	{0x1D7CE, 8559, 1},
+	{0x1D7CF, 8560, 1},
+	{0x1D7D0, 8561, 1},
+	{0x1D7D1, 8562, 1},
+	{0x1D7D2, 8563, 1},
+	{0x1D7D3, 8564, 1},
+	{0x1D7D4, 8565, 1},
+	{0x1D7D5, 8566, 1},
+	{0x1D7D6, 8567, 1},
+	{0x1D7D7, 8568, 1},
+	{0x1D7D8, 8569, 1},
+	{0x1D7D9, 8570, 1},
+	{0x1D7DA, 8571, 1},
+	{0x1D7DB, 8572, 1},
+	{0x1D7DC, 8573, 1},
+	{0x1D7DD, 8574, 1},
+	{0x1D7DE, 8575, 1},
+	{0x1D7DF, 8576, 1},
+	{0x1D7E0, 8577, 1},
+	{0x1D7E1, 8578, 1},
+	{0x1D7E2, 8579, 1},
+	{0x1D7E3, 8580, 1},
+	{0x1D7E4, 8581, 1},
+	{0x1D7E5, 8582, 1},
+	{0x1D7E6, 8583, 1},
+	{0x1D7E7, 8584, 1},
+	{0x1D7E8, 8585, 1},
+	{0x1D7E9, 8586, 1},
+	{0x1D7EA, 8587, 1},
+	{0x1D7EB, 8588, 1},
+	{0x1D7EC, 8589, 1},
+	{0x1D7ED, 8590, 1},
+	{0x1D7EE, 8591, 1},
+	{0x1D7EF, 8592, 1},
+	{0x1D7F0, 8593, 1},
+	{0x1D7F1, 8594, 1},
+	{0x1D7F2, 8595, 1},
+	{0x1D7F3, 8596, 1},
+	{0x1D7F4, 8597, 1},
+	{0x1D7F5, 8598, 1},
+	{0x1D7F6, 8599, 1},
+	{0x1D7F7, 8600, 1},
+	{0x1D7F8, 8601, 1},
+	{0x1D7F9, 8602, 1},
+	{0x1D7FA, 8603, 1},
+	{0x1D7FB, 8604, 1},
+	{0x1D7FC, 8605, 1},
+	{0x1D7FD, 8606, 1},
+	{0x1D7FE, 8607, 1},
+	{0x1D7FF, 8608, 1},
+	{0x1EE00, 8609, 1},
+	{0x1EE01, 8610, 1},
+	{0x1EE02, 8611, 1},
+	{0x1EE03, 8612, 1},
+	{0x1EE05, 8613, 1},
+	{0x1EE06, 8614, 1},
+	{0x1EE07, 8615, 1},
+	{0x1EE08, 8616, 1},
+	{0x1EE09, 8617, 1},
+	{0x1EE0A, 8618, 1},
+	{0x1EE0B, 8619, 1},
+	{0x1EE0C, 8620, 1},
+	{0x1EE0D, 8621, 1},
+	{0x1EE0E, 8622, 1},
+	{0x1EE0F, 8623, 1},
+	{0x1EE10, 8624, 1},
+	{0x1EE11, 8625, 1},
+	{0x1EE12, 8626, 1},
+	{0x1EE13, 8627, 1},
+	{0x1EE14, 8628, 1},
+	{0x1EE15, 8629, 1},
+	{0x1EE16, 8630, 1},
+	{0x1EE17, 8631, 1},
+	{0x1EE18, 8632, 1},
+	{0x1EE19, 8633, 1},
+	{0x1EE1A, 8634, 1},
+	{0x1EE1B, 8635, 1},
+	{0x1EE1C, 8636, 1},
+	{0x1EE1D, 8637, 1},
+	{0x1EE1E, 8638, 1},
+	{0x1EE1F, 8639, 1},
+	{0x1EE21, 8640, 1},
+	{0x1EE22, 8641, 1},
+	{0x1EE24, 8642, 1},
+	{0x1EE27, 8643, 1},
+	{0x1EE29, 8644, 1},
+	{0x1EE2A, 8645, 1},
+	{0x1EE2B, 8646, 1},
+	{0x1EE2C, 8647, 1},
+	{0x1EE2D, 8648, 1},
+	{0x1EE2E, 8649, 1},
+	{0x1EE2F, 8650, 1},
+	{0x1EE30, 8651, 1},
+	{0x1EE31, 8652, 1},
+	{0x1EE32, 8653, 1},
+	{0x1EE34, 8654, 1},
+	{0x1EE35, 8655, 1},
+	{0x1EE36, 8656, 1},
+	{0x1EE37, 8657, 1},
+	{0x1EE39, 8658, 1},
+	{0x1EE3B, 8659, 1},
+	{0x1EE42, 8660, 1},
+	{0x1EE47, 8661, 1},
+	{0x1EE49, 8662, 1},
+	{0x1EE4B, 8663, 1},
+	{0x1EE4D, 8664, 1},
+	{0x1EE4E, 8665, 1},
+	{0x1EE4F, 8666, 1},
+	{0x1EE51, 8667, 1},
+	{0x1EE52, 8668, 1},
+	{0x1EE54, 8669, 1},
+	{0x1EE57, 8670, 1},
+	{0x1EE59, 8671, 1},
+	{0x1EE5B, 8672, 1},
+	{0x1EE5D, 8673, 1},
+	{0x1EE5F, 8674, 1},
+	{0x1EE61, 8675, 1},
+	{0x1EE62, 8676, 1},
+	{0x1EE64, 8677, 1},
+	{0x1EE67, 8678, 1},
+	{0x1EE68, 8679, 1},
+	{0x1EE69, 8680, 1},
+	{0x1EE6A, 8681, 1},
+	{0x1EE6C, 8682, 1},
+	{0x1EE6D, 8683, 1},
+	{0x1EE6E, 8684, 1},
+	{0x1EE6F, 8685, 1},
+	{0x1EE70, 8686, 1},
+	{0x1EE71, 8687, 1},
+	{0x1EE72, 8688, 1},
+	{0x1EE74, 8689, 1},
+	{0x1EE75, 8690, 1},
+	{0x1EE76, 8691, 1},
+	{0x1EE77, 8692, 1},
+	{0x1EE79, 8693, 1},
+	{0x1EE7A, 8694, 1},
+	{0x1EE7B, 8695, 1},
+	{0x1EE7C, 8696, 1},
+	{0x1EE7E, 8697, 1},
+	{0x1EE80, 8698, 1},
+	{0x1EE81, 8699, 1},
+	{0x1EE82, 8700, 1},
+	{0x1EE83, 8701, 1},
+	{0x1EE84, 8702, 1},
+	{0x1EE85, 8703, 1},
+	{0x1EE86, 8704, 1},
+	{0x1EE87, 8705, 1},
+	{0x1EE88, 8706, 1},
+	{0x1EE89, 8707, 1},
+	{0x1EE8B, 8708, 1},
+	{0x1EE8C, 8709, 1},
+	{0x1EE8D, 8710, 1},
+	{0x1EE8E, 8711, 1},
+	{0x1EE8F, 8712, 1},
+	{0x1EE90, 8713, 1},
+	{0x1EE91, 8714, 1},
+	{0x1EE92, 8715, 1},
+	{0x1EE93, 8716, 1},
+	{0x1EE94, 8717, 1},
+	{0x1EE95, 8718, 1},
+	{0x1EE96, 8719, 1},
+	{0x1EE97, 8720, 1},
+	{0x1EE98, 8721, 1},
+	{0x1EE99, 8722, 1},
+	{0x1EE9A, 8723, 1},
+	{0x1EE9B, 8724, 1},
+	{0x1EEA1, 8725, 1},
+	{0x1EEA2, 8726, 1},
+	{0x1EEA3, 8727, 1},
+	{0x1EEA5, 8728, 1},
+	{0x1EEA6, 8729, 1},
+	{0x1EEA7, 8730, 1},
+	{0x1EEA8, 8731, 1},
+	{0x1EEA9, 8732, 1},
+	{0x1EEAB, 8733, 1},
+	{0x1EEAC, 8734, 1},
+	{0x1EEAD, 8735, 1},
+	{0x1EEAE, 8736, 1},
+	{0x1EEAF, 8737, 1},
+	{0x1EEB0, 8738, 1},
+	{0x1EEB1, 8739, 1},
+	{0x1EEB2, 8740, 1},
+	{0x1EEB3, 8741, 1},
+	{0x1EEB4, 8742, 1},
+	{0x1EEB5, 8743, 1},
+	{0x1EEB6, 8744, 1},
+	{0x1EEB7, 8745, 1},
+	{0x1EEB8, 8746, 1},
+	{0x1EEB9, 8747, 1},
+	{0x1EEBA, 8748, 1},
+	{0x1EEBB, 8749, 1},
+	{0x1F100, 8750, 2},
+	{0x1F101, 8752, 2},
+	{0x1F102, 8754, 2},
+	{0x1F103, 8756, 2},
+	{0x1F104, 8758, 2},
+	{0x1F105, 8760, 2},
+	{0x1F106, 8762, 2},
+	{0x1F107, 8764, 2},
+	{0x1F108, 8766, 2},
+	{0x1F109, 8768, 2},
+	{0x1F10A, 8770, 2},
+	{0x1F110, 8772, 3},
+	{0x1F111, 8775, 3},
+	{0x1F112, 8778, 3},
+	{0x1F113, 8781, 3},
+	{0x1F114, 8784, 3},
+	{0x1F115, 8787, 3},
+	{0x1F116, 8790, 3},
+	{0x1F117, 8793, 3},
+	{0x1F118, 8796, 3},
+	{0x1F119, 8799, 3},
+	{0x1F11A, 8802, 3},
+	{0x1F11B, 8805, 3},
+	{0x1F11C, 8808, 3},
+	{0x1F11D, 8811, 3},
+	{0x1F11E, 8814, 3},
+	{0x1F11F, 8817, 3},
+	{0x1F120, 8820, 3},
+	{0x1F121, 8823, 3},
+	{0x1F122, 8826, 3},
+	{0x1F123, 8829, 3},
+	{0x1F124, 8832, 3},
+	{0x1F125, 8835, 3},
+	{0x1F126, 8838, 3},
+	{0x1F127, 8841, 3},
+	{0x1F128, 8844, 3},
+	{0x1F129, 8847, 3},
+	{0x1F12A, 8850, 3},
+	{0x1F12B, 8853, 1},
+	{0x1F12C, 8854, 1},
+	{0x1F12D, 8855, 2},
+	{0x1F12E, 8857, 2},
+	{0x1F130, 8859, 1},
+	{0x1F131, 8860, 1},
+	{0x1F132, 8861, 1},
+	{0x1F133, 8862, 1},
+	{0x1F134, 8863, 1},
+	{0x1F135, 8864, 1},
+	{0x1F136, 8865, 1},
+	{0x1F137, 8866, 1},
+	{0x1F138, 8867, 1},
+	{0x1F139, 8868, 1},
+	{0x1F13A, 8869, 1},
+	{0x1F13B, 8870, 1},
+	{0x1F13C, 8871, 1},
+	{0x1F13D, 8872, 1},
+	{0x1F13E, 8873, 1},
+	{0x1F13F, 8874, 1},
+	{0x1F140, 8875, 1},
+	{0x1F141, 8876, 1},
+	{0x1F142, 8877, 1},
+	{0x1F143, 8878, 1},
+	{0x1F144, 8879, 1},
+	{0x1F145, 8880, 1},
+	{0x1F146, 8881, 1},
+	{0x1F147, 8882, 1},
+	{0x1F148, 8883, 1},
+	{0x1F149, 8884, 1},
+	{0x1F14A, 8885, 2},
+	{0x1F14B, 8887, 2},
+	{0x1F14C, 8889, 2},
+	{0x1F14D, 8891, 2},
+	{0x1F14E, 8893, 3},
+	{0x1F14F, 8896, 2},
+	{0x1F16A, 8898, 2},
+	{0x1F16B, 8900, 2},
+	{0x1F190, 8902, 2},
+	{0x1F200, 8904, 2},
+	{0x1F201, 8906, 2},
+	{0x1F202, 8908, 1},
+	{0x1F210, 8909, 1},
+	{0x1F211, 8910, 1},
+	{0x1F212, 8911, 1},
+	{0x1F213, 8912, 2},
+	{0x1F214, 8914, 1},
+	{0x1F215, 8915, 1},
+	{0x1F216, 8916, 1},
+	{0x1F217, 8917, 1},
+	{0x1F218, 8918, 1},
+	{0x1F219, 8919, 1},
+	{0x1F21A, 8920, 1},
+	{0x1F21B, 8921, 1},
+	{0x1F21C, 8922, 1},
+	{0x1F21D, 8923, 1},
+	{0x1F21E, 8924, 1},
+	{0x1F21F, 8925, 1},
+	{0x1F220, 8926, 1},
+	{0x1F221, 8927, 1},
+	{0x1F222, 8928, 1},
+	{0x1F223, 8929, 1},
+	{0x1F224, 8930, 1},
+	{0x1F225, 8931, 1},
+	{0x1F226, 8932, 1},
+	{0x1F227, 8933, 1},
+	{0x1F228, 8934, 1},
+	{0x1F229, 8935, 1},
+	{0x1F22A, 8936, 1},
+	{0x1F22B, 8937, 1},
+	{0x1F22C, 8938, 1},
+	{0x1F22D, 8939, 1},
+	{0x1F22E, 8940, 1},
+	{0x1F22F, 8941, 1},
+	{0x1F230, 8942, 1},
+	{0x1F231, 8943, 1},
+	{0x1F232, 8944, 1},
+	{0x1F233, 8945, 1},
+	{0x1F234, 8946, 1},
+	{0x1F235, 8947, 1},
+	{0x1F236, 8948, 1},
+	{0x1F237, 8949, 1},
+	{0x1F238, 8950, 1},
+	{0x1F239, 8951, 1},
+	{0x1F23A, 8952, 1},
+	{0x1F240, 8953, 3},
+	{0x1F241, 8956, 3},
+	{0x1F242, 8959, 3},
+	{0x1F243, 8962, 3},
+	{0x1F244, 8965, 3},
+	{0x1F245, 8968, 3},
+	{0x1F246, 8971, 3},
+	{0x1F247, 8974, 3},
+	{0x1F248, 8977, 3},
+	{0x1F250, 8980, 1},
+	{0x1F251, 8981, 1},
+};
+const slice<const decomposition> compat_decompositions(_compat_decompositions);
+
+const rune decomposition_runes[] = {
+	0x0041, 0x0300, 0x0041, 0x0301, 0x0041, 0x0302, 0x0041, 0x0303,
+	0x0041, 0x0308, 0x0041, 0x030A, 0x0043, 0x0327, 0x0045, 0x0300,
+	0x0045, 0x0301, 0x0045, 0x0302, 0x0045, 0x0308, 0x0049, 0x0300,
+	0x0049, 0x0301, 0x0049, 0x0302, 0x0049, 0x0308, 0x004E, 0x0303,
+	0x004F, 0x0300, 0x004F, 0x0301, 0x004F, 0x0302, 0x004F, 0x0303,
+	0x004F, 0x0308, 0x0055, 0x0300, 0x0055, 0x0301, 0x0055, 0x0302,
+	0x0055, 0x0308, 0x0059, 0x0301, 0x0061, 0x0300, 0x0061, 0x0301,
+	0x0061, 0x0302, 0x0061, 0x0303, 0x0061, 0x0308, 0x0061, 0x030A,
+	0x0063, 0x0327, 0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302,
+	0x0065, 0x0308, 0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302,
+	0x0069, 0x0308, 0x006E, 0x0303, 0x006F, 0x0300, 0x006F, 0x0301,
+	0x006F, 0x0302, 0x006F, 0x0303, 0x006F, 0x0308, 0x0075, 0x0300,
+	0x0075, 0x0301, 0x0075, 0x0302, 0x0075, 0x0308, 0x0079, 0x0301,
+	0x0079, 0x0308, 0x0041, 0x0304, 0x0061, 0x0304, 0x0041, 0x0306,
+	0x0061, 0x0306, 0x0041, 0x0328, 0x0061, 0x0328, 0x0043, 0x0301,
+	0x0063, 0x0301, 0x0043, 0x0302, 0x0063, 0x0302, 0x0043, 0x0307,
+	0x0063, 0x0307, 0x0043, 0x030C, 0x0063, 0x030C, 0x0044, 0x030C,
+	0x0064, 0x030C, 0x0045, 0x0304, 0x0065, 0x0304, 0x0045, 0x0306,
+	0x0065, 0x0306, 0x0045, 0x0307, 0x0065, 0x0307, 0x0045, 0x0328,
+	0x0065, 0x0328, 0x0045, 0x030C, 0x0065, 0x030C, 0x0047, 0x0302,
+	0x0067, 0x0302, 0x0047, 0x0306, 0x0067, 0x0306, 0x0047, 0x0307,
+	0x0067, 0x0307, 0x0047, 0x0327, 0x0067, 0x0327, 0x0048, 0x0302,
+	0x0068, 0x0302, 0x0049, 0x0303, 0x0069, 0x0303, 0x0049, 0x0304,
+	0x0069, 0x0304, 0x0049, 0x0306, 0x0069, 0x0306, 0x0049, 0x0328,
+	0x0069, 0x0328, 0x0049, 0x0307, 0x004A, 0x0302, 0x006A, 0x0302,
+	0x004B, 0x0327, 0x006B, 0x0327, 0x004C, 0x0301, 0x006C, 0x0301,
+	0x004C, 0x0327, 0x006C, 0x0327, 0x004C, 0x030C, 0x006C, 0x030C,
+	0x004E, 0x0301, 0x006E, 0x0301, 0x004E, 0x0327, 0x006E, 0x0327,
+	0x004E, 0x030C, 0x006E, 0x030C, 0x004F, 0x0304, 0x006F, 0x0304,
+	0x004F, 0x0306, 0x006F, 0x0306, 0x004F, 0x030B, 0x006F, 0x030B,
+	0x0052, 0x0301, 0x0072, 0x0301, 0x0052, 0x0327, 0x0072, 0x0327,
+	0x0052, 0x030C, 0x0072, 0x030C, 0x0053, 0x0301, 0x0073, 0x0301,
+	0x0053, 0x0302, 0x0073, 0x0302, 0x0053, 0x0327, 0x0073, 0x0327,
+	0x0053, 0x030C, 0x0073, 0x030C, 0x0054, 0x0327, 0x0074, 0x0327,
+	0x0054, 0x030C, 0x0074, 0x030C, 0x0055, 0x0303, 0x0075, 0x0303,
+	0x0055, 0x0304, 0x0075, 0x0304, 0x0055, 0x0306, 0x0075, 0x0306,
+	0x0055, 0x030A, 0x0075, 0x030A, 0x0055, 0x030B, 0x0075, 0x030B,
+	0x0055, 0x0328, 0x0075, 0x0328, 0x0057, 0x0302, 0x0077, 0x0302,
+	0x0059, 0x0302, 0x0079, 0x0302, 0x0059, 0x0308, 0x005A, 0x0301,
+	0x007A, 0x0301, 0x005A, 0x0307, 0x007A, 0x0307, 0x005A, 0x030C,
+	0x007A, 0x030C, 0x004F, 0x031B, 0x006F, 0x031B, 0x0055, 0x031B,
+	0x0075, 0x031B, 0x0041, 0x030C, 0x0061, 0x030C, 0x0049, 0x030C,
+	0x0069, 0x030C, 0x004F, 0x030C, 0x006F, 0x030C, 0x0055, 0x030C,
+	0x0075, 0x030C, 0x0055, 0x0308, 0x0304, 0x0075, 0x0308, 0x0304,
+	0x0055, 0x0308, 0x0301, 0x0075, 0x0308, 0x0301, 0x0055, 0x0308,
+	0x030C, 0x0075, 0x0308, 0x030C, 0x0055, 0x0308, 0x0300, 0x0075,
+	0x0308, 0x0300, 0x0041, 0x0308, 0x0304, 0x0061, 0x0308, 0x0304,
+	0x0041, 0x0307, 0x0304, 0x0061, 0x0307, 0x0304, 0x00C6, 0x0304,
+	0x00E6, 0x0304, 0x0047, 0x030C, 0x0067, 0x030C, 0x004B, 0x030C,
+	0x006B, 0x030C, 0x004F, 0x0328, 0x006F, 0x0328, 0x004F, 0x0328,
+	0x0304, 0x006F, 0x0328, 0x0304, 0x01B7, 0x030C, 0x0292, 0x030C,
+	0x006A, 0x030C, 0x0047, 0x0301, 0x0067, 0x0301, 0x004E, 0x0300,
+	0x006E, 0x0300, 0x0041, 0x030A, 0x0301, 0x0061, 0x030A, 0x0301,
+	0x00C6, 0x0301, 0x00E6, 0x0301, 0x00D8, 0x0301, 0x00F8, 0x0301,
+	0x0041, 0x030F, 0x0061, 0x030F, 0x0041, 0x0311, 0x0061, 0x0311,
+	0x0045, 0x030F, 0x0065, 0x030F, 0x0045, 0x0311, 0x0065, 0x0311,
+	0x0049, 0x030F, 0x0069, 0x030F, 0x0049, 0x0311, 0x0069, 0x0311,
+	0x004F, 0x030F, 0x006F, 0x030F, 0x004F, 0x0311, 0x006F, 0x0311,
+	0x0052, 0x030F, 0x0072, 0x030F, 0x0052, 0x0311, 0x0072, 0x0311,
+	0x0055, 0x030F, 0x0075, 0x030F, 0x0055, 0x0311, 0x0075, 0x0311,
+	0x0053, 0x0326, 0x0073, 0x0326, 0x0054, 0x0326, 0x0074, 0x0326,
+	0x0048, 0x030C, 0x0068, 0x030C, 0x0041, 0x0307, 0x0061, 0x0307,
+	0x0045, 0x0327, 0x0065, 0x0327, 0x004F, 0x0308, 0x0304, 0x006F,
+	0x0308, 0x0304, 0x004F, 0x0303, 0x0304, 0x006F, 0x0303, 0x0304,
+	0x004F, 0x0307, 0x006F, 0x0307, 0x004F, 0x0307, 0x0304, 0x006F,
+	0x0307, 0x0304, 0x0059, 0x0304, 0x0079, 0x0304, 0x0300, 0x0301,
+	0x0313, 0x0308, 0x0301, 0x02B9, 0x003B, 0x00A8, 0x0301, 0x0391,
+	0x0301, 0x00B7, 0x0395, 0x0301, 0x0397, 0x0301, 0x0399, 0x0301,
+	0x039F, 0x0301, 0x03A5, 0x0301, 0x03A9, 0x0301, 0x03B9, 0x0308,
+	0x0301, 0x0399, 0x0308, 0x03A5, 0x0308, 0x03B1, 0x0301, 0x03B5,
+	0x0301, 0x03B7, 0x0301, 0x03B9, 0x0301, 0x03C5, 0x0308, 0x0301,
+	0x03B9, 0x0308, 0x03C5, 0x0308, 0x03BF, 0x0301, 0x03C5, 0x0301,
+	0x03C9, 0x0301, 0x03D2, 0x0301, 0x03D2, 0x0308, 0x0415, 0x0300,
+	0x0415, 0x0308, 0x0413, 0x0301, 0x0406, 0x0308, 0x041A, 0x0301,
+	0x0418, 0x0300, 0x0423, 0x0306, 0x0418, 0x0306, 0x0438, 0x0306,
+	0x0435, 0x0300, 0x0435, 0x0308, 0x0433, 0x0301, 0x0456, 0x0308,
+	0x043A, 0x0301, 0x0438, 0x0300, 0x0443, 0x0306, 0x0474, 0x030F,
+	0x0475, 0x030F, 0x0416, 0x0306, 0x0436, 0x0306, 0x0410, 0x0306,
+	0x0430, 0x0306, 0x0410, 0x0308, 0x0430, 0x0308, 0x0415, 0x0306,
+	0x0435, 0x0306, 0x04D8, 0x0308, 0x04D9, 0x0308, 0x0416, 0x0308,
+	0x0436, 0x0308, 0x0417, 0x0308, 0x0437, 0x0308, 0x0418, 0x0304,
+	0x0438, 0x0304, 0x0418, 0x0308, 0x0438, 0x0308, 0x041E, 0x0308,
+	0x043E, 0x0308, 0x04E8, 0x0308, 0x04E9, 0x0308, 0x042D, 0x0308,
+	0x044D, 0x0308, 0x0423, 0x0304, 0x0443, 0x0304, 0x0423, 0x0308,
+	0x0443, 0x0308, 0x0423, 0x030B, 0x0443, 0x030B, 0x0427, 0x0308,
+	0x0447, 0x0308, 0x042B, 0x0308, 0x044B, 0x0308, 0x0627, 0x0653,
+	0x0627, 0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x064A, 0x0654,
+	0x06D5, 0x0654, 0x06C1, 0x0654, 0x06D2, 0x0654, 0x0928, 0x093C,
+	0x0930, 0x093C, 0x0933, 0x093C, 0x0915, 0x093C, 0x0916, 0x093C,
+	0x0917, 0x093C, 0x091C, 0x093C, 0x0921, 0x093C, 0x0922, 0x093C,
+	0x092B, 0x093C, 0x092F, 0x093C, 0x09C7, 0x09BE, 0x09C7, 0x09D7,
+	0x09A1, 0x09BC, 0x09A2, 0x09BC, 0x09AF, 0x09BC, 0x0A32, 0x0A3C,
+	0x0A38, 0x0A3C, 0x0A16, 0x0A3C, 0x0A17, 0x0A3C, 0x0A1C, 0x0A3C,
+	0x0A2B, 0x0A3C, 0x0B47, 0x0B56, 0x0B47, 0x0B3E, 0x0B47, 0x0B57,
+	0x0B21, 0x0B3C, 0x0B22, 0x0B3C, 0x0B92, 0x0BD7, 0x0BC6, 0x0BBE,
+	0x0BC7, 0x0BBE, 0x0BC6, 0x0BD7, 0x0C46, 0x0C56, 0x0CBF, 0x0CD5,
+	0x0CC6, 0x0CD5, 0x0CC6, 0x0CD6, 0x0CC6, 0x0CC2, 0x0CC6, 0x0CC2,
+	0x0CD5, 0x0D46, 0x0D3E, 0x0D47, 0x0D3E, 0x0D46, 0x0D57, 0x0DD9,
+	0x0DCA, 0x0DD9, 0x0DCF, 0x0DD9, 0x0DCF, 0x0DCA, 0x0DD9, 0x0DDF,
+	0x0F42, 0x0FB7, 0x0F4C, 0x0FB7, 0x0F51, 0x0FB7, 0x0F56, 0x0FB7,
+	0x0F5B, 0x0FB7, 0x0F40, 0x0FB5, 0x0F71, 0x0F72, 0x0F71, 0x0F74,
+	0x0FB2, 0x0F80, 0x0FB3, 0x0F80, 0x0F71, 0x0F80, 0x0F92, 0x0FB7,
+	0x0F9C, 0x0FB7, 0x0FA1, 0x0FB7, 0x0FA6, 0x0FB7, 0x0FAB, 0x0FB7,
+	0x0F90, 0x0FB5, 0x1025, 0x102E, 0x1B05, 0x1B35, 0x1B07, 0x1B35,
+	0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11, 0x1B35,
+	0x1B3A, 0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35, 0x1B3F, 0x1B35,
+	0x1B42, 0x1B35, 0x0041, 0x0325, 0x0061, 0x0325, 0x0042, 0x0307,
+	0x0062, 0x0307, 0x0042, 0x0323, 0x0062, 0x0323, 0x0042, 0x0331,
+	0x0062, 0x0331, 0x0043, 0x0327, 0x0301, 0x0063, 0x0327, 0x0301,
+	0x0044, 0x0307, 0x0064, 0x0307, 0x0044, 0x0323, 0x0064, 0x0323,
+	0x0044, 0x0331, 0x0064, 0x0331, 0x0044, 0x0327, 0x0064, 0x0327,
+	0x0044, 0x032D, 0x0064, 0x032D, 0x0045, 0x0304, 0x0300, 0x0065,
+	0x0304, 0x0300, 0x0045, 0x0304, 0x0301, 0x0065, 0x0304, 0x0301,
+	0x0045, 0x032D, 0x0065, 0x032D, 0x0045, 0x0330, 0x0065, 0x0330,
+	0x0045, 0x0327, 0x0306, 0x0065, 0x0327, 0x0306, 0x0046, 0x0307,
+	0x0066, 0x0307, 0x0047, 0x0304, 0x0067, 0x0304, 0x0048, 0x0307,
+	0x0068, 0x0307, 0x0048, 0x0323, 0x0068, 0x0323, 0x0048, 0x0308,
+	0x0068, 0x0308, 0x0048, 0x0327, 0x0068, 0x0327, 0x0048, 0x032E,
+	0x0068, 0x032E, 0x0049, 0x0330, 0x0069, 0x0330, 0x0049, 0x0308,
+	0x0301, 0x0069, 0x0308, 0x0301, 0x004B, 0x0301, 0x006B, 0x0301,
+	0x004B, 0x0323, 0x006B, 0x0323, 0x004B, 0x0331, 0x006B, 0x0331,
+	0x004C, 0x0323, 0x006C, 0x0323, 0x004C, 0x0323, 0x0304, 0x006C,
+	0x0323, 0x0304, 0x004C, 0x0331, 0x006C, 0x0331, 0x004C, 0x032D,
+	0x006C, 0x032D, 0x004D, 0x0301, 0x006D, 0x0301, 0x004D, 0x0307,
+	0x006D, 0x0307, 0x004D, 0x0323, 0x006D, 0x0323, 0x004E, 0x0307,
+	0x006E, 0x0307, 0x004E, 0x0323, 0x006E, 0x0323, 0x004E, 0x0331,
+	0x006E, 0x0331, 0x004E, 0x032D, 0x006E, 0x032D, 0x004F, 0x0303,
+	0x0301, 0x006F, 0x0303, 0x0301, 0x004F, 0x0303, 0x0308, 0x006F,
+	0x0303, 0x0308, 0x004F, 0x0304, 0x0300, 0x006F, 0x0304, 0x0300,
+	0x004F, 0x0304, 0x0301, 0x006F, 0x0304, 0x0301, 0x0050, 0x0301,
+	0x0070, 0x0301, 0x0050, 0x0307, 0x0070, 0x0307, 0x0052, 0x0307,
+	0x0072, 0x0307, 0x0052, 0x0323, 0x0072, 0x0323, 0x0052, 0x0323,
+	0x0304, 0x0072, 0x0323, 0x0304, 0x0052, 0x0331, 0x0072, 0x0331,
+	0x0053, 0x0307, 0x0073, 0x0307, 0x0053, 0x0323, 0x0073, 0x0323,
+	0x0053, 0x0301, 0x0307, 0x0073, 0x0301, 0x0307, 0x0053, 0x030C,
+	0x0307, 0x0073, 0x030C, 0x0307, 0x0053, 0x0323, 0x0307, 0x0073,
+	0x0323, 0x0307, 0x0054, 0x0307, 0x0074, 0x0307, 0x0054, 0x0323,
+	0x0074, 0x0323, 0x0054, 0x0331, 0x0074, 0x0331, 0x0054, 0x032D,
+	0x0074, 0x032D, 0x0055, 0x0324, 0x0075, 0x0324, 0x0055, 0x0330,
+	0x0075, 0x0330, 0x0055, 0x032D, 0x0075, 0x032D, 0x0055, 0x0303,
+	0x0301, 0x0075, 0x0303, 0x0301, 0x0055, 0x0304, 0x0308, 0x0075,
+	0x0304, 0x0308, 0x0056, 0x0303, 0x0076, 0x0303, 0x0056, 0x0323,
+	0x0076, 0x0323, 0x0057, 0x0300, 0x0077, 0x0300, 0x0057, 0x0301,
+	0x0077, 0x0301, 0x0057, 0x0308, 0x0077, 0x0308, 0x0057, 0x0307,
+	0x0077, 0x0307, 0x0057, 0x0323, 0x0077, 0x0323, 0x0058, 0x0307,
+	0x0078, 0x0307, 0x0058, 0x0308, 0x0078, 0x0308, 0x0059, 0x0307,
+	0x0079, 0x0307, 0x005A, 0x0302, 0x007A, 0x0302, 0x005A, 0x0323,
+	0x007A, 0x0323, 0x005A, 0x0331, 0x007A, 0x0331, 0x0068, 0x0331,
+	0x0074, 0x0308, 0x0077, 0x030A, 0x0079, 0x030A, 0x017F, 0x0307,
+	0x0041, 0x0323, 0x0061, 0x0323, 0x0041, 0x0309, 0x0061, 0x0309,
+	0x0041, 0x0302, 0x0301, 0x0061, 0x0302, 0x0301, 0x0041, 0x0302,
+	0x0300, 0x0061, 0x0302, 0x0300, 0x0041, 0x0302, 0x0309, 0x0061,
+	0x0302, 0x0309, 0x0041, 0x0302, 0x0303, 0x0061, 0x0302, 0x0303,
+	0x0041, 0x0323, 0x0302, 0x0061, 0x0323, 0x0302, 0x0041, 0x0306,
+	0x0301, 0x0061, 0x0306, 0x0301, 0x0041, 0x0306, 0x0300, 0x0061,
+	0x0306, 0x0300, 0x0041, 0x0306, 0x0309, 0x0061, 0x0306, 0x0309,
+	0x0041, 0x0306, 0x0303, 0x0061, 0x0306, 0x0303, 0x0041, 0x0323,
+	0x0306, 0x0061, 0x0323, 0x0306, 0x0045, 0x0323, 0x0065, 0x0323,
+	0x0045, 0x0309, 0x0065, 0x0309, 0x0045, 0x0303, 0x0065, 0x0303,
+	0x0045, 0x0302, 0x0301, 0x0065, 0x0302, 0x0301, 0x0045, 0x0302,
+	0x0300, 0x0065, 0x0302, 0x0300, 0x0045, 0x0302, 0x0309, 0x0065,
+	0x0302, 0x0309, 0x0045, 0x0302, 0x0303, 0x0065, 0x0302, 0x0303,
+	0x0045, 0x0323, 0x0302, 0x0065, 0x0323, 0x0302, 0x0049, 0x0309,
+	0x0069, 0x0309, 0x0049, 0x0323, 0x0069, 0x0323, 0x004F, 0x0323,
+	0x006F, 0x0323, 0x004F, 0x0309, 0x006F, 0x0309, 0x004F, 0x0302,
+	0x0301, 0x006F, 0x0302, 0x0301, 0x004F, 0x0302, 0x0300, 0x006F,
+	0x0302, 0x0300, 0x004F, 0x0302, 0x0309, 0x006F, 0x0302, 0x0309,
+	0x004F, 0x0302, 0x0303, 0x006F, 0x0302, 0x0303, 0x004F, 0x0323,
+	0x0302, 0x006F, 0x0323, 0x0302, 0x004F, 0x031B, 0x0301, 0x006F,
+	0x031B, 0x0301, 0x004F, 0x031B, 0x0300, 0x006F, 0x031B, 0x0300,
+	0x004F, 0x031B, 0x0309, 0x006F, 0x031B, 0x0309, 0x004F, 0x031B,
+	0x0303, 0x006F, 0x031B, 0x0303, 0x004F, 0x031B, 0x0323, 0x006F,
+	0x031B, 0x0323, 0x0055, 0x0323, 0x0075, 0x0323, 0x0055, 0x0309,
+	0x0075, 0x0309, 0x0055, 0x031B, 0x0301, 0x0075, 0x031B, 0x0301,
+	0x0055, 0x031B, 0x0300, 0x0075, 0x031B, 0x0300, 0x0055, 0x031B,
+	0x0309, 0x0075, 0x031B, 0x0309, 0x0055, 0x031B, 0x0303, 0x0075,
+	0x031B, 0x0303, 0x0055, 0x031B, 0x0323, 0x0075, 0x031B, 0x0323,
+	0x0059, 0x0300, 0x0079, 0x0300, 0x0059, 0x0323, 0x0079, 0x0323,
+	0x0059, 0x0309, 0x0079, 0x0309, 0x0059, 0x0303, 0x0079, 0x0303,
+	0x03B1, 0x0313, 0x03B1, 0x0314, 0x03B1, 0x0313, 0x0300, 0x03B1,
+	0x0314, 0x0300, 0x03B1, 0x0313, 0x0301, 0x03B1, 0x0314, 0x0301,
+	0x03B1, 0x0313, 0x0342, 0x03B1, 0x0314, 0x0342, 0x0391, 0x0313,
+	0x0391, 0x0314, 0x0391, 0x0313, 0x0300, 0x0391, 0x0314, 0x0300,
+	0x0391, 0x0313, 0x0301, 0x0391, 0x0314, 0x0301, 0x0391, 0x0313,
+	0x0342, 0x0391, 0x0314, 0x0342, 0x03B5, 0x0313, 0x03B5, 0x0314,
+	0x03B5, 0x0313, 0x0300, 0x03B5, 0x0314, 0x0300, 0x03B5, 0x0313,
+	0x0301, 0x03B5, 0x0314, 0x0301, 0x0395, 0x0313, 0x0395, 0x0314,
+	0x0395, 0x0313, 0x0300, 0x0395, 0x0314, 0x0300, 0x0395, 0x0313,
+	0x0301, 0x0395, 0x0314, 0x0301, 0x03B7, 0x0313, 0x03B7, 0x0314,
+	0x03B7, 0x0313, 0x0300, 0x03B7, 0x0314, 0x0300, 0x03B7, 0x0313,
+	0x0301, 0x03B7, 0x0314, 0x0301, 0x03B7, 0x0313, 0x0342, 0x03B7,
+	0x0314, 0x0342, 0x0397, 0x0313, 0x0397, 0x0314, 0x0397, 0x0313,
+	0x0300, 0x0397, 0x0314, 0x0300, 0x0397, 0x0313, 0x0301, 0x0397,
+	0x0314, 0x0301, 0x0397, 0x0313, 0x0342, 0x0397, 0x0314, 0x0342,
+	0x03B9, 0x0313, 0x03B9, 0x0314, 0x03B9, 0x0313, 0x0300, 0x03B9,
+	0x0314, 0x0300, 0x03B9, 0x0313, 0x0301, 0x03B9, 0x0314, 0x0301,
+	0x03B9, 0x0313, 0x0342, 0x03B9, 0x0314, 0x0342, 0x0399, 0x0313,
+	0x0399, 0x0314, 0x0399, 0x0313, 0x0300, 0x0399, 0x0314, 0x0300,
+	0x0399, 0x0313, 0x0301, 0x0399, 0x0314, 0x0301, 0x0399, 0x0313,
+	0x0342, 0x0399, 0x0314, 0x0342, 0x03BF, 0x0313, 0x03BF, 0x0314,
+	0x03BF, 0x0313, 0x0300, 0x03BF, 0x0314, 0x0300, 0x03BF, 0x0313,
+	0x0301, 0x03BF, 0x0314, 0x0301, 0x039F, 0x0313, 0x039F, 0x0314,
+	0x039F, 0x0313, 0x0300, 0x039F, 0x0314, 0x0300, 0x039F, 0x0313,
+	0x0301, 0x039F, 0x0314, 0x0301, 0x03C5, 0x0313, 0x03C5, 0x0314,
+	0x03C5, 0x0313, 0x0300, 0x03C5, 0x0314, 0x0300, 0x03C5, 0x0313,
+	0x0301, 0x03C5, 0x0314, 0x0301, 0x03C5, 0x0313, 0x0342, 0x03C5,
+	0x0314, 0x0342, 0x03A5, 0x0314, 0x03A5, 0x0314, 0x0300, 0x03A5,
+	0x0314, 0x0301, 0x03A5, 0x0314, 0x0342, 0x03C9, 0x0313, 0x03C9,
+	0x0314, 0x03C9, 0x0313, 0x0300, 0x03C9, 0x0314, 0x0300, 0x03C9,
+	0x0313, 0x0301, 0x03C9, 0x0314, 0x0301, 0x03C9, 0x0313, 0x0342,
+	0x03C9, 0x0314, 0x0342, 0x03A9, 0x0313, 0x03A9, 0x0314, 0x03A9,
+	0x0313, 0x0300, 0x03A9, 0x0314, 0x0300, 0x03A9, 0x0313, 0x0301,
+	0x03A9, 0x0314, 0x0301, 0x03A9, 0x0313, 0x0342, 0x03A9, 0x0314,
+	0x0342, 0x03B1, 0x0300, 0x03B1, 0x0301, 0x03B5, 0x0300, 0x03B5,
+	0x0301, 0x03B7, 0x0300, 0x03B7, 0x0301, 0x03B9, 0x0300, 0x03B9,
+	0x0301, 0x03BF, 0x0300, 0x03BF, 0x0301, 0x03C5, 0x0300, 0x03C5,
+	0x0301, 0x03C9, 0x0300, 0x03C9, 0x0301, 0x03B1, 0x0313, 0x0345,
+	0x03B1, 0x0314, 0x0345, 0x03B1, 0x0313, 0x0300, 0x0345, 0x03B1,
+	0x0314, 0x0300, 0x0345, 0x03B1, 0x0313, 0x0301, 0x0345, 0x03B1,
+	0x0314, 0x0301, 0x0345, 0x03B1, 0x0313, 0x0342, 0x0345, 0x03B1,
+	0x0314, 0x0342, 0x0345, 0x0391, 0x0313, 0x0345, 0x0391, 0x0314,
+	0x0345, 0x0391, 0x0313, 0x0300, 0x0345, 0x0391, 0x0314, 0x0300,
+	0x0345, 0x0391, 0x0313, 0x0301, 0x0345, 0x0391, 0x0314, 0x0301,
+	0x0345, 0x0391, 0x0313, 0x0342, 0x0345, 0x0391, 0x0314, 0x0342,
+	0x0345, 0x03B7, 0x0313, 0x0345, 0x03B7, 0x0314, 0x0345, 0x03B7,
+	0x0313, 0x0300, 0x0345, 0x03B7, 0x0314, 0x0300, 0x0345, 0x03B7,
+	0x0313, 0x0301, 0x0345, 0x03B7, 0x0314, 0x0301, 0x0345, 0x03B7,
+	0x0313, 0x0342, 0x0345, 0x03B7, 0x0314, 0x0342, 0x0345, 0x0397,
+	0x0313, 0x0345, 0x0397, 0x0314, 0x0345, 0x0397, 0x0313, 0x0300,
+	0x0345, 0x0397, 0x0314, 0x0300, 0x0345, 0x0397, 0x0313, 0x0301,
+	0x0345, 0x0397, 0x0314, 0x0301, 0x0345, 0x0397, 0x0313, 0x0342,
+	0x0345, 0x0397, 0x0314, 0x0342, 0x0345, 0x03C9, 0x0313, 0x0345,
+	0x03C9, 0x0314, 0x0345, 0x03C9, 0x0313, 0x0300, 0x0345, 0x03C9,
+	0x0314, 0x0300, 0x0345, 0x03C9, 0x0313, 0x0301, 0x0345, 0x03C9,
+	0x0314, 0x0301, 0x0345, 0x03C9, 0x0313, 0x0342, 0x0345, 0x03C9,
+	0x0314, 0x0342, 0x0345, 0x03A9, 0x0313, 0x0345, 0x03A9, 0x0314,
+	0x0345, 0x03A9, 0x0313, 0x0300, 0x0345, 0x03A9, 0x0314, 0x0300,
+	0x0345, 0x03A9, 0x0313, 0x0301, 0x0345, 0x03A9, 0x0314, 0x0301,
+	0x0345, 0x03A9, 0x0313, 0x0342, 0x0345, 0x03A9, 0x0314, 0x0342,
+	0x0345, 0x03B1, 0x0306, 0x03B1, 0x0304, 0x03B1, 0x0300, 0x0345,
+	0x03B1, 0x0345, 0x03B1, 0x0301, 0x0345, 0x03B1, 0x0342, 0x03B1,
+	0x0342, 0x0345, 0x0391, 0x0306, 0x0391, 0x0304, 0x0391, 0x0300,
+	0x0391, 0x0301, 0x0391, 0x0345, 0x03B9, 0x00A8, 0x0342, 0x03B7,
+	0x0300, 0x0345, 0x03B7, 0x0345, 0x03B7, 0x0301, 0x0345, 0x03B7,
+	0x0342, 0x03B7, 0x0342, 0x0345, 0x0395, 0x0300, 0x0395, 0x0301,
+	0x0397, 0x0300, 0x0397, 0x0301, 0x0397, 0x0345, 0x1FBF, 0x0300,
+	0x1FBF, 0x0301, 0x1FBF, 0x0342, 0x03B9, 0x0306, 0x03B9, 0x0304,
+	0x03B9, 0x0308, 0x0300, 0x03B9, 0x0308, 0x0301, 0x03B9, 0x0342,
+	0x03B9, 0x0308, 0x0342, 0x0399, 0x0306, 0x0399, 0x0304, 0x0399,
+	0x0300, 0x0399, 0x0301, 0x1FFE, 0x0300, 0x1FFE, 0x0301, 0x1FFE,
+	0x0342, 0x03C5, 0x0306, 0x03C5, 0x0304, 0x03C5, 0x0308, 0x0300,
+	0x03C5, 0x0308, 0x0301, 0x03C1, 0x0313, 0x03C1, 0x0314, 0x03C5,
+	0x0342, 0x03C5, 0x0308, 0x0342, 0x03A5, 0x0306, 0x03A5, 0x0304,
+	0x03A5, 0x0300, 0x03A5, 0x0301, 0x03A1, 0x0314, 0x00A8, 0x0300,
+	0x00A8, 0x0301, 0x0060, 0x03C9, 0x0300, 0x0345, 0x03C9, 0x0345,
+	0x03C9, 0x0301, 0x0345, 0x03C9, 0x0342, 0x03C9, 0x0342, 0x0345,
+	0x039F, 0x0300, 0x039F, 0x0301, 0x03A9, 0x0300, 0x03A9, 0x0301,
+	0x03A9, 0x0345, 0x00B4, 0x2002, 0x2003, 0x03A9, 0x004B, 0x0041,
+	0x030A, 0x2190, 0x0338, 0x2192, 0x0338, 0x2194, 0x0338, 0x21D0,
+	0x0338, 0x21D4, 0x0338, 0x21D2, 0x0338, 0x2203, 0x0338, 0x2208,
+	0x0338, 0x220B, 0x0338, 0x2223, 0x0338, 0x2225, 0x0338, 0x223C,
+	0x0338, 0x2243, 0x0338, 0x2245, 0x0338, 0x2248, 0x0338, 0x003D,
+	0x0338, 0x2261, 0x0338, 0x224D, 0x0338, 0x003C, 0x0338, 0x003E,
+	0x0338, 0x2264, 0x0338, 0x2265, 0x0338, 0x2272, 0x0338, 0x2273,
+	0x0338, 0x2276, 0x0338, 0x2277, 0x0338, 0x227A, 0x0338, 0x227B,
+	0x0338, 0x2282, 0x0338, 0x2283, 0x0338, 0x2286, 0x0338, 0x2287,
+	0x0338, 0x22A2, 0x0338, 0x22A8, 0x0338, 0x22A9, 0x0338, 0x22AB,
+	0x0338, 0x227C, 0x0338, 0x227D, 0x0338, 0x2291, 0x0338, 0x2292,
+	0x0338, 0x22B2, 0x0338, 0x22B3, 0x0338, 0x22B4, 0x0338, 0x22B5,
+	0x0338, 0x3008, 0x3009, 0x2ADD, 0x0338, 0x304B, 0x3099, 0x304D,
+	0x3099, 0x304F, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055,
+	0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305B, 0x3099, 0x305D,
+	0x3099, 0x305F, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066,
+	0x3099, 0x3068, 0x3099, 0x306F, 0x3099, 0x306F, 0x309A, 0x3072,
+	0x3099, 0x3072, 0x309A, 0x3075, 0x3099, 0x3075, 0x309A, 0x3078,
+	0x3099, 0x3078, 0x309A, 0x307B, 0x3099, 0x307B, 0x309A, 0x3046,
+	0x3099, 0x309D, 0x3099, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF,
+	0x3099, 0x30B1, 0x3099, 0x30B3, 0x3099, 0x30B5, 0x3099, 0x30B7,
+	0x3099, 0x30B9, 0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF,
+	0x3099, 0x30C1, 0x3099, 0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8,
+	0x3099, 0x30CF, 0x3099, 0x30CF, 0x309A, 0x30D2, 0x3099, 0x30D2,
+	0x309A, 0x30D5, 0x3099, 0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8,
+	0x309A, 0x30DB, 0x3099, 0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF,
+	0x3099, 0x30F0, 0x3099, 0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD,
+	0x3099, 0x8C48, 0x66F4, 0x8ECA, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5,
+	0x9F9C, 0x9F9C, 0x5951, 0x91D1, 0x5587, 0x5948, 0x61F6, 0x7669,
+	0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9,
+	0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04, 0x721B,
+	0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8,
+	0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86, 0x51B7,
+	0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8001, 0x8606, 0x865C,
+	0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0, 0x83C9,
+	0x9304, 0x9E7F, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262,
+	0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F,
+	0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C,
+	0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF, 0x6A02, 0x8AFE, 0x4E39,
+	0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9,
+	0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449,
+	0x8AAA, 0x6BBA, 0x8FB0, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565,
+	0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF,
+	0x52F5, 0x5442, 0x5973, 0x5EEC, 0x65C5, 0x6FFE, 0x792A, 0x95AD,
+	0x9A6A, 0x9E97, 0x9ECE, 0x529B, 0x66C6, 0x6B77, 0x8F62, 0x5E74,
+	0x6190, 0x6200, 0x649A, 0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4,
+	0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD,
+	0x70C8, 0x88C2, 0x8AAA, 0x5EC9, 0x5FF5, 0x637B, 0x6BAE, 0x7C3E,
+	0x7375, 0x4EE4, 0x56F9, 0x5BE7, 0x5DBA, 0x601C, 0x73B2, 0x7469,
+	0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE,
+	0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F, 0x6599,
+	0x6A02, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x9F8D, 0x6688, 0x962E,
+	0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B,
+	0x7D10, 0x985E, 0x516D, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA,
+	0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540F,
+	0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79,
+	0x88CF, 0x88E1, 0x91CC, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0,
+	0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8,
+	0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336,
+	0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4,
+	0x8F3B, 0x884C, 0x964D, 0x898B, 0x5ED3, 0x5140, 0x55C0, 0x585A,
+	0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F,
+	0x9756, 0x7CBE, 0x7FBD, 0x8612, 0x8AF8, 0x9038, 0x90FD, 0x98EF,
+	0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D,
+	0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668, 0x5840, 0x58A8,
+	0x5C64, 0x5C6E, 0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2,
+	0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422,
+	0x7891, 0x793E, 0x7949, 0x7948, 0x7950, 0x7956, 0x795D, 0x798D,
+	0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7DF4, 0x7E09, 0x7E41, 0x7F72,
+	0x8005, 0x81ED, 0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8B01,
+	0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038, 0x96E3, 0x97FF, 0x983B,
+	0x6075, 0x242EE, 0x8218, 0x4E26, 0x51B5, 0x5168, 0x4F80, 0x5145,
+	0x5180, 0x52C7, 0x52FA, 0x559D, 0x5555, 0x5599, 0x55E2, 0x585A,
+	0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69,
+	0x5FAD, 0x60D8, 0x614E, 0x6108, 0x618E, 0x6160, 0x61F2, 0x6234,
+	0x63C4, 0x641C, 0x6452, 0x6556, 0x6674, 0x6717, 0x671B, 0x6756,
+	0x6B79, 0x6BBA, 0x6D41, 0x6EDB, 0x6ECB, 0x6F22, 0x701E, 0x716E,
+	0x77A7, 0x7235, 0x72AF, 0x732A, 0x7471, 0x7506, 0x753B, 0x761D,
+	0x761F, 0x76CA, 0x76DB, 0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1,
+	0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4, 0x7F3E, 0x8005, 0x8352, 0x83EF,
+	0x8779, 0x8941, 0x8986, 0x8996, 0x8ABF, 0x8AF8, 0x8ACB, 0x8B01,
+	0x8AFE, 0x8AED, 0x8B39, 0x8B8A, 0x8D08, 0x8F38, 0x9072, 0x9199,
+	0x9276, 0x967C, 0x96E3, 0x9756, 0x97DB, 0x97FF, 0x980B, 0x983B,
+	0x9B12, 0x9F9C, 0x2284A, 0x22844, 0x233D5, 0x3B9D, 0x4018, 0x4039,
+	0x25249, 0x25CD0, 0x27ED3, 0x9F43, 0x9F8E, 0x05D9, 0x05B4, 0x05F2,
+	0x05B7, 0x05E9, 0x05C1, 0x05E9, 0x05C2, 0x05E9, 0x05BC, 0x05C1,
+	0x05E9, 0x05BC, 0x05C2, 0x05D0, 0x05B7, 0x05D0, 0x05B8, 0x05D0,
+	0x05BC, 0x05D1, 0x05BC, 0x05D2, 0x05BC, 0x05D3, 0x05BC, 0x05D4,
+	0x05BC, 0x05D5, 0x05BC, 0x05D6, 0x05BC, 0x05D8, 0x05BC, 0x05D9,
+	0x05BC, 0x05DA, 0x05BC, 0x05DB, 0x05BC, 0x05DC, 0x05BC, 0x05DE,
+	0x05BC, 0x05E0, 0x05BC, 0x05E1, 0x05BC, 0x05E3, 0x05BC, 0x05E4,
+	0x05BC, 0x05E6, 0x05BC, 0x05E7, 0x05BC, 0x05E8, 0x05BC, 0x05E9,
+	0x05BC, 0x05EA, 0x05BC, 0x05D5, 0x05B9, 0x05D1, 0x05BF, 0x05DB,
+	0x05BF, 0x05E4, 0x05BF, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5,
+	0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x1D157, 0x1D165, 0x1D158,
+	0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158,
+	0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172,
+	0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA,
+	0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F,
+	0x4E3D, 0x4E38, 0x4E41, 0x20122, 0x4F60, 0x4FAE, 0x4FBB, 0x5002,
+	0x507A, 0x5099, 0x50E7, 0x50CF, 0x349E, 0x2063A, 0x514D, 0x5154,
+	0x5164, 0x5177, 0x2051C, 0x34B9, 0x5167, 0x518D, 0x2054B, 0x5197,
+	0x51A4, 0x4ECC, 0x51AC, 0x51B5, 0x291DF, 0x51F5, 0x5203, 0x34DF,
+	0x523B, 0x5246, 0x5272, 0x5277, 0x3515, 0x52C7, 0x52C9, 0x52E4,
+	0x52FA, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535A, 0x5373,
+	0x537D, 0x537F, 0x537F, 0x537F, 0x20A2C, 0x7070, 0x53CA, 0x53DF,
+	0x20B63, 0x53EB, 0x53F1, 0x5406, 0x549E, 0x5438, 0x5448, 0x5468,
+	0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599,
+	0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5606, 0x5717, 0x5651, 0x5674,
+	0x5207, 0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B, 0x5832, 0x5831,
+	0x58AC, 0x214E4, 0x58F2, 0x58F7, 0x5906, 0x591A, 0x5922, 0x5962,
+	0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8, 0x5A66, 0x36EE,
+	0x36FC, 0x5B08, 0x5B3E, 0x5B3E, 0x219C8, 0x5BC3, 0x5BD8, 0x5BE7,
+	0x5BF3, 0x21B18, 0x5BFF, 0x5C06, 0x5F53, 0x5C22, 0x3781, 0x5C60,
+	0x5C6E, 0x5CC0, 0x5C8D, 0x21DE4, 0x5D43, 0x21DE6, 0x5D6E, 0x5D6B,
+	0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28, 0x5E3D, 0x5E69,
+	0x3862, 0x22183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6, 0x5ECA, 0x2A392,
+	0x5EFE, 0x22331, 0x22331, 0x8201, 0x5F22, 0x5F22, 0x38C7, 0x232B8,
+	0x261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD, 0x5FD7, 0x5FF9,
+	0x6081, 0x393A, 0x391C, 0x6094, 0x226D4, 0x60C7, 0x6148, 0x614C,
+	0x614E, 0x614C, 0x617A, 0x618E, 0x61B2, 0x61A4, 0x61AF, 0x61DE,
+	0x61F2, 0x61F6, 0x6210, 0x621B, 0x625D, 0x62B1, 0x62D4, 0x6350,
+	0x22B0C, 0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4, 0x22BF1, 0x6422,
+	0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E, 0x649D, 0x6477, 0x3A6C,
+	0x654F, 0x656C, 0x2300A, 0x65E3, 0x66F8, 0x6649, 0x3B19, 0x6691,
+	0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C, 0x80AD, 0x43D9,
+	0x6717, 0x671B, 0x6721, 0x675E, 0x6753, 0x233C3, 0x3B49, 0x67FA,
+	0x6785, 0x6852, 0x6885, 0x2346D, 0x688E, 0x681F, 0x6914, 0x3B9D,
+	0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB, 0x3C18, 0x6B21,
+	0x238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBA, 0x6BBB, 0x23A8D,
+	0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC, 0x6CBF, 0x6CCD, 0x6C67, 0x6D16,
+	0x6D3E, 0x6D77, 0x6D41, 0x6D69, 0x6D78, 0x6D85, 0x23D1E, 0x6D34,
+	0x6E2F, 0x6E6E, 0x3D33, 0x6ECB, 0x6EC7, 0x23ED1, 0x6DF9, 0x6F6E,
+	0x23F5E, 0x23F8E, 0x6FC6, 0x7039, 0x701E, 0x701B, 0x3D96, 0x704A,
+	0x707D, 0x7077, 0x70AD, 0x20525, 0x7145, 0x24263, 0x719C, 0x243AB,
+	0x7228, 0x7235, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735, 0x24814,
+	0x737A, 0x738B, 0x3EAC, 0x73A5, 0x3EB8, 0x3EB8, 0x7447, 0x745C,
+	0x7471, 0x7485, 0x74CA, 0x3F1B, 0x7524, 0x24C36, 0x753E, 0x24C92,
+	0x7570, 0x2219F, 0x7610, 0x24FA1, 0x24FB8, 0x25044, 0x3FFC, 0x4008,
+	0x76F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x771E, 0x771F, 0x771F,
+	0x774A, 0x4039, 0x778B, 0x4046, 0x4096, 0x2541D, 0x784E, 0x788C,
+	0x78CC, 0x40E3, 0x25626, 0x7956, 0x2569A, 0x256C5, 0x798F, 0x79EB,
+	0x412F, 0x7A40, 0x7A4A, 0x7A4F, 0x2597C, 0x25AA7, 0x25AA7, 0x7AEE,
+	0x4202, 0x25BAB, 0x7BC6, 0x7BC9, 0x4227, 0x25C80, 0x7CD2, 0x42A0,
+	0x7CE8, 0x7CE3, 0x7D00, 0x25F86, 0x7D63, 0x4301, 0x7DC7, 0x7E02,
+	0x7E45, 0x4334, 0x26228, 0x26247, 0x4359, 0x262D9, 0x7F7A, 0x2633E,
+	0x7F95, 0x7FFA, 0x8005, 0x264DA, 0x26523, 0x8060, 0x265A8, 0x8070,
+	0x2335F, 0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E, 0x5AB5, 0x267A7,
+	0x267B5, 0x23393, 0x2339C, 0x8201, 0x8204, 0x8F9E, 0x446B, 0x8291,
+	0x828B, 0x829D, 0x52B3, 0x82B1, 0x82B3, 0x82BD, 0x82E6, 0x26B3C,
+	0x82E5, 0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD, 0x83E7, 0x8457,
+	0x8353, 0x83CA, 0x83CC, 0x83DC, 0x26C36, 0x26D6B, 0x26CD5, 0x452B,
+	0x84F1, 0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C, 0x455D, 0x4561,
+	0x26FB1, 0x270D2, 0x456B, 0x8650, 0x865C, 0x8667, 0x8669, 0x86A9,
+	0x8688, 0x870E, 0x86E2, 0x8779, 0x8728, 0x876B, 0x8786, 0x45D7,
+	0x87E1, 0x8801, 0x45F9, 0x8860, 0x8863, 0x27667, 0x88D7, 0x88DE,
+	0x4635, 0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE, 0x46C7, 0x8AA0,
+	0x8AED, 0x8B8A, 0x8C55, 0x27CA8, 0x8CAB, 0x8CC1, 0x8D1B, 0x8D77,
+	0x27F2F, 0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE, 0x8ED4, 0x8F38,
+	0x285D2, 0x285ED, 0x9094, 0x90F1, 0x9111, 0x2872E, 0x911B, 0x9238,
+	0x92D7, 0x92D8, 0x927C, 0x93F9, 0x9415, 0x28BFA, 0x958B, 0x4995,
+	0x95B7, 0x28D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723, 0x29145, 0x2921A,
+	0x4A6E, 0x4A76, 0x97E0, 0x2940A, 0x4AB2, 0x29496, 0x980B, 0x980B,
+	0x9829, 0x295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7, 0x99C2, 0x99FE,
+	0x4BCE, 0x29B30, 0x9B12, 0x9C40, 0x9CFD, 0x4CCE, 0x4CED, 0x9D67,
+	0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E, 0x2A291, 0x9EBB, 0x4D56, 0x9EF9,
+	0x9EFE, 0x9F05, 0x9F0F, 0x9F16, 0x9F3B, 0x2A600, 0x0020, 0x0020,
+	0x0308, 0x0061, 0x0020, 0x0304, 0x0032, 0x0033, 0x0020, 0x0301,
+	0x03BC, 0x0020, 0x0327, 0x0031, 0x006F, 0x0031, 0x2044, 0x0034,
+	0x0031, 0x2044, 0x0032, 0x0033, 0x2044, 0x0034, 0x0049, 0x004A,
+	0x0069, 0x006A, 0x004C, 0x00B7, 0x006C, 0x00B7, 0x02BC, 0x006E,
+	0x0073, 0x0044, 0x005A, 0x030C, 0x0044, 0x007A, 0x030C, 0x0064,
+	0x007A, 0x030C, 0x004C, 0x004A, 0x004C, 0x006A, 0x006C, 0x006A,
+	0x004E, 0x004A, 0x004E, 0x006A, 0x006E, 0x006A, 0x0044, 0x005A,
+	0x0044, 0x007A, 0x0064, 0x007A, 0x0068, 0x0266, 0x006A, 0x0072,
+	0x0279, 0x027B, 0x0281, 0x0077, 0x0079, 0x0020, 0x0306, 0x0020,
+	0x0307, 0x0020, 0x030A, 0x0020, 0x0328, 0x0020, 0x0303, 0x0020,
+	0x030B, 0x0263, 0x006C, 0x0073, 0x0078, 0x0295, 0x0020, 0x0345,
+	0x0020, 0x0301, 0x0020, 0x0308, 0x0301, 0x03B2, 0x03B8, 0x03A5,
+	0x03A5, 0x0301, 0x03A5, 0x0308, 0x03C6, 0x03C0, 0x03BA, 0x03C1,
+	0x03C2, 0x0398, 0x03B5, 0x03A3, 0x0565, 0x0582, 0x0627, 0x0674,
+	0x0648, 0x0674, 0x06C7, 0x0674, 0x064A, 0x0674, 0x0E4D, 0x0E32,
+	0x0ECD, 0x0EB2, 0x0EAB, 0x0E99, 0x0EAB, 0x0EA1, 0x0F0B, 0x0FB2,
+	0x0F71, 0x0F80, 0x0FB3, 0x0F71, 0x0F80, 0x10DC, 0x0041, 0x00C6,
+	0x0042, 0x0044, 0x0045, 0x018E, 0x0047, 0x0048, 0x0049, 0x004A,
+	0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0222, 0x0050, 0x0052,
+	0x0054, 0x0055, 0x0057, 0x0061, 0x0250, 0x0251, 0x1D02, 0x0062,
+	0x0064, 0x0065, 0x0259, 0x025B, 0x025C, 0x0067, 0x006B, 0x006D,
+	0x014B, 0x006F, 0x0254, 0x1D16, 0x1D17, 0x0070, 0x0074, 0x0075,
+	0x1D1D, 0x026F, 0x0076, 0x1D25, 0x03B2, 0x03B3, 0x03B4, 0x03C6,
+	0x03C7, 0x0069, 0x0072, 0x0075, 0x0076, 0x03B2, 0x03B3, 0x03C1,
+	0x03C6, 0x03C7, 0x043D, 0x0252, 0x0063, 0x0255, 0x00F0, 0x025C,
+	0x0066, 0x025F, 0x0261, 0x0265, 0x0268, 0x0269, 0x026A, 0x1D7B,
+	0x029D, 0x026D, 0x1D85, 0x029F, 0x0271, 0x0270, 0x0272, 0x0273,
+	0x0274, 0x0275, 0x0278, 0x0282, 0x0283, 0x01AB, 0x0289, 0x028A,
+	0x1D1C, 0x028B, 0x028C, 0x007A, 0x0290, 0x0291, 0x0292, 0x03B8,
+	0x0061, 0x02BE, 0x0073, 0x0307, 0x0020, 0x0313, 0x0020, 0x0313,
+	0x0020, 0x0342, 0x0020, 0x0308, 0x0342, 0x0020, 0x0313, 0x0300,
+	0x0020, 0x0313, 0x0301, 0x0020, 0x0313, 0x0342, 0x0020, 0x0314,
+	0x0300, 0x0020, 0x0314, 0x0301, 0x0020, 0x0314, 0x0342, 0x0020,
+	0x0308, 0x0300, 0x0020, 0x0308, 0x0301, 0x0020, 0x0301, 0x0020,
+	0x0314, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+	0x0020, 0x0020, 0x0020, 0x0020, 0x2010, 0x0020, 0x0333, 0x002E,
+	0x002E, 0x002E, 0x002E, 0x002E, 0x002E, 0x0020, 0x2032, 0x2032,
+	0x2032, 0x2032, 0x2032, 0x2035, 0x2035, 0x2035, 0x2035, 0x2035,
+	0x0021, 0x0021, 0x0020, 0x0305, 0x003F, 0x003F, 0x003F, 0x0021,
+	0x0021, 0x003F, 0x2032, 0x2032, 0x2032, 0x2032, 0x0020, 0x0030,
+	0x0069, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x002B,
+	0x2212, 0x003D, 0x0028, 0x0029, 0x006E, 0x0030, 0x0031, 0x0032,
+	0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x002B,
+	0x2212, 0x003D, 0x0028, 0x0029, 0x0061, 0x0065, 0x006F, 0x0078,
+	0x0259, 0x0068, 0x006B, 0x006C, 0x006D, 0x006E, 0x0070, 0x0073,
+	0x0074, 0x0052, 0x0073, 0x0061, 0x002F, 0x0063, 0x0061, 0x002F,
+	0x0073, 0x0043, 0x00B0, 0x0043, 0x0063, 0x002F, 0x006F, 0x0063,
+	0x002F, 0x0075, 0x0190, 0x00B0, 0x0046, 0x0067, 0x0048, 0x0048,
+	0x0048, 0x0068, 0x0127, 0x0049, 0x0049, 0x004C, 0x006C, 0x004E,
+	0x004E, 0x006F, 0x0050, 0x0051, 0x0052, 0x0052, 0x0052, 0x0053,
+	0x004D, 0x0054, 0x0045, 0x004C, 0x0054, 0x004D, 0x005A, 0x005A,
+	0x0042, 0x0043, 0x0065, 0x0045, 0x0046, 0x004D, 0x006F, 0x05D0,
+	0x05D1, 0x05D2, 0x05D3, 0x0069, 0x0046, 0x0041, 0x0058, 0x03C0,
+	0x03B3, 0x0393, 0x03A0, 0x2211, 0x0044, 0x0064, 0x0065, 0x0069,
+	0x006A, 0x0031, 0x2044, 0x0037, 0x0031, 0x2044, 0x0039, 0x0031,
+	0x2044, 0x0031, 0x0030, 0x0031, 0x2044, 0x0033, 0x0032, 0x2044,
+	0x0033, 0x0031, 0x2044, 0x0035, 0x0032, 0x2044, 0x0035, 0x0033,
+	0x2044, 0x0035, 0x0034, 0x2044, 0x0035, 0x0031, 0x2044, 0x0036,
+	0x0035, 0x2044, 0x0036, 0x0031, 0x2044, 0x0038, 0x0033, 0x2044,
+	0x0038, 0x0035, 0x2044, 0x0038, 0x0037, 0x2044, 0x0038, 0x0031,
+	0x2044, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049,
+	0x0056, 0x0056, 0x0056, 0x0049, 0x0056, 0x0049, 0x0049, 0x0056,
+	0x0049, 0x0049, 0x0049, 0x0049, 0x0058, 0x0058, 0x0058, 0x0049,
+	0x0058, 0x0049, 0x0049, 0x004C, 0x0043, 0x0044, 0x004D, 0x0069,
+	0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0076, 0x0076,
+	0x0076, 0x0069, 0x0076, 0x0069, 0x0069, 0x0076, 0x0069, 0x0069,
+	0x0069, 0x0069, 0x0078, 0x0078, 0x0078, 0x0069, 0x0078, 0x0069,
+	0x0069, 0x006C, 0x0063, 0x0064, 0x006D, 0x0030, 0x2044, 0x0033,
+	0x222B, 0x222B, 0x222B, 0x222B, 0x222B, 0x222E, 0x222E, 0x222E,
+	0x222E, 0x222E, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036,
+	0x0037, 0x0038, 0x0039, 0x0031, 0x0030, 0x0031, 0x0031, 0x0031,
+	0x0032, 0x0031, 0x0033, 0x0031, 0x0034, 0x0031, 0x0035, 0x0031,
+	0x0036, 0x0031, 0x0037, 0x0031, 0x0038, 0x0031, 0x0039, 0x0032,
+	0x0030, 0x0028, 0x0031, 0x0029, 0x0028, 0x0032, 0x0029, 0x0028,
+	0x0033, 0x0029, 0x0028, 0x0034, 0x0029, 0x0028, 0x0035, 0x0029,
+	0x0028, 0x0036, 0x0029, 0x0028, 0x0037, 0x0029, 0x0028, 0x0038,
+	0x0029, 0x0028, 0x0039, 0x0029, 0x0028, 0x0031, 0x0030, 0x0029,
+	0x0028, 0x0031, 0x0031, 0x0029, 0x0028, 0x0031, 0x0032, 0x0029,
+	0x0028, 0x0031, 0x0033, 0x0029, 0x0028, 0x0031, 0x0034, 0x0029,
+	0x0028, 0x0031, 0x0035, 0x0029, 0x0028, 0x0031, 0x0036, 0x0029,
+	0x0028, 0x0031, 0x0037, 0x0029, 0x0028, 0x0031, 0x0038, 0x0029,
+	0x0028, 0x0031, 0x0039, 0x0029, 0x0028, 0x0032, 0x0030, 0x0029,
+	0x0031, 0x002E, 0x0032, 0x002E, 0x0033, 0x002E, 0x0034, 0x002E,
+	0x0035, 0x002E, 0x0036, 0x002E, 0x0037, 0x002E, 0x0038, 0x002E,
+	0x0039, 0x002E, 0x0031, 0x0030, 0x002E, 0x0031, 0x0031, 0x002E,
+	0x0031, 0x0032, 0x002E, 0x0031, 0x0033, 0x002E, 0x0031, 0x0034,
+	0x002E, 0x0031, 0x0035, 0x002E, 0x0031, 0x0036, 0x002E, 0x0031,
+	0x0037, 0x002E, 0x0031, 0x0038, 0x002E, 0x0031, 0x0039, 0x002E,
+	0x0032, 0x0030, 0x002E, 0x0028, 0x0061, 0x0029, 0x0028, 0x0062,
+	0x0029, 0x0028, 0x0063, 0x0029, 0x0028, 0x0064, 0x0029, 0x0028,
+	0x0065, 0x0029, 0x0028, 0x0066, 0x0029, 0x0028, 0x0067, 0x0029,
+	0x0028, 0x0068, 0x0029, 0x0028, 0x0069, 0x0029, 0x0028, 0x006A,
+	0x0029, 0x0028, 0x006B, 0x0029, 0x0028, 0x006C, 0x0029, 0x0028,
+	0x006D, 0x0029, 0x0028, 0x006E, 0x0029, 0x0028, 0x006F, 0x0029,
+	0x0028, 0x0070, 0x0029, 0x0028, 0x0071, 0x0029, 0x0028, 0x0072,
+	0x0029, 0x0028, 0x0073, 0x0029, 0x0028, 0x0074, 0x0029, 0x0028,
+	0x0075, 0x0029, 0x0028, 0x0076, 0x0029, 0x0028, 0x0077, 0x0029,
+	0x0028, 0x0078, 0x0029, 0x0028, 0x0079, 0x0029, 0x0028, 0x007A,
+	0x0029, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+	0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D,
+	0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+	0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0030, 0x222B, 0x222B,
+	0x222B, 0x222B, 0x003A, 0x003A, 0x003D, 0x003D, 0x003D, 0x003D,
+	0x003D, 0x003D, 0x006A, 0x0056, 0x2D61, 0x6BCD, 0x9F9F, 0x4E00,
+	0x4E28, 0x4E36, 0x4E3F, 0x4E59, 0x4E85, 0x4E8C, 0x4EA0, 0x4EBA,
+	0x513F, 0x5165, 0x516B, 0x5182, 0x5196, 0x51AB, 0x51E0, 0x51F5,
+	0x5200, 0x529B, 0x52F9, 0x5315, 0x531A, 0x5338, 0x5341, 0x535C,
+	0x5369, 0x5382, 0x53B6, 0x53C8, 0x53E3, 0x56D7, 0x571F, 0x58EB,
+	0x5902, 0x590A, 0x5915, 0x5927, 0x5973, 0x5B50, 0x5B80, 0x5BF8,
+	0x5C0F, 0x5C22, 0x5C38, 0x5C6E, 0x5C71, 0x5DDB, 0x5DE5, 0x5DF1,
+	0x5DFE, 0x5E72, 0x5E7A, 0x5E7F, 0x5EF4, 0x5EFE, 0x5F0B, 0x5F13,
+	0x5F50, 0x5F61, 0x5F73, 0x5FC3, 0x6208, 0x6236, 0x624B, 0x652F,
+	0x6534, 0x6587, 0x6597, 0x65A4, 0x65B9, 0x65E0, 0x65E5, 0x66F0,
+	0x6708, 0x6728, 0x6B20, 0x6B62, 0x6B79, 0x6BB3, 0x6BCB, 0x6BD4,
+	0x6BDB, 0x6C0F, 0x6C14, 0x6C34, 0x706B, 0x722A, 0x7236, 0x723B,
+	0x723F, 0x7247, 0x7259, 0x725B, 0x72AC, 0x7384, 0x7389, 0x74DC,
+	0x74E6, 0x7518, 0x751F, 0x7528, 0x7530, 0x758B, 0x7592, 0x7676,
+	0x767D, 0x76AE, 0x76BF, 0x76EE, 0x77DB, 0x77E2, 0x77F3, 0x793A,
+	0x79B8, 0x79BE, 0x7A74, 0x7ACB, 0x7AF9, 0x7C73, 0x7CF8, 0x7F36,
+	0x7F51, 0x7F8A, 0x7FBD, 0x8001, 0x800C, 0x8012, 0x8033, 0x807F,
+	0x8089, 0x81E3, 0x81EA, 0x81F3, 0x81FC, 0x820C, 0x821B, 0x821F,
+	0x826E, 0x8272, 0x8278, 0x864D, 0x866B, 0x8840, 0x884C, 0x8863,
+	0x897E, 0x898B, 0x89D2, 0x8A00, 0x8C37, 0x8C46, 0x8C55, 0x8C78,
+	0x8C9D, 0x8D64, 0x8D70, 0x8DB3, 0x8EAB, 0x8ECA, 0x8F9B, 0x8FB0,
+	0x8FB5, 0x9091, 0x9149, 0x91C6, 0x91CC, 0x91D1, 0x9577, 0x9580,
+	0x961C, 0x96B6, 0x96B9, 0x96E8, 0x9751, 0x975E, 0x9762, 0x9769,
+	0x97CB, 0x97ED, 0x97F3, 0x9801, 0x98A8, 0x98DB, 0x98DF, 0x9996,
+	0x9999, 0x99AC, 0x9AA8, 0x9AD8, 0x9ADF, 0x9B25, 0x9B2F, 0x9B32,
+	0x9B3C, 0x9B5A, 0x9CE5, 0x9E75, 0x9E7F, 0x9EA5, 0x9EBB, 0x9EC3,
+	0x9ECD, 0x9ED1, 0x9EF9, 0x9EFD, 0x9F0E, 0x9F13, 0x9F20, 0x9F3B,
+	0x9F4A, 0x9F52, 0x9F8D, 0x9F9C, 0x9FA0, 0x0020, 0x3012, 0x5341,
+	0x5344, 0x5345, 0x0020, 0x3099, 0x0020, 0x309A, 0x3088, 0x308A,
+	0x30B3, 0x30C8, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD,
+	0x1103, 0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4,
+	0x11B5, 0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110A,
+	0x110B, 0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112,
+	0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168,
+	0x1169, 0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F, 0x1170,
+	0x1171, 0x1172, 0x1173, 0x1174, 0x1175, 0x1160, 0x1114, 0x1115,
+	0x11C7, 0x11C8, 0x11CC, 0x11CE, 0x11D3, 0x11D7, 0x11D9, 0x111C,
+	0x11DD, 0x11DF, 0x111D, 0x111E, 0x1120, 0x1122, 0x1123, 0x1127,
+	0x1129, 0x112B, 0x112C, 0x112D, 0x112E, 0x112F, 0x1132, 0x1136,
+	0x1140, 0x1147, 0x114C, 0x11F1, 0x11F2, 0x1157, 0x1158, 0x1159,
+	0x1184, 0x1185, 0x1188, 0x1191, 0x1192, 0x1194, 0x119E, 0x11A1,
+	0x4E00, 0x4E8C, 0x4E09, 0x56DB, 0x4E0A, 0x4E2D, 0x4E0B, 0x7532,
+	0x4E59, 0x4E19, 0x4E01, 0x5929, 0x5730, 0x4EBA, 0x0028, 0x1100,
+	0x0029, 0x0028, 0x1102, 0x0029, 0x0028, 0x1103, 0x0029, 0x0028,
+	0x1105, 0x0029, 0x0028, 0x1106, 0x0029, 0x0028, 0x1107, 0x0029,
+	0x0028, 0x1109, 0x0029, 0x0028, 0x110B, 0x0029, 0x0028, 0x110C,
+	0x0029, 0x0028, 0x110E, 0x0029, 0x0028, 0x110F, 0x0029, 0x0028,
+	0x1110, 0x0029, 0x0028, 0x1111, 0x0029, 0x0028, 0x1112, 0x0029,
+	0x0028, 0x1100, 0x1161, 0x0029, 0x0028, 0x1102, 0x1161, 0x0029,
+	0x0028, 0x1103, 0x1161, 0x0029, 0x0028, 0x1105, 0x1161, 0x0029,
+	0x0028, 0x1106, 0x1161, 0x0029, 0x0028, 0x1107, 0x1161, 0x0029,
+	0x0028, 0x1109, 0x1161, 0x0029, 0x0028, 0x110B, 0x1161, 0x0029,
+	0x0028, 0x110C, 0x1161, 0x0029, 0x0028, 0x110E, 0x1161, 0x0029,
+	0x0028, 0x110F, 0x1161, 0x0029, 0x0028, 0x1110, 0x1161, 0x0029,
+	0x0028, 0x1111, 0x1161, 0x0029, 0x0028, 0x1112, 0x1161, 0x0029,
+	0x0028, 0x110C, 0x116E, 0x0029, 0x0028, 0x110B, 0x1169, 0x110C,
+	0x1165, 0x11AB, 0x0029, 0x0028, 0x110B, 0x1169, 0x1112, 0x116E,
+	0x0029, 0x0028, 0x4E00, 0x0029, 0x0028, 0x4E8C, 0x0029, 0x0028,
+	0x4E09, 0x0029, 0x0028, 0x56DB, 0x0029, 0x0028, 0x4E94, 0x0029,
+	0x0028, 0x516D, 0x0029, 0x0028, 0x4E03, 0x0029, 0x0028, 0x516B,
+	0x0029, 0x0028, 0x4E5D, 0x0029, 0x0028, 0x5341, 0x0029, 0x0028,
+	0x6708, 0x0029, 0x0028, 0x706B, 0x0029, 0x0028, 0x6C34, 0x0029,
+	0x0028, 0x6728, 0x0029, 0x0028, 0x91D1, 0x0029, 0x0028, 0x571F,
+	0x0029, 0x0028, 0x65E5, 0x0029, 0x0028, 0x682A, 0x0029, 0x0028,
+	0x6709, 0x0029, 0x0028, 0x793E, 0x0029, 0x0028, 0x540D, 0x0029,
+	0x0028, 0x7279, 0x0029, 0x0028, 0x8CA1, 0x0029, 0x0028, 0x795D,
+	0x0029, 0x0028, 0x52B4, 0x0029, 0x0028, 0x4EE3, 0x0029, 0x0028,
+	0x547C, 0x0029, 0x0028, 0x5B66, 0x0029, 0x0028, 0x76E3, 0x0029,
+	0x0028, 0x4F01, 0x0029, 0x0028, 0x8CC7, 0x0029, 0x0028, 0x5354,
+	0x0029, 0x0028, 0x796D, 0x0029, 0x0028, 0x4F11, 0x0029, 0x0028,
+	0x81EA, 0x0029, 0x0028, 0x81F3, 0x0029, 0x554F, 0x5E7C, 0x6587,
+	0x7B8F, 0x0050, 0x0054, 0x0045, 0x0032, 0x0031, 0x0032, 0x0032,
+	0x0032, 0x0033, 0x0032, 0x0034, 0x0032, 0x0035, 0x0032, 0x0036,
+	0x0032, 0x0037, 0x0032, 0x0038, 0x0032, 0x0039, 0x0033, 0x0030,
+	0x0033, 0x0031, 0x0033, 0x0032, 0x0033, 0x0033, 0x0033, 0x0034,
+	0x0033, 0x0035, 0x1100, 0x1102, 0x1103, 0x1105, 0x1106, 0x1107,
+	0x1109, 0x110B, 0x110C, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112,
+	0x1100, 0x1161, 0x1102, 0x1161, 0x1103, 0x1161, 0x1105, 0x1161,
+	0x1106, 0x1161, 0x1107, 0x1161, 0x1109, 0x1161, 0x110B, 0x1161,
+	0x110C, 0x1161, 0x110E, 0x1161, 0x110F, 0x1161, 0x1110, 0x1161,
+	0x1111, 0x1161, 0x1112, 0x1161, 0x110E, 0x1161, 0x11B7, 0x1100,
+	0x1169, 0x110C, 0x116E, 0x110B, 0x1174, 0x110B, 0x116E, 0x4E00,
+	0x4E8C, 0x4E09, 0x56DB, 0x4E94, 0x516D, 0x4E03, 0x516B, 0x4E5D,
+	0x5341, 0x6708, 0x706B, 0x6C34, 0x6728, 0x91D1, 0x571F, 0x65E5,
+	0x682A, 0x6709, 0x793E, 0x540D, 0x7279, 0x8CA1, 0x795D, 0x52B4,
+	0x79D8, 0x7537, 0x5973, 0x9069, 0x512A, 0x5370, 0x6CE8, 0x9805,
+	0x4F11, 0x5199, 0x6B63, 0x4E0A, 0x4E2D, 0x4E0B, 0x5DE6, 0x53F3,
+	0x533B, 0x5B97, 0x5B66, 0x76E3, 0x4F01, 0x8CC7, 0x5354, 0x591C,
+	0x0033, 0x0036, 0x0033, 0x0037, 0x0033, 0x0038, 0x0033, 0x0039,
+	0x0034, 0x0030, 0x0034, 0x0031, 0x0034, 0x0032, 0x0034, 0x0033,
+	0x0034, 0x0034, 0x0034, 0x0035, 0x0034, 0x0036, 0x0034, 0x0037,
+	0x0034, 0x0038, 0x0034, 0x0039, 0x0035, 0x0030, 0x0031, 0x6708,
+	0x0032, 0x6708, 0x0033, 0x6708, 0x0034, 0x6708, 0x0035, 0x6708,
+	0x0036, 0x6708, 0x0037, 0x6708, 0x0038, 0x6708, 0x0039, 0x6708,
+	0x0031, 0x0030, 0x6708, 0x0031, 0x0031, 0x6708, 0x0031, 0x0032,
+	0x6708, 0x0048, 0x0067, 0x0065, 0x0072, 0x0067, 0x0065, 0x0056,
+	0x004C, 0x0054, 0x0044, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA,
+	0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9,
+	0x30BB, 0x30BD, 0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA,
+	0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8,
+	0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6,
+	0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F0,
+	0x30F1, 0x30F2, 0x30A2, 0x30CF, 0x309A, 0x30FC, 0x30C8, 0x30A2,
+	0x30EB, 0x30D5, 0x30A1, 0x30A2, 0x30F3, 0x30D8, 0x309A, 0x30A2,
+	0x30A2, 0x30FC, 0x30EB, 0x30A4, 0x30CB, 0x30F3, 0x30AF, 0x3099,
+	0x30A4, 0x30F3, 0x30C1, 0x30A6, 0x30A9, 0x30F3, 0x30A8, 0x30B9,
+	0x30AF, 0x30FC, 0x30C8, 0x3099, 0x30A8, 0x30FC, 0x30AB, 0x30FC,
+	0x30AA, 0x30F3, 0x30B9, 0x30AA, 0x30FC, 0x30E0, 0x30AB, 0x30A4,
+	0x30EA, 0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x30AB, 0x30ED, 0x30EA,
+	0x30FC, 0x30AB, 0x3099, 0x30ED, 0x30F3, 0x30AB, 0x3099, 0x30F3,
+	0x30DE, 0x30AD, 0x3099, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30CB,
+	0x30FC, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x30AD, 0x3099, 0x30EB,
+	0x30BF, 0x3099, 0x30FC, 0x30AD, 0x30ED, 0x30AD, 0x30ED, 0x30AF,
+	0x3099, 0x30E9, 0x30E0, 0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8,
+	0x30EB, 0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x30AF, 0x3099,
+	0x30E9, 0x30E0, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30C8, 0x30F3,
+	0x30AF, 0x30EB, 0x30BB, 0x3099, 0x30A4, 0x30ED, 0x30AF, 0x30ED,
+	0x30FC, 0x30CD, 0x30B1, 0x30FC, 0x30B9, 0x30B3, 0x30EB, 0x30CA,
+	0x30B3, 0x30FC, 0x30DB, 0x309A, 0x30B5, 0x30A4, 0x30AF, 0x30EB,
+	0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x30B7, 0x30EA, 0x30F3,
+	0x30AF, 0x3099, 0x30BB, 0x30F3, 0x30C1, 0x30BB, 0x30F3, 0x30C8,
+	0x30BF, 0x3099, 0x30FC, 0x30B9, 0x30C6, 0x3099, 0x30B7, 0x30C8,
+	0x3099, 0x30EB, 0x30C8, 0x30F3, 0x30CA, 0x30CE, 0x30CE, 0x30C3,
+	0x30C8, 0x30CF, 0x30A4, 0x30C4, 0x30CF, 0x309A, 0x30FC, 0x30BB,
+	0x30F3, 0x30C8, 0x30CF, 0x309A, 0x30FC, 0x30C4, 0x30CF, 0x3099,
+	0x30FC, 0x30EC, 0x30EB, 0x30D2, 0x309A, 0x30A2, 0x30B9, 0x30C8,
+	0x30EB, 0x30D2, 0x309A, 0x30AF, 0x30EB, 0x30D2, 0x309A, 0x30B3,
+	0x30D2, 0x3099, 0x30EB, 0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C8,
+	0x3099, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x30D5, 0x3099, 0x30C3,
+	0x30B7, 0x30A7, 0x30EB, 0x30D5, 0x30E9, 0x30F3, 0x30D8, 0x30AF,
+	0x30BF, 0x30FC, 0x30EB, 0x30D8, 0x309A, 0x30BD, 0x30D8, 0x309A,
+	0x30CB, 0x30D2, 0x30D8, 0x30EB, 0x30C4, 0x30D8, 0x309A, 0x30F3,
+	0x30B9, 0x30D8, 0x309A, 0x30FC, 0x30B7, 0x3099, 0x30D8, 0x3099,
+	0x30FC, 0x30BF, 0x30DB, 0x309A, 0x30A4, 0x30F3, 0x30C8, 0x30DB,
+	0x3099, 0x30EB, 0x30C8, 0x30DB, 0x30F3, 0x30DB, 0x309A, 0x30F3,
+	0x30C8, 0x3099, 0x30DB, 0x30FC, 0x30EB, 0x30DB, 0x30FC, 0x30F3,
+	0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x30DE, 0x30A4, 0x30EB, 0x30DE,
+	0x30C3, 0x30CF, 0x30DE, 0x30EB, 0x30AF, 0x30DE, 0x30F3, 0x30B7,
+	0x30E7, 0x30F3, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x30DF, 0x30EA,
+	0x30DF, 0x30EA, 0x30CF, 0x3099, 0x30FC, 0x30EB, 0x30E1, 0x30AB,
+	0x3099, 0x30E1, 0x30AB, 0x3099, 0x30C8, 0x30F3, 0x30E1, 0x30FC,
+	0x30C8, 0x30EB, 0x30E4, 0x30FC, 0x30C8, 0x3099, 0x30E4, 0x30FC,
+	0x30EB, 0x30E6, 0x30A2, 0x30F3, 0x30EA, 0x30C3, 0x30C8, 0x30EB,
+	0x30EA, 0x30E9, 0x30EB, 0x30D2, 0x309A, 0x30FC, 0x30EB, 0x30FC,
+	0x30D5, 0x3099, 0x30EB, 0x30EC, 0x30E0, 0x30EC, 0x30F3, 0x30C8,
+	0x30B1, 0x3099, 0x30F3, 0x30EF, 0x30C3, 0x30C8, 0x0030, 0x70B9,
+	0x0031, 0x70B9, 0x0032, 0x70B9, 0x0033, 0x70B9, 0x0034, 0x70B9,
+	0x0035, 0x70B9, 0x0036, 0x70B9, 0x0037, 0x70B9, 0x0038, 0x70B9,
+	0x0039, 0x70B9, 0x0031, 0x0030, 0x70B9, 0x0031, 0x0031, 0x70B9,
+	0x0031, 0x0032, 0x70B9, 0x0031, 0x0033, 0x70B9, 0x0031, 0x0034,
+	0x70B9, 0x0031, 0x0035, 0x70B9, 0x0031, 0x0036, 0x70B9, 0x0031,
+	0x0037, 0x70B9, 0x0031, 0x0038, 0x70B9, 0x0031, 0x0039, 0x70B9,
+	0x0032, 0x0030, 0x70B9, 0x0032, 0x0031, 0x70B9, 0x0032, 0x0032,
+	0x70B9, 0x0032, 0x0033, 0x70B9, 0x0032, 0x0034, 0x70B9, 0x0068,
+	0x0050, 0x0061, 0x0064, 0x0061, 0x0041, 0x0055, 0x0062, 0x0061,
+	0x0072, 0x006F, 0x0056, 0x0070, 0x0063, 0x0064, 0x006D, 0x0064,
+	0x006D, 0x0032, 0x0064, 0x006D, 0x0033, 0x0049, 0x0055, 0x5E73,
+	0x6210, 0x662D, 0x548C, 0x5927, 0x6B63, 0x660E, 0x6CBB, 0x682A,
+	0x5F0F, 0x4F1A, 0x793E, 0x0070, 0x0041, 0x006E, 0x0041, 0x03BC,
+	0x0041, 0x006D, 0x0041, 0x006B, 0x0041, 0x004B, 0x0042, 0x004D,
+	0x0042, 0x0047, 0x0042, 0x0063, 0x0061, 0x006C, 0x006B, 0x0063,
+	0x0061, 0x006C, 0x0070, 0x0046, 0x006E, 0x0046, 0x03BC, 0x0046,
+	0x03BC, 0x0067, 0x006D, 0x0067, 0x006B, 0x0067, 0x0048, 0x007A,
+	0x006B, 0x0048, 0x007A, 0x004D, 0x0048, 0x007A, 0x0047, 0x0048,
+	0x007A, 0x0054, 0x0048, 0x007A, 0x03BC, 0x006C, 0x006D, 0x006C,
+	0x0064, 0x006C, 0x006B, 0x006C, 0x0066, 0x006D, 0x006E, 0x006D,
+	0x03BC, 0x006D, 0x006D, 0x006D, 0x0063, 0x006D, 0x006B, 0x006D,
+	0x006D, 0x006D, 0x0032, 0x0063, 0x006D, 0x0032, 0x006D, 0x0032,
+	0x006B, 0x006D, 0x0032, 0x006D, 0x006D, 0x0033, 0x0063, 0x006D,
+	0x0033, 0x006D, 0x0033, 0x006B, 0x006D, 0x0033, 0x006D, 0x2215,
+	0x0073, 0x006D, 0x2215, 0x0073, 0x0032, 0x0050, 0x0061, 0x006B,
+	0x0050, 0x0061, 0x004D, 0x0050, 0x0061, 0x0047, 0x0050, 0x0061,
+	0x0072, 0x0061, 0x0064, 0x0072, 0x0061, 0x0064, 0x2215, 0x0073,
+	0x0072, 0x0061, 0x0064, 0x2215, 0x0073, 0x0032, 0x0070, 0x0073,
+	0x006E, 0x0073, 0x03BC, 0x0073, 0x006D, 0x0073, 0x0070, 0x0056,
+	0x006E, 0x0056, 0x03BC, 0x0056, 0x006D, 0x0056, 0x006B, 0x0056,
+	0x004D, 0x0056, 0x0070, 0x0057, 0x006E, 0x0057, 0x03BC, 0x0057,
+	0x006D, 0x0057, 0x006B, 0x0057, 0x004D, 0x0057, 0x006B, 0x03A9,
+	0x004D, 0x03A9, 0x0061, 0x002E, 0x006D, 0x002E, 0x0042, 0x0071,
+	0x0063, 0x0063, 0x0063, 0x0064, 0x0043, 0x2215, 0x006B, 0x0067,
+	0x0043, 0x006F, 0x002E, 0x0064, 0x0042, 0x0047, 0x0079, 0x0068,
+	0x0061, 0x0048, 0x0050, 0x0069, 0x006E, 0x004B, 0x004B, 0x004B,
+	0x004D, 0x006B, 0x0074, 0x006C, 0x006D, 0x006C, 0x006E, 0x006C,
+	0x006F, 0x0067, 0x006C, 0x0078, 0x006D, 0x0062, 0x006D, 0x0069,
+	0x006C, 0x006D, 0x006F, 0x006C, 0x0050, 0x0048, 0x0070, 0x002E,
+	0x006D, 0x002E, 0x0050, 0x0050, 0x004D, 0x0050, 0x0052, 0x0073,
+	0x0072, 0x0053, 0x0076, 0x0057, 0x0062, 0x0056, 0x2215, 0x006D,
+	0x0041, 0x2215, 0x006D, 0x0031, 0x65E5, 0x0032, 0x65E5, 0x0033,
+	0x65E5, 0x0034, 0x65E5, 0x0035, 0x65E5, 0x0036, 0x65E5, 0x0037,
+	0x65E5, 0x0038, 0x65E5, 0x0039, 0x65E5, 0x0031, 0x0030, 0x65E5,
+	0x0031, 0x0031, 0x65E5, 0x0031, 0x0032, 0x65E5, 0x0031, 0x0033,
+	0x65E5, 0x0031, 0x0034, 0x65E5, 0x0031, 0x0035, 0x65E5, 0x0031,
+	0x0036, 0x65E5, 0x0031, 0x0037, 0x65E5, 0x0031, 0x0038, 0x65E5,
+	0x0031, 0x0039, 0x65E5, 0x0032, 0x0030, 0x65E5, 0x0032, 0x0031,
+	0x65E5, 0x0032, 0x0032, 0x65E5, 0x0032, 0x0033, 0x65E5, 0x0032,
+	0x0034, 0x65E5, 0x0032, 0x0035, 0x65E5, 0x0032, 0x0036, 0x65E5,
+	0x0032, 0x0037, 0x65E5, 0x0032, 0x0038, 0x65E5, 0x0032, 0x0039,
+	0x65E5, 0x0033, 0x0030, 0x65E5, 0x0033, 0x0031, 0x65E5, 0x0067,
+	0x0061, 0x006C, 0xA76F, 0x0126, 0x0153, 0x0066, 0x0066, 0x0066,
+	0x0069, 0x0066, 0x006C, 0x0066, 0x0066, 0x0069, 0x0066, 0x0066,
+	0x006C, 0x0073, 0x0074, 0x0073, 0x0074, 0x0574, 0x0576, 0x0574,
+	0x0565, 0x0574, 0x056B, 0x057E, 0x0576, 0x0574, 0x056D, 0x05E2,
+	0x05D0, 0x05D3, 0x05D4, 0x05DB, 0x05DC, 0x05DD, 0x05E8, 0x05EA,
+	0x002B, 0x05D0, 0x05DC, 0x0671, 0x0671, 0x067B, 0x067B, 0x067B,
+	0x067B, 0x067E, 0x067E, 0x067E, 0x067E, 0x0680, 0x0680, 0x0680,
+	0x0680, 0x067A, 0x067A, 0x067A, 0x067A, 0x067F, 0x067F, 0x067F,
+	0x067F, 0x0679, 0x0679, 0x0679, 0x0679, 0x06A4, 0x06A4, 0x06A4,
+	0x06A4, 0x06A6, 0x06A6, 0x06A6, 0x06A6, 0x0684, 0x0684, 0x0684,
+	0x0684, 0x0683, 0x0683, 0x0683, 0x0683, 0x0686, 0x0686, 0x0686,
+	0x0686, 0x0687, 0x0687, 0x0687, 0x0687, 0x068D, 0x068D, 0x068C,
+	0x068C, 0x068E, 0x068E, 0x0688, 0x0688, 0x0698, 0x0698, 0x0691,
+	0x0691, 0x06A9, 0x06A9, 0x06A9, 0x06A9, 0x06AF, 0x06AF, 0x06AF,
+	0x06AF, 0x06B3, 0x06B3, 0x06B3, 0x06B3, 0x06B1, 0x06B1, 0x06B1,
+	0x06B1, 0x06BA, 0x06BA, 0x06BB, 0x06BB, 0x06BB, 0x06BB, 0x06D5,
+	0x0654, 0x06D5, 0x0654, 0x06C1, 0x06C1, 0x06C1, 0x06C1, 0x06BE,
+	0x06BE, 0x06BE, 0x06BE, 0x06D2, 0x06D2, 0x06D2, 0x0654, 0x06D2,
+	0x0654, 0x06AD, 0x06AD, 0x06AD, 0x06AD, 0x06C7, 0x06C7, 0x06C6,
+	0x06C6, 0x06C8, 0x06C8, 0x06C7, 0x0674, 0x06CB, 0x06CB, 0x06C5,
+	0x06C5, 0x06C9, 0x06C9, 0x06D0, 0x06D0, 0x06D0, 0x06D0, 0x0649,
+	0x0649, 0x064A, 0x0654, 0x0627, 0x064A, 0x0654, 0x0627, 0x064A,
+	0x0654, 0x06D5, 0x064A, 0x0654, 0x06D5, 0x064A, 0x0654, 0x0648,
+	0x064A, 0x0654, 0x0648, 0x064A, 0x0654, 0x06C7, 0x064A, 0x0654,
+	0x06C7, 0x064A, 0x0654, 0x06C6, 0x064A, 0x0654, 0x06C6, 0x064A,
+	0x0654, 0x06C8, 0x064A, 0x0654, 0x06C8, 0x064A, 0x0654, 0x06D0,
+	0x064A, 0x0654, 0x06D0, 0x064A, 0x0654, 0x06D0, 0x064A, 0x0654,
+	0x0649, 0x064A, 0x0654, 0x0649, 0x064A, 0x0654, 0x0649, 0x06CC,
+	0x06CC, 0x06CC, 0x06CC, 0x064A, 0x0654, 0x062C, 0x064A, 0x0654,
+	0x062D, 0x064A, 0x0654, 0x0645, 0x064A, 0x0654, 0x0649, 0x064A,
+	0x0654, 0x064A, 0x0628, 0x062C, 0x0628, 0x062D, 0x0628, 0x062E,
+	0x0628, 0x0645, 0x0628, 0x0649, 0x0628, 0x064A, 0x062A, 0x062C,
+	0x062A, 0x062D, 0x062A, 0x062E, 0x062A, 0x0645, 0x062A, 0x0649,
+	0x062A, 0x064A, 0x062B, 0x062C, 0x062B, 0x0645, 0x062B, 0x0649,
+	0x062B, 0x064A, 0x062C, 0x062D, 0x062C, 0x0645, 0x062D, 0x062C,
+	0x062D, 0x0645, 0x062E, 0x062C, 0x062E, 0x062D, 0x062E, 0x0645,
+	0x0633, 0x062C, 0x0633, 0x062D, 0x0633, 0x062E, 0x0633, 0x0645,
+	0x0635, 0x062D, 0x0635, 0x0645, 0x0636, 0x062C, 0x0636, 0x062D,
+	0x0636, 0x062E, 0x0636, 0x0645, 0x0637, 0x062D, 0x0637, 0x0645,
+	0x0638, 0x0645, 0x0639, 0x062C, 0x0639, 0x0645, 0x063A, 0x062C,
+	0x063A, 0x0645, 0x0641, 0x062C, 0x0641, 0x062D, 0x0641, 0x062E,
+	0x0641, 0x0645, 0x0641, 0x0649, 0x0641, 0x064A, 0x0642, 0x062D,
+	0x0642, 0x0645, 0x0642, 0x0649, 0x0642, 0x064A, 0x0643, 0x0627,
+	0x0643, 0x062C, 0x0643, 0x062D, 0x0643, 0x062E, 0x0643, 0x0644,
+	0x0643, 0x0645, 0x0643, 0x0649, 0x0643, 0x064A, 0x0644, 0x062C,
+	0x0644, 0x062D, 0x0644, 0x062E, 0x0644, 0x0645, 0x0644, 0x0649,
+	0x0644, 0x064A, 0x0645, 0x062C, 0x0645, 0x062D, 0x0645, 0x062E,
+	0x0645, 0x0645, 0x0645, 0x0649, 0x0645, 0x064A, 0x0646, 0x062C,
+	0x0646, 0x062D, 0x0646, 0x062E, 0x0646, 0x0645, 0x0646, 0x0649,
+	0x0646, 0x064A, 0x0647, 0x062C, 0x0647, 0x0645, 0x0647, 0x0649,
+	0x0647, 0x064A, 0x064A, 0x062C, 0x064A, 0x062D, 0x064A, 0x062E,
+	0x064A, 0x0645, 0x064A, 0x0649, 0x064A, 0x064A, 0x0630, 0x0670,
+	0x0631, 0x0670, 0x0649, 0x0670, 0x0020, 0x064C, 0x0651, 0x0020,
+	0x064D, 0x0651, 0x0020, 0x064E, 0x0651, 0x0020, 0x064F, 0x0651,
+	0x0020, 0x0650, 0x0651, 0x0020, 0x0651, 0x0670, 0x064A, 0x0654,
+	0x0631, 0x064A, 0x0654, 0x0632, 0x064A, 0x0654, 0x0645, 0x064A,
+	0x0654, 0x0646, 0x064A, 0x0654, 0x0649, 0x064A, 0x0654, 0x064A,
+	0x0628, 0x0631, 0x0628, 0x0632, 0x0628, 0x0645, 0x0628, 0x0646,
+	0x0628, 0x0649, 0x0628, 0x064A, 0x062A, 0x0631, 0x062A, 0x0632,
+	0x062A, 0x0645, 0x062A, 0x0646, 0x062A, 0x0649, 0x062A, 0x064A,
+	0x062B, 0x0631, 0x062B, 0x0632, 0x062B, 0x0645, 0x062B, 0x0646,
+	0x062B, 0x0649, 0x062B, 0x064A, 0x0641, 0x0649, 0x0641, 0x064A,
+	0x0642, 0x0649, 0x0642, 0x064A, 0x0643, 0x0627, 0x0643, 0x0644,
+	0x0643, 0x0645, 0x0643, 0x0649, 0x0643, 0x064A, 0x0644, 0x0645,
+	0x0644, 0x0649, 0x0644, 0x064A, 0x0645, 0x0627, 0x0645, 0x0645,
+	0x0646, 0x0631, 0x0646, 0x0632, 0x0646, 0x0645, 0x0646, 0x0646,
+	0x0646, 0x0649, 0x0646, 0x064A, 0x0649, 0x0670, 0x064A, 0x0631,
+	0x064A, 0x0632, 0x064A, 0x0645, 0x064A, 0x0646, 0x064A, 0x0649,
+	0x064A, 0x064A, 0x064A, 0x0654, 0x062C, 0x064A, 0x0654, 0x062D,
+	0x064A, 0x0654, 0x062E, 0x064A, 0x0654, 0x0645, 0x064A, 0x0654,
+	0x0647, 0x0628, 0x062C, 0x0628, 0x062D, 0x0628, 0x062E, 0x0628,
+	0x0645, 0x0628, 0x0647, 0x062A, 0x062C, 0x062A, 0x062D, 0x062A,
+	0x062E, 0x062A, 0x0645, 0x062A, 0x0647, 0x062B, 0x0645, 0x062C,
+	0x062D, 0x062C, 0x0645, 0x062D, 0x062C, 0x062D, 0x0645, 0x062E,
+	0x062C, 0x062E, 0x0645, 0x0633, 0x062C, 0x0633, 0x062D, 0x0633,
+	0x062E, 0x0633, 0x0645, 0x0635, 0x062D, 0x0635, 0x062E, 0x0635,
+	0x0645, 0x0636, 0x062C, 0x0636, 0x062D, 0x0636, 0x062E, 0x0636,
+	0x0645, 0x0637, 0x062D, 0x0638, 0x0645, 0x0639, 0x062C, 0x0639,
+	0x0645, 0x063A, 0x062C, 0x063A, 0x0645, 0x0641, 0x062C, 0x0641,
+	0x062D, 0x0641, 0x062E, 0x0641, 0x0645, 0x0642, 0x062D, 0x0642,
+	0x0645, 0x0643, 0x062C, 0x0643, 0x062D, 0x0643, 0x062E, 0x0643,
+	0x0644, 0x0643, 0x0645, 0x0644, 0x062C, 0x0644, 0x062D, 0x0644,
+	0x062E, 0x0644, 0x0645, 0x0644, 0x0647, 0x0645, 0x062C, 0x0645,
+	0x062D, 0x0645, 0x062E, 0x0645, 0x0645, 0x0646, 0x062C, 0x0646,
+	0x062D, 0x0646, 0x062E, 0x0646, 0x0645, 0x0646, 0x0647, 0x0647,
+	0x062C, 0x0647, 0x0645, 0x0647, 0x0670, 0x064A, 0x062C, 0x064A,
+	0x062D, 0x064A, 0x062E, 0x064A, 0x0645, 0x064A, 0x0647, 0x064A,
+	0x0654, 0x0645, 0x064A, 0x0654, 0x0647, 0x0628, 0x0645, 0x0628,
+	0x0647, 0x062A, 0x0645, 0x062A, 0x0647, 0x062B, 0x0645, 0x062B,
+	0x0647, 0x0633, 0x0645, 0x0633, 0x0647, 0x0634, 0x0645, 0x0634,
+	0x0647, 0x0643, 0x0644, 0x0643, 0x0645, 0x0644, 0x0645, 0x0646,
+	0x0645, 0x0646, 0x0647, 0x064A, 0x0645, 0x064A, 0x0647, 0x0640,
+	0x064E, 0x0651, 0x0640, 0x064F, 0x0651, 0x0640, 0x0650, 0x0651,
+	0x0637, 0x0649, 0x0637, 0x064A, 0x0639, 0x0649, 0x0639, 0x064A,
+	0x063A, 0x0649, 0x063A, 0x064A, 0x0633, 0x0649, 0x0633, 0x064A,
+	0x0634, 0x0649, 0x0634, 0x064A, 0x062D, 0x0649, 0x062D, 0x064A,
+	0x062C, 0x0649, 0x062C, 0x064A, 0x062E, 0x0649, 0x062E, 0x064A,
+	0x0635, 0x0649, 0x0635, 0x064A, 0x0636, 0x0649, 0x0636, 0x064A,
+	0x0634, 0x062C, 0x0634, 0x062D, 0x0634, 0x062E, 0x0634, 0x0645,
+	0x0634, 0x0631, 0x0633, 0x0631, 0x0635, 0x0631, 0x0636, 0x0631,
+	0x0637, 0x0649, 0x0637, 0x064A, 0x0639, 0x0649, 0x0639, 0x064A,
+	0x063A, 0x0649, 0x063A, 0x064A, 0x0633, 0x0649, 0x0633, 0x064A,
+	0x0634, 0x0649, 0x0634, 0x064A, 0x062D, 0x0649, 0x062D, 0x064A,
+	0x062C, 0x0649, 0x062C, 0x064A, 0x062E, 0x0649, 0x062E, 0x064A,
+	0x0635, 0x0649, 0x0635, 0x064A, 0x0636, 0x0649, 0x0636, 0x064A,
+	0x0634, 0x062C, 0x0634, 0x062D, 0x0634, 0x062E, 0x0634, 0x0645,
+	0x0634, 0x0631, 0x0633, 0x0631, 0x0635, 0x0631, 0x0636, 0x0631,
+	0x0634, 0x062C, 0x0634, 0x062D, 0x0634, 0x062E, 0x0634, 0x0645,
+	0x0633, 0x0647, 0x0634, 0x0647, 0x0637, 0x0645, 0x0633, 0x062C,
+	0x0633, 0x062D, 0x0633, 0x062E, 0x0634, 0x062C, 0x0634, 0x062D,
+	0x0634, 0x062E, 0x0637, 0x0645, 0x0638, 0x0645, 0x0627, 0x064B,
+	0x0627, 0x064B, 0x062A, 0x062C, 0x0645, 0x062A, 0x062D, 0x062C,
+	0x062A, 0x062D, 0x062C, 0x062A, 0x062D, 0x0645, 0x062A, 0x062E,
+	0x0645, 0x062A, 0x0645, 0x062C, 0x062A, 0x0645, 0x062D, 0x062A,
+	0x0645, 0x062E, 0x062C, 0x0645, 0x062D, 0x062C, 0x0645, 0x062D,
+	0x062D, 0x0645, 0x064A, 0x062D, 0x0645, 0x0649, 0x0633, 0x062D,
+	0x062C, 0x0633, 0x062C, 0x062D, 0x0633, 0x062C, 0x0649, 0x0633,
+	0x0645, 0x062D, 0x0633, 0x0645, 0x062D, 0x0633, 0x0645, 0x062C,
+	0x0633, 0x0645, 0x0645, 0x0633, 0x0645, 0x0645, 0x0635, 0x062D,
+	0x062D, 0x0635, 0x062D, 0x062D, 0x0635, 0x0645, 0x0645, 0x0634,
+	0x062D, 0x0645, 0x0634, 0x062D, 0x0645, 0x0634, 0x062C, 0x064A,
+	0x0634, 0x0645, 0x062E, 0x0634, 0x0645, 0x062E, 0x0634, 0x0645,
+	0x0645, 0x0634, 0x0645, 0x0645, 0x0636, 0x062D, 0x0649, 0x0636,
+	0x062E, 0x0645, 0x0636, 0x062E, 0x0645, 0x0637, 0x0645, 0x062D,
+	0x0637, 0x0645, 0x062D, 0x0637, 0x0645, 0x0645, 0x0637, 0x0645,
+	0x064A, 0x0639, 0x062C, 0x0645, 0x0639, 0x0645, 0x0645, 0x0639,
+	0x0645, 0x0645, 0x0639, 0x0645, 0x0649, 0x063A, 0x0645, 0x0645,
+	0x063A, 0x0645, 0x064A, 0x063A, 0x0645, 0x0649, 0x0641, 0x062E,
+	0x0645, 0x0641, 0x062E, 0x0645, 0x0642, 0x0645, 0x062D, 0x0642,
+	0x0645, 0x0645, 0x0644, 0x062D, 0x0645, 0x0644, 0x062D, 0x064A,
+	0x0644, 0x062D, 0x0649, 0x0644, 0x062C, 0x062C, 0x0644, 0x062C,
+	0x062C, 0x0644, 0x062E, 0x0645, 0x0644, 0x062E, 0x0645, 0x0644,
+	0x0645, 0x062D, 0x0644, 0x0645, 0x062D, 0x0645, 0x062D, 0x062C,
+	0x0645, 0x062D, 0x0645, 0x0645, 0x062D, 0x064A, 0x0645, 0x062C,
+	0x062D, 0x0645, 0x062C, 0x0645, 0x0645, 0x062E, 0x062C, 0x0645,
+	0x062E, 0x0645, 0x0645, 0x062C, 0x062E, 0x0647, 0x0645, 0x062C,
+	0x0647, 0x0645, 0x0645, 0x0646, 0x062D, 0x0645, 0x0646, 0x062D,
+	0x0649, 0x0646, 0x062C, 0x0645, 0x0646, 0x062C, 0x0645, 0x0646,
+	0x062C, 0x0649, 0x0646, 0x0645, 0x064A, 0x0646, 0x0645, 0x0649,
+	0x064A, 0x0645, 0x0645, 0x064A, 0x0645, 0x0645, 0x0628, 0x062E,
+	0x064A, 0x062A, 0x062C, 0x064A, 0x062A, 0x062C, 0x0649, 0x062A,
+	0x062E, 0x064A, 0x062A, 0x062E, 0x0649, 0x062A, 0x0645, 0x064A,
+	0x062A, 0x0645, 0x0649, 0x062C, 0x0645, 0x064A, 0x062C, 0x062D,
+	0x0649, 0x062C, 0x0645, 0x0649, 0x0633, 0x062E, 0x0649, 0x0635,
+	0x062D, 0x064A, 0x0634, 0x062D, 0x064A, 0x0636, 0x062D, 0x064A,
+	0x0644, 0x062C, 0x064A, 0x0644, 0x0645, 0x064A, 0x064A, 0x062D,
+	0x064A, 0x064A, 0x062C, 0x064A, 0x064A, 0x0645, 0x064A, 0x0645,
+	0x0645, 0x064A, 0x0642, 0x0645, 0x064A, 0x0646, 0x062D, 0x064A,
+	0x0642, 0x0645, 0x062D, 0x0644, 0x062D, 0x0645, 0x0639, 0x0645,
+	0x064A, 0x0643, 0x0645, 0x064A, 0x0646, 0x062C, 0x062D, 0x0645,
+	0x062E, 0x064A, 0x0644, 0x062C, 0x0645, 0x0643, 0x0645, 0x0645,
+	0x0644, 0x062C, 0x0645, 0x0646, 0x062C, 0x062D, 0x062C, 0x062D,
+	0x064A, 0x062D, 0x062C, 0x064A, 0x0645, 0x062C, 0x064A, 0x0641,
+	0x0645, 0x064A, 0x0628, 0x062D, 0x064A, 0x0643, 0x0645, 0x0645,
+	0x0639, 0x062C, 0x0645, 0x0635, 0x0645, 0x0645, 0x0633, 0x062E,
+	0x064A, 0x0646, 0x062C, 0x064A, 0x0635, 0x0644, 0x06D2, 0x0642,
+	0x0644, 0x06D2, 0x0627, 0x0644, 0x0644, 0x0647, 0x0627, 0x0643,
+	0x0628, 0x0631, 0x0645, 0x062D, 0x0645, 0x062F, 0x0635, 0x0644,
+	0x0639, 0x0645, 0x0631, 0x0633, 0x0648, 0x0644, 0x0639, 0x0644,
+	0x064A, 0x0647, 0x0648, 0x0633, 0x0644, 0x0645, 0x0635, 0x0644,
+	0x0649, 0x0635, 0x0644, 0x0649, 0x0020, 0x0627, 0x0644, 0x0644,
+	0x0647, 0x0020, 0x0639, 0x0644, 0x064A, 0x0647, 0x0020, 0x0648,
+	0x0633, 0x0644, 0x0645, 0x062C, 0x0644, 0x0020, 0x062C, 0x0644,
+	0x0627, 0x0644, 0x0647, 0x0631, 0x06CC, 0x0627, 0x0644, 0x002C,
+	0x3001, 0x3002, 0x003A, 0x003B, 0x0021, 0x003F, 0x3016, 0x3017,
+	0x002E, 0x002E, 0x002E, 0x002E, 0x002E, 0x2014, 0x2013, 0x005F,
+	0x005F, 0x0028, 0x0029, 0x007B, 0x007D, 0x3014, 0x3015, 0x3010,
+	0x3011, 0x300A, 0x300B, 0x3008, 0x3009, 0x300C, 0x300D, 0x300E,
+	0x300F, 0x005B, 0x005D, 0x0020, 0x0305, 0x0020, 0x0305, 0x0020,
+	0x0305, 0x0020, 0x0305, 0x005F, 0x005F, 0x005F, 0x002C, 0x3001,
+	0x002E, 0x003B, 0x003A, 0x003F, 0x0021, 0x2014, 0x0028, 0x0029,
+	0x007B, 0x007D, 0x3014, 0x3015, 0x0023, 0x0026, 0x002A, 0x002B,
+	0x002D, 0x003C, 0x003E, 0x003D, 0x005C, 0x0024, 0x0025, 0x0040,
+	0x0020, 0x064B, 0x0640, 0x064B, 0x0020, 0x064C, 0x0020, 0x064D,
+	0x0020, 0x064E, 0x0640, 0x064E, 0x0020, 0x064F, 0x0640, 0x064F,
+	0x0020, 0x0650, 0x0640, 0x0650, 0x0020, 0x0651, 0x0640, 0x0651,
+	0x0020, 0x0652, 0x0640, 0x0652, 0x0621, 0x0627, 0x0653, 0x0627,
+	0x0653, 0x0627, 0x0654, 0x0627, 0x0654, 0x0648, 0x0654, 0x0648,
+	0x0654, 0x0627, 0x0655, 0x0627, 0x0655, 0x064A, 0x0654, 0x064A,
+	0x0654, 0x064A, 0x0654, 0x064A, 0x0654, 0x0627, 0x0627, 0x0628,
+	0x0628, 0x0628, 0x0628, 0x0629, 0x0629, 0x062A, 0x062A, 0x062A,
+	0x062A, 0x062B, 0x062B, 0x062B, 0x062B, 0x062C, 0x062C, 0x062C,
+	0x062C, 0x062D, 0x062D, 0x062D, 0x062D, 0x062E, 0x062E, 0x062E,
+	0x062E, 0x062F, 0x062F, 0x0630, 0x0630, 0x0631, 0x0631, 0x0632,
+	0x0632, 0x0633, 0x0633, 0x0633, 0x0633, 0x0634, 0x0634, 0x0634,
+	0x0634, 0x0635, 0x0635, 0x0635, 0x0635, 0x0636, 0x0636, 0x0636,
+	0x0636, 0x0637, 0x0637, 0x0637, 0x0637, 0x0638, 0x0638, 0x0638,
+	0x0638, 0x0639, 0x0639, 0x0639, 0x0639, 0x063A, 0x063A, 0x063A,
+	0x063A, 0x0641, 0x0641, 0x0641, 0x0641, 0x0642, 0x0642, 0x0642,
+	0x0642, 0x0643, 0x0643, 0x0643, 0x0643, 0x0644, 0x0644, 0x0644,
+	0x0644, 0x0645, 0x0645, 0x0645, 0x0645, 0x0646, 0x0646, 0x0646,
+	0x0646, 0x0647, 0x0647, 0x0647, 0x0647, 0x0648, 0x0648, 0x0649,
+	0x0649, 0x064A, 0x064A, 0x064A, 0x064A, 0x0644, 0x0627, 0x0653,
+	0x0644, 0x0627, 0x0653, 0x0644, 0x0627, 0x0654, 0x0644, 0x0627,
+	0x0654, 0x0644, 0x0627, 0x0655, 0x0644, 0x0627, 0x0655, 0x0644,
+	0x0627, 0x0644, 0x0627, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025,
+	0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D,
+	0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035,
+	0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D,
+	0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+	0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D,
+	0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+	0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D,
+	0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+	0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D,
+	0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+	0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D,
+	0x007E, 0x2985, 0x2986, 0x3002, 0x300C, 0x300D, 0x3001, 0x30FB,
+	0x30F2, 0x30A1, 0x30A3, 0x30A5, 0x30A7, 0x30A9, 0x30E3, 0x30E5,
+	0x30E7, 0x30C3, 0x30FC, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA,
+	0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9,
+	0x30BB, 0x30BD, 0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA,
+	0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8,
+	0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6,
+	0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F3,
+	0x3099, 0x309A, 0x1160, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC,
+	0x11AD, 0x1103, 0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3,
+	0x11B4, 0x11B5, 0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109,
+	0x110A, 0x110B, 0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111,
+	0x1112, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167,
+	0x1168, 0x1169, 0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F,
+	0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175, 0x00A2, 0x00A3,
+	0x00AC, 0x0020, 0x0304, 0x00A6, 0x00A5, 0x20A9, 0x2502, 0x2190,
+	0x2191, 0x2192, 0x2193, 0x25A0, 0x25CB, 0x0041, 0x0042, 0x0043,
+	0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B,
+	0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053,
+	0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061,
+	0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069,
+	0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071,
+	0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079,
+	0x007A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+	0x0066, 0x0067, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+	0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076,
+	0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043, 0x0044,
+	0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C,
+	0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+	0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061, 0x0062,
+	0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A,
+	0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072,
+	0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A,
+	0x0041, 0x0043, 0x0044, 0x0047, 0x004A, 0x004B, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058,
+	0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0066, 0x0068,
+	0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x0070, 0x0071,
+	0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079,
+	0x007A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+	0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D,
+	0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+	0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0044,
+	0x0045, 0x0046, 0x0047, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E,
+	0x004F, 0x0050, 0x0051, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066,
+	0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+	0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076,
+	0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0044, 0x0045,
+	0x0046, 0x0047, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004F,
+	0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x0061,
+	0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069,
+	0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071,
+	0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079,
+	0x007A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+	0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D,
+	0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+	0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043,
+	0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B,
+	0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053,
+	0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061,
+	0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069,
+	0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071,
+	0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079,
+	0x007A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+	0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D,
+	0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+	0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043,
+	0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B,
+	0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053,
+	0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061,
+	0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069,
+	0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071,
+	0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079,
+	0x007A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+	0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D,
+	0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+	0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043,
+	0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B,
+	0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053,
+	0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061,
+	0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069,
+	0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071,
+	0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079,
+	0x007A, 0x0131, 0x0237, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395,
+	0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D,
+	0x039E, 0x039F, 0x03A0, 0x03A1, 0x0398, 0x03A3, 0x03A4, 0x03A5,
+	0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x2207, 0x03B1, 0x03B2, 0x03B3,
+	0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB,
+	0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3,
+	0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x2202, 0x03B5,
+	0x03B8, 0x03BA, 0x03C6, 0x03C1, 0x03C0, 0x0391, 0x0392, 0x0393,
+	0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B,
+	0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x0398, 0x03A3,
+	0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x2207, 0x03B1,
+	0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9,
+	0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1,
+	0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9,
+	0x2202, 0x03B5, 0x03B8, 0x03BA, 0x03C6, 0x03C1, 0x03C0, 0x0391,
+	0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399,
+	0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1,
+	0x0398, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9,
+	0x2207, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7,
+	0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
+	0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7,
+	0x03C8, 0x03C9, 0x2202, 0x03B5, 0x03B8, 0x03BA, 0x03C6, 0x03C1,
+	0x03C0, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+	0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F,
+	0x03A0, 0x03A1, 0x0398, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7,
+	0x03A8, 0x03A9, 0x2207, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5,
+	0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD,
+	0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5,
+	0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x2202, 0x03B5, 0x03B8, 0x03BA,
+	0x03C6, 0x03C1, 0x03C0, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395,
+	0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D,
+	0x039E, 0x039F, 0x03A0, 0x03A1, 0x0398, 0x03A3, 0x03A4, 0x03A5,
+	0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x2207, 0x03B1, 0x03B2, 0x03B3,
+	0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB,
+	0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3,
+	0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x2202, 0x03B5,
+	0x03B8, 0x03BA, 0x03C6, 0x03C1, 0x03C0, 0x03DC, 0x03DD, 0x0030,
+	0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038,
+	0x0039, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036,
+	0x0037, 0x0038, 0x0039, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+	0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0030, 0x0031, 0x0032,
+	0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0030,
+	0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038,
+	0x0039, 0x0627, 0x0628, 0x062C, 0x062F, 0x0648, 0x0632, 0x062D,
+	0x0637, 0x064A, 0x0643, 0x0644, 0x0645, 0x0646, 0x0633, 0x0639,
+	0x0641, 0x0635, 0x0642, 0x0631, 0x0634, 0x062A, 0x062B, 0x062E,
+	0x0630, 0x0636, 0x0638, 0x063A, 0x066E, 0x06BA, 0x06A1, 0x066F,
+	0x0628, 0x062C, 0x0647, 0x062D, 0x064A, 0x0643, 0x0644, 0x0645,
+	0x0646, 0x0633, 0x0639, 0x0641, 0x0635, 0x0642, 0x0634, 0x062A,
+	0x062B, 0x062E, 0x0636, 0x063A, 0x062C, 0x062D, 0x064A, 0x0644,
+	0x0646, 0x0633, 0x0639, 0x0635, 0x0642, 0x0634, 0x062E, 0x0636,
+	0x063A, 0x06BA, 0x066F, 0x0628, 0x062C, 0x0647, 0x062D, 0x0637,
+	0x064A, 0x0643, 0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635,
+	0x0642, 0x0634, 0x062A, 0x062B, 0x062E, 0x0636, 0x0638, 0x063A,
+	0x066E, 0x06A1, 0x0627, 0x0628, 0x062C, 0x062F, 0x0647, 0x0648,
+	0x0632, 0x062D, 0x0637, 0x064A, 0x0644, 0x0645, 0x0646, 0x0633,
+	0x0639, 0x0641, 0x0635, 0x0642, 0x0631, 0x0634, 0x062A, 0x062B,
+	0x062E, 0x0630, 0x0636, 0x0638, 0x063A, 0x0628, 0x062C, 0x062F,
+	0x0648, 0x0632, 0x062D, 0x0637, 0x064A, 0x0644, 0x0645, 0x0646,
+	0x0633, 0x0639, 0x0641, 0x0635, 0x0642, 0x0631, 0x0634, 0x062A,
+	0x062B, 0x062E, 0x0630, 0x0636, 0x0638, 0x063A, 0x0030, 0x002E,
+	0x0030, 0x002C, 0x0031, 0x002C, 0x0032, 0x002C, 0x0033, 0x002C,
+	0x0034, 0x002C, 0x0035, 0x002C, 0x0036, 0x002C, 0x0037, 0x002C,
+	0x0038, 0x002C, 0x0039, 0x002C, 0x0028, 0x0041, 0x0029, 0x0028,
+	0x0042, 0x0029, 0x0028, 0x0043, 0x0029, 0x0028, 0x0044, 0x0029,
+	0x0028, 0x0045, 0x0029, 0x0028, 0x0046, 0x0029, 0x0028, 0x0047,
+	0x0029, 0x0028, 0x0048, 0x0029, 0x0028, 0x0049, 0x0029, 0x0028,
+	0x004A, 0x0029, 0x0028, 0x004B, 0x0029, 0x0028, 0x004C, 0x0029,
+	0x0028, 0x004D, 0x0029, 0x0028, 0x004E, 0x0029, 0x0028, 0x004F,
+	0x0029, 0x0028, 0x0050, 0x0029, 0x0028, 0x0051, 0x0029, 0x0028,
+	0x0052, 0x0029, 0x0028, 0x0053, 0x0029, 0x0028, 0x0054, 0x0029,
+	0x0028, 0x0055, 0x0029, 0x0028, 0x0056, 0x0029, 0x0028, 0x0057,
+	0x0029, 0x0028, 0x0058, 0x0029, 0x0028, 0x0059, 0x0029, 0x0028,
+	0x005A, 0x0029, 0x3014, 0x0053, 0x3015, 0x0043, 0x0052, 0x0043,
+	0x0044, 0x0057, 0x005A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+	0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D,
+	0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+	0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0048, 0x0056, 0x004D,
+	0x0056, 0x0053, 0x0044, 0x0053, 0x0053, 0x0050, 0x0050, 0x0056,
+	0x0057, 0x0043, 0x004D, 0x0043, 0x004D, 0x0044, 0x0044, 0x004A,
+	0x307B, 0x304B, 0x30B3, 0x30B3, 0x30B5, 0x624B, 0x5B57, 0x53CC,
+	0x30C6, 0x3099, 0x4E8C, 0x591A, 0x89E3, 0x5929, 0x4EA4, 0x6620,
+	0x7121, 0x6599, 0x524D, 0x5F8C, 0x518D, 0x65B0, 0x521D, 0x7D42,
+	0x751F, 0x8CA9, 0x58F0, 0x5439, 0x6F14, 0x6295, 0x6355, 0x4E00,
+	0x4E09, 0x904A, 0x5DE6, 0x4E2D, 0x53F3, 0x6307, 0x8D70, 0x6253,
+	0x7981, 0x7A7A, 0x5408, 0x6E80, 0x6709, 0x6708, 0x7533, 0x5272,
+	0x55B6, 0x3014, 0x672C, 0x3015, 0x3014, 0x4E09, 0x3015, 0x3014,
+	0x4E8C, 0x3015, 0x3014, 0x5B89, 0x3015, 0x3014, 0x70B9, 0x3015,
+	0x3014, 0x6253, 0x3015, 0x3014, 0x76D7, 0x3015, 0x3014, 0x52DD,
+	0x3015, 0x3014, 0x6557, 0x3015, 0x5F97, 0x53EF,
+};
+
+const composition _compositions[] = {
+	{0x003C, 0x0338, 0x226E},
+	{0x003D, 0x0338, 0x2260},
+	{0x003E, 0x0338, 0x226F},
+	{0x0041, 0x0300, 0x00C0},
+	{0x0041, 0x0301, 0x00C1},
+	{0x0041, 0x0302, 0x00C2},
+	{0x0041, 0x0303, 0x00C3},
+	{0x0041, 0x0304, 0x0100},
+	{0x0041, 0x0306, 0x0102},
+	{0x0041, 0x0307, 0x0226},
+	{0x0041, 0x0308, 0x00C4},
+	{0x0041, 0x0309, 0x1EA2},
+	{0x0041, 0x030A, 0x00C5},
+	{0x0041, 0x030C, 0x01CD},
+	{0x0041, 0x030F, 0x0200},
+	{0x0041, 0x0311, 0x0202},
+	{0x0041, 0x0323, 0x1EA0},
+	{0x0041, 0x0325, 0x1E00},
+	{0x0041, 0x0328, 0x0104},
+	{0x0042, 0x0307, 0x1E02},
+	{0x0042, 0x0323, 0x1E04},
+	{0x0042, 0x0331, 0x1E06},
+	{0x0043, 0x0301, 0x0106},
+	{0x0043, 0x0302, 0x0108},
+	{0x0043, 0x0307, 0x010A},
+	{0x0043, 0x030C, 0x010C},
+	{0x0043, 0x0327, 0x00C7},
+	{0x0044, 0x0307, 0x1E0A},
+	{0x0044, 0x030C, 0x010E},
+	{0x0044, 0x0323, 0x1E0C},
+	{0x0044, 0x0327, 0x1E10},
+	{0x0044, 0x032D, 0x1E12},
+	{0x0044, 0x0331, 0x1E0E},
+	{0x0045, 0x0300, 0x00C8},
+	{0x0045, 0x0301, 0x00C9},
+	{0x0045, 0x0302, 0x00CA},
+	{0x0045, 0x0303, 0x1EBC},
+	{0x0045, 0x0304, 0x0112},
+	{0x0045, 0x0306, 0x0114},
+	{0x0045, 0x0307, 0x0116},
+	{0x0045, 0x0308, 0x00CB},
+	{0x0045, 0x0309, 0x1EBA},
+	{0x0045, 0x030C, 0x011A},
+	{0x0045, 0x030F, 0x0204},
+	{0x0045, 0x0311, 0x0206},
+	{0x0045, 0x0323, 0x1EB8},
+	{0x0045, 0x0327, 0x0228},
+	{0x0045, 0x0328, 0x0118},
+	{0x0045, 0x032D, 0x1E18},
+	{0x0045, 0x0330, 0x1E1A},
+	{0x0046, 0x0307, 0x1E1E},
+	{0x0047, 0x0301, 0x01F4},
+	{0x0047, 0x0302, 0x011C},
+	{0x0047, 0x0304, 0x1E20},
+	{0x0047, 0x0306, 0x011E},
+	{0x0047, 0x0307, 0x0120},
+	{0x0047, 0x030C, 0x01E6},
+	{0x0047, 0x0327, 0x0122},
+	{0x0048, 0x0302, 0x0124},
+	{0x0048, 0x0307, 0x1E22},
+	{0x0048, 0x0308, 0x1E26},
+	{0x0048, 0x030C, 0x021E},
+	{0x0048, 0x0323, 0x1E24},
+	{0x0048, 0x0327, 0x1E28},
+	{0x0048, 0x032E, 0x1E2A},
+	{0x0049, 0x0300, 0x00CC},
+	{0x0049, 0x0301, 0x00CD},
+	{0x0049, 0x0302, 0x00CE},
+	{0x0049, 0x0303, 0x0128},
+	{0x0049, 0x0304, 0x012A},
+	{0x0049, 0x0306, 0x012C},
+	{0x0049, 0x0307, 0x0130},
+	{0x0049, 0x0308, 0x00CF},
+	{0x0049, 0x0309, 0x1EC8},
+	{0x0049, 0x030C, 0x01CF},
+	{0x0049, 0x030F, 0x0208},
+	{0x0049, 0x0311, 0x020A},
+	{0x0049, 0x0323, 0x1ECA},
+	{0x0049, 0x0328, 0x012E},
+	{0x0049, 0x0330, 0x1E2C},
+	{0x004A, 0x0302, 0x0134},
+	{0x004B, 0x0301, 0x1E30},
+	{0x004B, 0x030C, 0x01E8},
+	{0x004B, 0x0323, 0x1E32},
+	{0x004B, 0x0327, 0x0136},
+	{0x004B, 0x0331, 0x1E34},
+	{0x004C, 0x0301, 0x0139},
+	{0x004C, 0x030C, 0x013D},
+	{0x004C, 0x0323, 0x1E36},
+	{0x004C, 0x0327, 0x013B},
+	{0x004C, 0x032D, 0x1E3C},
+	{0x004C, 0x0331, 0x1E3A},
+	{0x004D, 0x0301, 0x1E3E},
+	{0x004D, 0x0307, 0x1E40},
+	{0x004D, 0x0323, 0x1E42},
+	{0x004E, 0x0300, 0x01F8},
+	{0x004E, 0x0301, 0x0143},
+	{0x004E, 0x0303, 0x00D1},
+	{0x004E, 0x0307, 0x1E44},
+	{0x004E, 0x030C, 0x0147},
+	{0x004E, 0x0323, 0x1E46},
+	{0x004E, 0x0327, 0x0145},
+	{0x004E, 0x032D, 0x1E4A},
+	{0x004E, 0x0331, 0x1E48},
+	{0x004F, 0x0300, 0x00D2},
+	{0x004F, 0x0301, 0x00D3},
+	{0x004F, 0x0302, 0x00D4},
+	{0x004F, 0x0303, 0x00D5},
+	{0x004F, 0x0304, 0x014C},
+	{0x004F, 0x0306, 0x014E},
+	{0x004F, 0x0307, 0x022E},
+	{0x004F, 0x0308, 0x00D6},
+	{0x004F, 0x0309, 0x1ECE},
+	{0x004F, 0x030B, 0x0150},
+	{0x004F, 0x030C, 0x01D1},
+	{0x004F, 0x030F, 0x020C},
+	{0x004F, 0x0311, 0x020E},
+	{0x004F, 0x031B, 0x01A0},
+	{0x004F, 0x0323, 0x1ECC},
+	{0x004F, 0x0328, 0x01EA},
+	{0x0050, 0x0301, 0x1E54},
+	{0x0050, 0x0307, 0x1E56},
+	{0x0052, 0x0301, 0x0154},
+	{0x0052, 0x0307, 0x1E58},
+	{0x0052, 0x030C, 0x0158},
+	{0x0052, 0x030F, 0x0210},
+	{0x0052, 0x0311, 0x0212},
+	{0x0052, 0x0323, 0x1E5A},
+	{0x0052, 0x0327, 0x0156},
+	{0x0052, 0x0331, 0x1E5E},
+	{0x0053, 0x0301, 0x015A},
+	{0x0053, 0x0302, 0x015C},
+	{0x0053, 0x0307, 0x1E60},
+	{0x0053, 0x030C, 0x0160},
+	{0x0053, 0x0323, 0x1E62},
+	{0x0053, 0x0326, 0x0218},
+	{0x0053, 0x0327, 0x015E},
+	{0x0054, 0x0307, 0x1E6A},
+	{0x0054, 0x030C, 0x0164},
+	{0x0054, 0x0323, 0x1E6C},
+	{0x0054, 0x0326, 0x021A},
+	{0x0054, 0x0327, 0x0162},
+	{0x0054, 0x032D, 0x1E70},
+	{0x0054, 0x0331, 0x1E6E},
+	{0x0055, 0x0300, 0x00D9},
+	{0x0055, 0x0301, 0x00DA},
+	{0x0055, 0x0302, 0x00DB},
+	{0x0055, 0x0303, 0x0168},
+	{0x0055, 0x0304, 0x016A},
+	{0x0055, 0x0306, 0x016C},
+	{0x0055, 0x0308, 0x00DC},
+	{0x0055, 0x0309, 0x1EE6},
+	{0x0055, 0x030A, 0x016E},
+	{0x0055, 0x030B, 0x0170},
+	{0x0055, 0x030C, 0x01D3},
+	{0x0055, 0x030F, 0x0214},
+	{0x0055, 0x0311, 0x0216},
+	{0x0055, 0x031B, 0x01AF},
+	{0x0055, 0x0323, 0x1EE4},
+	{0x0055, 0x0324, 0x1E72},
+	{0x0055, 0x0328, 0x0172},
+	{0x0055, 0x032D, 0x1E76},
+	{0x0055, 0x0330, 0x1E74},
+	{0x0056, 0x0303, 0x1E7C},
+	{0x0056, 0x0323, 0x1E7E},
+	{0x0057, 0x0300, 0x1E80},
+	{0x0057, 0x0301, 0x1E82},
+	{0x0057, 0x0302, 0x0174},
+	{0x0057, 0x0307, 0x1E86},
+	{0x0057, 0x0308, 0x1E84},
+	{0x0057, 0x0323, 0x1E88},
+	{0x0058, 0x0307, 0x1E8A},
+	{0x0058, 0x0308, 0x1E8C},
+	{0x0059, 0x0300, 0x1EF2},
+	{0x0059, 0x0301, 0x00DD},
+	{0x0059, 0x0302, 0x0176},
+	{0x0059, 0x0303, 0x1EF8},
+	{0x0059, 0x0304, 0x0232},
+	{0x0059, 0x0307, 0x1E8E},
+	{0x0059, 0x0308, 0x0178},
+	{0x0059, 0x0309, 0x1EF6},
+	{0x0059, 0x0323, 0x1EF4},
+	{0x005A, 0x0301, 0x0179},
+	{0x005A, 0x0302, 0x1E90},
+	{0x005A, 0x0307, 0x017B},
+	{0x005A, 0x030C, 0x017D},
+	{0x005A, 0x0323, 0x1E92},
+	{0x005A, 0x0331, 0x1E94},
+	{0x0061, 0x0300, 0x00E0},
+	{0x0061, 0x0301, 0x00E1},
+	{0x0061, 0x0302, 0x00E2},
+	{0x0061, 0x0303, 0x00E3},
+	{0x0061, 0x0304, 0x0101},
+	{0x0061, 0x0306, 0x0103},
+	{0x0061, 0x0307, 0x0227},
+	{0x0061, 0x0308, 0x00E4},
+	{0x0061, 0x0309, 0x1EA3},
+	{0x0061, 0x030A, 0x00E5},
+	{0x0061, 0x030C, 0x01CE},
+	{0x0061, 0x030F, 0x0201},
+	{0x0061, 0x0311, 0x0203},
+	{0x0061, 0x0323, 0x1EA1},
+	{0x0061, 0x0325, 0x1E01},
+	{0x0061, 0x0328, 0x0105},
+	{0x0062, 0x0307, 0x1E03},
+	{0x0062, 0x0323, 0x1E05},
+	{0x0062, 0x0331, 0x1E07},
+	{0x0063, 0x0301, 0x0107},
+	{0x0063, 0x0302, 0x0109},
+	{0x0063, 0x0307, 0x010B},
+	{0x0063, 0x030C, 0x010D},
+	{0x0063, 0x0327, 0x00E7},
+	{0x0064, 0x0307, 0x1E0B},
+	{0x0064, 0x030C, 0x010F},
+	{0x0064, 0x0323, 0x1E0D},
+	{0x0064, 0x0327, 0x1E11},
+	{0x0064, 0x032D, 0x1E13},
+	{0x0064, 0x0331, 0x1E0F},
+	{0x0065, 0x0300, 0x00E8},
+	{0x0065, 0x0301, 0x00E9},
+	{0x0065, 0x0302, 0x00EA},
+	{0x0065, 0x0303, 0x1EBD},
+	{0x0065, 0x0304, 0x0113},
+	{0x0065, 0x0306, 0x0115},
+	{0x0065, 0x0307, 0x0117},
+	{0x0065, 0x0308, 0x00EB},
+	{0x0065, 0x0309, 0x1EBB},
+	{0x0065, 0x030C, 0x011B},
+	{0x0065, 0x030F, 0x0205},
+	{0x0065, 0x0311, 0x0207},
+	{0x0065, 0x0323, 0x1EB9},
+	{0x0065, 0x0327, 0x0229},
+	{0x0065, 0x0328, 0x0119},
+	{0x0065, 0x032D, 0x1E19},
+	{0x0065, 0x0330, 0x1E1B},
+	{0x0066, 0x0307, 0x1E1F},
+	{0x0067, 0x0301, 0x01F5},
+	{0x0067, 0x0302, 0x011D},
+	{0x0067, 0x0304, 0x1E21},
+	{0x0067, 0x0306, 0x011F},
+	{0x0067, 0x0307, 0x0121},
+	{0x0067, 0x030C, 0x01E7},
+	{0x0067, 0x0327, 0x0123},
+	{0x0068, 0x0302, 0x0125},
+	{0x0068, 0x0307, 0x1E23},
+	{0x0068, 0x0308, 0x1E27},
+	{0x0068, 0x030C, 0x021F},
+	{0x0068, 0x0323, 0x1E25},
+	{0x0068, 0x0327, 0x1E29},
+	{0x0068, 0x032E, 0x1E2B},
+	{0x0068, 0x0331, 0x1E96},
+	{0x0069, 0x0300, 0x00EC},
+	{0x0069, 0x0301, 0x00ED},
+	{0x0069, 0x0302, 0x00EE},
+	{0x0069, 0x0303, 0x0129},
+	{0x0069, 0x0304, 0x012B},
+	{0x0069, 0x0306, 0x012D},
+	{0x0069, 0x0308, 0x00EF},
+	{0x0069, 0x0309, 0x1EC9},
+	{0x0069, 0x030C, 0x01D0},
+	{0x0069, 0x030F, 0x0209},
+	{0x0069, 0x0311, 0x020B},
+	{0x0069, 0x0323, 0x1ECB},
+	{0x0069, 0x0328, 0x012F},
+	{0x0069, 0x0330, 0x1E2D},
+	{0x006A, 0x0302, 0x0135},
+	{0x006A, 0x030C, 0x01F0},
+	{0x006B, 0x0301, 0x1E31},
+	{0x006B, 0x030C, 0x01E9},
+	{0x006B, 0x0323, 0x1E33},
+	{0x006B, 0x0327, 0x0137},
+	{0x006B, 0x0331, 0x1E35},
+	{0x006C, 0x0301, 0x013A},
+	{0x006C, 0x030C, 0x013E},
+	{0x006C, 0x0323, 0x1E37},
+	{0x006C, 0x0327, 0x013C},
+	{0x006C, 0x032D, 0x1E3D},
+	{0x006C, 0x0331, 0x1E3B},
+	{0x006D, 0x0301, 0x1E3F},
+	{0x006D, 0x0307, 0x1E41},
+	{0x006D, 0x0323, 0x1E43},
+	{0x006E, 0x0300, 0x01F9},
+	{0x006E, 0x0301, 0x0144},
+	{0x006E, 0x0303, 0x00F1},
+	{0x006E, 0x0307, 0x1E45},
+	{0x006E, 0x030C, 0x0148},
+	{0x006E, 0x0323, 0x1E47},
+	{0x006E, 0x0327, 0x0146},
+	{0x006E, 0x032D, 0x1E4B},
+	{0x006E, 0x0331, 0x1E49},
+	{0x006F, 0x0300, 0x00F2},
+	{0x006F, 0x0301, 0x00F3},
+	{0x006F, 0x0302, 0x00F4},
+	{0x006F, 0x0303, 0x00F5},
+	{0x006F, 0x0304, 0x014D},
+	{0x006F, 0x0306, 0x014F},
+	{0x006F, 0x0307, 0x022F},
+	{0x006F, 0x0308, 0x00F6},
+	{0x006F, 0x0309, 0x1ECF},
+	{0x006F, 0x030B, 0x0151},
+	{0x006F, 0x030C, 0x01D2},
+	{0x006F, 0x030F, 0x020D},
+	{0x006F, 0x0311, 0x020F},
+	{0x006F, 0x031B, 0x01A1},
+	{0x006F, 0x0323, 0x1ECD},
+	{0x006F, 0x0328, 0x01EB},
+	{0x0070, 0x0301, 0x1E55},
+	{0x0070, 0x0307, 0x1E57},
+	{0x0072, 0x0301, 0x0155},
+	{0x0072, 0x0307, 0x1E59},
+	{0x0072, 0x030C, 0x0159},
+	{0x0072, 0x030F, 0x0211},
+	{0x0072, 0x0311, 0x0213},
+	{0x0072, 0x0323, 0x1E5B},
+	{0x0072, 0x0327, 0x0157},
+	{0x0072, 0x0331, 0x1E5F},
+	{0x0073, 0x0301, 0x015B},
+	{0x0073, 0x0302, 0x015D},
+	{0x0073, 0x0307, 0x1E61},
+	{0x0073, 0x030C, 0x0161},
+	{0x0073, 0x0323, 0x1E63},
+	{0x0073, 0x0326, 0x0219},
+	{0x0073, 0x0327, 0x015F},
+	{0x0074, 0x0307, 0x1E6B},
+	{0x0074, 0x0308, 0x1E97},
+	{0x0074, 0x030C, 0x0165},
+	{0x0074, 0x0323, 0x1E6D},
+	{0x0074, 0x0326, 0x021B},
+	{0x0074, 0x0327, 0x0163},
+	{0x0074, 0x032D, 0x1E71},
+	{0x0074, 0x0331, 0x1E6F},
+	{0x0075, 0x0300, 0x00F9},
+	{0x0075, 0x0301, 0x00FA},
+	{0x0075, 0x0302, 0x00FB},
+	{0x0075, 0x0303, 0x0169},
+	{0x0075, 0x0304, 0x016B},
+	{0x0075, 0x0306, 0x016D},
+	{0x0075, 0x0308, 0x00FC},
+	{0x0075, 0x0309, 0x1EE7},
+	{0x0075, 0x030A, 0x016F},
+	{0x0075, 0x030B, 0x0171},
+	{0x0075, 0x030C, 0x01D4},
+	{0x0075, 0x030F, 0x0215},
+	{0x0075, 0x0311, 0x0217},
+	{0x0075, 0x031B, 0x01B0},
+	{0x0075, 0x0323, 0x1EE5},
+	{0x0075, 0x0324, 0x1E73},
+	{0x0075, 0x0328, 0x0173},
+	{0x0075, 0x032D, 0x1E77},
+	{0x0075, 0x0330, 0x1E75},
+	{0x0076, 0x0303, 0x1E7D},
+	{0x0076, 0x0323, 0x1E7F},
+	{0x0077, 0x0300, 0x1E81},
+	{0x0077, 0x0301, 0x1E83},
+	{0x0077, 0x0302, 0x0175},
+	{0x0077, 0x0307, 0x1E87},
+	{0x0077, 0x0308, 0x1E85},
+	{0x0077, 0x030A, 0x1E98},
+	{0x0077, 0x0323, 0x1E89},
+	{0x0078, 0x0307, 0x1E8B},
+	{0x0078, 0x0308, 0x1E8D},
+	{0x0079, 0x0300, 0x1EF3},
+	{0x0079, 0x0301, 0x00FD},
+	{0x0079, 0x0302, 0x0177},
+	{0x0079, 0x0303, 0x1EF9},
+	{0x0079, 0x0304, 0x0233},
+	{0x0079, 0x0307, 0x1E8F},
+	{0x0079, 0x0308, 0x00FF},
+	{0x0079, 0x0309, 0x1EF7},
+	{0x0079, 0x030A, 0x1E99},
+	{0x0079, 0x0323, 0x1EF5},
+	{0x007A, 0x0301, 0x017A},
+	{0x007A, 0x0302, 0x1E91},
+	{0x007A, 0x0307, 0x017C},
+	{0x007A, 0x030C, 0x017E},
+	{0x007A, 0x0323, 0x1E93},
+	{0x007A, 0x0331, 0x1E95},
+	{0x00A8, 0x0300, 0x1FED},
+	{0x00A8, 0x0301, 0x0385},
+	{0x00A8, 0x0342, 0x1FC1},
+	{0x00C2, 0x0300, 0x1EA6},
+	{0x00C2, 0x0301, 0x1EA4},
+	{0x00C2, 0x0303, 0x1EAA},
+	{0x00C2, 0x0309, 0x1EA8},
+	{0x00C4, 0x0304, 0x01DE},
+	{0x00C5, 0x0301, 0x01FA},
+	{0x00C6, 0x0301, 0x01FC},
+	{0x00C6, 0x0304, 0x01E2},
+	{0x00C7, 0x0301, 0x1E08},
+	{0x00CA, 0x0300, 0x1EC0},
+	{0x00CA, 0x0301, 0x1EBE},
+	{0x00CA, 0x0303, 0x1EC4},
+	{0x00CA, 0x0309, 0x1EC2},
+	{0x00CF, 0x0301, 0x1E2E},
+	{0x00D4, 0x0300, 0x1ED2},
+	{0x00D4, 0x0301, 0x1ED0},
+	{0x00D4, 0x0303, 0x1ED6},
+	{0x00D4, 0x0309, 0x1ED4},
+	{0x00D5, 0x0301, 0x1E4C},
+	{0x00D5, 0x0304, 0x022C},
+	{0x00D5, 0x0308, 0x1E4E},
+	{0x00D6, 0x0304, 0x022A},
+	{0x00D8, 0x0301, 0x01FE},
+	{0x00DC, 0x0300, 0x01DB},
+	{0x00DC, 0x0301, 0x01D7},
+	{0x00DC, 0x0304, 0x01D5},
+	{0x00DC, 0x030C, 0x01D9},
+	{0x00E2, 0x0300, 0x1EA7},
+	{0x00E2, 0x0301, 0x1EA5},
+	{0x00E2, 0x0303, 0x1EAB},
+	{0x00E2, 0x0309, 0x1EA9},
+	{0x00E4, 0x0304, 0x01DF},
+	{0x00E5, 0x0301, 0x01FB},
+	{0x00E6, 0x0301, 0x01FD},
+	{0x00E6, 0x0304, 0x01E3},
+	{0x00E7, 0x0301, 0x1E09},
+	{0x00EA, 0x0300, 0x1EC1},
+	{0x00EA, 0x0301, 0x1EBF},
+	{0x00EA, 0x0303, 0x1EC5},
+	{0x00EA, 0x0309, 0x1EC3},
+	{0x00EF, 0x0301, 0x1E2F},
+	{0x00F4, 0x0300, 0x1ED3},
+	{0x00F4, 0x0301, 0x1ED1},
+	{0x00F4, 0x0303, 0x1ED7},
+	{0x00F4, 0x0309, 0x1ED5},
+	{0x00F5, 0x0301, 0x1E4D},
+	{0x00F5, 0x0304, 0x022D},
+	{0x00F5, 0x0308, 0x1E4F},
+	{0x00F6, 0x0304, 0x022B},
+	{0x00F8, 0x0301, 0x01FF},
+	{0x00FC, 0x0300, 0x01DC},
+	{0x00FC, 0x0301, 0x01D8},
+	{0x00FC, 0x0304, 0x01D6},
+	{0x00FC, 0x030C, 0x01DA},
+	{0x0102, 0x0300, 0x1EB0},
+	{0x0102, 0x0301, 0x1EAE},
+	{0x0102, 0x0303, 0x1EB4},
+	{0x0102, 0x0309, 0x1EB2},
+	{0x0103, 0x0300, 0x1EB1},
+	{0x0103, 0x0301, 0x1EAF},
+	{0x0103, 0x0303, 0x1EB5},
+	{0x0103, 0x0309, 0x1EB3},
+	{0x0112, 0x0300, 0x1E14},
+	{0x0112, 0x0301, 0x1E16},
+	{0x0113, 0x0300, 0x1E15},
+	{0x0113, 0x0301, 0x1E17},
+	{0x014C, 0x0300, 0x1E50},
+	{0x014C, 0x0301, 0x1E52},
+	{0x014D, 0x0300, 0x1E51},
+	{0x014D, 0x0301, 0x1E53},
+	{0x015A, 0x0307, 0x1E64},
+	{0x015B, 0x0307, 0x1E65},
+	{0x0160, 0x0307, 0x1E66},
+	{0x0161, 0x0307, 0x1E67},
+	{0x0168, 0x0301, 0x1E78},
+	{0x0169, 0x0301, 0x1E79},
+	{0x016A, 0x0308, 0x1E7A},
+	{0x016B, 0x0308, 0x1E7B},
+	{0x017F, 0x0307, 0x1E9B},
+	{0x01A0, 0x0300, 0x1EDC},
+	{0x01A0, 0x0301, 0x1EDA},
+	{0x01A0, 0x0303, 0x1EE0},
+	{0x01A0, 0x0309, 0x1EDE},
+	{0x01A0, 0x0323, 0x1EE2},
+	{0x01A1, 0x0300, 0x1EDD},
+	{0x01A1, 0x0301, 0x1EDB},
+	{0x01A1, 0x0303, 0x1EE1},
+	{0x01A1, 0x0309, 0x1EDF},
+	{0x01A1, 0x0323, 0x1EE3},
+	{0x01AF, 0x0300, 0x1EEA},
+	{0x01AF, 0x0301, 0x1EE8},
+	{0x01AF, 0x0303, 0x1EEE},
+	{0x01AF, 0x0309, 0x1EEC},
+	{0x01AF, 0x0323, 0x1EF0},
+	{0x01B0, 0x0300, 0x1EEB},
+	{0x01B0, 0x0301, 0x1EE9},
+	{0x01B0, 0x0303, 0x1EEF},
+	{0x01B0, 0x0309, 0x1EED},
+	{0x01B0, 0x0323, 0x1EF1},
+	{0x01B7, 0x030C, 0x01EE},
+	{0x01EA, 0x0304, 0x01EC},
+	{0x01EB, 0x0304, 0x01ED},
+	{0x0226, 0x0304, 0x01E0},
+	{0x0227, 0x0304, 0x01E1},
+	{0x0228, 0x0306, 0x1E1C},
+	{0x0229, 0x0306, 0x1E1D},
+	{0x022E, 0x0304, 0x0230},
+	{0x022F, 0x0304, 0x0231},
+	{0x0292, 0x030C, 0x01EF},
+	{0x0391, 0x0300, 0x1FBA},
+	{0x0391, 0x0301, 0x0386},
+	{0x0391, 0x0304, 0x1FB9},
+	{0x0391, 0x0306, 0x1FB8},
+	{0x0391, 0x0313, 0x1F08},
+	{0x0391, 0x0314, 0x1F09},
+	{0x0391, 0x0345, 0x1FBC},
+	{0x0395, 0x0300, 0x1FC8},
+	{0x0395, 0x0301, 0x0388},
+	{0x0395, 0x0313, 0x1F18},
+	{0x0395, 0x0314, 0x1F19},
+	{0x0397, 0x0300, 0x1FCA},
+	{0x0397, 0x0301, 0x0389},
+	{0x0397, 0x0313, 0x1F28},
+	{0x0397, 0x0314, 0x1F29},
+	{0x0397, 0x0345, 0x1FCC},
+	{0x0399, 0x0300, 0x1FDA},
+	{0x0399, 0x0301, 0x038A},
+	{0x0399, 0x0304, 0x1FD9},
+	{0x0399, 0x0306, 0x1FD8},
+	{0x0399, 0x0308, 0x03AA},
+	{0x0399, 0x0313, 0x1F38},
+	{0x0399, 0x0314, 0x1F39},
+	{0x039F, 0x0300, 0x1FF8},
+	{0x039F, 0x0301, 0x038C},
+	{0x039F, 0x0313, 0x1F48},
+	{0x039F, 0x0314, 0x1F49},
+	{0x03A1, 0x0314, 0x1FEC},
+	{0x03A5, 0x0300, 0x1FEA},
+	{0x03A5, 0x0301, 0x038E},
+	{0x03A5, 0x0304, 0x1FE9},
+	{0x03A5, 0x0306, 0x1FE8},
+	{0x03A5, 0x0308, 0x03AB},
+	{0x03A5, 0x0314, 0x1F59},
+	{0x03A9, 0x0300, 0x1FFA},
+	{0x03A9, 0x0301, 0x038F},
+	{0x03A9, 0x0313, 0x1F68},
+	{0x03A9, 0x0314, 0x1F69},
+	{0x03A9, 0x0345, 0x1FFC},
+	{0x03AC, 0x0345, 0x1FB4},
+	{0x03AE, 0x0345, 0x1FC4},
+	{0x03B1, 0x0300, 0x1F70},
+	{0x03B1, 0x0301, 0x03AC},
+	{0x03B1, 0x0304, 0x1FB1},
+	{0x03B1, 0x0306, 0x1FB0},
+	{0x03B1, 0x0313, 0x1F00},
+	{0x03B1, 0x0314, 0x1F01},
+	{0x03B1, 0x0342, 0x1FB6},
+	{0x03B1, 0x0345, 0x1FB3},
+	{0x03B5, 0x0300, 0x1F72},
+	{0x03B5, 0x0301, 0x03AD},
+	{0x03B5, 0x0313, 0x1F10},
+	{0x03B5, 0x0314, 0x1F11},
+	{0x03B7, 0x0300, 0x1F74},
+	{0x03B7, 0x0301, 0x03AE},
+	{0x03B7, 0x0313, 0x1F20},
+	{0x03B7, 0x0314, 0x1F21},
+	{0x03B7, 0x0342, 0x1FC6},
+	{0x03B7, 0x0345, 0x1FC3},
+	{0x03B9, 0x0300, 0x1F76},
+	{0x03B9, 0x0301, 0x03AF},
+	{0x03B9, 0x0304, 0x1FD1},
+	{0x03B9, 0x0306, 0x1FD0},
+	{0x03B9, 0x0308, 0x03CA},
+	{0x03B9, 0x0313, 0x1F30},
+	{0x03B9, 0x0314, 0x1F31},
+	{0x03B9, 0x0342, 0x1FD6},
+	{0x03BF, 0x0300, 0x1F78},
+	{0x03BF, 0x0301, 0x03CC},
+	{0x03BF, 0x0313, 0x1F40},
+	{0x03BF, 0x0314, 0x1F41},
+	{0x03C1, 0x0313, 0x1FE4},
+	{0x03C1, 0x0314, 0x1FE5},
+	{0x03C5, 0x0300, 0x1F7A},
+	{0x03C5, 0x0301, 0x03CD},
+	{0x03C5, 0x0304, 0x1FE1},
+	{0x03C5, 0x0306, 0x1FE0},
+	{0x03C5, 0x0308, 0x03CB},
+	{0x03C5, 0x0313, 0x1F50},
+	{0x03C5, 0x0314, 0x1F51},
+	{0x03C5, 0x0342, 0x1FE6},
+	{0x03C9, 0x0300, 0x1F7C},
+	{0x03C9, 0x0301, 0x03CE},
+	{0x03C9, 0x0313, 0x1F60},
+	{0x03C9, 0x0314, 0x1F61},
+	{0x03C9, 0x0342, 0x1FF6},
+	{0x03C9, 0x0345, 0x1FF3},
+	{0x03CA, 0x0300, 0x1FD2},
+	{0x03CA, 0x0301, 0x0390},
+	{0x03CA, 0x0342, 0x1FD7},
+	{0x03CB, 0x0300, 0x1FE2},
+	{0x03CB, 0x0301, 0x03B0},
+	{0x03CB, 0x0342, 0x1FE7},
+	{0x03CE, 0x0345, 0x1FF4},
+	{0x03D2, 0x0301, 0x03D3},
+	{0x03D2, 0x0308, 0x03D4},
+	{0x0406, 0x0308, 0x0407},
+	{0x0410, 0x0306, 0x04D0},
+	{0x0410, 0x0308, 0x04D2},
+	{0x0413, 0x0301, 0x0403},
+	{0x0415, 0x0300, 0x0400},
+	{0x0415, 0x0306, 0x04D6},
+	{0x0415, 0x0308, 0x0401},
+	{0x0416, 0x0306, 0x04C1},
+	{0x0416, 0x0308, 0x04DC},
+	{0x0417, 0x0308, 0x04DE},
+	{0x0418, 0x0300, 0x040D},
+	{0x0418, 0x0304, 0x04E2},
+	{0x0418, 0x0306, 0x0419},
+	{0x0418, 0x0308, 0x04E4},
+	{0x041A, 0x0301, 0x040C},
+	{0x041E, 0x0308, 0x04E6},
+	{0x0423, 0x0304, 0x04EE},
+	{0x0423, 0x0306, 0x040E},
+	{0x0423, 0x0308, 0x04F0},
+	{0x0423, 0x030B, 0x04F2},
+	{0x0427, 0x0308, 0x04F4},
+	{0x042B, 0x0308, 0x04F8},
+	{0x042D, 0x0308, 0x04EC},
+	{0x0430, 0x0306, 0x04D1},
+	{0x0430, 0x0308, 0x04D3},
+	{0x0433, 0x0301, 0x0453},
+	{0x0435, 0x0300, 0x0450},
+	{0x0435, 0x0306, 0x04D7},
+	{0x0435, 0x0308, 0x0451},
+	{0x0436, 0x0306, 0x04C2},
+	{0x0436, 0x0308, 0x04DD},
+	{0x0437, 0x0308, 0x04DF},
+	{0x0438, 0x0300, 0x045D},
+	{0x0438, 0x0304, 0x04E3},
+	{0x0438, 0x0306, 0x0439},
+	{0x0438, 0x0308, 0x04E5},
+	{0x043A, 0x0301, 0x045C},
+	{0x043E, 0x0308, 0x04E7},
+	{0x0443, 0x0304, 0x04EF},
+	{0x0443, 0x0306, 0x045E},
+	{0x0443, 0x0308, 0x04F1},
+	{0x0443, 0x030B, 0x04F3},
+	{0x0447, 0x0308, 0x04F5},
+	{0x044B, 0x0308, 0x04F9},
+	{0x044D, 0x0308, 0x04ED},
+	{0x0456, 0x0308, 0x0457},
+	{0x0474, 0x030F, 0x0476},
+	{0x0475, 0x030F, 0x0477},
+	{0x04D8, 0x0308, 0x04DA},
+	{0x04D9, 0x0308, 0x04DB},
+	{0x04E8, 0x0308, 0x04EA},
+	{0x04E9, 0x0308, 0x04EB},
+	{0x0627, 0x0653, 0x0622},
+	{0x0627, 0x0654, 0x0623},
+	{0x0627, 0x0655, 0x0625},
+	{0x0648, 0x0654, 0x0624},
+	{0x064A, 0x0654, 0x0626},
+	{0x06C1, 0x0654, 0x06C2},
+	{0x06D2, 0x0654, 0x06D3},
+	{0x06D5, 0x0654, 0x06C0},
+	{0x0928, 0x093C, 0x0929},
+	{0x0930, 0x093C, 0x0931},
+	{0x0933, 0x093C, 0x0934},
+	{0x09C7, 0x09BE, 0x09CB},
+	{0x09C7, 0x09D7, 0x09CC},
+	{0x0B47, 0x0B3E, 0x0B4B},
+	{0x0B47, 0x0B56, 0x0B48},
+	{0x0B47, 0x0B57, 0x0B4C},
+	{0x0B92, 0x0BD7, 0x0B94},
+	{0x0BC6, 0x0BBE, 0x0BCA},
+	{0x0BC6, 0x0BD7, 0x0BCC},
+	{0x0BC7, 0x0BBE, 0x0BCB},
+	{0x0C46, 0x0C56, 0x0C48},
+	{0x0CBF, 0x0CD5, 0x0CC0},
+	{0x0CC6, 0x0CC2, 0x0CCA},
+	{0x0CC6, 0x0CD5, 0x0CC7},
+	{0x0CC6, 0x0CD6, 0x0CC8},
+	{0x0CCA, 0x0CD5, 0x0CCB},
+	{0x0D46, 0x0D3E, 0x0D4A},
+	{0x0D46, 0x0D57, 0x0D4C},
+	{0x0D47, 0x0D3E, 0x0D4B},
+	{0x0DD9, 0x0DCA, 0x0DDA},
+	{0x0DD9, 0x0DCF, 0x0DDC},
+	{0x0DD9, 0x0DDF, 0x0DDE},
+	{0x0DDC, 0x0DCA, 0x0DDD},
+	{0x1025, 0x102E, 0x1026},
+	{0x1B05, 0x1B35, 0x1B06},
+	{0x1B07, 0x1B35, 0x1B08},
+	{0x1B09, 0x1B35, 0x1B0A},
+	{0x1B0B, 0x1B35, 0x1B0C},
+	{0x1B0D, 0x1B35, 0x1B0E},
+	{0x1B11, 0x1B35, 0x1B12},
+	{0x1B3A, 0x1B35, 0x1B3B},
+	{0x1B3C, 0x1B35, 0x1B3D},
+	{0x1B3E, 0x1B35, 0x1B40},
+	{0x1B3F, 0x1B35, 0x1B41},
+	{0x1B42, 0x1B35, 0x1B43},
+	{0x1E36, 0x0304, 0x1E38},
+	{0x1E37, 0x0304, 0x1E39},
+	{0x1E5A, 0x0304, 0x1E5C},
+	{0x1E5B, 0x0304, 0x1E5D},
+	{0x1E62, 0x0307, 0x1E68},
+	{0x1E63, 0x0307, 0x1E69},
+	{0x1EA0, 0x0302, 0x1EAC},
+	{0x1EA0, 0x0306, 0x1EB6},
+	{0x1EA1, 0x0302, 0x1EAD},
+	{0x1EA1, 0x0306, 0x1EB7},
+	{0x1EB8, 0x0302, 0x1EC6},
+	{0x1EB9, 0x0302, 0x1EC7},
+	{0x1ECC, 0x0302, 0x1ED8},
+	{0x1ECD, 0x0302, 0x1ED9},
+	{0x1F00, 0x0300, 0x1F02},
+	{0x1F00, 0x0301, 0x1F04},
+	{0x1F00, 0x0342, 0x1F06},
+	{0x1F00, 0x0345, 0x1F80},
+	{0x1F01, 0x0300, 0x1F03},
+	{0x1F01, 0x0301, 0x1F05},
+	{0x1F01, 0x0342, 0x1F07},
+	{0x1F01, 0x0345, 0x1F81},
+	{0x1F02, 0x0345, 0x1F82},
+	{0x1F03, 0x0345, 0x1F83},
+	{0x1F04, 0x0345, 0x1F84},
+	{0x1F05, 0x0345, 0x1F85},
+	{0x1F06, 0x0345, 0x1F86},
+	{0x1F07, 0x0345, 0x1F87},
+	{0x1F08, 0x0300, 0x1F0A},
+	{0x1F08, 0x0301, 0x1F0C},
+	{0x1F08, 0x0342, 0x1F0E},
+	{0x1F08, 0x0345, 0x1F88},
+	{0x1F09, 0x0300, 0x1F0B},
+	{0x1F09, 0x0301, 0x1F0D},
+	{0x1F09, 0x0342, 0x1F0F},
+	{0x1F09, 0x0345, 0x1F89},
+	{0x1F0A, 0x0345, 0x1F8A},
+	{0x1F0B, 0x0345, 0x1F8B},
+	{0x1F0C, 0x0345, 0x1F8C},
+	{0x1F0D, 0x0345, 0x1F8D},
+	{0x1F0E, 0x0345, 0x1F8E},
+	{0x1F0F, 0x0345, 0x1F8F},
+	{0x1F10, 0x0300, 0x1F12},
+	{0x1F10, 0x0301, 0x1F14},
+	{0x1F11, 0x0300, 0x1F13},
+	{0x1F11, 0x0301, 0x1F15},
+	{0x1F18, 0x0300, 0x1F1A},
+	{0x1F18, 0x0301, 0x1F1C},
+	{0x1F19, 0x0300, 0x1F1B},
+	{0x1F19, 0x0301, 0x1F1D},
+	{0x1F20, 0x0300, 0x1F22},
+	{0x1F20, 0x0301, 0x1F24},
+	{0x1F20, 0x0342, 0x1F26},
+	{0x1F20, 0x0345, 0x1F90},
+	{0x1F21, 0x0300, 0x1F23},
+	{0x1F21, 0x0301, 0x1F25},
+	{0x1F21, 0x0342, 0x1F27},
+	{0x1F21, 0x0345, 0x1F91},
+	{0x1F22, 0x0345, 0x1F92},
+	{0x1F23, 0x0345, 0x1F93},
+	{0x1F24, 0x0345, 0x1F94},
+	{0x1F25, 0x0345, 0x1F95},
+	{0x1F26, 0x0345, 0x1F96},
+	{0x1F27, 0x0345, 0x1F97},
+	{0x1F28, 0x0300, 0x1F2A},
+	{0x1F28, 0x0301, 0x1F2C},
+	{0x1F28, 0x0342, 0x1F2E},
+	{0x1F28, 0x0345, 0x1F98},
+	{0x1F29, 0x0300, 0x1F2B},
+	{0x1F29, 0x0301, 0x1F2D},
+	{0x1F29, 0x0342, 0x1F2F},
+	{0x1F29, 0x0345, 0x1F99},
+	{0x1F2A, 0x0345, 0x1F9A},
+	{0x1F2B, 0x0345, 0x1F9B},
+	{0x1F2C, 0x0345, 0x1F9C},
+	{0x1F2D, 0x0345, 0x1F9D},
+	{0x1F2E, 0x0345, 0x1F9E},
+	{0x1F2F, 0x0345, 0x1F9F},
+	{0x1F30, 0x0300, 0x1F32},
+	{0x1F30, 0x0301, 0x1F34},
+	{0x1F30, 0x0342, 0x1F36},
+	{0x1F31, 0x0300, 0x1F33},
+	{0x1F31, 0x0301, 0x1F35},
+	{0x1F31, 0x0342, 0x1F37},
+	{0x1F38, 0x0300, 0x1F3A},
+	{0x1F38, 0x0301, 0x1F3C},
+	{0x1F38, 0x0342, 0x1F3E},
+	{0x1F39, 0x0300, 0x1F3B},
+	{0x1F39, 0x0301, 0x1F3D},
+	{0x1F39, 0x0342, 0x1F3F},
+	{0x1F40, 0x0300, 0x1F42},
+	{0x1F40, 0x0301, 0x1F44},
+	{0x1F41, 0x0300, 0x1F43},
+	{0x1F41, 0x0301, 0x1F45},
+	{0x1F48, 0x0300, 0x1F4A},
+	{0x1F48, 0x0301, 0x1F4C},
+	{0x1F49, 0x0300, 0x1F4B},
+	{0x1F49, 0x0301, 0x1F4D},
+	{0x1F50, 0x0300, 0x1F52},
+	{0x1F50, 0x0301, 0x1F54},
+	{0x1F50, 0x0342, 0x1F56},
+	{0x1F51, 0x0300, 0x1F53},
+	{0x1F51, 0x0301, 0x1F55},
+	{0x1F51, 0x0342, 0x1F57},
+	{0x1F59, 0x0300, 0x1F5B},
+	{0x1F59, 0x0301, 0x1F5D},
+	{0x1F59, 0x0342, 0x1F5F},
+	{0x1F60, 0x0300, 0x1F62},
+	{0x1F60, 0x0301, 0x1F64},
+	{0x1F60, 0x0342, 0x1F66},
+	{0x1F60, 0x0345, 0x1FA0},
+	{0x1F61, 0x0300, 0x1F63},
+	{0x1F61, 0x0301, 0x1F65},
+	{0x1F61, 0x0342, 0x1F67},
+	{0x1F61, 0x0345, 0x1FA1},
+	{0x1F62, 0x0345, 0x1FA2},
+	{0x1F63, 0x0345, 0x1FA3},
+	{0x1F64, 0x0345, 0x1FA4},
+	{0x1F65, 0x0345, 0x1FA5},
+	{0x1F66, 0x0345, 0x1FA6},
+	{0x1F67, 0x0345, 0x1FA7},
+	{0x1F68, 0x0300, 0x1F6A},
+	{0x1F68, 0x0301, 0x1F6C},
+	{0x1F68, 0x0342, 0x1F6E},
+	{0x1F68, 0x0345, 0x1FA8},
+	{0x1F69, 0x0300, 0x1F6B},
+	{0x1F69, 0x0301, 0x1F6D},
+	{0x1F69, 0x0342, 0x1F6F},
+	{0x1F69, 0x0345, 0x1FA9},
+	{0x1F6A, 0x0345, 0x1FAA},
+	{0x1F6B, 0x0345, 0x1FAB},
+	{0x1F6C, 0x0345, 0x1FAC},
+	{0x1F6D, 0x0345, 0x1FAD},
+	{0x1F6E, 0x0345, 0x1FAE},
+	{0x1F6F, 0x0345, 0x1FAF},
+	{0x1F70, 0x0345, 0x1FB2},
+	{0x1F74, 0x0345, 0x1FC2},
+	{0x1F7C, 0x0345, 0x1FF2},
+	{0x1FB6, 0x0345, 0x1FB7},
+	{0x1FBF, 0x0300, 0x1FCD},
+	{0x1FBF, 0x0301, 0x1FCE},
+	{0x1FBF, 0x0342, 0x1FCF},
+	{0x1FC6, 0x0345, 0x1FC7},
+	{0x1FF6, 0x0345, 0x1FF7},
+	{0x1FFE, 0x0300, 0x1FDD},
+	{0x1FFE, 0x0301, 0x1FDE},
+	{0x1FFE, 0x0342, 0x1FDF},
+	{0x2190, 0x0338, 0x219A},
+	{0x2192, 0x0338, 0x219B},
+	{0x2194, 0x0338, 0x21AE},
+	{0x21D0, 0x0338, 0x21CD},
+	{0x21D2, 0x0338, 0x21CF},
+	{0x21D4, 0x0338, 0x21CE},
+	{0x2203, 0x0338, 0x2204},
+	{0x2208, 0x0338, 0x2209},
+	{0x220B, 0x0338, 0x220C},
+	{0x2223, 0x0338, 0x2224},
+	{0x2225, 0x0338, 0x2226},
+	{0x223C, 0x0338, 0x2241},
+	{0x2243, 0x0338, 0x2244},
+	{0x2245, 0x0338, 0x2247},
+	{0x2248, 0x0338, 0x2249},
+	{0x224D, 0x0338, 0x226D},
+	{0x2261, 0x0338, 0x2262},
+	{0x2264, 0x0338, 0x2270},
+	{0x2265, 0x0338, 0x2271},
+	{0x2272, 0x0338, 0x2274},
+	{0x2273, 0x0338, 0x2275},
+	{0x2276, 0x0338, 0x2278},
+	{0x2277, 0x0338, 0x2279},
+	{0x227A, 0x0338, 0x2280},
+	{0x227B, 0x0338, 0x2281},
+	{0x227C, 0x0338, 0x22E0},
+	{0x227D, 0x0338, 0x22E1},
+	{0x2282, 0x0338, 0x2284},
+	{0x2283, 0x0338, 0x2285},
+	{0x2286, 0x0338, 0x2288},
+	{0x2287, 0x0338, 0x2289},
+	{0x2291, 0x0338, 0x22E2},
+	{0x2292, 0x0338, 0x22E3},
+	{0x22A2, 0x0338, 0x22AC},
+	{0x22A8, 0x0338, 0x22AD},
+	{0x22A9, 0x0338, 0x22AE},
+	{0x22AB, 0x0338, 0x22AF},
+	{0x22B2, 0x0338, 0x22EA},
+	{0x22B3, 0x0338, 0x22EB},
+	{0x22B4, 0x0338, 0x22EC},
+	{0x22B5, 0x0338, 0x22ED},
+	{0x3046, 0x3099, 0x3094},
+	{0x304B, 0x3099, 0x304C},
+	{0x304D, 0x3099, 0x304E},
+	{0x304F, 0x3099, 0x3050},
+	{0x3051, 0x3099, 0x3052},
+	{0x3053, 0x3099, 0x3054},
+	{0x3055, 0x3099, 0x3056},
+	{0x3057, 0x3099, 0x3058},
+	{0x3059, 0x3099, 0x305A},
+	{0x305B, 0x3099, 0x305C},
+	{0x305D, 0x3099, 0x305E},
+	{0x305F, 0x3099, 0x3060},
+	{0x3061, 0x3099, 0x3062},
+	{0x3064, 0x3099, 0x3065},
+	{0x3066, 0x3099, 0x3067},
+	{0x3068, 0x3099, 0x3069},
+	{0x306F, 0x3099, 0x3070},
+	{0x306F, 0x309A, 0x3071},
+	{0x3072, 0x3099, 0x3073},
+	{0x3072, 0x309A, 0x3074},
+	{0x3075, 0x3099, 0x3076},
+	{0x3075, 0x309A, 0x3077},
+	{0x3078, 0x3099, 0x3079},
+	{0x3078, 0x309A, 0x307A},
+	{0x307B, 0x3099, 0x307C},
+	{0x307B, 0x309A, 0x307D},
+	{0x309D, 0x3099, 0x309E},
+	{0x30A6, 0x3099, 0x30F4},
+	{0x30AB, 0x3099, 0x30AC},
+	{0x30AD, 0x3099, 0x30AE},
+	{0x30AF, 0x3099, 0x30B0},
+	{0x30B1, 0x3099, 0x30B2},
+	{0x30B3, 0x3099, 0x30B4},
+	{0x30B5, 0x3099, 0x30B6},
+	{0x30B7, 0x3099, 0x30B8},
+	{0x30B9, 0x3099, 0x30BA},
+	{0x30BB, 0x3099, 0x30BC},
+	{0x30BD, 0x3099, 0x30BE},
+	{0x30BF, 0x3099, 0x30C0},
+	{0x30C1, 0x3099, 0x30C2},
+	{0x30C4, 0x3099, 0x30C5},
+	{0x30C6, 0x3099, 0x30C7},
+	{0x30C8, 0x3099, 0x30C9},
+	{0x30CF, 0x3099, 0x30D0},
+	{0x30CF, 0x309A, 0x30D1},
+	{0x30D2, 0x3099, 0x30D3},
+	{0x30D2, 0x309A, 0x30D4},
+	{0x30D5, 0x3099, 0x30D6},
+	{0x30D5, 0x309A, 0x30D7},
+	{0x30D8, 0x3099, 0x30D9},
+	{0x30D8, 0x309A, 0x30DA},
+	{0x30DB, 0x3099, 0x30DC},
+	{0x30DB, 0x309A, 0x30DD},
+	{0x30EF, 0x3099, 0x30F7},
+	{0x30F0, 0x3099, 0x30F8},
+	{0x30F1, 0x3099, 0x30F9},
+	{0x30F2, 0x3099, 0x30FA},
+	{0x30FD, 0x3099, 0x30FE},
+	{0x11099, 0x110BA, 0x1109A},
+	{0x1109B, 0x110BA, 0x1109C},
+	{0x110A5, 0x110BA, 0x110AB},
+	{0x11131, 0x11127, 0x1112E},
+	{0x11132, 0x11127, 0x1112F},
+};
+const slice<const composition> compositions(_compositions);
+
@@ -410,6 +410,7 @@ public:
 				detail::free(cur);
 			}
 			b.free();
+			b.clear();
 		}
 		_count = 0;
 	}
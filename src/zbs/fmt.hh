@@ -2,8 +2,11 @@
 
 #include <type_traits>
 #include <cstdio>
+#include <cstdarg>
+#include <cstddef>
 #include "_error.hh"
 #include "_string.hh"
+#include "_vector.hh"
 
 namespace zbs {
 namespace detail {
@@ -47,13 +50,316 @@ constexpr error *get_last_if_error(T&&, Args &&...other) {
 
 } // namespace zbs::detail
 
+namespace io {
+class writer;
+} // namespace zbs::io
+
 namespace fmt {
 
+/// A destination for formatted output. The output is passed to write() piece
+/// by piece, in order.
+class sink {
+public:
+	virtual ~sink() = default;
+	virtual void write(slice<const char> s) = 0;
+};
+
 string sprintf(const char *format, ...);
 string vsprintf(const char *format, va_list vl);
 
-// TODO:
-//int printf(const char *format, ...);
-//int fprintf(io::writer &w, const char *format, ...);
+/// Appends the formatted output to `s`, without intermediate buffers.
+/// Returns the number of bytes appended, or -1 if the format is invalid.
+int append(string &s, const char *format, ...);
+int vappend(string &s, const char *format, va_list vl);
+
+/// Writes the formatted output to `buf` followed by a terminating zero,
+/// truncating it if it doesn't fit. Returns the length of the complete output
+/// (excluding the terminating zero), so the output was truncated if the result
+/// is not less than `buf.len()`. Returns -1 if the format is invalid.
+int snprintf(slice<char> buf, const char *format, ...);
+int vsnprintf(slice<char> buf, const char *format, va_list vl);
+
+/// Writes the formatted output to `s`. Returns the number of bytes written,
+/// or -1 if the format is invalid.
+int vformat_to(sink &s, const char *format, va_list vl);
+
+/// Writes the formatted output to `w`. An io::buffered_writer gets it
+/// formatted straight into its buffer, which is flushed only when it fills up.
+/// Other writers get it collected in a small buffer on the stack, so that they
+/// see few large writes. Returns the number of bytes written, or -1 if the
+/// format is invalid or a write fails.
+int fprintf(io::writer &w, const char *format, ...);
+int vfprintf(io::writer &w, const char *format, va_list vl);
+
+/// Writes the formatted output to the standard output file descriptor. It
+/// bypasses the buffer of C's stdout, which must be flushed first if both
+/// are used.
+int printf(const char *format, ...);
+int vprintf(const char *format, va_list vl);
+
+//============================================================================
+// numbers
+//============================================================================
+
+/// Appends the decimal form of `v` to `s`.
+void append_int(string &s, int64 v);
+
+/// Unsigned version of append_int.
+void append_uint(string &s, uint64 v);
+
+/// Appends the string form of `v` according to the format `fmt` ('e', 'f' or
+/// 'g', as in printf) and precision `prec`. A negative `prec` uses the smallest
+/// number of digits necessary to represent the value exactly, that is the
+/// output parses back to the same `v`. For floats the shortest output is
+/// computed in float precision.
+void append_float(string &s, double v, char fmt = 'g', int prec = -1);
+void append_float(string &s, float v, char fmt = 'g', int prec = -1);
+
+namespace detail {
+
+/// Writes the decimal digits of `v` right before `end` and returns a pointer
+/// to the first one. There must be room for 20 digits.
+char *format_uint(char *end, uint64 v);
+
+/// Writes the shortest digits which identify the finite non-zero `v` to
+/// `digits` (room for 17 digits is needed), ignoring the sign. Returns the
+/// number of digits, the value is d.ddd * 10^`*exp`.
+int shortest_digits(double v, char *digits, int *exp);
+int shortest_digits(float v, char *digits, int *exp);
+
+/// Size of the buffer needed by format_shortest.
+constexpr int shortest_size = 360;
+
+/// Writes `v` to `buf` as append_float(s, v, fmt, -1) would. Returns the
+/// number of bytes written.
+int format_shortest(char *buf, double v, char fmt);
+int format_shortest(char *buf, float v, char fmt);
+
+} // namespace zbs::fmt::detail
+
+//============================================================================
+// format
+//============================================================================
+
+// A type-safe alternative to sprintf. Replacement fields in the format string
+// are delimited by braces:
+//
+//     fmt::format("{} has {} items", name, n)
+//     fmt::format("{1} {0}", "world", "hello")
+//     fmt::format("{:08x}|{:>6.2f}|{:-^9}", 255, 3.14159, "mid")
+//
+// A field is {[index][:[[fill]align][0][width][.precision][type]]}, where
+// align is '<', '>' or '^', and type is one of "bcdoxX" for integers, "eEfFgG"
+// for floats, 's' for strings and 'c' to format an integer as a rune. Width
+// and precision are counted in runes for strings. Literal braces are written
+// as "{{" and "}}". Fields referring to missing arguments produce "{!MISSING}",
+// malformed ones "{!BADFORMAT}".
+//
+// Arguments are formatted by formatter<T>::format(sink&, const T&, const
+// spec&). Integers, floats, bool, char, char32_t (as a rune), C strings,
+// string, slices, vectors, errors (and pointers to them) and pointers are
+// supported, other types can be added by specializing formatter<T>. Note
+// that rune is an alias of int32 and is formatted as a number, unless the 'c'
+// type is used.
+
+/// Parsed options of a replacement field.
+struct spec {
+	rune fill = ' ';
+	char align = 0; // '<', '>', '^' or 0 for the default alignment
+	bool zero = false;
+	int width = 0;
+	int precision = -1;
+	char type = 0;
+};
+
+template <typename T, typename Enable = void>
+struct formatter;
+
+template <>
+struct formatter<bool> {
+	static void format(sink &out, bool v, const spec &s);
+};
+
+template <>
+struct formatter<char> {
+	static void format(sink &out, char v, const spec &s);
+};
+
+template <>
+struct formatter<char32_t> {
+	static void format(sink &out, char32_t v, const spec &s);
+};
+
+template <>
+struct formatter<int64> {
+	static void format(sink &out, int64 v, const spec &s);
+};
+
+template <>
+struct formatter<uint64> {
+	static void format(sink &out, uint64 v, const spec &s);
+};
+
+template <typename T>
+struct formatter<T, typename std::enable_if<
+	std::is_integral<T>::value &&
+	!std::is_same<T, bool>::value &&
+	!std::is_same<T, char>::value &&
+	!std::is_same<T, char32_t>::value &&
+	!std::is_same<T, int64>::value &&
+	!std::is_same<T, uint64>::value
+>::type> {
+	static void format(sink &out, T v, const spec &s) {
+		if (std::is_signed<T>::value) {
+			formatter<int64>::format(out, v, s);
+		} else {
+			formatter<uint64>::format(out, v, s);
+		}
+	}
+};
+
+template <>
+struct formatter<double> {
+	static void format(sink &out, double v, const spec &s);
+};
+
+template <>
+struct formatter<float> {
+	static void format(sink &out, float v, const spec &s);
+};
+
+template <>
+struct formatter<slice<const char>> {
+	static void format(sink &out, slice<const char> v, const spec &s);
+};
+
+template <>
+struct formatter<slice<char>> : formatter<slice<const char>> {};
+
+template <>
+struct formatter<string> : formatter<slice<const char>> {};
+
+template <>
+struct formatter<const char*> {
+	static void format(sink &out, const char *v, const spec &s) {
+		formatter<slice<const char>>::format(out, v ? v : "(null)", s);
+	}
+};
+
+template <>
+struct formatter<char*> : formatter<const char*> {};
+
+template <std::size_t N>
+struct formatter<char[N]> : formatter<const char*> {};
+
+/// Errors of any class are formatted as their message, pointers to them too
+/// ("(null)" if null), since errors are usually passed around by pointer.
+template <typename T>
+struct formatter<T, typename std::enable_if<std::is_base_of<error, T>::value>::type> {
+	static void format(sink &out, const error &v, const spec &s) {
+		formatter<const char*>::format(out, v.what(), s);
+	}
+};
+
+template <>
+struct formatter<const void*> {
+	static void format(sink &out, const void *v, const spec &s);
+};
+
+template <typename T>
+struct formatter<T*, typename std::enable_if<!std::is_base_of<error, T>::value>::type> {
+	static void format(sink &out, const T *v, const spec &s) {
+		formatter<const void*>::format(out, v, s);
+	}
+};
+
+template <typename T>
+struct formatter<T*, typename std::enable_if<std::is_base_of<error, T>::value>::type> {
+	static void format(sink &out, const error *v, const spec &s) {
+		formatter<const char*>::format(out, v ? v->what() : nullptr, s);
+	}
+};
+
+/// Elements are separated by spaces and enclosed in brackets, the spec
+/// applies to each element.
+template <typename T>
+struct formatter<slice<T>> {
+	static void format(sink &out, slice<T> v, const spec &s) {
+		out.write("[");
+		for (int i = 0; i < v.len(); i++) {
+			if (i != 0) {
+				out.write(" ");
+			}
+			formatter<typename std::remove_const<T>::type>::format(out, v[i], s);
+		}
+		out.write("]");
+	}
+};
+
+template <typename T>
+struct formatter<vector<T>> {
+	static void format(sink &out, const vector<T> &v, const spec &s) {
+		formatter<slice<const T>>::format(out, v, s);
+	}
+};
+
+namespace detail {
+
+struct format_arg {
+	const void *value;
+	void (*format)(sink &out, const void *value, const spec &s);
+	bool number; // numbers are aligned to the right by default
+};
+
+template <typename T>
+void format_value(sink &out, const void *value, const spec &s) {
+	formatter<T>::format(out, *static_cast<const T*>(value), s);
+}
+
+template <typename T>
+format_arg make_format_arg(const T &v) {
+	return {&v, format_value<T>,
+		std::is_arithmetic<T>::value &&
+		!std::is_same<T, bool>::value &&
+		!std::is_same<T, char>::value &&
+		!std::is_same<T, char32_t>::value};
+}
+
+void vformat(sink &out, slice<const char> format, slice<const format_arg> args);
+void vformat_append(string &out, slice<const char> format, slice<const format_arg> args);
+int vformat_write(io::writer &out, slice<const char> format, slice<const format_arg> args);
+
+} // namespace zbs::fmt::detail
+
+/// Writes the arguments formatted according to `format` to `out`.
+template <typename ...Args>
+void format_to(sink &out, slice<const char> format, const Args &...args) {
+	const detail::format_arg a[] = {detail::make_format_arg(args)..., {nullptr, nullptr, false}};
+	detail::vformat(out, format, slice<const detail::format_arg>(a, sizeof...(Args)));
+}
+
+/// Appends the arguments formatted according to `format` to `out`.
+template <typename ...Args>
+void format_to(string &out, slice<const char> format, const Args &...args) {
+	const detail::format_arg a[] = {detail::make_format_arg(args)..., {nullptr, nullptr, false}};
+	detail::vformat_append(out, format, slice<const detail::format_arg>(a, sizeof...(Args)));
+}
+
+/// Writes the arguments formatted according to `format` to `out`, see fprintf()
+/// for the buffering. Returns the number of bytes written, or -1 if a write
+/// fails.
+template <typename ...Args>
+int format_to(io::writer &out, slice<const char> format, const Args &...args) {
+	const detail::format_arg a[] = {detail::make_format_arg(args)..., {nullptr, nullptr, false}};
+	return detail::vformat_write(out, format, slice<const detail::format_arg>(a, sizeof...(Args)));
+}
+
+/// Returns the arguments formatted according to `format`.
+template <typename ...Args>
+string format(slice<const char> format, const Args &...args) {
+	string out;
+	format_to(out, format, args...);
+	return out;
+}
 
 }} // namespace zbs::fmt
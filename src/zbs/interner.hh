@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include "_types.hh"
+#include "_slice.hh"
+#include "_vector.hh"
+#include "_map.hh"
+#include "_optional.hh"
+
+namespace zbs {
+
+/// Maps strings to dense 32-bit ids (atoms), storing every distinct string
+/// once. The bytes are copied into large chunks which are never moved or freed
+/// before the interner is destroyed, so the slices returned by lookup() stay
+/// valid for the lifetime of the interner. Ids are assigned in the order the
+/// strings are first seen, starting from 0, so they can index plain arrays.
+///
+/// Two ids are equal if and only if the strings are equal, which makes the
+/// ids a cheap replacement for string comparison and hashing.
+///
+/// By default the interner is not safe for concurrent use. When constructed
+/// with a number of shards, the strings are spread over that many shards, each
+/// with its own lock and memory, and intern() and find() may be called from
+/// multiple threads. lookup() never takes a lock.
+class interner {
+	static constexpr int _chunk_size = 16 * 1024;
+	static constexpr int _segment_shift = 10;
+	// the ids stay below 1 << 31, len() is an int
+	static constexpr int _max_segments = 31 - _segment_shift;
+
+	struct _shard {
+		std::mutex mutex;
+		map<slice<const char>, uint32> ids;
+		vector<char*> chunks;
+		int chunk_len = 0;
+		int chunk_cap = 0;
+
+		~_shard();
+		slice<const char> copy(slice<const char> s);
+	};
+
+	std::unique_ptr<_shard[]> _shards;
+	int _shards_mask = 0;
+	bool _locking = false;
+
+	// Id to string table. Segment k holds 1 << (k + _segment_shift) entries,
+	// the segments are allocated on demand and never moved.
+	std::atomic<slice<const char>*> _segments[_max_segments];
+	std::mutex _segments_mutex;
+	// Ids handed out when locking, and ids whose entries are stored. Only the
+	// latter are visible through len() and lookup().
+	std::atomic<uint32> _next;
+	std::atomic<uint32> _len;
+
+	_shard &_shard_of(slice<const char> s) const;
+	slice<const char> *_entry(uint32 id) const;
+	uint32 _insert(_shard &sh, slice<const char> s);
+
+public:
+	/// Constructs an interner. If `shards` is greater than zero, it is safe
+	/// for concurrent use and has `shards` shards (rounded up to a power of
+	/// two).
+	explicit interner(int shards = 0);
+	~interner();
+
+	interner(const interner&) = delete;
+	interner &operator=(const interner&) = delete;
+
+	/// Returns the id of `s`, adding a copy of `s` if it hasn't been seen yet.
+	uint32 intern(slice<const char> s);
+
+	/// Returns the id of `s` if it was interned.
+	optional<uint32> find(slice<const char> s) const;
+
+	/// Returns the string with the given id, which must be less than len().
+	slice<const char> lookup(uint32 id) const;
+
+	/// Returns the number of distinct strings interned.
+	int len() const { return _len.load(std::memory_order_acquire); }
+};
+
+} // namespace zbs
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "_types.hh"
+#include "_error.hh"
+#include "_slice.hh"
+#include "_string.hh"
+#include "_utils.hh"
+
+namespace zbs {
+namespace io {
+
+/// Domain of the errors reported by the operating system, the code is the
+/// errno value.
+extern error_domain errno_domain;
+
+/// Default buffer size of buffered readers and writers.
+constexpr int default_buffer_size = 4096;
+
+//============================================================================
+// reader
+//============================================================================
+
+/// A source of bytes.
+class reader {
+public:
+	virtual ~reader() = default;
+
+	/// Reads up to `buf.len()` bytes into `buf`. Returns the number of bytes
+	/// read, which is 0 only at the end of the input (or if `buf` is empty).
+	/// Returns -1 and sets `err` on failure.
+	virtual int read(slice<char> buf, error *err = &default_error) = 0;
+};
+
+//============================================================================
+// writer
+//============================================================================
+
+/// A destination for bytes.
+class writer {
+public:
+	virtual ~writer() = default;
+
+	/// Writes all of `buf`. Returns `buf.len()`, or -1 and sets `err` on
+	/// failure, in which case part of `buf` may have been written.
+	virtual int write(slice<const char> buf, error *err = &default_error) = 0;
+
+	/// Writes all of `bufs` one after another, as a single write of their
+	/// concatenation would. Returns the total length, or -1 and sets `err`
+	/// on failure. The default implementation calls write() for each of them.
+	virtual int writev(slice<const slice<const char>> bufs, error *err = &default_error);
+};
+
+//============================================================================
+// fd_reader, fd_writer
+//============================================================================
+
+/// Reads from a file descriptor, which is not closed by the reader.
+class fd_reader : public reader {
+	int _fd;
+
+public:
+	explicit fd_reader(int fd): _fd(fd) {}
+
+	int fd() const { return _fd; }
+	int read(slice<char> buf, error *err = &default_error) override;
+};
+
+/// Writes to a file descriptor, which is not closed by the writer. Every call
+/// is at least one system call, writev() is a single one unless the kernel
+/// accepts only part of the data.
+class fd_writer : public writer {
+	int _fd;
+
+public:
+	explicit fd_writer(int fd): _fd(fd) {}
+
+	int fd() const { return _fd; }
+	int write(slice<const char> buf, error *err = &default_error) override;
+	int writev(slice<const slice<const char>> bufs, error *err = &default_error) override;
+};
+
+//============================================================================
+// buffered_reader
+//============================================================================
+
+/// Adds a buffer to a reader, so that small reads don't cost a call to the
+/// underlying reader each.
+class buffered_reader : public reader {
+	reader *_r;
+	char *_buf;
+	int _size;
+	int _begin = 0;
+	int _end = 0;
+
+	int _fill(error *err);
+
+public:
+	/// Constructs a reader reading from `r` through a buffer of `size` bytes.
+	explicit buffered_reader(reader &r, int size = default_buffer_size);
+	~buffered_reader();
+
+	buffered_reader(const buffered_reader&) = delete;
+	buffered_reader &operator=(const buffered_reader&) = delete;
+
+	/// Reads buffered data, calling the underlying reader at most once. Reads
+	/// which are at least as large as the buffer bypass it when it is empty.
+	int read(slice<char> buf, error *err = &default_error) override;
+
+	/// Returns the next `n` bytes without consuming them, reading more as
+	/// needed. The result is shorter than `n` only at the end of the input
+	/// or on failure. `n` must not exceed the buffer size. The slice is valid
+	/// until the next call on the reader.
+	slice<const char> peek(int n, error *err = &default_error);
+
+	/// Consumes up to `n` bytes without copying them. Returns the number of
+	/// bytes skipped, or -1 and sets `err` on failure.
+	int discard(int n, error *err = &default_error);
+
+	/// Appends the bytes up to and including the first `delim` to `out`.
+	/// Returns the number of bytes appended, which is 0 only at the end of the
+	/// input. The last line of the input may lack the delimiter. Returns -1
+	/// and sets `err` on failure.
+	int read_until(char delim, string *out, error *err = &default_error);
+
+	/// Returns the number of bytes which can be read without calling the
+	/// underlying reader.
+	int buffered() const { return _end - _begin; }
+};
+
+//============================================================================
+// buffered_writer
+//============================================================================
+
+/// Adds a buffer to a writer, so that small writes are combined into large
+/// ones. The data reaches the underlying writer when the buffer fills up or
+/// on flush(). The destructor flushes too, but it has nowhere to report
+/// failures, so call flush() explicitly when they matter.
+///
+/// When a write doesn't fit, the buffered data and the new data are passed to
+/// the underlying writer in a single writev() call.
+class buffered_writer : public writer {
+	writer *_w;
+	char *_buf;
+	int _size;
+	int _len = 0;
+
+	int _write_through(slice<const slice<const char>> bufs, int n, error *err);
+
+public:
+	/// Constructs a writer writing to `w` through a buffer of `size` bytes.
+	explicit buffered_writer(writer &w, int size = default_buffer_size);
+	~buffered_writer();
+
+	buffered_writer(const buffered_writer&) = delete;
+	buffered_writer &operator=(const buffered_writer&) = delete;
+
+	int write(slice<const char> buf, error *err = &default_error) override;
+	int writev(slice<const slice<const char>> bufs, error *err = &default_error) override;
+
+	/// Writes a single byte.
+	int write_byte(char c, error *err = &default_error) {
+		if (_len == _size && flush(err) < 0) {
+			return -1;
+		}
+		_buf[_len++] = c;
+		return 1;
+	}
+
+	/// Writes the buffered data to the underlying writer. Returns 0, or -1
+	/// and sets `err` on failure. The buffer is empty afterwards either way,
+	/// since part of the data may have been written.
+	int flush(error *err = &default_error);
+
+	/// Returns the free space at the end of the buffer, flushing it first if
+	/// less than `n` bytes are free. Data written there becomes part of the
+	/// output with commit(). `n` must not exceed the buffer size. Returns an
+	/// empty slice and sets `err` if the flush fails.
+	slice<char> reserve(int n, error *err = &default_error);
+
+	/// Appends `n` bytes written to the slice returned by reserve().
+	void commit(int n) {
+		_ZBS_ASSERT(n >= 0 && n <= _size - _len);
+		_len += n;
+	}
+
+	/// Returns the number of bytes waiting to be flushed.
+	int buffered() const { return _len; }
+
+	/// Returns the size of the buffer.
+	int size() const { return _size; }
+};
+
+}} // namespace zbs::io
@@ -6,6 +6,9 @@
 #include "zbs/_error.hh"
 #include "zbs/_optional.hh"
 #include "zbs/_func.hh"
+#include "zbs/_string.hh"
+#include "zbs/_map.hh"
+#include <atomic>
 #include <memory>
 
 namespace zbs {
@@ -33,14 +36,41 @@ enum class ast_type : byte {
 	capture,    // capture
 };
 
+struct ast_node;
+
+// Reference counted pointer to an ast_node. Nodes are immutable once they are
+// part of an ast, so asts built from the same parts share them instead of
+// copying.
+class ast_ptr {
+	const ast_node *_p = nullptr;
+
+public:
+	ast_ptr() = default;
+	// takes a new node, or one shared with other pointers
+	explicit ast_ptr(const ast_node *p);
+	ast_ptr(const ast_ptr &r): ast_ptr(r._p) {}
+	ast_ptr(ast_ptr &&r): _p(r._p) { r._p = nullptr; }
+	~ast_ptr();
+
+	ast_ptr &operator=(ast_ptr r) {
+		std::swap(_p, r._p);
+		return *this;
+	}
+
+	const ast_node *get() const { return _p; }
+	const ast_node *operator->() const { return _p; }
+	const ast_node &operator*() const { return *_p; }
+	explicit operator bool() const { return _p != nullptr; }
+};
+
 // PEG AST node
 struct ast_node {
 	static constexpr int shortbuf_len = sizeof(char*);
 
 	ast_type type;
 
-	// literal, set:
-	//    length of the buffer
+	// literal, set, call:
+	//    length of the buffer (the rule name for calls)
 	// any:
 	//    number of any matches (optimization)
 	// repetition:
@@ -49,8 +79,11 @@ struct ast_node {
 	//    capture type
 	int len;
 
-	std::unique_ptr<ast_node> left;
-	std::unique_ptr<ast_node> right;
+	ast_ptr left;
+	ast_ptr right;
+
+	// number of ast_ptr pointing to the node
+	mutable std::atomic<int> refs{0};
 
 	// short buffer optimization here, don't allocate the buffer for a
 	// string unless its length is greater than shortbuf_len
@@ -73,15 +106,25 @@ struct ast_node {
 	ast_node &operator=(ast_node&&) = delete;
 	ast_node &operator=(const ast_node&) = delete;
 
-	// valid for literal and set
+	// valid for literal, set and call
 	slice<char> buffer();
 	slice<const char> buffer() const;
-
-	ast_node *clone() const;
 };
 
+inline ast_ptr::ast_ptr(const ast_node *p): _p(p) {
+	if (_p)
+		_p->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline ast_ptr::~ast_ptr() {
+	if (_p && _p->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		delete _p;
+}
+
+// Copying an ast is cheap, the copy shares the nodes, and so do the asts
+// the operators below build from it.
 struct ast {
-	std::unique_ptr<ast_node> p;
+	ast_ptr p;
 
 	ast() = delete;
 	ast(const char *str);
@@ -150,14 +193,65 @@ ast operator&(ast &&arg);
 ast operator!(const ast &arg);
 ast operator!(ast &&arg);
 
+// V(name) - matches the rule 'name' of the grammar being compiled, rules may
+// refer to each other and to themselves
+ast V(const char *name);
+
 void dump(const ast &a);
 
+class program;
+
+// A set of named rules, which makes recursive patterns such as nested
+// brackets or arithmetic expressions possible:
+//
+//     grammar g;
+//     g.rule("expr", V("term") >> *(S("+-") >> V("term")));
+//     g.rule("term", R("09") | "(" >> V("expr") >> ")");
+//     matcher m = compile(g);
+//
+// Matching starts with the first rule. Left recursive rules, which could call
+// themselves without consuming input, are rejected by compile().
+class grammar {
+	friend program compile(const grammar &g, error *err);
+
+	struct _rule {
+		string name;
+		ast_ptr def;
+		bool memoize;
+	};
+	vector<_rule> _rules;
+
+public:
+	grammar() = default;
+	grammar(grammar&&) = default;
+	grammar(const grammar&) = delete;
+	~grammar();
+
+	grammar &operator=(grammar&&) = delete;
+	grammar &operator=(const grammar&) = delete;
+
+	// Adds the rule 'name' defined as 'def'. If 'memoize' is set, the result
+	// of the rule at each input position is remembered during a match, so
+	// that backtracking never applies it at the same position twice
+	// (packrat parsing). It bounds the time spent in the rule to linear at
+	// the cost of memory proportional to the input length.
+	grammar &rule(const char *name, const ast &def, bool memoize = false);
+	grammar &rule(const char *name, ast &&def, bool memoize = false);
+};
+
 enum class capture_type : int {
 	group,
 	simple,
 	close,
 };
 
+// The state of a streaming match, see matcher::feed().
+enum class match_status {
+	fail,
+	match,
+	need_more_input,
+};
+
 class capturer {
 public:
 	virtual ~capturer();
@@ -190,7 +284,89 @@ public:
 	vector<slice<const char>> result() { return std::move(_result); }
 };
 
-class bytecode {
+// A capture in a capture_tree. Groups span the input from where they were
+// opened to where they were closed.
+struct capture_node {
+	int begin; // offsets into the input
+	int end;
+	int parent; // index of the enclosing capture, -1 at the top level
+	bool group;
+};
+
+// The captures of a match, listed in the order they were opened, so that
+// captures precede the ones nested in them. A flat alternative to a
+// capturer, which costs a virtual call per capture and usually a copy into a
+// vector on top.
+class capture_tree {
+	slice<const char> _input;
+	slice<const capture_node> _nodes;
+
+public:
+	capture_tree(slice<const char> input, slice<const capture_node> nodes):
+		_input(input), _nodes(nodes) {}
+
+	int len() const { return _nodes.len(); }
+	const capture_node &operator[](int i) const { return _nodes[i]; }
+	slice<const capture_node> nodes() const { return _nodes; }
+
+	// Returns the captured part of the input.
+	slice<const char> text(int i) const {
+		return _input.sub(_nodes[i].begin, _nodes[i].end);
+	}
+};
+
+class matcher;
+
+// A compiled pattern. It never changes after compilation, so it may be used
+// by any number of matchers on any number of threads at the same time.
+// Copies share the code, copying is cheap.
+class program {
+public:
+	// The entry point of the code generate_cpp() produces.
+	using native_func = bool (*)(matcher &m, slice<const char> input);
+
+private:
+	friend class matcher;
+	friend program compile(const ast &tree, error *err);
+	friend program compile(const grammar &g, error *err);
+	friend string generate_cpp(const program &p, const char *name, error *err);
+
+	// What the matches start with, so that searches skip the positions
+	// where there can't be one.
+	struct scan_t {
+		// the program may match the empty string, or nothing is known
+		bool anywhere = true;
+		// a match starts with this literal, or else with a byte of the
+		// set, rows[c & 15 | (c & 128) >> 3] has bit (c >> 4 & 7) set
+		// for its bytes c
+		string prefix;
+		uint8 rows[32] = {};
+	};
+
+	struct data {
+		vector<byte> code;
+		native_func native_match;
+		scan_t scan;
+	};
+	std::shared_ptr<const data> d;
+
+	program(vector<byte> code, scan_t scan);
+
+public:
+	program() = delete;
+	explicit program(vector<byte> code);
+	explicit program(native_func f);
+};
+
+// Matches input against a program. Holds the state of a match, the
+// backtrack stack and the captures, which is reused by the following
+// matches, so that a matcher doesn't allocate once it has warmed up. A
+// matcher must not be used by several threads at once, use one per thread.
+class matcher {
+public:
+	struct native;
+
+private:
 	struct stack_t {
 		slice<const char> input;
 		int offset;
@@ -202,23 +378,126 @@ class bytecode {
 		int offset;
 	};
 
-	vector<byte> code;
+	// result of a memoized rule at some position, 'end' is -1 if the rule
+	// failed, otherwise its captures are in memo_captures
+	struct memo_t {
+		int end;
+		int captures_offset;
+		int captures_len;
+	};
+
+	struct memo_hash {
+		int operator()(uint64 key, int seed) const;
+	};
+
+	// state of a streaming match between chunks
+	struct stream_t {
+		// the part of the input still needed by the match, which starts
+		// at 'offset' in the stream
+		vector<char> buf;
+		int64 offset = 0;
+		// where to continue, 'input' is relative to 'buf'
+		int pc = 0;
+		int input = 0;
+		// the data of the captures [0, flushed), which no longer are in
+		// 'buf', their offsets point into 'captured'
+		vector<char> captured;
+		int flushed = 0;
+		int64 end = 0;
+		match_status status = match_status::fail;
+	};
+
+	program prog;
 	vector<stack_t> stack;
 	vector<capture_t> captures;
 	slice<const char> initial_input;
-	void apply_captures(capturer *c) const;
+	map<uint64, memo_t, memo_hash> memo;
+	vector<capture_t> memo_captures;
+	stream_t stream;
+	vector<capture_node> tree;
+
+	void reset();
+	match_status run(int *pc, slice<const char> *input, bool more);
+	match_status resume(slice<const char> chunk, bool more);
+	void rebase(const char *from, slice<const char> to);
+	void flush_captures(int end);
+	int skip(slice<const char> input, int pos) const;
+	bool match_at(slice<const char> input, int pos, int *end);
+	bool search(slice<const char> input, int pos, int last_end, int *begin,
+		int *end);
 
 public:
-	bytecode() = delete;
-	explicit bytecode(vector<byte> code): code(code) {}
-	bytecode(bytecode&&) = default;
-	bytecode(const bytecode&) = default;
+	matcher() = delete;
+	matcher(program p): prog(std::move(p)) {}
+	matcher(matcher&&) = default;
+	matcher(const matcher &r);
 
-	bytecode &operator=(bytecode&&) = default;
-	bytecode &operator=(const bytecode&) = default;
+	matcher &operator=(matcher&&) = default;
+	matcher &operator=(const matcher &r);
+
+	const program &get_program() const { return prog; }
 
 	bool match(slice<const char> input);
 
+	// Searches 'input' for the first position the program matches at,
+	// trying them from left to right, byte by byte. Returns the matched part
+	// of 'input', the captures are those of that match. The positions a
+	// match can't start at, judging by its first byte or literal prefix, are
+	// skipped without running the program.
+	optional<slice<const char>> find(slice<const char> input);
+
+	// Calls 'f' for every match in 'input', from left to right. The search
+	// continues where the previous match ended, an empty match right there
+	// doesn't count. 'f' may take the captures of the match with
+	// apply_captures(). Returns the number of matches.
+	int gmatch(slice<const char> input, func<void (slice<const char> match)> f);
+
+	// Returns the matches gmatch() finds.
+	vector<slice<const char>> find_all(slice<const char> input);
+
+	// Streaming matches take the input in chunks, as it is read from a file
+	// or arrives from the network:
+	//
+	//     m.start();
+	//     match_status s = match_status::need_more_input;
+	//     while (s == match_status::need_more_input && read_chunk(&chunk))
+	//         s = m.feed(chunk);
+	//     if (s == match_status::need_more_input)
+	//         s = m.finish();
+	//
+	// The result is the same as matching the concatenated chunks at once,
+	// but the matcher keeps only the input its backtrack entries may return
+	// to, so that streams of any size can be matched in bounded memory if
+	// the pattern commits to its choices. Captures are copied out of the
+	// chunks when the input they refer to is dropped, the others stay where
+	// they are. The chunks are not referenced after feed() returns.
+	//
+	// feed() returns need_more_input when the match can't be decided with
+	// the input seen so far, finish() marks the end of the input and decides
+	// it. Once the result is known, it is returned again by both. Programs
+	// made by generate_cpp() can't suspend, their input is kept until
+	// finish(). match() abandons a streaming match.
+	void start();
+	match_status feed(slice<const char> chunk);
+	match_status finish();
+
+	// Returns the length of the part of the stream matched by the last
+	// successful streaming match.
+	int64 stream_matched() const { return stream.end; }
+
+	// Passes the captures of the last successful match to 'c'.
+	void apply_captures(capturer *c) const;
+
+	// Returns the captures of the last successful match as a tree. The nodes
+	// are placed in 'buf' if it is large enough, in the matcher otherwise,
+	// where they stay until the next call. Not available for streaming
+	// matches which had to copy their captures, use apply_captures().
+	capture_tree captures_tree(slice<capture_node> buf = {});
+
+	// Matches 'input' and returns its captures as captures_tree() does.
+	optional<capture_tree> match_tree(slice<const char> input,
+		slice<capture_node> buf = {});
+
 	template <typename T = sequential_capturer<>, typename ...Args>
 	optional<typename std::result_of<decltype(&T::result)(T)>::type>
 	capture(slice<const char> input, Args &&...args) {
@@ -231,6 +510,102 @@ public:
 	}
 };
 
-bytecode compile(const ast &tree, error *err = &default_error);
+// A matcher with its own program, what a compiled pattern used to be before
+// the two were split.
+using bytecode = matcher;
+
+// The operations of the VM instructions, used by the code generate_cpp()
+// produces. Not meant to be used otherwise.
+struct matcher::native {
+	static void choice(matcher &m, slice<const char> input, int label) {
+		m.stack.append({input, label, m.captures.len()});
+	}
+	static void commit(matcher &m) {
+		m.stack.resize(m.stack.len()-1);
+	}
+	static void partial_commit(matcher &m, slice<const char> input) {
+		auto &last = m.stack[m.stack.len()-1];
+		last.input = input;
+		last.captures_len = m.captures.len();
+	}
+	static slice<const char> rewind_commit(matcher &m) {
+		const slice<const char> input = m.stack[m.stack.len()-1].input;
+		m.captures.resize(m.stack[m.stack.len()-1].captures_len);
+		m.stack.resize(m.stack.len()-1);
+		return input;
+	}
+	static void capture(matcher &m, capture_type t, slice<const char> input) {
+		m.captures.append({t, int(input.data() - m.initial_input.data())});
+	}
+	static void call(matcher &m, int label) {
+		m.stack.append({{}, label, -1});
+	}
+	// returns the label to return to
+	static int return_(matcher &m) {
+		const int label = m.stack[m.stack.len()-1].offset;
+		m.stack.resize(m.stack.len()-1);
+		return label;
+	}
+	// reports whether 'r' is in one of the 'n' sorted ranges, pairs of
+	// from, to
+	static bool in_ranges(const rune *ranges, int n, rune r) {
+		int lo = 0;
+		int hi = n;
+		while (lo < hi) {
+			const int mid = (lo + hi) / 2;
+			if (r < ranges[mid*2])
+				hi = mid;
+			else if (r > ranges[mid*2+1])
+				lo = mid + 1;
+			else
+				return true;
+		}
+		return false;
+	}
+	static bool end(matcher &m, slice<const char> input) {
+		m.stream.end = input.data() - m.initial_input.data();
+		return true;
+	}
+
+	// Backtracks to the last choice. Returns false if there is none, the
+	// match failed then.
+	static bool fail(matcher &m, slice<const char> *input, int *label);
+
+	// Returns -1 if the rule wasn't applied at 'input' yet, a choice
+	// backtracking to 'label' is pushed then. Otherwise returns whether it
+	// succeeded, repeating its captures and advancing 'input' if it did.
+	static int memo_enter(matcher &m, int rule, slice<const char> *input,
+		int label);
+	static void memo_commit(matcher &m, int rule, slice<const char> input);
+	static void memo_fail(matcher &m, int rule, slice<const char> input);
+};
+
+program compile(const ast &tree, error *err = &default_error);
+program compile(const grammar &g, error *err = &default_error);
+
+// Matches every input against 'p', spreading them over 'threads' threads (as
+// many as there are cores if 0), each with a matcher of its own. Returns
+// whether each input matched.
+vector<bool> match_many(const program &p, slice<const slice<const char>> inputs,
+	int threads = 0);
+
+// Calls 'f' after matching each input, with its index, the matcher holding
+// its captures and the result. 'f' is called from the worker threads
+// concurrently.
+void match_many(const program &p, slice<const slice<const char>> inputs,
+	func<void (int i, matcher &m, bool ok)> f, int threads = 0);
+
+// Translates 'p' into C++ source, for patterns known at build time. The
+// choices become branches, sets become switches and the instructions are
+// laid out as straight-line code, so that nothing is decoded at match time.
+// The source defines
+//
+//     zbs::peg::program <name>();
+//
+// which returns a program matching the same way as 'p'. 'name' must be a C++
+// identifier. Typically a small program builds the grammar and writes the
+// source as part of the build, see tools/makepegtest.cc.
+string generate_cpp(const program &p, const char *name,
+	error *err = &default_error);
 
 }} // namespace zbs::peg
@@ -4,26 +4,240 @@
 #include "_string.hh"
 #include "_vector.hh"
 #include "_func.hh"
+#include "unicode/utf8.hh"
 
 namespace zbs {
+namespace unicode {
+
+struct range_table;
+
+} // namespace zbs::unicode
+
 namespace strings {
 
+/// A set of runes compiled once for repeated use by index_any, last_index_any,
+/// contains_any and the trim family. ASCII members are kept in a bitmap, others
+/// in a sorted list or a range table. Overloads taking a plain `chars` or
+/// `cutset` slice compile a temporary set on each call.
+class char_set {
+	// _ascii[c & 15] has bit (c >> 4) set for every ASCII member c.
+	uint8 _ascii[16];
+	vector<rune> _runes;
+	const unicode::range_table *_table = nullptr;
+
+	void _add_ascii(uint8 c) { _ascii[c & 15] |= 1 << (c >> 4); }
+	bool _has_ascii(uint8 c) const { return _ascii[c & 15] & (1 << (c >> 4)); }
+	int _scan(slice<const char> s, bool in) const;
+	int _scan_last(slice<const char> s, bool in) const;
+
+public:
+	/// Constructs an empty set.
+	char_set();
+
+	/// Constructs a set of the UTF-8 encoded runes in `chars`. Invalid bytes
+	/// add utf8::rune_error.
+	explicit char_set(slice<const char> chars);
+
+	/// Constructs a set of the runes in `table`. The table is referenced, not
+	/// copied, and must outlive the set.
+	explicit char_set(const unicode::range_table &table);
+
+	/// Reports whether `r` is in the set.
+	bool contains(rune r) const;
+
+	/// Reports whether all members of the set are ASCII.
+	bool is_ascii() const { return _runes.len() == 0 && _table == nullptr; }
+
+	/// Returns the length of the leading part of `s` consisting of runes in
+	/// the set.
+	int span(slice<const char> s) const;
+
+	/// Returns the length of the leading part of `s` consisting of runes not
+	/// in the set.
+	int cspan(slice<const char> s) const;
+
+	/// Returns the offset of the trailing part of `s` consisting of runes in
+	/// the set.
+	int rspan(slice<const char> s) const;
+
+	/// Returns the offset of the trailing part of `s` consisting of runes not
+	/// in the set.
+	int rcspan(slice<const char> s) const;
+};
+
+
+/// A buffer for building strings efficiently with minimal memory copying.
+/// Grows by doubling. The contents are handed over to a string with take(),
+/// without copying.
+class builder {
+	char *_data = nullptr;
+	int _len = 0;
+	int _cap = 0; // the allocation has one extra byte for the terminating zero
+
+	void _grow(int n);
+	char *_extend(int n) {
+		if (_len + n > _cap) {
+			_grow(n);
+		}
+		char *p = _data + _len;
+		_len += n;
+		return p;
+	}
+
+public:
+	builder() = default;
+	builder(const builder&) = delete;
+	builder(builder &&r);
+	~builder();
+
+	builder &operator=(const builder&) = delete;
+	builder &operator=(builder &&r);
+
+	/// Returns the number of accumulated bytes.
+	int len() const { return _len; }
+
+	/// Returns the number of bytes which can be accumulated without
+	/// reallocation.
+	int cap() const { return _cap; }
+
+	/// Returns the accumulated bytes. The slice is valid until the next
+	/// modification of the builder.
+	slice<const char> sub() const { return {_data, _len}; }
+
+	/// Grows the capacity, if necessary, to guarantee space for another `n`
+	/// bytes.
+	void grow(int n);
+
+	/// Discards the accumulated bytes, but keeps the allocated memory.
+	void reset() { _len = 0; }
+
+	/// Appends the contents of `s`.
+	void write(slice<const char> s);
+
+	/// Appends the byte `c`.
+	void write_byte(char c) { *_extend(1) = c; }
+
+	/// Appends the UTF-8 encoding of `r`. Invalid runes are encoded as
+	/// utf8::rune_error.
+	void write_rune(rune r);
+
+	/// Appends the string form of `v` in the given `base` (2 to 36), lower-case
+	/// letters are used for digit values >= 10.
+	void write_int(int64 v, int base = 10);
+
+	/// Unsigned version of write_int.
+	void write_uint(uint64 v, int base = 10);
+
+	/// Appends the string form of `v` according to the format `fmt` ('e', 'f'
+	/// or 'g', as in printf) and precision `prec`. A negative `prec` uses the
+	/// smallest number of digits necessary to represent the value exactly.
+	void write_float(double v, char fmt = 'g', int prec = -1);
+
+	/// Transfers the accumulated bytes to a string, without copying. The
+	/// builder is empty afterwards.
+	string take();
+};
+
+/// A precompiled list of old/new string pairs, replacing all occurrences of
+/// the old strings in a single pass. Replacements happen in the order the old
+/// strings appear in the input, without overlapping; when several old strings
+/// match at the same offset, the one passed first wins.
+class replacer {
+	enum class kind : byte {
+		byte_map,    // all old and new strings are single bytes
+		byte_string, // all old strings are single bytes
+		single,      // a single pair with a multi-byte old string
+		generic,     // a trie
+	};
+
+	kind _kind;
+	vector<string> _old;
+	vector<string> _new;
+
+	// byte_map and byte_string modes
+	uint8 _byte_map[256];
+	int16 _byte_pair[256]; // index of the pair replacing the byte, or -1
+
+	// generic mode, a trie of old strings; bytes which occur in old strings
+	// are mapped to dense slot numbers, a node has _trie_width child slots
+	uint16 _trie_slot[256];
+	int _trie_width = 0;
+	vector<int> _trie_next;  // node*_trie_width+slot -> child node or 0
+	vector<int> _trie_value; // node -> index of the pair, or -1
+
+	int _lookup(slice<const char> s, bool ignore_root, int *len) const;
+	void _replace_generic(builder &out, slice<const char> s) const;
+
+public:
+	/// Constructs a replacer from a list of old, new string pairs:
+	/// {old1, new1, old2, new2, ...}. The strings are copied.
+	explicit replacer(slice<const slice<const char>> oldnew);
+
+	/// Returns a copy of `s` with all replacements performed.
+	string replace(slice<const char> s) const;
+
+	/// Writes `s` with all replacements performed to `out`.
+	void replace(builder &out, slice<const char> s) const;
+};
+
+/// Maps byte offsets in a text to line and column numbers. The offsets of all
+/// newlines are collected once, in a single pass over the text, lookups are
+/// binary searches over them. Lines and columns are counted from 1, columns
+/// are in bytes. The text itself is not referenced.
+class line_index {
+	vector<int> _newlines;
+	int _len = 0;
+
+public:
+	struct position {
+		int line;
+		int column;
+	};
+
+	/// Constructs an index of an empty text.
+	line_index() = default;
+
+	/// Constructs an index of `text`.
+	explicit line_index(slice<const char> text);
+
+	/// Returns the number of lines, which is the number of newlines plus one.
+	int line_count() const { return _newlines.len() + 1; }
+
+	/// Returns the line and column of the byte at `offset`. The offset must be
+	/// in the range [0, len(text)].
+	position position_of(int offset) const;
+
+	/// Returns the offset of the first byte of `line`, which must be in the
+	/// range [1, line_count()].
+	int line_start(int line) const;
+};
+
 bool              contains(slice<const char> s, slice<const char> substr);
 bool              contains_any(slice<const char> s, slice<const char> chars);
+bool              contains_any(slice<const char> s, const char_set &chars);
+bool              contains_fold(slice<const char> s, slice<const char> substr);
 bool              contains_rune(slice<const char> s, rune r);
 int               count(slice<const char> s, slice<const char> sep);
+int               count_byte(slice<const char> s, char c);
+int               count_fold(slice<const char> s, slice<const char> sep);
 bool              equal_fold(slice<const char> a, slice<const char> b);
 vector<string>    fields(slice<const char> s);
 vector<string>    fields_func(slice<const char> s, func<bool(rune)> f);
+string            fold_key(slice<const char> s);
 bool              starts_with(slice<const char> s, slice<const char> prefix);
 bool              ends_with(slice<const char> s, slice<const char> suffix);
 int               index(slice<const char> s, slice<const char> sep);
+void              index_all_bytes(slice<const char> s, char c, vector<int> *out);
 int               index_any(slice<const char> s, slice<const char> chars);
+int               index_any(slice<const char> s, const char_set &chars);
+int               index_fold(slice<const char> s, slice<const char> sep);
 int               index_func(slice<const char> s, func<bool(rune)> f);
+int               index_byte(slice<const char> s, char c);
 int               index_rune(slice<const char> s, rune r);
 string            join(slice<const string> a, slice<const char> sep);
 int               last_index(slice<const char> s, slice<const char> sep);
 int               last_index_any(slice<const char> s, slice<const char> chars);
+int               last_index_any(slice<const char> s, const char_set &chars);
 int               last_index_func(slice<const char> s, func<bool(rune)> f);
 string            map(func<rune(rune)> f, slice<const char> s);
 string            repeat(slice<const char> s, int count);
@@ -40,13 +254,145 @@ string            to_upper(slice<const char> s);
 //string          to_title_special(unicode::special_case case, slice<const char> s);
 //string          to_upper_special(unicode::special_case case, slice<const char> s);
 slice<const char> trim(slice<const char> s, slice<const char> cutset);
+slice<const char> trim(slice<const char> s, const char_set &cutset);
 slice<const char> trim_func(slice<const char> s, func<bool(rune)> f);
 slice<const char> trim_left(slice<const char> s, slice<const char> cutset);
+slice<const char> trim_left(slice<const char> s, const char_set &cutset);
 slice<const char> trim_left_func(slice<const char> s, func<bool(rune)> f);
 slice<const char> trim_right(slice<const char> s, slice<const char> cutset);
+slice<const char> trim_right(slice<const char> s, const char_set &cutset);
 slice<const char> trim_right_func(slice<const char> s, func<bool(rune)> f);
 slice<const char> trim_space(slice<const char> s);
 slice<const char> trim_prefix(slice<const char> s, slice<const char> prefix);
 slice<const char> trim_suffix(slice<const char> s, slice<const char> suffix);
 
+} // namespace zbs::strings
+
+namespace detail {
+
+template <typename F>
+int index_if(slice<const char> s, F &f, bool truth) {
+	int start = 0;
+	while (start < s.len()) {
+		sized_rune r {s[start], 1};
+		if (uint8(r.rune) >= unicode::utf8::rune_self) {
+			r = unicode::utf8::decode_rune(s.sub(start));
+		}
+		if (bool(f(r.rune)) == truth) {
+			return start;
+		}
+		start += r.size;
+	}
+	return -1;
+}
+
+template <typename F>
+int last_index_if(slice<const char> s, F &f, bool truth) {
+	for (int i = s.len(); i > 0;) {
+		sized_rune r {s[i-1], 1};
+		if (uint8(r.rune) >= unicode::utf8::rune_self) {
+			r = unicode::utf8::decode_last_rune(s.sub(0, i));
+		}
+		i -= r.size;
+		if (bool(f(r.rune)) == truth) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+} // namespace zbs::detail
+
+namespace strings {
+
+// Template versions of the *_func functions. The predicate (or mapping) is
+// called directly instead of through func<>, which allows the compiler to
+// inline it into the loop. Prefer the func<> versions unless the call overhead
+// matters.
+
+template <typename F>
+int index_if(slice<const char> s, F f) {
+	return detail::index_if(s, f, true);
+}
+
+template <typename F>
+int last_index_if(slice<const char> s, F f) {
+	return detail::last_index_if(s, f, true);
+}
+
+template <typename F>
+slice<const char> trim_left_if(slice<const char> s, F f) {
+	int i = detail::index_if(s, f, false);
+	if (i == -1) {
+		return {};
+	}
+	return s.sub(i);
+}
+
+template <typename F>
+slice<const char> trim_right_if(slice<const char> s, F f) {
+	int i = detail::last_index_if(s, f, false);
+	if (i >= 0 && uint8(s[i]) >= unicode::utf8::rune_self) {
+		i += unicode::utf8::decode_rune(s.sub(i)).size;
+	} else {
+		i++;
+	}
+	return s.sub(0, i);
+}
+
+template <typename F>
+slice<const char> trim_if(slice<const char> s, F f) {
+	return trim_right_if(trim_left_if(s, f), f);
+}
+
+template <typename F>
+vector<string> fields_if(slice<const char> s, F f) {
+	int n = 0;
+	bool in_field = false;
+	for (const auto &it : string_iter(s)) {
+		bool was_in_field = in_field;
+		in_field = !f(it.rune);
+		if (in_field && !was_in_field) {
+			n++;
+		}
+	}
+
+	vector<string> a;
+	a.reserve(n);
+
+	int field_start = -1;
+	for (const auto &it : string_iter(s)) {
+		if (f(it.rune)) {
+			if (field_start >= 0) {
+				a.append(s.sub(field_start, it.offset));
+				field_start = -1;
+			}
+		} else if (field_start == -1) {
+			field_start = it.offset;
+		}
+	}
+	if (field_start >= 0) {
+		// last field might end at EOF
+		a.append(s.sub(field_start));
+	}
+	return a;
+}
+
+// Template version of map.
+template <typename F>
+string transform(F f, slice<const char> s) {
+	string out;
+	out.reserve(s.len());
+
+	for (const auto &it : string_iter(s)) {
+		rune r = f(it.rune);
+		if (r >= 0) {
+			char tmp[unicode::utf8::utf_max];
+			int n = unicode::utf8::encode_rune(tmp, r);
+			out.append(slice<char>(tmp).sub(0, n));
+		}
+	}
+	return out;
+}
+
 }} // namespace zbs::strings
@@ -3,6 +3,8 @@
 #include "_types.hh"
 #include "_slice.hh"
 #include "_map.hh"
+#include "_string.hh"
+#include "_vector.hh"
 
 namespace zbs {
 namespace unicode {
@@ -142,6 +144,20 @@ bool is_upper(rune r);
 ///     simple_fold(U'1') = U'1'
 rune simple_fold(rune r);
 
+/// Maps r to the canonical member of its simple case folding orbit, which is
+/// usually the lower case form. Two runes are equivalent under simple case
+/// folding if and only if their canonical members are equal, which makes it
+/// possible to compare or hash case-insensitive text one rune at a time
+/// without walking the orbit via simple_fold.
+///
+/// For example:
+///
+///     fold_canonical(U'A') = U'a'
+///     fold_canonical(U'\u212A') = U'k' (Kelvin symbol, K)
+///     fold_canonical(U'\u03C2') = U'\u03C3' (final sigma, ς)
+///     fold_canonical(U'1') = U'1'
+rune fold_canonical(rune r);
+
 /// Maps r to the specified _case: upper_case, lower_case, or title_case.
 rune to(case_t _case, rune r);
 
@@ -154,6 +170,86 @@ rune to_title(rune r);
 /// Maps r to upper case.
 rune to_upper(rune r);
 
+/// Unicode normalization forms, see http://www.unicode.org/reports/tr15/.
+enum norm_form {
+	NFC,  ///< Canonical decomposition, followed by canonical composition.
+	NFD,  ///< Canonical decomposition.
+	NFKC, ///< Compatibility decomposition, followed by canonical composition.
+	NFKD, ///< Compatibility decomposition.
+};
+
+/// Reports whether `s` is in the normalization form `f`.
+bool is_normalized(norm_form f, slice<const char> s);
+
+/// Returns `s` in the normalization form `f`. Most of the text is usually
+/// normalized already, it is checked with a quick scan. If all of `s` is
+/// normalized, it is returned as is and `buf` is not used. Otherwise the result
+/// is written to `buf` and a slice of `buf` is returned. Invalid UTF-8 bytes
+/// are passed through unchanged.
+slice<const char> normalize(norm_form f, slice<const char> s, string *buf);
+
+/// Returns a copy of `s` in the normalization form `f`.
+string normalize(norm_form f, slice<const char> s);
+
+/// Represents an inclusive range of Unicode code points from lo to hi.
+struct rune_range {
+	rune lo;
+	rune hi;
+};
+
+/// A set of Unicode code points compiled for constant time membership tests.
+/// Latin-1 members are kept in a flat bitmap, the rest of the BMP in a
+/// two-level bitmap in which identical blocks of 256 code points are shared,
+/// and members above the BMP in a sorted list of ranges. Sets are compiled
+/// from range tables, runes or ranges and combined with `|` and `-`.
+///
+/// For example:
+///
+///     rune_set ident = rune_set(letter) | rune_set(digit) |
+///             rune_set(slice<const rune>({U'_'}));
+///     int n = ident.span(s);
+class rune_set {
+	vector<rune_range> _ranges; // sorted, neither overlapping nor adjacent
+	int _astral = 0;            // the first range which ends above the BMP
+	uint64 _latin1[4];
+	uint8 _ascii[16];           // _ascii[c & 15] has bit (c >> 4) set for members
+	uint16 _bmp_index[256];     // block of every 256 code points in _bmp_blocks
+	vector<uint64> _bmp_blocks; // 4 words per block, 0 is empty and 1 is full
+
+	void _compile();
+
+public:
+	/// Constructs an empty set.
+	rune_set();
+
+	/// Constructs a set of the code points in `table`.
+	explicit rune_set(const range_table &table);
+
+	/// Constructs a set of `runes`, which don't need to be sorted or unique.
+	explicit rune_set(slice<const rune> runes);
+
+	/// Constructs a set of the code points in `ranges`, which may overlap and
+	/// don't need to be sorted. Empty ranges (lo > hi) are ignored.
+	explicit rune_set(slice<const rune_range> ranges);
+
+	/// Reports whether `r` is in the set.
+	bool contains(rune r) const;
+
+	/// Returns the length of the leading part of `s` consisting of code points
+	/// in the set. Invalid UTF-8 bytes are treated as replacement_char.
+	int span(slice<const char> s) const;
+
+	/// Returns the sorted list of ranges in the set. The ranges neither overlap
+	/// nor are adjacent, so two sets are equal if their ranges are equal.
+	slice<const rune_range> ranges() const { return _ranges; }
+};
+
+/// Returns the union of `a` and `b`.
+rune_set operator|(const rune_set &a, const rune_set &b);
+
+/// Returns the code points in `a` which are not in `b`.
+rune_set operator-(const rune_set &a, const rune_set &b);
+
 }} // namespace zbs::unicode
 
 #include "_unicode_tables.hh"
@@ -67,6 +67,73 @@ bool valid(slice<const char> s);
 /// out of range or surrogate half are illegal.
 bool valid_rune(rune r);
 
+/// Incremental UTF-8 decoder for input which arrives in chunks. Sequences split
+/// between chunks are carried over and decoded once the rest arrives, so the
+/// output is the same as decoding the concatenated input at once.
+///
+/// Typical use:
+///
+///     utf8::decoder d;
+///     while (read_chunk(&chunk)) {
+///         d.feed(chunk);
+///         rune r;
+///         while (d.next(&r)) {
+///             ...
+///         }
+///     }
+///     d.finish();
+///     rune r;
+///     while (d.next(&r)) {
+///         ...
+///     }
+class decoder {
+public:
+	/// A part of the input returned by next_span(). Either a run of valid
+	/// UTF-8 or a single invalid byte.
+	struct span {
+		slice<const char> data;
+		bool valid;
+	};
+
+private:
+	slice<const char> _in;
+	int _pos = 0;
+	char _pending[utf_max];
+	int _pending_len = 0;
+	char _joined[utf_max];
+	bool _eof = false;
+
+	bool _decode_pending(sized_rune *r);
+	void _carry();
+
+public:
+	/// Sets the next chunk of input. The previous chunk must be consumed
+	/// (next() or next_span() returned false). The chunk is referenced, not
+	/// copied, and must stay alive until it is consumed.
+	void feed(slice<const char> s);
+
+	/// Marks the end of the input. Carried over bytes of an incomplete
+	/// sequence are reported as errors by subsequent calls.
+	void finish();
+
+	/// Resets the decoder to its initial state.
+	void reset();
+
+	/// Reports whether bytes of an incomplete sequence are carried over.
+	bool pending() const { return _pending_len > 0; }
+
+	/// Decodes the next rune into `r`. Invalid encodings produce #rune_error,
+	/// one byte at a time, just like decode_rune(). Returns false if more input
+	/// is needed.
+	bool next(rune *r);
+
+	/// Returns the next span of the input in `s`: the longest run of valid
+	/// UTF-8 or a single invalid byte. A span never splits a rune. For runes
+	/// split between chunks, the data points into the decoder and is valid
+	/// until the next call. Returns false if more input is needed.
+	bool next_span(span *s);
+};
+
 // TODO: Go has some built-in utf8 functionality in the language like string ->
 // []rune conversions. We need these too in some form here or should we
 // implement them as u32string?
@@ -1,5 +1,9 @@
 #include "stf.hh"
 #include "zbs/fmt.hh"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 
 using namespace zbs;
 
@@ -10,3 +14,411 @@ STF_TEST("fmt::sprintf(const char*, ...)") {
 	string s = fmt::sprintf("Hello, %s: %d", "nsf", number);
 	STF_ASSERT(s == "Hello, nsf: 43");
 }
+
+STF_TEST("fmt::append(string&, const char*, ...)") {
+	string s = "log: ";
+	STF_ASSERT(fmt::append(s, "%s=%d", "x", 42) == 4);
+	STF_ASSERT(s == "log: x=42");
+	STF_ASSERT(fmt::append(s, "%s", "") == 0);
+	STF_ASSERT(fmt::append(s, ", %5.2f|%-4s|", 3.14159, "ab") == 13);
+	STF_ASSERT(s == "log: x=42,  3.14|ab  |");
+}
+
+STF_TEST("fmt::snprintf(slice<char>, const char*, ...)") {
+	char buf[8];
+	STF_ASSERT(fmt::snprintf(buf, "%d-%d", 1, 2) == 3);
+	STF_ASSERT(string(buf) == "1-2");
+	STF_ASSERT(fmt::snprintf(buf, "%s", "truncated") == 9);
+	STF_ASSERT(string(buf) == "truncat");
+	STF_ASSERT(fmt::snprintf(slice<char>(buf, 1), "%d", 12345) == 5);
+	STF_ASSERT(buf[0] == '\0');
+	STF_ASSERT(fmt::snprintf(slice<char>(), "%d", 12345) == 5);
+}
+
+struct counting_sink : fmt::sink {
+	int calls = 0;
+	string out;
+
+	void write(slice<const char> s) override {
+		calls++;
+		out.append(s);
+	}
+};
+
+static int vformat_to_helper(fmt::sink &s, const char *format, ...) {
+	va_list vl;
+	va_start(vl, format);
+	int n = fmt::vformat_to(s, format, vl);
+	va_end(vl);
+	return n;
+}
+
+STF_TEST("fmt::vformat_to(sink&, const char*, va_list)") {
+	counting_sink cs;
+	STF_ASSERT(vformat_to_helper(cs, "[%04x] %s", 255, "done") == 11);
+	STF_ASSERT(cs.out == "[00ff] done");
+	STF_ASSERT(cs.calls > 0);
+}
+
+struct point {
+	int x;
+	int y;
+};
+
+namespace zbs {
+namespace fmt {
+
+template <>
+struct formatter<point> {
+	static void format(sink &out, const point &p, const spec &s) {
+		format_to(out, "(");
+		formatter<int>::format(out, p.x, s);
+		format_to(out, ", ");
+		formatter<int>::format(out, p.y, s);
+		format_to(out, ")");
+	}
+};
+
+}} // namespace zbs::fmt
+
+STF_TEST("fmt::format(slice<const char>, const Args&...)") {
+	struct format_test {
+		string out;
+		string expected;
+	};
+	string name = "nsf";
+	slice<const char> sl = name.sub(1);
+	error err;
+	err.set("out of %s", "luck");
+	const int ints[] = {1, -2, 3};
+	format_test format_tests[] = {
+		{fmt::format(""), ""},
+		{fmt::format("plain"), "plain"},
+		{fmt::format("Hello, {}: {}", name, 43), "Hello, nsf: 43"},
+		{fmt::format("{} {} {}", sl, "lit", 'c'), "sf lit c"},
+		{fmt::format("{1} {0} {1}", "a", "b"), "b a b"},
+		{fmt::format("{{}} {}", 1), "{} 1"},
+		{fmt::format("{} {}", true, false), "true false"},
+		{fmt::format("{} {} {}", -1, 18446744073709551615ULL, int8(-128)), "-1 18446744073709551615 -128"},
+		{fmt::format("{}", (long long)-9223372036854775807LL - 1), "-9223372036854775808"},
+		{fmt::format("{:x} {:X} {:o} {:b}", 255, 255, 8, 5), "ff FF 10 101"},
+		{fmt::format("{:08x}|{:5}|{:<5}|{:^5}|{:*>5}", 0xbeef, 42, 42, 42, 42), "0000beef|   42|42   | 42  |***42"},
+		{fmt::format("{:05}|{:05}", -42, 3.5), "-0042|003.5"},
+		{fmt::format("{} {} {}", 0.1, 1e21, -2.5f), "0.1 1e+21 -2.5"},
+		{fmt::format("{:.2f} {:.3e} {:G}", 3.14159, 1234.5, 1e-10), "3.14 1.234e+03 1E-10"},
+		{fmt::format("{:>6.2f}", 3.14159), "  3.14"},
+		{fmt::format("{:5}|{:>5}|{:.2}|{:☺^7}", "ab", "ab", "Grüße", "ü"), "ab   |   ab|Gr|☺☺☺ü☺☺☺"},
+		{fmt::format("{} {:c} {:c}", U'☺', 0x263A, rune('x')), "☺ ☺ x"},
+		{fmt::format("{}", err), "out of luck"},
+		{fmt::format("[{}] {} {}", abort_error(), &err, (const error*)nullptr), "[] out of luck (null)"},
+		{fmt::format("{}", (const char*)nullptr), "(null)"},
+		{fmt::format("{}", (void*)0x1234), "0x1234"},
+		{fmt::format("{} {:x}", slice<const int>(ints), vector<int>{10, 11}), "[1 -2 3] [a b]"},
+		{fmt::format("{}", vector<string>{"a", "b"}), "[a b]"},
+		{fmt::format("{:x} {:>8}", point{10, 11}, point{1, 2}), "(a, b)   (1, 2)"},
+		{fmt::format("{} {}", 1), "1 {!MISSING}"},
+		{fmt::format("{:q} {:.} {", 1, 2), "{!BADFORMAT} {!BADFORMAT} {!BADFORMAT}"},
+		{fmt::format("} {}", 1), "{!BADFORMAT} 1"},
+		{fmt::format("{2147483648} {}", 1, 2), "{!BADFORMAT} 1"},
+		{fmt::format("{:99999999999}|{:.99999999999}", 1, 2.5), "{!BADFORMAT}|{!BADFORMAT}"},
+		{fmt::format("{:.\xC3\xA9}|{\xFF}", 2.5, 1), "{!BADFORMAT}|{!BADFORMAT}"},
+	};
+	for (const auto &test : format_tests) {
+		if (test.out != test.expected) {
+			STF_ERRORF("expected %s, got %s", test.expected.c_str(), test.out.c_str());
+		}
+	}
+
+	string s = "log:";
+	fmt::format_to(s, " {}={}", "x", 1);
+	STF_ASSERT(s == "log: x=1");
+}
+
+STF_TEST("fmt::append_int(string&, int64)") {
+	string s;
+	fmt::append_int(s, 0);
+	s.append(' ');
+	fmt::append_int(s, -7);
+	s.append(' ');
+	fmt::append_int(s, 1234567890);
+	s.append(' ');
+	fmt::append_int(s, -9223372036854775807LL - 1);
+	s.append(' ');
+	fmt::append_uint(s, 18446744073709551615ULL);
+	STF_ASSERT(s == "0 -7 1234567890 -9223372036854775808 18446744073709551615");
+
+	// every number of digits
+	uint64 v = 0;
+	for (int i = 0; i < 20; i++) {
+		v = v * 10 + (i % 9) + 1;
+		char want[32];
+		std::snprintf(want, sizeof(want), "%llu", (unsigned long long)v);
+		string got;
+		fmt::append_uint(got, v);
+		if (got != (const char*)want) {
+			STF_ERRORF("expected %s, got %s", want, got.c_str());
+		}
+	}
+}
+
+STF_TEST("fmt::append_float(string&, double, char, int)") {
+	struct float_test {
+		double v;
+		char fmt;
+		int prec;
+		const char *expected;
+	};
+	const float_test float_tests[] = {
+		{0, 'g', -1, "0"},
+		{-0.0, 'g', -1, "-0"},
+		{0, 'e', -1, "0e+00"},
+		{0, 'f', -1, "0"},
+		{1, 'g', -1, "1"},
+		{0.1, 'g', -1, "0.1"},
+		{0.3, 'e', -1, "3e-01"},
+		{1.0 / 3, 'g', -1, "0.3333333333333333"},
+		{2.0 / 3, 'f', -1, "0.6666666666666666"},
+		{123456, 'g', -1, "123456"},
+		{1e21, 'g', -1, "1e+21"},
+		{1e21, 'f', -1, "1000000000000000000000"},
+		{1.5e-5, 'g', -1, "1.5e-05"},
+		{1.5e-5, 'f', -1, "0.000015"},
+		{0.0001, 'g', -1, "0.0001"},
+		{5e-324, 'g', -1, "5e-324"},
+		{1.7976931348623157e308, 'g', -1, "1.7976931348623157e+308"},
+		{2.2250738585072014e-308, 'e', -1, "2.2250738585072014e-308"},
+		{9007199254740993.0, 'g', -1, "9007199254740992"},
+		{1e23, 'g', -1, "1e+23"},
+		{-12.5, 'e', -1, "-1.25e+01"},
+		{HUGE_VAL, 'g', -1, "inf"},
+		{-HUGE_VAL, 'f', -1, "-inf"},
+		{3.14159, 'f', 2, "3.14"},
+		{3.14159, 'e', 0, "3e+00"},
+		{1234.5, 'g', 3, "1.23e+03"},
+	};
+	for (const auto &test : float_tests) {
+		string s;
+		fmt::append_float(s, test.v, test.fmt, test.prec);
+		if (s != test.expected) {
+			STF_ERRORF("expected %s, got %s", test.expected, s.c_str());
+		}
+	}
+
+	string s;
+	fmt::append_float(s, 0.1f);
+	s.append(' ');
+	fmt::append_float(s, 16777216.0f, 'e');
+	s.append(' ');
+	fmt::append_float(s, 1e-45f);
+	s.append(' ');
+	fmt::append_float(s, 3.4028235e38f, 'g');
+	STF_ASSERT(s == "0.1 1.6777216e+07 1e-45 3.4028235e+38");
+}
+
+// Finds the shortest digits the slow way: the smallest number of digits
+// which survives a round trip through the C library. The correctly rounded
+// digits may miss the rounding interval while a neighbour hits it.
+template <typename T>
+static int reference_shortest(T v, char *digits, int *exp) {
+	auto round_trips = [v](unsigned long long m, int e) {
+		char tmp[64];
+		std::snprintf(tmp, sizeof(tmp), "%llue%d", m, e);
+		return sizeof(T) == sizeof(float) ?
+			std::strtof(tmp, nullptr) == v :
+			std::strtod(tmp, nullptr) == v;
+	};
+	for (int n = 1; ; n++) {
+		char tmp[64];
+		std::snprintf(tmp, sizeof(tmp), "%.*e", n - 1, double(v));
+		const char *e = std::strchr(tmp, 'e');
+		unsigned long long m = 0;
+		for (const char *p = tmp; p < e; p++) {
+			if (*p >= '0' && *p <= '9') {
+				m = m * 10 + (*p - '0');
+			}
+		}
+		int me = std::atoi(e + 1) - (n - 1);
+		if (!round_trips(m, me)) {
+			if (round_trips(m + 1, me)) {
+				m++;
+			} else if (round_trips(m - 1, me)) {
+				m--;
+			} else if (n < 17) {
+				continue;
+			}
+		}
+		while (m % 10 == 0) {
+			m /= 10;
+			me++;
+		}
+		const int len = std::sprintf(digits, "%llu", m);
+		*exp = me + len - 1;
+		return len;
+	}
+}
+
+static uint64 next_random(uint64 *state) {
+	// xorshift64*
+	uint64 x = *state;
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	*state = x;
+	return x * 2685821657736338717ULL;
+}
+
+STF_TEST("fmt::detail::shortest_digits(double, char*, int*)") {
+	uint64 state = 88172645463325252ULL;
+	for (int i = 0; i < 100000; i++) {
+		// the smallest subnormals first
+		uint64 bits = i < 16 ? i : next_random(&state);
+		if (i >= 16 && i % 4 == 0) {
+			// short mantissas are more likely to have short decimals
+			bits &= ~((uint64(1) << (next_random(&state) % 52)) - 1);
+		}
+		double v;
+		std::memcpy(&v, &bits, sizeof(v));
+		if (!std::isfinite(v) || v == 0) {
+			continue;
+		}
+		v = std::fabs(v);
+		char want[20], got[20];
+		int want_exp, got_exp;
+		const int want_len = reference_shortest(v, want, &want_exp);
+		const int got_len = fmt::detail::shortest_digits(v, got, &got_exp);
+		if (want_len != got_len || want_exp != got_exp ||
+			std::memcmp(want, got, got_len) != 0)
+		{
+			STF_ERRORF("%.17g: expected %.*se%d, got %.*se%d", v,
+				want_len, want, want_exp, got_len, got, got_exp);
+			break;
+		}
+	}
+}
+
+STF_TEST("fmt::detail::shortest_digits(float, char*, int*)") {
+	uint64 state = 2463534242ULL;
+	for (int i = 0; i < 100000; i++) {
+		// the smallest subnormals first
+		const uint32 bits = i < 16 ? i : next_random(&state);
+		float v;
+		std::memcpy(&v, &bits, sizeof(v));
+		if (!std::isfinite(v) || v == 0) {
+			continue;
+		}
+		v = std::fabs(v);
+		char want[20], got[20];
+		int want_exp, got_exp;
+		const int want_len = reference_shortest(v, want, &want_exp);
+		const int got_len = fmt::detail::shortest_digits(v, got, &got_exp);
+		if (want_len != got_len || want_exp != got_exp ||
+			std::memcmp(want, got, got_len) != 0)
+		{
+			STF_ERRORF("%.9g: expected %.*se%d, got %.*se%d", v,
+				want_len, want, want_exp, got_len, got, got_exp);
+			break;
+		}
+	}
+}
+
+STF_TEST("fmt::sprintf numbers match the C library") {
+	// rounding corner cases: a carry into a new leading block, a digit
+	// right after a block boundary and a tie
+	STF_ASSERT(fmt::sprintf("%.0e", 9.7e17) == "1e+18");
+	STF_ASSERT(fmt::sprintf("%.17e", 0.884557) == "8.84557000000000038e-01");
+	STF_ASSERT(fmt::sprintf("%.19e", 67226636539938.2890625) == "6.7226636539938289062e+13");
+
+	// glibc drops a zero required by '#' when %g rounds up to the next
+	// power of ten ("1.E+02" for %#.2G of 99.99), check it separately
+	STF_ASSERT(fmt::sprintf("%#.2G|%#.3g|%#.0f|%#g", 99.99, 1.5, 2.0, 0.1) ==
+		"1.0E+02|1.50|2.|0.100000");
+
+	const char *flags[] = {"", "-", "+", " ", "0", "+ ", "+0", "- "};
+	const char conversions[] = "dieEfFgG";
+	uint64 state = 1;
+	for (int i = 0; i < 20000; i++) {
+		const uint64 r = next_random(&state);
+		const char conv = conversions[r % 8];
+		char format[32];
+		char *f = format;
+		*f++ = '%';
+		f += std::sprintf(f, "%s", flags[(r >> 8) % 8]);
+		if ((r >> 12) & 1) {
+			f += std::sprintf(f, "%d", int((r >> 13) % 30));
+		}
+		if ((r >> 18) & 1) {
+			f += std::sprintf(f, ".%d", int((r >> 19) % 20));
+		}
+		*f++ = conv;
+		*f = '\0';
+
+		char want[512];
+		string got;
+		if (conv == 'd' || conv == 'i') {
+			const int v = int(next_random(&state) >> (r >> 24) % 64);
+			std::snprintf(want, sizeof(want), format, v);
+			got = fmt::sprintf(format, v);
+		} else {
+			double v;
+			switch ((r >> 24) % 3) {
+			case 0:
+				// a short decimal
+				v = double(int64(next_random(&state) % 2000001) - 1000000) /
+					std::pow(10.0, double((r >> 32) % 12));
+				break;
+			case 1:
+				// a value with a random exponent
+				v = double(next_random(&state) >> 11) / (1ULL << 53) *
+					std::pow(10.0, double(int((r >> 32) % 60) - 30));
+				break;
+			default: {
+				const uint64 bits = next_random(&state);
+				std::memcpy(&v, &bits, sizeof(v));
+				if (std::isnan(v) || std::fabs(v) > 1e200) {
+					v = 0.5;
+				}
+			}
+			}
+			std::snprintf(want, sizeof(want), format, v);
+			got = fmt::sprintf(format, v);
+		}
+		if (got != (const char*)want) {
+			STF_ERRORF("%s: expected %s, got %s", format, want, got.c_str());
+			break;
+		}
+	}
+}
+
+static volatile int bench_sink;
+
+STF_BENCH("fmt::append_int(string&, int64)") {
+	string s;
+	for (int i = 0; i < STF_N; i++) {
+		s.clear();
+		fmt::append_int(s, int64(i) * 2654435761LL);
+		bench_sink = s.len();
+	}
+}
+
+STF_BENCH("std::snprintf(%lld)") {
+	char buf[32];
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = std::snprintf(buf, sizeof(buf), "%lld", (long long)i * 2654435761LL);
+	}
+}
+
+STF_BENCH("fmt::append_float(string&, double)") {
+	string s;
+	for (int i = 0; i < STF_N; i++) {
+		s.clear();
+		fmt::append_float(s, i * 1.0137);
+		bench_sink = s.len();
+	}
+}
+
+STF_BENCH("std::snprintf(%.17g)") {
+	char buf[32];
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = std::snprintf(buf, sizeof(buf), "%.17g", i * 1.0137);
+	}
+}
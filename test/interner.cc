@@ -0,0 +1,105 @@
+#include "stf.hh"
+#include "zbs.hh"
+#include "zbs/interner.hh"
+#include "zbs/fmt.hh"
+#include "zbs/strings.hh"
+
+#include <atomic>
+#include <thread>
+
+STF_SUITE_NAME("zbs::interner");
+
+using namespace zbs;
+
+STF_TEST("interner::intern(slice<const char>)") {
+	interner in;
+	STF_ASSERT(in.len() == 0);
+	STF_ASSERT(in.intern("host") == 0);
+	STF_ASSERT(in.intern("path") == 1);
+	STF_ASSERT(in.intern("") == 2);
+	STF_ASSERT(in.intern("host") == 0);
+	STF_ASSERT(in.intern(string("path")) == 1);
+	STF_ASSERT(in.intern("") == 2);
+	STF_ASSERT(in.len() == 3);
+
+	STF_ASSERT(in.lookup(0) == "host");
+	STF_ASSERT(in.lookup(1) == "path");
+	STF_ASSERT(in.lookup(2) == "");
+
+	// the stored bytes are a copy
+	string s = "temporary";
+	uint32 id = in.intern(s);
+	s[0] = 'T';
+	STF_ASSERT(in.lookup(id) == "temporary");
+	STF_ASSERT(in.intern(s) != id);
+
+	STF_ASSERT(in.find("host") && *in.find("host") == 0);
+	STF_ASSERT(!in.find("missing"));
+	STF_ASSERT(in.len() == 5);
+}
+
+STF_TEST("interner stable slices") {
+	interner in;
+	vector<slice<const char>> slices;
+	string big = strings::repeat("x", 10000);
+	for (int i = 0; i < 5000; i++) {
+		string s = i % 100 == 0 ? big + fmt::sprintf("%d", i) : fmt::sprintf("key-%d", i);
+		STF_ASSERT(in.intern(s) == uint32(i));
+		slices.append(in.lookup(i));
+	}
+	for (int i = 0; i < 5000; i++) {
+		STF_ASSERT(in.lookup(i).data() == slices[i].data());
+		string s = i % 100 == 0 ? big + fmt::sprintf("%d", i) : fmt::sprintf("key-%d", i);
+		STF_ASSERT(in.lookup(i) == s);
+		STF_ASSERT(in.intern(s) == uint32(i));
+	}
+}
+
+STF_TEST("interner sharded") {
+	interner in(8);
+	const int threads = 4;
+	const int keys = 5000;
+	vector<uint32> ids[threads];
+	vector<std::thread> workers;
+	for (int t = 0; t < threads; t++) {
+		workers.append(std::thread([&in, &ids, t]() {
+			for (int i = 0; i < keys; i++) {
+				// every thread interns the same keys in a different order
+				int k = (i * 7 + t * 1013) % keys;
+				ids[t].append(in.intern(fmt::sprintf("key-%d", k)));
+			}
+		}));
+	}
+	// ids below len() can be looked up while others are being added
+	std::atomic<bool> done(false);
+	int bad = 0;
+	std::thread reader([&in, &done, &bad]() {
+		while (!done.load()) {
+			const int n = in.len();
+			if (n > 0 && !strings::starts_with(in.lookup(n - 1), "key-")) {
+				bad++;
+			}
+		}
+	});
+	for (auto &w : workers) {
+		w.join();
+	}
+	done.store(true);
+	reader.join();
+
+	STF_ASSERT(bad == 0);
+	STF_ASSERT(in.len() == keys);
+	vector<bool> seen(keys, false);
+	for (int t = 0; t < threads; t++) {
+		for (int i = 0; i < keys; i++) {
+			int k = (i * 7 + t * 1013) % keys;
+			uint32 id = ids[t][i];
+			STF_ASSERT(id < uint32(keys));
+			STF_ASSERT(in.lookup(id) == fmt::sprintf("key-%d", k));
+			seen[id] = true;
+		}
+	}
+	for (int i = 0; i < keys; i++) {
+		STF_ASSERT(seen[i]);
+	}
+}
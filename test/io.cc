@@ -0,0 +1,221 @@
+#include "stf.hh"
+#include "zbs/io.hh"
+#include "zbs/fmt.hh"
+#include <cerrno>
+#include <unistd.h>
+
+using namespace zbs;
+
+STF_SUITE_NAME("zbs/io");
+
+namespace {
+
+// Records every call.
+struct recording_writer : io::writer {
+	string out;
+	int writes = 0;
+	int writevs = 0;
+	bool fail = false;
+
+	int write(slice<const char> buf, error *err = &default_error) override {
+		writes++;
+		if (fail) {
+			err->set("recording_writer: write failed");
+			return -1;
+		}
+		out.append(buf);
+		return buf.len();
+	}
+	int writev(slice<const slice<const char>> bufs, error *err = &default_error) override {
+		writevs++;
+		if (fail) {
+			err->set("recording_writer: writev failed");
+			return -1;
+		}
+		int n = 0;
+		for (int i = 0; i < bufs.len(); i++) {
+			out.append(bufs[i]);
+			n += bufs[i].len();
+		}
+		return n;
+	}
+};
+
+// Returns the input a few bytes at a time.
+struct chunked_reader : io::reader {
+	slice<const char> in;
+	int chunk;
+	int reads = 0;
+
+	chunked_reader(slice<const char> in, int chunk): in(in), chunk(chunk) {}
+	int read(slice<char> buf, error* = &default_error) override {
+		reads++;
+		int n = in.len() < chunk ? in.len() : chunk;
+		if (n > buf.len()) {
+			n = buf.len();
+		}
+		copy(buf, in.sub(0, n));
+		in = in.sub(n);
+		return n;
+	}
+};
+
+} // anonymous namespace
+
+STF_TEST("io::buffered_writer") {
+	recording_writer rw;
+	{
+		io::buffered_writer bw(rw, 16);
+		STF_ASSERT(bw.write("hello") == 5);
+		STF_ASSERT(bw.write_byte(',') == 1);
+		STF_ASSERT(bw.write(" world") == 6);
+		STF_ASSERT(bw.buffered() == 12);
+		STF_ASSERT(rw.writes == 0 && rw.writevs == 0);
+
+		// doesn't fit, goes out together with the buffered data
+		STF_ASSERT(bw.write("!!!!!!") == 6);
+		STF_ASSERT(rw.writevs == 1);
+		STF_ASSERT(rw.out == "hello, world!!!!!!");
+		STF_ASSERT(bw.buffered() == 0);
+
+		// an empty buffer is bypassed by large writes
+		STF_ASSERT(bw.write("0123456789abcdefXYZ") == 19);
+		STF_ASSERT(rw.writes == 1 && rw.writevs == 1);
+
+		const slice<const char> parts[] = {"a", "bc", "", "def"};
+		STF_ASSERT(bw.writev(parts) == 6);
+		STF_ASSERT(bw.buffered() == 6);
+
+		slice<char> r = bw.reserve(4);
+		STF_ASSERT(r.len() == 10);
+		r[0] = 'g';
+		r[1] = 'h';
+		bw.commit(2);
+		STF_ASSERT(bw.buffered() == 8);
+
+		// not enough room, flushes first
+		r = bw.reserve(12);
+		STF_ASSERT(r.len() == 16);
+		STF_ASSERT(rw.out == "hello, world!!!!!!0123456789abcdefXYZabcdefgh");
+		r[0] = 'i';
+		bw.commit(1);
+	}
+	// the destructor flushes
+	STF_ASSERT(rw.out == "hello, world!!!!!!0123456789abcdefXYZabcdefghi");
+}
+
+STF_TEST("io::buffered_writer errors") {
+	recording_writer rw;
+	rw.fail = true;
+	io::buffered_writer bw(rw, 8);
+	error err(error_verbosity::quiet);
+	STF_ASSERT(bw.write("abc", &err) == 3);
+	STF_ASSERT(!err);
+	STF_ASSERT(bw.flush(&err) == -1);
+	STF_ASSERT(err);
+	STF_ASSERT(bw.buffered() == 0);
+
+	error err2(error_verbosity::quiet);
+	STF_ASSERT(bw.write("abcdefghij", &err2) == -1);
+	STF_ASSERT(err2);
+}
+
+STF_TEST("io::buffered_reader") {
+	const char input[] = "first line\nsecond\n\nlast";
+	chunked_reader cr(input, 3);
+	io::buffered_reader br(cr, 8);
+
+	string line;
+	STF_ASSERT(br.read_until('\n', &line) == 11);
+	STF_ASSERT(line == "first line\n");
+
+	STF_ASSERT(br.peek(4) == "seco");
+	STF_ASSERT(br.discard(2) == 2);
+
+	// only what is buffered
+	char buf[3];
+	STF_ASSERT(br.read(buf) == 2);
+	STF_ASSERT(slice<const char>(buf, 2) == "co");
+
+	line.clear();
+	STF_ASSERT(br.read_until('\n', &line) == 3);
+	STF_ASSERT(line == "nd\n");
+	line.clear();
+	STF_ASSERT(br.read_until('\n', &line) == 1);
+	line.clear();
+	STF_ASSERT(br.read_until('\n', &line) == 4);
+	STF_ASSERT(line == "last");
+	STF_ASSERT(br.read_until('\n', &line) == 0);
+	STF_ASSERT(br.read(buf) == 0);
+	STF_ASSERT(br.peek(2).len() == 0);
+
+	// large reads bypass an empty buffer
+	chunked_reader cr2("0123456789", 10);
+	io::buffered_reader br2(cr2, 4);
+	char big[8];
+	STF_ASSERT(br2.read(big) == 8);
+	STF_ASSERT(cr2.reads == 1);
+	STF_ASSERT(br2.discard(5) == 2);
+}
+
+STF_TEST("io::fd_writer, io::fd_reader") {
+	int fds[2];
+	STF_ASSERT(pipe(fds) == 0);
+	io::fd_writer w(fds[1]);
+	io::fd_reader r(fds[0]);
+
+	const slice<const char> parts[] = {"gather", " ", "", "write"};
+	STF_ASSERT(w.writev(parts) == 12);
+	STF_ASSERT(w.write("!") == 1);
+	close(fds[1]);
+
+	io::buffered_reader br(r);
+	string all;
+	STF_ASSERT(br.read_until('\0', &all) == 13);
+	STF_ASSERT(all == "gather write!");
+	close(fds[0]);
+
+	io::fd_writer bad(fds[1]);
+	error err(error_verbosity::quiet);
+	STF_ASSERT(bad.write("x", &err) == -1);
+	STF_ASSERT(err.code() == error_code(&io::errno_domain, EBADF));
+}
+
+STF_TEST("fmt::fprintf(io::writer&, const char*, ...)") {
+	recording_writer rw;
+	STF_ASSERT(fmt::fprintf(rw, "%s=%d;", "x", 42) == 5);
+	STF_ASSERT(rw.out == "x=42;");
+	STF_ASSERT(rw.writes == 1);
+
+	// longer than the stack buffer
+	string big;
+	big.resize(1000, 'z');
+	STF_ASSERT(fmt::fprintf(rw, "[%s]", big.c_str()) == 1002);
+	STF_ASSERT(rw.out.len() == 1007);
+	STF_ASSERT(rw.out.sub(5, 7) == "[z");
+
+	STF_ASSERT(fmt::format_to(rw, "{}-{}", 1, "two") == 5);
+	STF_ASSERT(rw.out.sub(1007) == "1-two");
+
+	rw.fail = true;
+	STF_ASSERT(fmt::fprintf(rw, "%d", 1) == -1);
+}
+
+STF_TEST("fmt::fprintf(io::buffered_writer&, const char*, ...)") {
+	recording_writer rw;
+	io::buffered_writer bw(rw, 64);
+	for (int i = 0; i < 3; i++) {
+		STF_ASSERT(fmt::fprintf(bw, "line %d\n", i) == 7);
+	}
+	STF_ASSERT(fmt::format_to(bw, "{:>4}\n", 3.5) == 5);
+	STF_ASSERT(rw.writes == 0 && rw.writevs == 0);
+	STF_ASSERT(bw.flush() == 0);
+	STF_ASSERT(rw.out == "line 0\nline 1\nline 2\n 3.5\n");
+
+	// the buffer is used through a plain writer reference too
+	io::writer &w = bw;
+	STF_ASSERT(fmt::fprintf(w, "%d\n", 7) == 2);
+	STF_ASSERT(fmt::format_to(w, "{}\n", 8) == 2);
+	STF_ASSERT(bw.buffered() == 4);
+	STF_ASSERT(rw.writes == 1 && rw.writevs == 0);
+}
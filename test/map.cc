@@ -1,5 +1,6 @@
 #include "stf.hh"
 #include "zbs.hh"
+#include "zbs/fmt.hh"
 
 STF_SUITE_NAME("zbs::map");
 
@@ -202,6 +203,21 @@ STF_TEST("map(map&&)") {
 	STF_ASSERT(b["Sam Doe"] == "");
 }
 
+STF_TEST("map::clear()") {
+	map<string, int> a;
+	for (int round = 0; round < 3; round++) {
+		for (int i = 0; i < 200; i++) {
+			a[fmt::sprintf("key %d", i)] = i + round;
+		}
+		STF_ASSERT(a.len() == 200);
+		STF_ASSERT(*a.lookup("key 150") == 150 + round);
+		a.clear();
+		STF_ASSERT(a.len() == 0);
+		STF_ASSERT(a.lookup("key 150") == nullptr);
+		STF_ASSERT(a.lookup("key 0") == nullptr);
+	}
+}
+
 STF_TEST("oop ctor/dtor balance correctness") {
 	STF_ASSERT(oop::balance == 0);
 }
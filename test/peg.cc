@@ -1,9 +1,14 @@
 #include "stf.hh"
 #include "zbs.hh"
 #include "zbs/peg.hh"
+#include "zbs/fmt.hh"
+#include <thread>
 
 STF_SUITE_NAME("zbs::peg");
 
+// generated by tools/makepegtest.bash
+#include "peg_generated.inl"
+
 namespace peg = zbs::peg;
 
 STF_TEST("basic sequence match") {
@@ -146,7 +151,7 @@ STF_TEST("tcltk layout (somewhat)") {
 	ast opt_space_nl = *S(" \t\n");
 	ast line = opt_space_nl >> captoken >> *(+space >> captoken);
 	ast layout = line >> *(C(P("\n")) >> line) >> opt_space_nl >> !any();
-	auto p = compile(layout);
+	matcher p = compile(layout);
 	auto optresult = p.capture(R"(
 		.f -   -      .div
 		.7 .8  .9     .mul
@@ -170,3 +175,703 @@ STF_TEST("tcltk layout (somewhat)") {
 		STF_ASSERT(result[i] == expected[i]);
 	}
 }
+
+STF_TEST("shared subtrees") {
+	using namespace zbs::peg;
+	ast ident = +(R("az") | "_");
+	ast list = ident >> *("," >> ident);
+	STF_ASSERT(list.p->left.get() == ident.p.get());
+	STF_ASSERT(list.p->right->left->right.get() == ident.p.get());
+
+	// copies and the asts built from them outlive the original
+	ast call = P("(") >> ")";
+	{
+		ast args = list;
+		STF_ASSERT(args.p.get() == list.p.get());
+		call = ident >> "(" >> -args >> ")";
+	}
+	list = P("x");
+	bytecode p = compile(call >> !any());
+	STF_ASSERT(p.match("f(a,b_,c)"));
+	STF_ASSERT(p.match("g()"));
+	STF_ASSERT(!p.match("f(a,)"));
+
+	grammar g;
+	g.rule("call", call);
+	g.rule("ident", ident);
+	bytecode p2 = compile(g);
+	STF_ASSERT(p2.match("f(x)"));
+}
+
+STF_TEST("grammar") {
+	using namespace zbs::peg;
+	grammar brackets;
+	brackets.rule("s", V("b") >> !any());
+	brackets.rule("b", *("(" >> V("b") >> ")" | "[" >> V("b") >> "]"));
+	bytecode p = compile(brackets);
+	STF_ASSERT(p.match(""));
+	STF_ASSERT(p.match("()[]"));
+	STF_ASSERT(p.match("([()[]])(())"));
+	STF_ASSERT(!p.match("(]"));
+	STF_ASSERT(!p.match("(()"));
+	STF_ASSERT(!p.match("())"));
+
+	// mutual recursion and captures
+	grammar expr;
+	expr.rule("expr", V("term") >> *(C(S("+-")) >> V("term")) >> !any());
+	expr.rule("term", V("factor") >> *(C(S("*/")) >> V("factor")));
+	expr.rule("factor", C(+R("09")) | "(" >> V("sum") >> ")");
+	expr.rule("sum", V("term") >> *(C(S("+-")) >> V("term")));
+	bytecode p2 = compile(expr);
+	auto result = p2.capture("1+2*(30-4)/5");
+	STF_ASSERT(result);
+	const char *expected[] = {"1", "+", "2", "*", "30", "-", "4", "/", "5"};
+	STF_ASSERT(result->len() == 9);
+	for (int i = 0; i < 9; i++) {
+		STF_ASSERT((*result)[i] == expected[i]);
+	}
+	STF_ASSERT(!p2.match("1+"));
+	STF_ASSERT(!p2.match("(1"));
+
+	// a copy works on its own
+	bytecode p3 = p;
+	STF_ASSERT(p3.match("[()]"));
+	STF_ASSERT(!p3.match("[(])"));
+}
+
+STF_TEST("grammar errors") {
+	using namespace zbs::peg;
+	auto compile_error = [](const grammar &g) {
+		zbs::error err;
+		compile(g, &err);
+		return zbs::string(err.what());
+	};
+
+	grammar undefined;
+	undefined.rule("a", "x" >> V("b"));
+	STF_ASSERT(compile_error(undefined) == "peg: undefined rule 'b'");
+
+	grammar left;
+	left.rule("a", V("a") >> "x" | "x");
+	STF_ASSERT(compile_error(left) == "peg: rule 'a' is left recursive");
+
+	// through a rule which may match nothing
+	grammar indirect;
+	indirect.rule("a", "x" >> V("a") | V("b") >> V("c"));
+	indirect.rule("b", *P("y"));
+	indirect.rule("c", -V("a") >> "z");
+	STF_ASSERT(compile_error(indirect) == "peg: rule 'a' is left recursive");
+
+	grammar twice;
+	twice.rule("a", "x");
+	twice.rule("a", "y");
+	STF_ASSERT(compile_error(twice) == "peg: rule 'a' defined twice");
+
+	zbs::error err;
+	compile(P("x") >> V("a"), &err);
+	STF_ASSERT(zbs::string(err.what()) == "peg: rule 'a' used outside of a grammar");
+
+	grammar empty;
+	STF_ASSERT(compile_error(empty) == "peg: empty grammar");
+}
+
+STF_TEST("grammar memoization") {
+	using namespace zbs::peg;
+	// every level tries the nested rule three times, which takes 3^depth
+	// steps without memoization
+	auto nested = [](bool memoize) {
+		grammar g;
+		g.rule("s", V("r") >> !any());
+		g.rule("r",
+			"(" >> V("r") >> C(P(")")) >> "x" |
+			"(" >> V("r") >> C(P(")")) >> "y" |
+			"(" >> V("r") >> C(P(")")) |
+			C(P("a")), memoize);
+		return compile(g);
+	};
+	auto input = [](int depth) {
+		zbs::string s;
+		for (int i = 0; i < depth; i++)
+			s.append('(');
+		s.append('a');
+		for (int i = 0; i < depth; i++)
+			s.append(')');
+		return s;
+	};
+
+	bytecode plain = nested(false);
+	bytecode memo = nested(true);
+	for (int depth = 0; depth < 6; depth++) {
+		zbs::string s = input(depth);
+		auto a = plain.capture(s);
+		auto b = memo.capture(s);
+		STF_ASSERT(a && b);
+		STF_ASSERT(a->len() == depth + 1 && b->len() == depth + 1);
+		for (int i = 0; i < a->len(); i++) {
+			STF_ASSERT((*a)[i] == (*b)[i]);
+		}
+		s.append('z');
+		STF_ASSERT(!plain.match(s) && !memo.match(s));
+	}
+
+	// would take 3^40 steps without the memo table
+	zbs::string deep = input(40);
+	auto result = memo.capture(deep);
+	STF_ASSERT(result);
+	STF_ASSERT(result->len() == 41);
+	STF_ASSERT((*result)[0] == "a");
+	STF_ASSERT((*result)[40] == ")");
+	deep.append(')');
+	STF_ASSERT(!memo.match(deep));
+}
+
+STF_TEST("choice first sets") {
+	using namespace zbs::peg;
+	// keywords with common prefixes, the ones after can't be skipped by
+	// looking at the first byte only
+	ast kw = P("if") | "in" | "for" | "function" | "else" | "while";
+	bytecode p = compile(kw >> !R("az"));
+	STF_ASSERT(p.match("if"));
+	STF_ASSERT(p.match("in"));
+	STF_ASSERT(p.match("for"));
+	STF_ASSERT(p.match("function"));
+	STF_ASSERT(p.match("else"));
+	STF_ASSERT(p.match("while"));
+	STF_ASSERT(!p.match("iff"));
+	STF_ASSERT(!p.match("fun"));
+	STF_ASSERT(!p.match("elsewhere"));
+	STF_ASSERT(!p.match("wh"));
+	STF_ASSERT(!p.match(""));
+
+	// the first byte decides, but the rest still may fail
+	bytecode p2 = compile((P("abc") | "xyz" | "q") >> ";");
+	STF_ASSERT(p2.match("xyz;"));
+	STF_ASSERT(p2.match("q;"));
+	STF_ASSERT(!p2.match("abd;"));
+	STF_ASSERT(!p2.match("x;"));
+
+	// invalid utf-8 matches the replacement character
+	bytecode p3 = compile(S("\xEF\xBF\xBD") | "x");
+	STF_ASSERT(p3.match("\xEF\xBF\xBD"));
+	STF_ASSERT(p3.match("\xFF"));
+	STF_ASSERT(p3.match("x"));
+	STF_ASSERT(!p3.match("y"));
+	bytecode p4 = compile(R("я\xF4\x8F\xBF\xBF") | "x");
+	STF_ASSERT(p4.match("\x80"));
+	STF_ASSERT(p4.match("я"));
+	STF_ASSERT(!p4.match("ю"));
+
+	// rules
+	grammar g;
+	g.rule("stmt", V("if") | V("while") | V("expr"));
+	g.rule("if", "if(" >> V("expr") >> ")" >> V("stmt"));
+	g.rule("while", "while(" >> V("expr") >> ")" >> V("stmt"));
+	g.rule("expr", +R("az") >> ";");
+	bytecode p5 = compile(g);
+	STF_ASSERT(p5.match("if(a;)while(b;)c;"));
+	STF_ASSERT(p5.match("iff;"));
+	STF_ASSERT(p5.match("whilst;"));
+	STF_ASSERT(!p5.match("if(a;)"));
+	STF_ASSERT(!p5.match("while(b;)"));
+}
+
+STF_TEST("head-fail patterns and spans") {
+	using namespace zbs::peg;
+	matcher m = compile(C(*S("ab")) >> C(*R("09")) >> C(*(P("x") | "y")) >>
+		C(-P("-")) >> C(*S("абв")));
+	auto result = m.capture("abba12xyx-вба!");
+	STF_ASSERT(result);
+	STF_ASSERT(result->len() == 5);
+	STF_ASSERT((*result)[0] == "abba");
+	STF_ASSERT((*result)[1] == "12");
+	STF_ASSERT((*result)[2] == "xyx");
+	STF_ASSERT((*result)[3] == "-");
+	STF_ASSERT((*result)[4] == "вба");
+
+	bytecode p = compile(*R("ая") >> !any());
+	STF_ASSERT(p.match("приветмир"));
+	STF_ASSERT(!p.match("привет мир"));
+	STF_ASSERT(!p.match("при\xFF"));
+
+	bytecode p2 = compile(*(S("ab") >> *P("c")) >> !S("xy") >> any());
+	STF_ASSERT(p2.match("acccbbcz"));
+	STF_ASSERT(!p2.match("acccbbcx"));
+	STF_ASSERT(!p2.match("ab"));
+}
+
+STF_TEST("character classes") {
+	using namespace zbs::peg;
+	// a choice of ranges and single runes is one set, the runes beyond ascii
+	// are looked up in its sorted ranges
+	ast letter = R("az") | R("AZ") | R("ая") | R("АЯ") | P("ё") |
+		R("\u03b1\u03c9") | R("\u3040\u309f") | R("\u4e00\u9fff") | S("_$");
+	bytecode p = compile(+letter >> !any());
+	STF_ASSERT(p.match("helloПриветёж"));
+	STF_ASSERT(p.match("\u03b3\u03b5\u03b9\u03b1_$"));
+	STF_ASSERT(p.match("\u3053\u3093\u306b\u3061\u306f\u4e16\u754c"));
+	STF_ASSERT(!p.match("hello world"));
+	STF_ASSERT(!p.match("\u30ab\u30bf\u30ab\u30ca"));
+	STF_ASSERT(!p.match("x\xFF"));
+
+	// differences of classes
+	matcher m = compile(C(*(any() - ",")) >> "," >> C(+(R("az") - S("aeiou"))));
+	auto result = m.capture("при вет\xFF,bcdfa");
+	STF_ASSERT(result);
+	STF_ASSERT((*result)[0] == "при вет\xFF");
+	STF_ASSERT((*result)[1] == "bcdf");
+	STF_ASSERT(!m.match(",aeiou"));
+
+	// literals of any length
+	zbs::string lit;
+	for (int i = 0; i < 100; i++) {
+		lit.append("abc");
+	}
+	bytecode p2 = compile(P(lit.c_str()) >> "!");
+	zbs::string input = lit;
+	input.append("!");
+	STF_ASSERT(p2.match(input));
+	input[299] = 'x';
+	STF_ASSERT(!p2.match(input));
+}
+
+STF_TEST("generate_cpp") {
+	using namespace zbs::peg;
+	// the grammars of tools/makepegtest.cc, interpreted
+	grammar expr;
+	expr.rule("expr", V("term") >> *(C(S("+-")) >> V("term")) >> !any());
+	expr.rule("term", V("factor") >> *(C(S("*/")) >> V("factor")));
+	expr.rule("factor", C(+R("09")) | "(" >> V("sum") >> ")" | C(+R("ая")));
+	expr.rule("sum", V("term") >> *(C(S("+-")) >> V("term")));
+	grammar nested;
+	nested.rule("s", V("r") >> !any());
+	nested.rule("r",
+		"(" >> V("r") >> C(P(")")) >> "x" |
+		"(" >> V("r") >> C(P(")")) >> "y" |
+		"(" >> V("r") >> C(P(")")) |
+		C(P("a")), true);
+	ast kw = P("if") | "in" | "for" | "function" | "else" | "while";
+
+	struct {
+		bytecode interpreted;
+		bytecode generated;
+		const char *inputs[6];
+	} tests[] = {
+		{compile(expr), generated_expr(),
+			{"1+2*(30-4)/5", "икс*(2+игрек)", "1+", "(1", "", "2*\xFF"}},
+		{compile(nested), generated_nested(),
+			{"a", "((a)x)", "(((a)y)x)", "((a)", "((a)z)", "(((((a)))))"}},
+		{compile(*S(" \t") >> C(kw) >> &S(" ;(") >> -C(*(any() - ";"))),
+			generated_keywords(),
+			{"  if (x) y;", "\tfunction f", "for;", "fort", "whilst", "else"}},
+		{compile(C(*S("жǒ")) >> C(S("aя") - S("a"))), generated_non_ascii(),
+			{"жǒя", "я", "ǒжa", "", "ǒ", "a"}},
+	};
+	for (auto &t : tests) {
+		for (const char *in : t.inputs) {
+			auto a = t.interpreted.capture(in);
+			auto b = t.generated.capture(in);
+			STF_ASSERT(bool(a) == bool(b));
+			if (!a || !b)
+				continue;
+			STF_ASSERT(a->len() == b->len());
+			for (int i = 0; i < a->len() && i < b->len(); i++) {
+				STF_ASSERT((*a)[i] == (*b)[i]);
+			}
+		}
+	}
+
+	matcher m = generated_expr();
+	auto result = m.capture("икс*(2+игрек)");
+	STF_ASSERT(result);
+	STF_ASSERT(result->len() == 5);
+	STF_ASSERT((*result)[4] == "игрек");
+
+	zbs::error err;
+	generate_cpp(compile(P("x")), "not an identifier", &err);
+	STF_ASSERT(zbs::string(err.what()) == "peg: 'not an identifier' is not a C++ identifier");
+}
+
+STF_TEST("program, matcher") {
+	using namespace zbs::peg;
+	const program p = compile(C(+R("09")) >> *("," >> C(+R("09"))) >> !any());
+
+	// matchers share the program, each keeps its own captures
+	matcher a(p), b(p);
+	STF_ASSERT(a.match("1,22,333"));
+	STF_ASSERT(b.match("4"));
+	STF_ASSERT(!b.match("4,"));
+	sequential_capturer<> cap;
+	a.apply_captures(&cap);
+	auto result = cap.result();
+	STF_ASSERT(result.len() == 3);
+	STF_ASSERT(result[2] == "333");
+
+	// and may run on several threads at once
+	zbs::vector<std::thread> threads;
+	bool ok[4] = {};
+	for (int t = 0; t < 4; t++) {
+		threads.append(std::thread([&p, &ok, t]() {
+			matcher m(p);
+			ok[t] = true;
+			for (int i = 0; i < 1000; i++) {
+				ok[t] = ok[t] && m.match("12,34,56") && !m.match("12,,34");
+			}
+		}));
+	}
+	for (auto &t : threads)
+		t.join();
+	for (bool b : ok)
+		STF_ASSERT(b);
+}
+
+STF_TEST("match_many") {
+	using namespace zbs::peg;
+	const program p = compile(C(+R("az")) >> "=" >> C(+R("09")) >> !any());
+	zbs::vector<zbs::string> records;
+	for (int i = 0; i < 1000; i++) {
+		records.append(zbs::fmt::sprintf(i % 3 ? "key%c=%d" : "bad %d", 'a' + i % 26, i));
+	}
+	zbs::vector<zbs::slice<const char>> inputs;
+	for (const auto &r : records)
+		inputs.append(r);
+
+	auto results = match_many(p, inputs, 4);
+	STF_ASSERT(results.len() == 1000);
+	matcher m(p);
+	for (int i = 0; i < 1000; i++) {
+		STF_ASSERT(results[i] == m.match(inputs[i]));
+	}
+
+	// captures are taken on the worker threads
+	zbs::vector<zbs::string> values;
+	values.resize(inputs.len());
+	auto collect = [&values](int i, matcher &m, bool ok) {
+		if (!ok)
+			return;
+		sequential_capturer<> cap;
+		m.apply_captures(&cap);
+		values[i] = cap.result()[1];
+	};
+	match_many(p, inputs, collect);
+	STF_ASSERT(values[0] == "");
+	STF_ASSERT(values[1] == "1");
+	STF_ASSERT(values[998] == "998");
+
+	STF_ASSERT(match_many(p, {}).len() == 0);
+}
+
+static volatile bool bench_sink;
+
+static zbs::string keywords_input() {
+	const char *words[] = {"if", "in", "for", "function", "else", "while",
+		"return", "break", "x", "continue", "var", "let", "const"};
+	zbs::string s;
+	for (int i = 0; i < 1000; i++) {
+		s.append(words[i * 7 % 13]);
+		s.append(' ');
+	}
+	return s;
+}
+
+STF_TEST("streaming match") {
+	using namespace zbs::peg;
+	grammar expr;
+	expr.rule("expr", V("term") >> *(C(S("+-")) >> V("term")) >> !any());
+	expr.rule("term", V("factor") >> *(C(S("*/")) >> V("factor")));
+	expr.rule("factor", C(+R("09")) | "(" >> V("sum") >> ")" | C(+R("ая")));
+	expr.rule("sum", V("term") >> *(C(S("+-")) >> V("term")), true);
+	const program p = compile(expr);
+	const char *inputs[] = {"1+2*(30-4)/5", "икс*(2+игрек)", "1+", "(1", "", "2*\xFF"};
+
+	// every split gives the result of matching the whole input
+	matcher whole(p), m(p);
+	for (const char *in : inputs) {
+		const zbs::slice<const char> s = in;
+		auto expected = whole.capture(s);
+		for (int chunk = 1; chunk <= 4; chunk++) {
+			m.start();
+			match_status st = match_status::need_more_input;
+			zbs::string buf;
+			for (int i = 0; i < s.len() && st == match_status::need_more_input; i += chunk) {
+				// the chunk doesn't outlive the call
+				buf = s.sub(i, std::min(i + chunk, s.len()));
+				st = m.feed(buf);
+				buf.resize(0);
+			}
+			if (st == match_status::need_more_input)
+				st = m.finish();
+			STF_ASSERT((st == match_status::match) == bool(expected));
+			if (!expected)
+				continue;
+			sequential_capturer<> cap;
+			m.apply_captures(&cap);
+			auto result = cap.result();
+			STF_ASSERT(result.len() == expected->len());
+			for (int i = 0; i < result.len() && i < expected->len(); i++) {
+				STF_ASSERT(result[i] == (*expected)[i]);
+			}
+			STF_ASSERT(m.stream_matched() == s.len());
+		}
+	}
+
+	// decided as soon as possible, the result stays
+	m = compile(P("ab") | "ac");
+	m.start();
+	STF_ASSERT(m.feed("a") == match_status::need_more_input);
+	STF_ASSERT(m.feed("d") == match_status::fail);
+	STF_ASSERT(m.finish() == match_status::fail);
+	m.start();
+	STF_ASSERT(m.feed("acdc") == match_status::match);
+	STF_ASSERT(m.stream_matched() == 2);
+	STF_ASSERT(m.feed("x") == match_status::match);
+
+	// a rune split between chunks
+	m = compile(C(R("аб")));
+	m.start();
+	STF_ASSERT(m.feed("\xD0") == match_status::need_more_input);
+	STF_ASSERT(m.feed("\xB1") == match_status::match);
+	sequential_capturer<> rune;
+	m.apply_captures(&rune);
+	STF_ASSERT(rune.result()[0] == "б");
+
+	// nested simple captures, the outer one is kept until it's closed
+	m = compile(*(C(P("a") >> C(P("b")) >> "c") >> ";") >> !any());
+	m.start();
+	STF_ASSERT(m.feed("ab") == match_status::need_more_input);
+	STF_ASSERT(m.feed("c;a") == match_status::need_more_input);
+	STF_ASSERT(m.feed("bc;") == match_status::need_more_input);
+	STF_ASSERT(m.finish() == match_status::match);
+	sequential_capturer<> nested;
+	m.apply_captures(&nested);
+	auto abc = nested.result();
+	STF_ASSERT(abc.len() == 4);
+	STF_ASSERT(abc[0] == "abc" && abc[1] == "b" && abc[2] == "abc" && abc[3] == "b");
+
+	// the lines are committed, only the captures are kept
+	m = compile(*(C(+R("az")) >> "\n") >> !any());
+	m.start();
+	for (int i = 0; i < 10000; i++) {
+		STF_ASSERT(m.feed(i % 2 ? "rst\n" : "abc\nxyz") == match_status::need_more_input);
+	}
+	STF_ASSERT(m.finish() == match_status::match);
+	sequential_capturer<> cap;
+	m.apply_captures(&cap);
+	auto lines = cap.result();
+	STF_ASSERT(lines.len() == 10000);
+	STF_ASSERT(lines[0] == "abc" && lines[1] == "xyzrst" && lines[9999] == "xyzrst");
+
+	// a copy made mid-stream doesn't keep the memoized results of its own
+	// earlier input
+	grammar memoized;
+	memoized.rule("s", "x" >> V("r") >> !any());
+	memoized.rule("r", P("a"), true);
+	const program mp = compile(memoized);
+	matcher a(mp), b(mp);
+	STF_ASSERT(!a.match("xb"));
+	b.start();
+	STF_ASSERT(b.feed("") == match_status::need_more_input);
+	a = b;
+	STF_ASSERT(a.feed("xa") == match_status::need_more_input);
+	STF_ASSERT(a.finish() == match_status::match);
+
+	// generated programs can't suspend, they match on finish()
+	m = generated_expr();
+	m.start();
+	STF_ASSERT(m.feed("1+") == match_status::need_more_input);
+	STF_ASSERT(m.feed("2") == match_status::need_more_input);
+	STF_ASSERT(m.finish() == match_status::match);
+	STF_ASSERT(m.stream_matched() == 3);
+}
+
+STF_TEST("find, find_all, gmatch") {
+	using namespace zbs::peg;
+	const char *log =
+		"GET /a 200 12ms\n"
+		"ERROR: disk full\n"
+		"GET /b 404 7ms\n"
+		"ERROR: timeout\n";
+
+	matcher m = compile(C(+R("09")) >> "ms");
+	auto found = m.find(log);
+	STF_ASSERT(found && *found == "12ms");
+	auto c = m.capture("12ms");
+	STF_ASSERT(c && (*c)[0] == "12");
+	auto all = m.find_all(log);
+	STF_ASSERT(all.len() == 2);
+	STF_ASSERT(all[0] == "12ms" && all[1] == "7ms");
+	STF_ASSERT(!m.find("GET /c 500\n"));
+	STF_ASSERT(m.find_all("").len() == 0);
+
+	// starts with a literal, the captures belong to each match
+	m = compile(P("ERROR: ") >> C(*(any() - "\n")));
+	zbs::vector<zbs::string> errors;
+	const int n = m.gmatch(log, [&](zbs::slice<const char> match) {
+		STF_ASSERT(match.len() > 7);
+		sequential_capturer<> cap;
+		m.apply_captures(&cap);
+		errors.append(cap.result()[0]);
+	});
+	STF_ASSERT(n == 2 && errors.len() == 2);
+	STF_ASSERT(errors[0] == "disk full" && errors[1] == "timeout");
+
+	// an empty match right after another one doesn't count
+	m = compile(*P("a"));
+	all = m.find_all("baab");
+	STF_ASSERT(all.len() == 3);
+	STF_ASSERT(all[0] == "" && all[1] == "aa" && all[2] == "");
+
+	// a grammar, non-ascii first bytes
+	grammar g;
+	g.rule("word", C(V("letter") >> *V("letter")));
+	g.rule("letter", R("ая") | R("az"));
+	m = compile(g);
+	all = m.find_all("1 слово, 2 word!");
+	STF_ASSERT(all.len() == 2);
+	STF_ASSERT(all[0] == "слово" && all[1] == "word");
+
+	// generated programs try every position
+	m = generated_keywords();
+	found = m.find("xx if (y)");
+	STF_ASSERT(found && *found == " if (y)");
+}
+
+STF_TEST("capture_tree") {
+	using namespace zbs::peg;
+	ast pair = Cg(C(+R("az")) >> "=" >> C(*R("09")));
+	matcher m = compile(pair >> *("," >> pair) >> !any());
+
+	const char *input = "a=1,bc=,d=234";
+	auto t = m.match_tree(input);
+	STF_ASSERT(t && t->len() == 9);
+	STF_ASSERT(t->nodes().len() == 9);
+	STF_ASSERT((*t)[0].group && (*t)[0].parent == -1);
+	STF_ASSERT(t->text(0) == "a=1");
+	STF_ASSERT(!(*t)[1].group && (*t)[1].parent == 0);
+	STF_ASSERT(t->text(1) == "a" && t->text(2) == "1");
+	STF_ASSERT((*t)[3].group && (*t)[3].parent == -1);
+	STF_ASSERT(t->text(4) == "bc" && t->text(5) == "");
+	STF_ASSERT((*t)[8].parent == 6 && t->text(8) == "234");
+	STF_ASSERT((*t)[8].begin == 10 && (*t)[8].end == 13);
+	STF_ASSERT(!m.match_tree("a=1,"));
+
+	// in the caller's buffer if it fits
+	capture_node buf[9];
+	t = m.match_tree(input, buf);
+	STF_ASSERT(t && t->nodes().data() == buf);
+	STF_ASSERT(t->text(7) == "d");
+	t = m.match_tree(input, zbs::slice<capture_node>(buf, 8));
+	STF_ASSERT(t && t->nodes().data() != buf && t->len() == 9);
+
+	// nested groups, and the captures of a search
+	m = compile(Cg(P("(") >> Cg(C(R("az"))) >> ")"));
+	auto found = m.find("x (y) z");
+	STF_ASSERT(found && *found == "(y)");
+	capture_tree nested = m.captures_tree();
+	STF_ASSERT(nested.len() == 3);
+	STF_ASSERT(nested[1].parent == 0 && nested[2].parent == 1);
+	STF_ASSERT(nested.text(0) == "(y)" && nested.text(2) == "y");
+	STF_ASSERT(nested[2].begin == 3);
+
+	// simple captures nested in simple captures
+	m = compile(C(P("a") >> C(P("b")) >> "c") >> C(C(P("d"))));
+	t = m.match_tree("abcd");
+	STF_ASSERT(t && t->len() == 4);
+	STF_ASSERT(t->text(0) == "abc" && (*t)[0].parent == -1);
+	STF_ASSERT(t->text(1) == "b" && (*t)[1].parent == 0);
+	STF_ASSERT(t->text(2) == "d" && (*t)[2].parent == -1);
+	STF_ASSERT(t->text(3) == "d" && (*t)[3].parent == 2);
+}
+
+static zbs::string fields_input() {
+	zbs::string s;
+	for (int i = 0; i < 1000; i++) {
+		s.append(zbs::fmt::sprintf("%sfield%d", i == 0 ? "" : ",", i));
+	}
+	return s;
+}
+
+static zbs::string log_input() {
+	zbs::string s;
+	for (int i = 0; i < 1000; i++) {
+		s.append(zbs::fmt::sprintf(i % 50 ? "GET /index.html 200 %dms\n" :
+			"ERROR: request %d timed out\n", i));
+	}
+	return s;
+}
+
+STF_BENCH("peg keyword alternation") {
+	using namespace zbs::peg;
+	ast kw = P("if") | "in" | "for" | "function" | "else" | "while" |
+		"return" | "break" | "continue" | "var" | "let" | "const";
+	bytecode p = compile(*((kw | R("az")) >> *S(" ")) >> !any());
+	zbs::string s = keywords_input();
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = p.match(s);
+	}
+}
+
+STF_BENCH("peg find_all in a log") {
+	using namespace zbs::peg;
+	matcher m = compile(P("ERROR: ") >> C(*(any() - "\n")));
+	zbs::string s = log_input();
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = m.find_all(s).len() == 20;
+	}
+}
+
+STF_BENCH("peg captures, sequential_capturer") {
+	using namespace zbs::peg;
+	ast field = C(*(any() - ","));
+	matcher m = compile(field >> *("," >> field));
+	zbs::string s = fields_input();
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = m.capture(s)->len() == 1000;
+	}
+}
+
+STF_BENCH("peg captures, capture_tree") {
+	using namespace zbs::peg;
+	ast field = C(*(any() - ","));
+	matcher m = compile(field >> *("," >> field));
+	zbs::string s = fields_input();
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = m.match_tree(s)->len() == 1000;
+	}
+}
+
+STF_BENCH("peg unicode class") {
+	using namespace zbs::peg;
+	ast letter = R("az") | R("AZ") | R("ая") | R("АЯ") | P("ё") | P("Ё") |
+		R("\u03b1\u03c9") | R("\u0391\u03a9") | R("\u3040\u309f") |
+		R("\u30a0\u30ff") | R("\u4e00\u9fff");
+	bytecode p = compile(*(+letter >> *S(" ")) >> !any());
+	zbs::string s;
+	for (int i = 0; i < 200; i++) {
+		s.append("Съешь же ещё этих мягких французских булок \u65e5\u672c\u8a9e ");
+	}
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = p.match(s);
+	}
+}
+
+STF_BENCH("peg grammar construction") {
+	using namespace zbs::peg;
+	ast ws = *S(" \t\n");
+	ast ident = (R("az") | "_") >> *(R("az") | R("09") | "_");
+	ast params = "(" >> ws >> -(ident >> *("," >> ws >> ident)) >> ")" >> ws;
+	zbs::vector<zbs::string> names;
+	for (int k = 0; k < 300; k++) {
+		names.append(zbs::fmt::sprintf("keyword%d", k));
+	}
+	for (int i = 0; i < STF_N; i++) {
+		grammar g;
+		ast keyword = P("if") >> params;
+		for (const zbs::string &name : names) {
+			ast rule = P(name.c_str()) >> !ident >> ws >> params;
+			keyword = keyword | rule;
+			g.rule(name.c_str(), rule);
+		}
+		g.rule("top", *keyword);
+		bench_sink = keyword.p->type == ast_type::choice;
+	}
+}
@@ -0,0 +1,659 @@
+// Generated by zbs::peg::generate_cpp()
+// DO NOT EDIT
+
+#include "zbs/peg.hh"
+#include "zbs/unicode/utf8.hh"
+#include <cstring>
+
+namespace {
+
+bool generated_expr_match(zbs::peg::matcher &m, zbs::slice<const char> in) {
+	using native = zbs::peg::matcher::native;
+	int label;
+
+	native::call(m, 8);
+	goto L16;
+L8:
+	goto L596;
+L16:
+	native::call(m, 24);
+	goto L176;
+L24:
+	if (in.len() == 0)
+		goto L128;
+	switch (zbs::uint8(in[0])) {
+	case 43: case 45:
+		break;
+	default:
+		goto L128;
+	}
+	native::choice(m, in, 128);
+L72:
+	native::capture(m, zbs::peg::capture_type(1), in);
+	if (in.len() == 0)
+		goto fail;
+	{
+		switch (zbs::uint8(in[0])) {
+		case 43: case 45:
+			break;
+		default:
+			goto fail;
+		}
+		in = in.sub(1);
+	}
+	native::capture(m, zbs::peg::capture_type::close, in);
+	native::call(m, 120);
+	goto L176;
+L120:
+	native::partial_commit(m, in);
+	goto L72;
+L128:
+	if (in.len() == 0)
+		goto L172;
+	switch (zbs::uint8(in[0])) {
+	case 0: case 1: case 2: case 3: case 4: case 5: case 6: case 7:
+	case 8: case 9: case 10: case 11: case 12: case 13: case 14: case 15:
+	case 16: case 17: case 18: case 19: case 20: case 21: case 22: case 23:
+	case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31:
+	case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+	case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+	case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+	case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+	case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+	case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+	case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87:
+	case 88: case 89: case 90: case 91: case 92: case 93: case 94: case 95:
+	case 96: case 97: case 98: case 99: case 100: case 101: case 102: case 103:
+	case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111:
+	case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119:
+	case 120: case 121: case 122: case 123: case 124: case 125: case 126: case 127:
+	case 128: case 129: case 130: case 131: case 132: case 133: case 134: case 135:
+	case 136: case 137: case 138: case 139: case 140: case 141: case 142: case 143:
+	case 144: case 145: case 146: case 147: case 148: case 149: case 150: case 151:
+	case 152: case 153: case 154: case 155: case 156: case 157: case 158: case 159:
+	case 160: case 161: case 162: case 163: case 164: case 165: case 166: case 167:
+	case 168: case 169: case 170: case 171: case 172: case 173: case 174: case 175:
+	case 176: case 177: case 178: case 179: case 180: case 181: case 182: case 183:
+	case 184: case 185: case 186: case 187: case 188: case 189: case 190: case 191:
+	case 192: case 193: case 194: case 195: case 196: case 197: case 198: case 199:
+	case 200: case 201: case 202: case 203: case 204: case 205: case 206: case 207:
+	case 208: case 209: case 210: case 211: case 212: case 213: case 214: case 215:
+	case 216: case 217: case 218: case 219: case 220: case 221: case 222: case 223:
+	case 224: case 225: case 226: case 227: case 228: case 229: case 230: case 231:
+	case 232: case 233: case 234: case 235: case 236: case 237: case 238: case 239:
+	case 240: case 241: case 242: case 243: case 244: case 245: case 246: case 247:
+	case 248: case 249: case 250: case 251: case 252: case 253: case 254: case 255:
+		break;
+	default:
+		goto L172;
+	}
+	goto fail;
+L172:
+	goto ret;
+L176:
+	native::call(m, 184);
+	goto L292;
+L184:
+	if (in.len() == 0)
+		goto L288;
+	switch (zbs::uint8(in[0])) {
+	case 42: case 47:
+		break;
+	default:
+		goto L288;
+	}
+	native::choice(m, in, 288);
+L232:
+	native::capture(m, zbs::peg::capture_type(1), in);
+	if (in.len() == 0)
+		goto fail;
+	{
+		switch (zbs::uint8(in[0])) {
+		case 42: case 47:
+			break;
+		default:
+			goto fail;
+		}
+		in = in.sub(1);
+	}
+	native::capture(m, zbs::peg::capture_type::close, in);
+	native::call(m, 280);
+	goto L292;
+L280:
+	native::partial_commit(m, in);
+	goto L232;
+L288:
+	goto ret;
+L292:
+	if (in.len() == 0)
+		goto L448;
+	switch (zbs::uint8(in[0])) {
+	case 40: case 48: case 49: case 50: case 51: case 52: case 53: case 54:
+	case 55: case 56: case 57:
+		break;
+	default:
+		goto L448;
+	}
+	if (in.len() == 0)
+		goto L408;
+	switch (zbs::uint8(in[0])) {
+	case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+	case 56: case 57:
+		break;
+	default:
+		goto L408;
+	}
+	native::capture(m, zbs::peg::capture_type(1), in);
+	if (in.len() == 0)
+		goto fail;
+	{
+		const zbs::uint8 c = in[0];
+		if (c < 48 || c > 57)
+			goto fail;
+		in = in.sub(1);
+	}
+	while (in.len() != 0) {
+		const zbs::uint8 c = in[0];
+		if (c < 48 || c > 57)
+			break;
+		in = in.sub(1);
+	}
+	native::capture(m, zbs::peg::capture_type::close, in);
+	goto L476;
+L408:
+	if (in.len() < 1 || std::memcmp(in.data(), "(", 1) != 0)
+		goto fail;
+	in = in.sub(1);
+	native::call(m, 428);
+	goto L480;
+L428:
+	if (in.len() < 1 || std::memcmp(in.data(), ")", 1) != 0)
+		goto fail;
+	in = in.sub(1);
+	goto L476;
+L448:
+	native::capture(m, zbs::peg::capture_type(1), in);
+	if (in.len() == 0)
+		goto fail;
+	{
+		const zbs::sized_rune r = zbs::unicode::utf8::decode_rune(in);
+		if (r.rune < 1072 || r.rune > 1103)
+			goto fail;
+		in = in.sub(r.size);
+	}
+	while (in.len() != 0) {
+		const zbs::sized_rune r = zbs::unicode::utf8::decode_rune(in);
+		if (r.rune < 1072 || r.rune > 1103)
+			break;
+		in = in.sub(r.size);
+	}
+	native::capture(m, zbs::peg::capture_type::close, in);
+L476:
+	goto ret;
+L480:
+	native::call(m, 488);
+	goto L176;
+L488:
+	if (in.len() == 0)
+		goto L592;
+	switch (zbs::uint8(in[0])) {
+	case 43: case 45:
+		break;
+	default:
+		goto L592;
+	}
+	native::choice(m, in, 592);
+L536:
+	native::capture(m, zbs::peg::capture_type(1), in);
+	if (in.len() == 0)
+		goto fail;
+	{
+		switch (zbs::uint8(in[0])) {
+		case 43: case 45:
+			break;
+		default:
+			goto fail;
+		}
+		in = in.sub(1);
+	}
+	native::capture(m, zbs::peg::capture_type::close, in);
+	native::call(m, 584);
+	goto L176;
+L584:
+	native::partial_commit(m, in);
+	goto L536;
+L592:
+	goto ret;
+L596:
+	return native::end(m, in);
+fail:
+	if (!native::fail(m, &in, &label))
+		return false;
+	switch (label) {
+	case 128:
+		goto L128;
+	case 288:
+		goto L288;
+	case 592:
+		goto L592;
+	}
+	return false;
+ret:
+	switch (native::return_(m)) {
+	case 8:
+		goto L8;
+	case 24:
+		goto L24;
+	case 120:
+		goto L120;
+	case 184:
+		goto L184;
+	case 280:
+		goto L280;
+	case 428:
+		goto L428;
+	case 488:
+		goto L488;
+	case 584:
+		goto L584;
+	}
+	return false;
+}
+
+} // anonymous namespace
+
+zbs::peg::program generated_expr() {
+	return zbs::peg::program(generated_expr_match);
+}
+
+// Generated by zbs::peg::generate_cpp()
+// DO NOT EDIT
+
+#include "zbs/peg.hh"
+#include "zbs/unicode/utf8.hh"
+#include <cstring>
+
+namespace {
+
+bool generated_nested_match(zbs::peg::matcher &m, zbs::slice<const char> in) {
+	using native = zbs::peg::matcher::native;
+	int label;
+
+	native::call(m, 8);
+	goto L16;
+L8:
+	goto L348;
+L16:
+	native::call(m, 24);
+	goto L72;
+L24:
+	if (in.len() == 0)
+		goto L68;
+	switch (zbs::uint8(in[0])) {
+	case 0: case 1: case 2: case 3: case 4: case 5: case 6: case 7:
+	case 8: case 9: case 10: case 11: case 12: case 13: case 14: case 15:
+	case 16: case 17: case 18: case 19: case 20: case 21: case 22: case 23:
+	case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31:
+	case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+	case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+	case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+	case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+	case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+	case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+	case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87:
+	case 88: case 89: case 90: case 91: case 92: case 93: case 94: case 95:
+	case 96: case 97: case 98: case 99: case 100: case 101: case 102: case 103:
+	case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111:
+	case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119:
+	case 120: case 121: case 122: case 123: case 124: case 125: case 126: case 127:
+	case 128: case 129: case 130: case 131: case 132: case 133: case 134: case 135:
+	case 136: case 137: case 138: case 139: case 140: case 141: case 142: case 143:
+	case 144: case 145: case 146: case 147: case 148: case 149: case 150: case 151:
+	case 152: case 153: case 154: case 155: case 156: case 157: case 158: case 159:
+	case 160: case 161: case 162: case 163: case 164: case 165: case 166: case 167:
+	case 168: case 169: case 170: case 171: case 172: case 173: case 174: case 175:
+	case 176: case 177: case 178: case 179: case 180: case 181: case 182: case 183:
+	case 184: case 185: case 186: case 187: case 188: case 189: case 190: case 191:
+	case 192: case 193: case 194: case 195: case 196: case 197: case 198: case 199:
+	case 200: case 201: case 202: case 203: case 204: case 205: case 206: case 207:
+	case 208: case 209: case 210: case 211: case 212: case 213: case 214: case 215:
+	case 216: case 217: case 218: case 219: case 220: case 221: case 222: case 223:
+	case 224: case 225: case 226: case 227: case 228: case 229: case 230: case 231:
+	case 232: case 233: case 234: case 235: case 236: case 237: case 238: case 239:
+	case 240: case 241: case 242: case 243: case 244: case 245: case 246: case 247:
+	case 248: case 249: case 250: case 251: case 252: case 253: case 254: case 255:
+		break;
+	default:
+		goto L68;
+	}
+	goto fail;
+L68:
+	goto ret;
+L72:
+	switch (native::memo_enter(m, 1, &in, 340)) {
+	case 0:
+		goto fail;
+	case 1:
+		goto ret;
+	}
+	if (in.len() == 0 || zbs::uint8(in[0]) != 40)
+		goto L304;
+	if (in.len() == 0 || zbs::uint8(in[0]) != 40)
+		goto L252;
+	native::choice(m, in, 252);
+	if (in.len() == 0 || zbs::uint8(in[0]) != 40)
+		goto L188;
+	native::choice(m, in, 188);
+	if (in.len() < 1 || std::memcmp(in.data(), "(", 1) != 0)
+		goto fail;
+	in = in.sub(1);
+	native::call(m, 144);
+	goto L72;
+L144:
+	native::capture(m, zbs::peg::capture_type(1), in);
+	if (in.len() < 1 || std::memcmp(in.data(), ")", 1) != 0)
+		goto fail;
+	in = in.sub(1);
+	native::capture(m, zbs::peg::capture_type::close, in);
+	if (in.len() < 1 || std::memcmp(in.data(), "x", 1) != 0)
+		goto fail;
+	in = in.sub(1);
+	native::commit(m);
+	goto L244;
+L188:
+	if (in.len() < 1 || std::memcmp(in.data(), "(", 1) != 0)
+		goto fail;
+	in = in.sub(1);
+	native::call(m, 208);
+	goto L72;
+L208:
+	native::capture(m, zbs::peg::capture_type(1), in);
+	if (in.len() < 1 || std::memcmp(in.data(), ")", 1) != 0)
+		goto fail;
+	in = in.sub(1);
+	native::capture(m, zbs::peg::capture_type::close, in);
+	if (in.len() < 1 || std::memcmp(in.data(), "y", 1) != 0)
+		goto fail;
+	in = in.sub(1);
+L244:
+	native::commit(m);
+	goto L328;
+L252:
+	if (in.len() < 1 || std::memcmp(in.data(), "(", 1) != 0)
+		goto fail;
+	in = in.sub(1);
+	native::call(m, 272);
+	goto L72;
+L272:
+	native::capture(m, zbs::peg::capture_type(1), in);
+	if (in.len() < 1 || std::memcmp(in.data(), ")", 1) != 0)
+		goto fail;
+	in = in.sub(1);
+	native::capture(m, zbs::peg::capture_type::close, in);
+	goto L328;
+L304:
+	native::capture(m, zbs::peg::capture_type(1), in);
+	if (in.len() < 1 || std::memcmp(in.data(), "a", 1) != 0)
+		goto fail;
+	in = in.sub(1);
+	native::capture(m, zbs::peg::capture_type::close, in);
+L328:
+	native::memo_commit(m, 1, in);
+	goto ret;
+L340:
+	native::memo_fail(m, 1, in);
+	goto fail;
+L348:
+	return native::end(m, in);
+fail:
+	if (!native::fail(m, &in, &label))
+		return false;
+	switch (label) {
+	case 188:
+		goto L188;
+	case 252:
+		goto L252;
+	case 340:
+		goto L340;
+	}
+	return false;
+ret:
+	switch (native::return_(m)) {
+	case 8:
+		goto L8;
+	case 24:
+		goto L24;
+	case 144:
+		goto L144;
+	case 208:
+		goto L208;
+	case 272:
+		goto L272;
+	}
+	return false;
+}
+
+} // anonymous namespace
+
+zbs::peg::program generated_nested() {
+	return zbs::peg::program(generated_nested_match);
+}
+
+// Generated by zbs::peg::generate_cpp()
+// DO NOT EDIT
+
+#include "zbs/peg.hh"
+#include "zbs/unicode/utf8.hh"
+#include <cstring>
+
+namespace {
+
+bool generated_keywords_match(zbs::peg::matcher &m, zbs::slice<const char> in) {
+	using native = zbs::peg::matcher::native;
+	int label;
+
+	while (in.len() != 0) {
+		switch (zbs::uint8(in[0])) {
+		case 9: case 32:
+			in = in.sub(1);
+			continue;
+		}
+		break;
+	}
+	native::capture(m, zbs::peg::capture_type(1), in);
+	if (in.len() == 0)
+		goto L312;
+	switch (zbs::uint8(in[0])) {
+	case 101: case 102: case 105:
+		break;
+	default:
+		goto L312;
+	}
+	if (in.len() == 0)
+		goto L288;
+	switch (zbs::uint8(in[0])) {
+	case 102: case 105:
+		break;
+	default:
+		goto L288;
+	}
+	if (in.len() == 0)
+		goto L260;
+	switch (zbs::uint8(in[0])) {
+	case 102: case 105:
+		break;
+	default:
+		goto L260;
+	}
+	native::choice(m, in, 260);
+	if (in.len() == 0 || zbs::uint8(in[0]) != 105)
+		goto L236;
+	if (in.len() == 0 || zbs::uint8(in[0]) != 105)
+		goto L212;
+	native::choice(m, in, 212);
+	if (in.len() < 2 || std::memcmp(in.data(), "if", 2) != 0)
+		goto fail;
+	in = in.sub(2);
+	native::commit(m);
+	goto L252;
+L212:
+	if (in.len() < 2 || std::memcmp(in.data(), "in", 2) != 0)
+		goto fail;
+	in = in.sub(2);
+	goto L252;
+L236:
+	if (in.len() < 3 || std::memcmp(in.data(), "for", 3) != 0)
+		goto fail;
+	in = in.sub(3);
+L252:
+	native::commit(m);
+	goto L328;
+L260:
+	if (in.len() < 8 || std::memcmp(in.data(), "function", 8) != 0)
+		goto fail;
+	in = in.sub(8);
+	goto L328;
+L288:
+	if (in.len() < 4 || std::memcmp(in.data(), "else", 4) != 0)
+		goto fail;
+	in = in.sub(4);
+	goto L328;
+L312:
+	if (in.len() < 5 || std::memcmp(in.data(), "while", 5) != 0)
+		goto fail;
+	in = in.sub(5);
+L328:
+	native::capture(m, zbs::peg::capture_type::close, in);
+	native::choice(m, in, 376);
+	if (in.len() == 0)
+		goto fail;
+	{
+		switch (zbs::uint8(in[0])) {
+		case 32: case 40: case 59:
+			break;
+		default:
+			goto fail;
+		}
+		in = in.sub(1);
+	}
+	in = native::rewind_commit(m);
+	goto L380;
+L376:
+	goto fail;
+L380:
+	native::choice(m, in, 440);
+	native::capture(m, zbs::peg::capture_type(1), in);
+	while (in.len() != 0) {
+		if (zbs::uint8(in[0]) < 128) {
+			switch (zbs::uint8(in[0])) {
+			case 0: case 1: case 2: case 3: case 4: case 5: case 6: case 7:
+			case 8: case 9: case 10: case 11: case 12: case 13: case 14: case 15:
+			case 16: case 17: case 18: case 19: case 20: case 21: case 22: case 23:
+			case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31:
+			case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+			case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+			case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+			case 56: case 57: case 58: case 60: case 61: case 62: case 63: case 64:
+			case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72:
+			case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+			case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88:
+			case 89: case 90: case 91: case 92: case 93: case 94: case 95: case 96:
+			case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104:
+			case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+			case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120:
+			case 121: case 122: case 123: case 124: case 125: case 126: case 127:
+				in = in.sub(1);
+				continue;
+			}
+			break;
+		}
+		static const zbs::rune ranges[] = {
+			128, 1114111,
+		};
+		const zbs::sized_rune r = zbs::unicode::utf8::decode_rune(in);
+		if (!native::in_ranges(ranges, 1, r.rune))
+			break;
+		in = in.sub(r.size);
+	}
+	native::capture(m, zbs::peg::capture_type::close, in);
+	native::commit(m);
+	goto L440;
+L440:
+	return native::end(m, in);
+fail:
+	if (!native::fail(m, &in, &label))
+		return false;
+	switch (label) {
+	case 212:
+		goto L212;
+	case 260:
+		goto L260;
+	case 376:
+		goto L376;
+	case 440:
+		goto L440;
+	}
+	return false;
+}
+
+} // anonymous namespace
+
+zbs::peg::program generated_keywords() {
+	return zbs::peg::program(generated_keywords_match);
+}
+
+// Generated by zbs::peg::generate_cpp()
+// DO NOT EDIT
+
+#include "zbs/peg.hh"
+#include "zbs/unicode/utf8.hh"
+#include <cstring>
+
+namespace {
+
+bool generated_non_ascii_match(zbs::peg::matcher &m, zbs::slice<const char> in) {
+	using native = zbs::peg::matcher::native;
+	int label;
+
+	native::capture(m, zbs::peg::capture_type(1), in);
+	while (in.len() != 0) {
+		if (zbs::uint8(in[0]) < 128)
+			break;
+		static const zbs::rune ranges[] = {
+			466, 466, 1078, 1078,
+		};
+		const zbs::sized_rune r = zbs::unicode::utf8::decode_rune(in);
+		if (!native::in_ranges(ranges, 2, r.rune))
+			break;
+		in = in.sub(r.size);
+	}
+	native::capture(m, zbs::peg::capture_type::close, in);
+	native::capture(m, zbs::peg::capture_type(1), in);
+	if (in.len() == 0)
+		goto fail;
+	if (zbs::uint8(in[0]) < 128)
+		goto fail;
+	{
+		static const zbs::rune ranges[] = {
+			1103, 1103,
+		};
+		const zbs::sized_rune r = zbs::unicode::utf8::decode_rune(in);
+		if (!native::in_ranges(ranges, 1, r.rune))
+			goto fail;
+		in = in.sub(r.size);
+	}
+	native::capture(m, zbs::peg::capture_type::close, in);
+	return native::end(m, in);
+fail:
+	if (!native::fail(m, &in, &label))
+		return false;
+	switch (label) {
+	}
+	return false;
+}
+
+} // anonymous namespace
+
+zbs::peg::program generated_non_ascii() {
+	return zbs::peg::program(generated_non_ascii_match);
+}
@@ -18,6 +18,15 @@ static void _MCC(_test_func_, __LINE__)(stf::test&);						\
 static stf::test _MCC(_test_, __LINE__)(_stf_runner, name, _MCC(_test_func_, __LINE__));	\
 static void _MCC(_test_func_, __LINE__)(stf::test &__T)
 
+// Benchmarks run only if the test binary is invoked with -bench. The body
+// should perform the measured operation STF_N times.
+#define STF_BENCH(name)										\
+static void _MCC(_bench_func_, __LINE__)(stf::bench&);						\
+static stf::bench _MCC(_bench_, __LINE__)(_stf_runner, name, _MCC(_bench_func_, __LINE__));	\
+static void _MCC(_bench_func_, __LINE__)(stf::bench &__B)
+
+#define STF_N __B.n
+
 #define STF_FUNC(name, ...)									\
 static void name(stf::test &__T, __VA_ARGS__)
 
@@ -47,8 +56,10 @@ namespace stf {
 
 struct runner;
 struct test;
+struct bench;
 
 typedef void (*functype)(test&);
+typedef void (*bench_functype)(bench&);
 
 struct test {
 	std::string name = "<unnamed>";
@@ -78,6 +89,14 @@ struct test {
 	}
 };
 
+struct bench {
+	std::string name = "<unnamed>";
+	bench_functype func;
+	int n = 1;
+
+	bench(runner &r, std::string name, bench_functype);
+};
+
 struct name_setter {
 	name_setter(runner &r, std::string name);
 };
@@ -85,17 +104,47 @@ struct name_setter {
 struct runner {
 	std::string suite_name;
 	std::vector<test> tests;
+	std::vector<bench> benchmarks;
 	int failed = 0;
 	bool verbose = false;
+	bool run_benchmarks = false;
 
 	void init(int argc, char **argv) {
 		for (int i = 0; i < argc; i++) {
 			if (strcmp(argv[i], "-v") == 0) {
 				verbose = true;
+			} else if (strcmp(argv[i], "-bench") == 0) {
+				run_benchmarks = true;
 			}
 		}
 	}
 
+	// Runs the benchmark with increasing n until it takes at least a second,
+	// similar to Go's testing package.
+	void run_bench(bench &b) {
+		const double target = 1e9;
+		double ns = 0;
+		for (b.n = 1;;) {
+			auto start = std::chrono::steady_clock::now();
+			(*b.func)(b);
+			auto end = std::chrono::steady_clock::now();
+			ns = std::chrono::duration_cast<std::chrono::nanoseconds>
+				(end-start).count();
+			if (ns >= target || b.n >= 1000000000) {
+				break;
+			}
+			double next = ns > 0 ? b.n * target / ns * 1.2 : b.n * 100.0;
+			if (next > b.n * 100.0) {
+				next = b.n * 100.0;
+			}
+			if (next < b.n + 1.0) {
+				next = b.n + 1.0;
+			}
+			b.n = next > 1e9 ? 1000000000 : int(next);
+		}
+		logf_force("%-50s %12d %14.1f ns/op\n", b.name.c_str(), b.n, ns / b.n);
+	}
+
 	void logf_force(const char *format, ...) {
 		va_list vl;
 		va_start(vl, format);
@@ -145,10 +194,15 @@ struct runner {
 		if (failed > 0) {
 			logf_force("FAIL\t%s\t%d.%03ds\n", suite_name.c_str(), s_part, ms_part);
 			return 1;
-		} else {
-			logf_force("ok\t%s\t%d.%03ds\n", suite_name.c_str(), s_part, ms_part);
-			return 0;
 		}
+		logf_force("ok\t%s\t%d.%03ds\n", suite_name.c_str(), s_part, ms_part);
+
+		if (run_benchmarks) {
+			for (auto &b: benchmarks) {
+				run_bench(b);
+			}
+		}
+		return 0;
 	}
 };
 
@@ -156,6 +210,10 @@ test::test(runner &r, std::string name, functype func): name(name), func(func) {
 	r.tests.push_back(*this);
 }
 
+bench::bench(runner &r, std::string name, bench_functype func): name(name), func(func) {
+	r.benchmarks.push_back(*this);
+}
+
 name_setter::name_setter(runner &r, std::string name) {
 	r.suite_name = name;
 }
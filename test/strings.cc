@@ -202,6 +202,53 @@ STF_TEST("strings::last_index_any(slice<const char>, slice<const char>)") {
 	}
 }
 
+STF_TEST("strings::char_set") {
+	struct char_set_test {
+		string s;
+		string chars;
+	};
+	string dots = "1....2....3....4";
+	string long_ascii = strings::repeat("abcdefghijklmnopqrstuvwxyz", 3);
+	vector<char_set_test> char_set_tests = {
+		{"", ""},
+		{"", "abc"},
+		{"abc", ""},
+		{"abba", "ab"},
+		{"a☺b☻c☹d", "uvw☻xyz"},
+		{"a☺b☻c☹d", "abcd"},
+		{"☺☺☺ x ☺☺☺", "☺"},
+		{"a.RegExp*", ".(|)*+?^$[]"},
+		{dots + dots + dots, " "},
+		{dots + dots + dots, "."},
+		{dots + "☺" + dots + dots, "☺"},
+		{long_ascii + "\x80" + long_ascii, "\xff"},
+		{long_ascii + "\x80" + long_ascii, "z"},
+		{"  " + long_ascii + "\t\n", " \t\n"},
+		{"\u2C6F\u2C6F\u0250\u0250\u2C6F\u2C6F", "\u2C6F"},
+		{"☺\xc0", "☺"},
+	};
+	for (const auto &test : char_set_tests) {
+		strings::char_set cs(test.chars);
+		auto f = [&](rune r) { return strings::contains_rune(test.chars, r); };
+
+		int i = strings::index_func(test.s, f);
+		STF_ASSERT(strings::index_any(test.s, cs) == i);
+		STF_ASSERT(strings::contains_any(test.s, cs) == (i != -1));
+		STF_ASSERT(strings::last_index_any(test.s, cs) ==
+			strings::last_index_func(test.s, f));
+		STF_ASSERT(strings::trim_left(test.s, cs) == strings::trim_left_func(test.s, f));
+		STF_ASSERT(strings::trim_right(test.s, cs) == strings::trim_right_func(test.s, f));
+		STF_ASSERT(strings::trim(test.s, cs) == strings::trim_func(test.s, f));
+	}
+
+	strings::char_set space(unicode::White_Space);
+	STF_ASSERT(!space.is_ascii());
+	STF_ASSERT(space.contains(' ') && space.contains(0x3000));
+	STF_ASSERT(!space.contains('x'));
+	STF_ASSERT(strings::trim("\u3000 \tfoo\u2029\n", space) == "foo");
+	STF_ASSERT(strings::index_any("abc\u00A0def", space) == 3);
+}
+
 string ten_runes(rune ch) {
 	char tmp[utf8::utf_max];
 	int n = utf8::encode_rune(tmp, ch);
@@ -332,6 +379,77 @@ STF_TEST("strings::count(slice<const char>, slice<const char>)") {
 	}
 }
 
+STF_TEST("strings::count_byte, index_byte and index_all_bytes") {
+	// long enough for the byte counters to be flushed a few times
+	string s = strings::repeat("a,bb,\n,ccc\n", 1000) + "dd,";
+	int commas = 0;
+	vector<int> want;
+	for (int i = 0; i < s.len(); i++) {
+		if (s[i] == ',') {
+			commas++;
+			want.append(i);
+		}
+	}
+	STF_ASSERT(strings::count_byte(s, ',') == commas);
+	STF_ASSERT(strings::count(s, ",") == commas);
+	STF_ASSERT(strings::count_byte(s, '\n') == 2000);
+	STF_ASSERT(strings::count_byte(s, 'x') == 0);
+	STF_ASSERT(strings::count_byte("", 'x') == 0);
+	STF_ASSERT(strings::count_byte("\xff\xff", '\xff') == 2);
+
+	vector<int> out = {-1};
+	strings::index_all_bytes(s, ',', &out);
+	STF_ASSERT(out.len() == want.len() + 1 && out[0] == -1);
+	STF_ASSERT(out.sub(1) == want.sub());
+	out.clear();
+	strings::index_all_bytes("x", ',', &out);
+	STF_ASSERT(out.len() == 0);
+
+	STF_ASSERT(strings::index_byte(s, ',') == 1);
+	STF_ASSERT(strings::index_byte(s, 'd') == s.len() - 3);
+	STF_ASSERT(strings::index_byte(s, 'x') == -1);
+	STF_ASSERT(strings::index_byte("", 'x') == -1);
+	STF_ASSERT(strings::index(s, "d") == s.len() - 3);
+}
+
+STF_TEST("strings::line_index") {
+	strings::line_index empty;
+	STF_ASSERT(empty.line_count() == 1);
+	STF_ASSERT(empty.position_of(0).line == 1 && empty.position_of(0).column == 1);
+
+	const char *text = "first\nsecond\n\nфорт\n";
+	strings::line_index idx(text);
+	STF_ASSERT(idx.line_count() == 5);
+	struct position_test {
+		int offset;
+		int line;
+		int column;
+	};
+	position_test position_tests[] = {
+		{0, 1, 1},
+		{4, 1, 5},
+		{5, 1, 6},
+		{6, 2, 1},
+		{12, 2, 7},
+		{13, 3, 1},
+		{14, 4, 1},
+		{20, 4, 7},
+		{22, 4, 9},
+		{23, 5, 1},
+	};
+	for (const auto &test : position_tests) {
+		auto pos = idx.position_of(test.offset);
+		if (pos.line != test.line || pos.column != test.column) {
+			STF_ERRORF("position_of(%d): expected %d:%d, got %d:%d", test.offset,
+				test.line, test.column, pos.line, pos.column);
+		}
+	}
+	STF_ASSERT(idx.line_start(1) == 0);
+	STF_ASSERT(idx.line_start(2) == 6);
+	STF_ASSERT(idx.line_start(4) == 14);
+	STF_ASSERT(idx.line_start(5) == 23);
+}
+
 STF_TEST("strings::equal_fold(slice<const char>, slice<const char>)") {
 	struct equal_fold_test {
 		string a;
@@ -350,6 +468,14 @@ STF_TEST("strings::equal_fold(slice<const char>, slice<const char>)") {
 		{"abcdefghijK", "abcdefghij\u212A", true},
 		{"abcdefghijkz", "abcdefghij\u212Ay", false},
 		{"abcdefghijKz", "abcdefghij\u212Ay", false},
+		{"Content-Type: text/html", "content-type: TEXT/HTML", true},
+		{"Content-Type: text/html", "content-type: TEXT/HTMX", false},
+		{"Content-Type: text/html", "content-type: text/htm", false},
+		{"accept-encoding/gzip/deflate", "ACCEPT-ENCODING/GZIP/DEFLATE", true},
+		{"@[`{ABCDEFGHIJKLMNOPQRSTUVWXYZ", "`{@[abcdefghijklmnopqrstuvwxyz", false},
+		{"ABCDEFGHIJKLMNOPQRSTUVWXYZαβδ", "abcdefghijklmnopqrstuvwxyzΑΒΔ", true},
+		{"ABCDEFGHIJKLMNOPQRSTUVWXYZ\u212A", "abcdefghijklmnopqrstuvwxyzk", true},
+		{"ABCDEFGH\u212AJKLMNOPQRSTUVWXYZ", "abcdefghkjklmnopqrstuvwxyz", true},
 	};
 	for (const auto &test : equal_fold_tests) {
 		STF_ASSERT(strings::equal_fold(test.a, test.b) == test.out);
@@ -357,6 +483,108 @@ STF_TEST("strings::equal_fold(slice<const char>, slice<const char>)") {
 	}
 }
 
+STF_TEST("strings::fold_key(slice<const char>)") {
+	struct fold_key_test {
+		string in;
+		string out;
+	};
+	vector<fold_key_test> fold_key_tests = {
+		{"", ""},
+		{"abc", "abc"},
+		{"Content-Type", "content-type"},
+		{"ΑΒΔ", "αβδ"},
+		{"\u212Aelvin", "kelvin"},
+		{"ΣΑΣ", "σασ"},
+		{"σας", "σασ"},
+		{"\u023A", "\u2C65"},
+	};
+	for (const auto &test : fold_key_tests) {
+		STF_ASSERT(strings::fold_key(test.in) == test.out);
+	}
+	STF_ASSERT(strings::fold_key("HeLLo \u212Aitty") == strings::fold_key("hello KITTY"));
+}
+
+STF_TEST("strings::index_fold(slice<const char>, slice<const char>)") {
+	struct index_fold_test {
+		string s;
+		string sep;
+		int out;
+	};
+	vector<index_fold_test> index_fold_tests = {
+		{"", "", 0},
+		{"", "a", -1},
+		{"abc", "", 0},
+		{"abc", "B", 1},
+		{"ABC", "bc", 1},
+		{"abc", "abcd", -1},
+		{"Content-Type: text/html", "content-type", 0},
+		{"X-Foo: 1\r\nCONTENT-type: text/html", "Content-Type", 10},
+		{"accept-encoding: gzip, deflate, br, zstd", "DEFLATE, BR", 23},
+		{"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxy", "XY", 56},
+		{"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx", "XY", -1},
+		// longer than the inline copy of the needle
+		{"yxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxy",
+			"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXY", 2},
+		{"the Kelvin scale", "kelvin", 4},
+		{"the kelvin scale", "KELVIN", 4},
+		{"miſsiſſippi", "SSIP", 6},
+		{"ΣΊΣΥΦΟΣ", "σίσυφος", 0},
+		{"Grüße aus KÖLN", "köln", 12},
+		{"Grüße aus KÖLN", "kÖln", 12},
+		{"Grüße aus KÖLN", "koln", -1},
+		{"\xff\xfe abc", "\xfe A", 1},
+		{"é\xa9", "\xa9", 2},
+	};
+	for (const auto &test : index_fold_tests) {
+		int out = strings::index_fold(test.s, test.sep);
+		if (out != test.out) {
+			STF_ERRORF("index_fold(%s, %s): expected %d, got %d",
+				test.s.c_str(), test.sep.c_str(), test.out, out);
+		}
+		STF_ASSERT(strings::contains_fold(test.s, test.sep) == (test.out >= 0));
+	}
+
+	STF_ASSERT(strings::count_fold("", "") == 1);
+	STF_ASSERT(strings::count_fold("ΣΑΣ", "") == 4);
+	STF_ASSERT(strings::count_fold("aAaAa", "aa") == 2);
+	STF_ASSERT(strings::count_fold("KKk", "KK") == 1);
+	STF_ASSERT(strings::count_fold("σας ΣΑΣ", "Σ") == 4);
+
+	// compare against a brute force search with equal_fold
+	const char *alphabet[] = {"a", "A", "k", "K", "K", "s", "S", "ſ",
+		"σ", "ς", "Σ", "é", "É", "-", "\xff"};
+	const int alphabet_len = sizeof(alphabet) / sizeof(alphabet[0]);
+	unsigned seed = 1;
+	auto random_string = [&](int runes) {
+		string out;
+		for (int i = 0; i < runes; i++) {
+			seed = seed * 1103515245 + 12345;
+			out.append(alphabet[(seed >> 16) % alphabet_len]);
+		}
+		return out;
+	};
+	for (int i = 0; i < 2000; i++) {
+		string s = random_string(40);
+		string sep = random_string(1 + i % 3);
+		int want = -1;
+		for (int j = 0; j < s.len() && want == -1; j += utf8::decode_rune(s.sub(j)).size) {
+			for (int k = j; k < s.len();) {
+				k += utf8::decode_rune(s.sub(k)).size;
+				if (strings::equal_fold(s.sub(j, k), sep)) {
+					want = j;
+					break;
+				}
+			}
+		}
+		int got = strings::index_fold(s, sep);
+		if (got != want) {
+			STF_ERRORF("index_fold(%s, %s): expected %d, got %d",
+				s.c_str(), sep.c_str(), want, got);
+			break;
+		}
+	}
+}
+
 STF_TEST("strings::fields(slice<const char>)") {
 	struct fields_test {
 		string s;
@@ -713,3 +941,235 @@ STF_TEST("strings::trim_func(slice<const char>, func<bool(rune)>)") {
 		STF_ASSERT(strings::trim_func(test.in, test.f) == test.out);
 	}
 }
+
+STF_TEST("strings::builder") {
+	strings::builder b;
+	STF_ASSERT(b.len() == 0);
+	STF_ASSERT(b.take() == "");
+
+	b.write("hello");
+	b.write_byte(',');
+	b.write_byte(' ');
+	b.write_rune(U'世');
+	b.write_rune(U'界');
+	b.write_rune(-1);
+	STF_ASSERT(b.sub() == "hello, 世界�");
+
+	b.reset();
+	STF_ASSERT(b.len() == 0 && b.cap() > 0);
+	b.write_int(0);
+	b.write_byte(' ');
+	b.write_int(-42);
+	b.write_byte(' ');
+	b.write_int(std::numeric_limits<int64>::min());
+	b.write_byte(' ');
+	b.write_uint(std::numeric_limits<uint64>::max(), 16);
+	b.write_byte(' ');
+	b.write_uint(5, 2);
+	STF_ASSERT(b.sub() == "0 -42 -9223372036854775808 ffffffffffffffff 101");
+
+	struct float_test {
+		double v;
+		char fmt;
+		int prec;
+		string out;
+	};
+	vector<float_test> float_tests = {
+		{1, 'g', -1, "1"},
+		{0.1, 'g', -1, "0.1"},
+		{-2.5, 'g', -1, "-2.5"},
+		{1.0/3, 'g', -1, "0.3333333333333333"},
+		{1e21, 'g', -1, "1e+21"},
+		{123456, 'e', -1, "1.23456e+05"},
+		{0.000125, 'f', -1, "0.000125"},
+		{1e6, 'f', -1, "1000000"},
+		{3.14159, 'f', 2, "3.14"},
+		{3.14159, 'e', 3, "3.142e+00"},
+		{1e22, 'f', -1, "1" + string(strings::repeat("0", 22))},
+	};
+	for (const auto &test : float_tests) {
+		b.reset();
+		b.write_float(test.v, test.fmt, test.prec);
+		if (b.sub() != test.out) {
+			STF_ERRORF("write_float(%g, '%c', %d): expected %s, got %s",
+				test.v, test.fmt, test.prec,
+				test.out.c_str(), string(b.sub()).c_str());
+		}
+	}
+
+	strings::builder b2;
+	b2.grow(100);
+	STF_ASSERT(b2.cap() >= 100);
+	const char *data = b2.sub().data();
+	for (int i = 0; i < 100; i++) {
+		b2.write_byte('a' + i % 26);
+	}
+	STF_ASSERT(b2.sub().data() == data);
+	string s = b2.take();
+	STF_ASSERT(s.data() == data);
+	STF_ASSERT(s.len() == 100 && s.c_str()[100] == '\0');
+	STF_ASSERT(b2.len() == 0 && b2.cap() == 0);
+}
+
+STF_TEST("strings::replacer") {
+	struct replacer_test {
+		const strings::replacer *r;
+		string in;
+		string out;
+	};
+
+	strings::replacer html_escaper({
+		"&", "&amp;",
+		"<", "&lt;",
+		">", "&gt;",
+		R"(")", "&quot;",
+		"'", "&apos;",
+	});
+	strings::replacer html_unescaper({
+		"&amp;", "&",
+		"&lt;", "<",
+		"&gt;", ">",
+		"&quot;", R"(")",
+		"&apos;", "'",
+	});
+	strings::replacer capital_letters({"a", "A", "b", "B"});
+	strings::replacer inc({"a", "b", "b", "c", "c", "d", "d", "e", "e", "f"});
+	strings::replacer single({"abc", "[]"});
+	strings::replacer empty({"", "X"});
+	strings::replacer priority({"a", "1", "aa", "2", "aaa", "3"});
+	strings::replacer priority2({"aaa", "3", "aa", "2", "a", "1"});
+	strings::replacer blank({"\n", "<BR>\n", "-", "", "_", ""});
+	strings::replacer mixed({"ab", "X", "b", "Y", "☺", ":)"});
+
+	vector<replacer_test> replacer_tests = {
+		{&html_escaper, "No changes", "No changes"},
+		{&html_escaper, "I <3 escaping & stuff", "I &lt;3 escaping &amp; stuff"},
+		{&html_escaper, "&&&", "&amp;&amp;&amp;"},
+		{&html_escaper, "", ""},
+		{&html_unescaper, "&amp;&amp;&amp;", "&&&"},
+		{&html_unescaper, "&lt;b&gt;HTMLX&lt;/b&gt;", "<b>HTMLX</b>"},
+		{&html_unescaper, "&amp;lt;", "&lt;"},
+		{&capital_letters, "brad", "BrAd"},
+		{&capital_letters, strings::repeat("a", 100), strings::repeat("A", 100)},
+		{&inc, "abcdefg", "bcdeffg"},
+		{&single, "xabcxabcabcx", "x[]x[][]x"},
+		{&single, "ababababc", "ababab[]"},
+		{&empty, "", "X"},
+		{&empty, "abc", "XaXbXcX"},
+		{&empty, "☺x", "X☺XxX"},
+		{&priority, "aaaa", "1111"},
+		{&priority2, "aaaa", "31"},
+		{&blank, "oo\n--__--oo", "oo<BR>\noo"},
+		{&mixed, "abb☺a", "XY:)a"},
+	};
+	for (const auto &test : replacer_tests) {
+		auto out = test.r->replace(test.in);
+		if (out != test.out) {
+			STF_ERRORF("replace(%s): expected %s, got %s",
+				test.in.c_str(), test.out.c_str(), out.c_str());
+		}
+	}
+
+	strings::builder b;
+	b.write("<p>");
+	html_escaper.replace(b, "a < b");
+	b.write("</p>");
+	STF_ASSERT(b.sub() == "<p>a &lt; b</p>");
+}
+
+STF_TEST("strings::index_if and friends") {
+	auto is_digit = [](rune r) { return r >= '0' && r <= '9'; };
+	STF_ASSERT(strings::index_if("abc123☺", is_digit) == 3);
+	STF_ASSERT(strings::index_if("abc☺", is_digit) == -1);
+	STF_ASSERT(strings::last_index_if("12abc3☺", is_digit) == 5);
+	STF_ASSERT(strings::trim_if("12☺abc☺34", is_digit) == "☺abc☺");
+	STF_ASSERT(strings::trim_left_if("12☺abc34", is_digit) == "☺abc34");
+	STF_ASSERT(strings::trim_right_if("12abc☺34", is_digit) == "12abc☺");
+	STF_ASSERT(strings::trim_if("1234", is_digit) == "");
+	STF_ASSERT(strings::index_if("x　y", unicode::is_space) == 1);
+
+	auto f = strings::fields_if("1a22b333", is_digit);
+	STF_ASSERT(f.len() == 2 && f[0] == "a" && f[1] == "b");
+
+	auto m = strings::transform([](rune r) { return r == 'a' ? U'☺' : r; }, "banana");
+	STF_ASSERT(m == "b☺n☺n☺");
+	m = strings::transform([](rune r) { return r == 'a' ? -1 : r; }, "banana");
+	STF_ASSERT(m == "bnn");
+}
+
+static volatile int bench_sink;
+
+static string bench_text() {
+	return strings::repeat("The quick brown fox jumps over the lazy dog; "
+		"Съешь же ещё этих мягких французских булок. ", 16) + "!";
+}
+
+STF_BENCH("strings::index_func(lambda)") {
+	string s = bench_text();
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = strings::index_func(s, [](rune r) { return r == '!'; });
+	}
+}
+
+STF_BENCH("strings::index_if(lambda)") {
+	string s = bench_text();
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = strings::index_if(s, [](rune r) { return r == '!'; });
+	}
+}
+
+STF_BENCH("strings::fields_func(unicode::is_space)") {
+	string s = bench_text();
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = strings::fields_func(s, unicode::is_space).len();
+	}
+}
+
+STF_BENCH("strings::fields_if(unicode::is_space)") {
+	string s = bench_text();
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = strings::fields_if(s, unicode::is_space).len();
+	}
+}
+
+STF_BENCH("strings::map(rot13)") {
+	string s = bench_text();
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = strings::map(rot13, s).len();
+	}
+}
+
+STF_BENCH("strings::transform(rot13)") {
+	string s = bench_text();
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = strings::transform(rot13, s).len();
+	}
+}
+
+STF_BENCH("strings::index(to_lower(s), to_lower(sep))") {
+	string s = bench_text();
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = strings::index(strings::to_lower(s), strings::to_lower("LAZY DOG!"));
+	}
+}
+
+STF_BENCH("strings::index_fold(s, sep)") {
+	string s = bench_text();
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = strings::index_fold(s, "LAZY DOG!");
+	}
+}
+
+STF_BENCH("strings::count(s, \"\\n\")") {
+	string s = strings::repeat(bench_text() + "\n", 64);
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = strings::count(s, "\n");
+	}
+}
+
+STF_BENCH("strings::line_index(s)") {
+	string s = strings::repeat(bench_text() + "\n", 64);
+	for (int i = 0; i < STF_N; i++) {
+		bench_sink = strings::line_index(s).line_count();
+	}
+}
@@ -338,6 +338,28 @@ STF_TEST("unicode::simple_fold(rune)") {
 	}
 }
 
+STF_TEST("unicode::fold_canonical(rune)") {
+	STF_ASSERT(unicode::fold_canonical('A') == 'a');
+	STF_ASSERT(unicode::fold_canonical('a') == 'a');
+	STF_ASSERT(unicode::fold_canonical('1') == '1');
+	STF_ASSERT(unicode::fold_canonical(U'\u212A') == 'k');
+	STF_ASSERT(unicode::fold_canonical(U'\u017F') == 's');
+	STF_ASSERT(unicode::fold_canonical(U'\u03C2') == U'\u03C3');
+	STF_ASSERT(unicode::fold_canonical(U'\u0130') == U'\u0130');
+	STF_ASSERT(unicode::fold_canonical(U'\U00010400') == U'\U00010428');
+	STF_ASSERT(unicode::fold_canonical(-1) == -1);
+	STF_ASSERT(unicode::fold_canonical(1 << 30) == 1 << 30);
+
+	// every member of a simple_fold orbit has the same canonical rune
+	for (rune r = 0; r <= unicode::max_rune; r++) {
+		rune c = unicode::fold_canonical(r);
+		if (unicode::fold_canonical(unicode::simple_fold(r)) != c) {
+			STF_ERRORF("fold_canonical(simple_fold(%#x)) != %#x", r, c);
+			break;
+		}
+	}
+}
+
 struct case_test {
 	unicode::case_t cas;
 	rune in;
@@ -482,3 +504,115 @@ STF_TEST("unicode::to_title(rune)") {
 }
 
 // TODO: port more tests from Go
+
+STF_TEST("unicode::normalize(norm_form, slice<const char>)") {
+	struct normalize_test {
+		string in;
+		string nfc;
+		string nfd;
+		string nfkc;
+		string nfkd;
+	};
+	vector<normalize_test> normalize_tests = {
+		{"", "", "", "", ""},
+		{"abc", "abc", "abc", "abc", "abc"},
+		{"\u00C5", "\u00C5", "A\u030A", "\u00C5", "A\u030A"},
+		{"A\u030A", "\u00C5", "A\u030A", "\u00C5", "A\u030A"},
+		{"\u212B", "\u00C5", "A\u030A", "\u00C5", "A\u030A"},
+		{"\u1E9B\u0323", "\u1E9B\u0323", "\u017F\u0323\u0307", "\u1E69", "s\u0323\u0307"},
+		{"q\u0307\u0323", "q\u0323\u0307", "q\u0323\u0307", "q\u0323\u0307", "q\u0323\u0307"},
+		{"d\u0307\u0323", "\u1E0D\u0307", "d\u0323\u0307", "\u1E0D\u0307", "d\u0323\u0307"},
+		{"\uFB01", "\uFB01", "\uFB01", "fi", "fi"},
+		{"x\u00B2", "x\u00B2", "x\u00B2", "x2", "x2"},
+		{"\u0958", "\u0915\u093C", "\u0915\u093C", "\u0915\u093C", "\u0915\u093C"},
+		{"\u0B47\u0B3E", "\u0B4B", "\u0B47\u0B3E", "\u0B4B", "\u0B47\u0B3E"},
+		{"\u1100\u1161", "\uAC00", "\u1100\u1161", "\uAC00", "\u1100\u1161"},
+		{"\uAC00\u11A8", "\uAC01", "\u1100\u1161\u11A8", "\uAC01", "\u1100\u1161\u11A8"},
+		{"\u3131\u314F", "\u3131\u314F", "\u3131\u314F", "\uAC00", "\u1100\u1161"},
+		{"\u0301a", "\u0301a", "\u0301a", "\u0301a", "\u0301a"},
+		{"e\u0301 \u00E9", "\u00E9 \u00E9", "e\u0301 e\u0301", "\u00E9 \u00E9", "e\u0301 e\u0301"},
+		{"\xff\u0301e\u0301\xc0\u0301", "\xff\u0301\u00E9\xc0\u0301", "\xff\u0301e\u0301\xc0\u0301",
+			"\xff\u0301\u00E9\xc0\u0301", "\xff\u0301e\u0301\xc0\u0301"},
+		{"e\xc0\u0301", "e\xc0\u0301", "e\xc0\u0301", "e\xc0\u0301", "e\xc0\u0301"},
+	};
+	unicode::norm_form forms[] = {unicode::NFC, unicode::NFD, unicode::NFKC, unicode::NFKD};
+	const char *names[] = {"NFC", "NFD", "NFKC", "NFKD"};
+	for (const auto &test : normalize_tests) {
+		const string *expected[] = {&test.nfc, &test.nfd, &test.nfkc, &test.nfkd};
+		for (int i = 0; i < 4; i++) {
+			string out = unicode::normalize(forms[i], test.in);
+			if (out != *expected[i]) {
+				STF_ERRORF("normalize(%s, %s): expected %s, got %s", names[i],
+					test.in.c_str(), expected[i]->c_str(), out.c_str());
+			}
+			if (unicode::is_normalized(forms[i], test.in) != (test.in == *expected[i])) {
+				STF_ERRORF("is_normalized(%s, %s): expected %s", names[i],
+					test.in.c_str(), test.in == *expected[i] ? "true" : "false");
+			}
+		}
+	}
+
+	// normalized input is returned as is
+	string buf;
+	string in = "Gr\u00FC\u00DFe, \u4E16\u754C";
+	auto out = unicode::normalize(unicode::NFC, in, &buf);
+	STF_ASSERT(out.data() == in.data() && out.len() == in.len());
+	STF_ASSERT(buf.len() == 0);
+	out = unicode::normalize(unicode::NFD, in, &buf);
+	STF_ASSERT(out.data() == buf.data());
+	STF_ASSERT(out == "Grüße, 世界");
+}
+
+STF_TEST("unicode::rune_set") {
+	const unicode::range_table *tables[] = {&unicode::letter, &unicode::White_Space,
+		&unicode::digit, &unicode::Greek};
+	for (const unicode::range_table *t : tables) {
+		unicode::rune_set set(*t);
+		for (rune r = -1; r <= unicode::max_rune + 1; r++) {
+			if (set.contains(r) != unicode::is(*t, r)) {
+				STF_ERRORF("rune_set.contains(%X) != is(%X)", r, r);
+				break;
+			}
+		}
+	}
+
+	unicode::rune_set empty;
+	STF_ASSERT(!empty.contains(0) && !empty.contains('a') && !empty.contains(0x10000));
+	STF_ASSERT(empty.ranges().len() == 0);
+
+	const rune runes[] = {'c', 'a', 'b', 0x4E16, 0x1F600, 'a', 0x4E17};
+	unicode::rune_set abc(runes);
+	STF_ASSERT(abc.ranges().len() == 3);
+	STF_ASSERT(abc.contains('a') && abc.contains('c') && !abc.contains('d'));
+	STF_ASSERT(abc.contains(0x4E17) && !abc.contains(0x4E18) && abc.contains(0x1F600));
+
+	const unicode::rune_range ranges[] = {{'0', '9'}, {0xFF00, 0x10100}, {'5', 'A'}, {'z', 'a'}};
+	unicode::rune_set rs(ranges);
+	STF_ASSERT(rs.ranges().len() == 2);
+	STF_ASSERT(rs.ranges()[0].lo == '0' && rs.ranges()[0].hi == 'A');
+	STF_ASSERT(rs.contains(0xFFFF) && rs.contains(0x10000) && rs.contains(0x10100));
+	STF_ASSERT(!rs.contains(0xFEFF) && !rs.contains(0x10101) && !rs.contains('a'));
+
+	unicode::rune_set u = rs | abc;
+	unicode::rune_set d = u - abc;
+	STF_ASSERT(u.contains('a') && u.contains('5') && u.contains(0x4E16));
+	STF_ASSERT(!d.contains('a') && d.contains('5') && !d.contains(0x4E16));
+	STF_ASSERT(d.ranges().len() == rs.ranges().len());
+	for (int i = 0; i < d.ranges().len(); i++) {
+		STF_ASSERT(d.ranges()[i].lo == rs.ranges()[i].lo);
+		STF_ASSERT(d.ranges()[i].hi == rs.ranges()[i].hi);
+	}
+	unicode::rune_set holes = unicode::rune_set(unicode::letter) - abc;
+	STF_ASSERT(!holes.contains('a') && holes.contains('d') && !holes.contains(0x4E16));
+	STF_ASSERT(holes.contains(0x4E15) && holes.contains(0x4E18));
+
+	const rune underscore[] = {'_'};
+	unicode::rune_set ident = unicode::rune_set(unicode::letter) |
+		unicode::rune_set(unicode::digit) | unicode::rune_set(underscore);
+	STF_ASSERT(ident.span("") == 0);
+	STF_ASSERT(ident.span("hello_world42 = 1") == 13);
+	STF_ASSERT(ident.span("Grüße_мир_世界_0123456789abcdef+") == 38);
+	STF_ASSERT(ident.span("abc\xff") == 3);
+	STF_ASSERT(ident.span("abcdefghijklmnopqrstuvwxyz☺") == 26);
+	STF_ASSERT(unicode::rune_set(unicode::White_Space).span(" \t\n　 x") == 9);
+}
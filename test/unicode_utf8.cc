@@ -273,3 +273,78 @@ STF_TEST("utf8::rune_start(char)") {
 		}
 	}
 }
+
+STF_TEST("utf8::decoder") {
+	vector<string> inputs = {
+		"",
+		"hello, world",
+		"Hello, 世界",
+		"☺☻☹ abc \U0010FFFF \u0080",
+		"\xed\xa0\x80\x80", // surrogate
+		"a\xc0\xc0 b\xe2\x98 c\xf4\x90\x80\x80 d",
+		"trailing \xe2\x98",
+		"\xf0\x9f",
+		"\x80\x80\x80 \xe4\xb8\x96\xe4",
+		"0123456789abcdef0123456789abcdef☺0123456789abcdef0123456789",
+	};
+	for (const auto &in : inputs) {
+		vector<rune> expected;
+		for (int i = 0; i < in.len();) {
+			auto r = utf8::decode_rune(in.sub(i));
+			expected.append(r.rune);
+			i += r.size;
+		}
+
+		for (int chunk = 1; chunk <= 7; chunk++) {
+			// runes
+			utf8::decoder d;
+			vector<rune> runes;
+			rune r;
+			for (int i = 0; i < in.len(); i += chunk) {
+				d.feed(in.sub(i, std::min(i + chunk, in.len())));
+				while (d.next(&r)) {
+					runes.append(r);
+				}
+			}
+			d.finish();
+			while (d.next(&r)) {
+				runes.append(r);
+			}
+			STF_ASSERT(!d.pending());
+			if (runes.sub() != expected.sub()) {
+				STF_ERRORF("decoder::next(%s), chunk size %d: mismatch",
+					in.c_str(), chunk);
+			}
+
+			// spans
+			d.reset();
+			string joined;
+			int invalid = 0;
+			utf8::decoder::span s;
+			for (int i = 0; i < in.len(); i += chunk) {
+				d.feed(in.sub(i, std::min(i + chunk, in.len())));
+				while (d.next_span(&s)) {
+					STF_ASSERT(s.data.len() > 0);
+					STF_ASSERT(utf8::valid(s.data) == s.valid);
+					invalid += s.valid ? 0 : 1;
+					joined.append(s.data);
+				}
+			}
+			d.finish();
+			while (d.next_span(&s)) {
+				STF_ASSERT(utf8::valid(s.data) == s.valid);
+				invalid += s.valid ? 0 : 1;
+				joined.append(s.data);
+			}
+			STF_ASSERT(joined == in);
+
+			int expected_invalid = 0;
+			for (int i = 0; i < in.len();) {
+				auto r = utf8::decode_rune(in.sub(i));
+				expected_invalid += r.rune == utf8::rune_error && r.size == 1;
+				i += r.size;
+			}
+			STF_ASSERT(invalid == expected_invalid);
+		}
+	}
+}
@@ -0,0 +1,4 @@
+#!/bin/bash
+
+go run makefloattables.go
+cp fmt_private_tables.inl ../src
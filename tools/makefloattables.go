@@ -0,0 +1,76 @@
+// +build ignore
+
+// Table generator for the shortest float formatting in fmt.cc.
+
+package main
+
+import (
+	"bufio"
+	"fmt"
+	"log"
+	"math/big"
+	"os"
+)
+
+const (
+	kMin = -324
+	kMax = 292
+)
+
+// floor(e * log2(10)), the same approximation as flog2pow10 in fmt.cc
+func flog2pow10(e int) int {
+	return int((int64(e) * 913124641741) >> 38)
+}
+
+func main() {
+	f, err := os.Create("fmt_private_tables.inl")
+	if err != nil {
+		log.Fatal(err)
+	}
+	defer f.Close()
+	w := bufio.NewWriter(f)
+	defer w.Flush()
+
+	fmt.Fprint(w, header)
+	fmt.Fprintf(w, "static const int pow10_k_min = %d;\n", kMin)
+	fmt.Fprintf(w, "static const int pow10_k_max = %d;\n\n", kMax)
+	fmt.Fprintf(w, "static const uint64 pow10_g[%d][2] = {\n", kMax-kMin+1)
+
+	lo := new(big.Int).Lsh(big.NewInt(1), 125)
+	hi := new(big.Int).Lsh(big.NewInt(1), 126)
+	mask := new(big.Int).Sub(new(big.Int).Lsh(big.NewInt(1), 63), big.NewInt(1))
+	ten := big.NewInt(10)
+	for k := kMin; k <= kMax; k++ {
+		// g = floor(10^-k * 2^r) + 1, where r = 125 - flog2pow10(-k)
+		r := 125 - flog2pow10(-k)
+		g := new(big.Int)
+		if k <= 0 {
+			g.Exp(ten, big.NewInt(int64(-k)), nil)
+			if r >= 0 {
+				g.Lsh(g, uint(r))
+			} else {
+				g.Rsh(g, uint(-r))
+			}
+		} else {
+			g.Lsh(big.NewInt(1), uint(r))
+			g.Quo(g, new(big.Int).Exp(ten, big.NewInt(int64(k)), nil))
+		}
+		g.Add(g, big.NewInt(1))
+		if g.Cmp(lo) < 0 || g.Cmp(hi) >= 0 {
+			log.Fatalf("g(%d) is out of range", k)
+		}
+		g1 := new(big.Int).Rsh(g, 63)
+		g0 := new(big.Int).And(g, mask)
+		fmt.Fprintf(w, "\t{0x%016X, 0x%016X}, // %d\n", g1.Uint64(), g0.Uint64(), k)
+	}
+	fmt.Fprint(w, "};\n")
+}
+
+const header = `// Generated by running makefloattables.go
+// DO NOT EDIT
+
+// pow10_g[k - pow10_k_min] is the 126-bit approximation of 10^-k used by the
+// shortest float formatting: floor(10^-k * 2^r) + 1, where r is chosen so that
+// the value is in the range [2^125, 2^126). The value is split into the high
+// and the low 63 bits.
+`
@@ -0,0 +1,8 @@
+#!/bin/bash
+set -e
+
+# needs the library built by waf
+g++ -std=c++11 -I../src -I../build makepegtest.cc ../build/src/libzbs.a -o makepegtest
+./makepegtest > peg_generated.inl
+rm makepegtest
+cp peg_generated.inl ../test
@@ -0,0 +1,49 @@
+// Generator of test/peg_generated.inl, the grammars of the generate_cpp()
+// test translated to C++. Keep them in sync with test/peg.cc.
+
+#include "zbs.hh"
+#include "zbs/peg.hh"
+#include <cstdio>
+
+using namespace zbs::peg;
+
+static program expr() {
+	grammar g;
+	g.rule("expr", V("term") >> *(C(S("+-")) >> V("term")) >> !any());
+	g.rule("term", V("factor") >> *(C(S("*/")) >> V("factor")));
+	g.rule("factor", C(+R("09")) | "(" >> V("sum") >> ")" | C(+R("ая")));
+	g.rule("sum", V("term") >> *(C(S("+-")) >> V("term")));
+	return compile(g);
+}
+
+static program nested() {
+	grammar g;
+	g.rule("s", V("r") >> !any());
+	g.rule("r",
+		"(" >> V("r") >> C(P(")")) >> "x" |
+		"(" >> V("r") >> C(P(")")) >> "y" |
+		"(" >> V("r") >> C(P(")")) |
+		C(P("a")), true);
+	return compile(g);
+}
+
+static program keywords() {
+	ast kw = P("if") | "in" | "for" | "function" | "else" | "while";
+	return compile(*S(" \t") >> C(kw) >> &S(" ;(") >> -C(*(any() - ";")));
+}
+
+static program non_ascii() {
+	return compile(C(*S("жǒ")) >> C(S("aя") - S("a")));
+}
+
+int main() {
+	zbs::string out;
+	out.append(generate_cpp(expr(), "generated_expr"));
+	out.append('\n');
+	out.append(generate_cpp(nested(), "generated_nested"));
+	out.append('\n');
+	out.append(generate_cpp(keywords(), "generated_keywords"));
+	out.append('\n');
+	out.append(generate_cpp(non_ascii(), "generated_non_ascii"));
+	fwrite(out.data(), 1, out.len(), stdout);
+}
@@ -30,18 +30,21 @@ func main() {
 	defer o.close()
 	loadChars() // always needed
 	loadCasefold()
+	loadCompositionExclusions()
 	printCategories()
 	printScriptOrProperty(false)
 	printScriptOrProperty(true)
 	printCases()
 	printLatinProperties()
 	printCasefold()
+	printNormalization()
 	printSizes()
 	printFooter()
 }
 
 var dataURL = flag.String("data", "", "full URL for UnicodeData.txt; defaults to --url/UnicodeData.txt")
 var casefoldingURL = flag.String("casefolding", "", "full URL for CaseFolding.txt; defaults to --url/CaseFolding.txt")
+var exclusionsURL = flag.String("exclusions", "", "full URL for CompositionExclusions.txt; defaults to --url/CompositionExclusions.txt")
 var url = flag.String("url",
 	"http://www.unicode.org/Public/6.2.0/ucd/",
 	"URL of Unicode database directory")
@@ -228,6 +231,9 @@ type Char struct {
 	titleCase rune
 	foldCase  rune // simple case folding
 	caseOrbit rune // next in simple case folding orbit
+	ccc       uint8  // canonical combining class
+	decomp    []rune // decomposition mapping
+	compat    bool   // decomp is a compatibility mapping
 }
 
 // Scripts.txt has form:
@@ -299,6 +305,14 @@ func parseCategory(line string) (state State) {
 	default:
 		char.letter(field[FSimpleUppercaseMapping], field[FSimpleLowercaseMapping], field[FSimpleTitlecaseMapping])
 	}
+	if field[FCanonicalCombiningClass] != "" {
+		ccc, err := strconv.ParseUint(field[FCanonicalCombiningClass], 10, 8)
+		if err != nil {
+			logger.Fatalf("%U: bad combining class: %s", point, err)
+		}
+		char.ccc = uint8(ccc)
+	}
+	char.decomposition(field[FDecompositionTypeAndMapping])
 	switch {
 	case strings.Index(field[FName], ", First>") > 0:
 		state = SFirst
@@ -322,6 +336,25 @@ func (char *Char) letter(u, l, t string) {
 	char.titleCase = char.letterValue(t, "T")
 }
 
+// The decomposition field has form:
+//	0041 0300
+//	<compat> 0020 0308
+func (char *Char) decomposition(s string) {
+	f := strings.Fields(s)
+	if len(f) > 0 && f[0][0] == '<' {
+		char.compat = true
+		f = f[1:]
+	}
+	for _, h := range f {
+		v, err := strconv.ParseUint(h, 16, 64)
+		if err != nil {
+			char.dump("D")
+			logger.Fatalf("%U: bad decomposition(%s): %s", char.codePoint, s, err)
+		}
+		char.decomp = append(char.decomp, rune(v))
+	}
+}
+
 func (char *Char) letterValue(s string, cas string) rune {
 	if s == "" {
 		return 0
@@ -450,6 +483,37 @@ func loadCasefold() {
 	}
 }
 
+var compositionExclusions = make(map[rune]bool)
+
+// CompositionExclusions.txt has form:
+//	0958    #  DEVANAGARI LETTER QA
+func loadCompositionExclusions() {
+	if *exclusionsURL == "" {
+		flag.Set("exclusions", *url+"CompositionExclusions.txt")
+	}
+	input := open(*exclusionsURL)
+	defer input.close()
+	scanner := bufio.NewScanner(input)
+	for scanner.Scan() {
+		line := scanner.Text()
+		if i := strings.Index(line, "#"); i >= 0 {
+			line = line[:i]
+		}
+		line = strings.TrimSpace(line)
+		if len(line) == 0 {
+			continue
+		}
+		p, err := strconv.ParseUint(line, 16, 64)
+		if err != nil {
+			logger.Fatalf("CompositionExclusions.txt %.5s...: %s", line, err)
+		}
+		compositionExclusions[rune(p)] = true
+	}
+	if scanner.Err() != nil {
+		logger.Fatal(scanner.Err())
+	}
+}
+
 const progHeader = `// Generated by running maketables.go
 // DO NOT EDIT
 
@@ -1200,6 +1264,8 @@ func printCasefold() {
 	}
 
 	printCaseOrbit()
+	printAsciiFold()
+	printFoldCanonical()
 
 	// Tables of category and script folding exceptions: code points
 	// that must be added when interpreting a particular category/script
@@ -1318,6 +1384,399 @@ func printCaseOrbit() {
 	ppt("const slice<const fold_pair> case_orbit(_case_orbit);\n\n");
 }
 
+// simpleFold returns the next rune in the simple case folding orbit of i, the
+// same value unicode::simple_fold computes at runtime.
+func simpleFold(i rune) rune {
+	c := &chars[i]
+	if c.caseOrbit != 0 {
+		return c.caseOrbit
+	}
+	if c.lowerCase != i && c.lowerCase != 0 {
+		return c.lowerCase
+	}
+	if c.upperCase != i && c.upperCase != 0 {
+		return c.upperCase
+	}
+	return i
+}
+
+func printAsciiFold() {
+	if *test {
+		return
+	}
+	ppt("const uint16 ascii_fold[max_ascii+1] = {\n")
+	for i := 0; i <= unicode.MaxASCII; i++ {
+		ppt("\t0x%04X,\n", simpleFold(rune(i)))
+	}
+	ppt("};\n\n")
+}
+
+const foldCanonicalShift = 5
+
+// foldCanonical returns the canonical member of the simple case folding orbit
+// of i, which is the simple case folding (C + S) of i from CaseFolding.txt.
+func foldCanonical(i rune) rune {
+	if f := chars[i].foldCase; f != 0 {
+		return f
+	}
+	return i
+}
+
+// printFoldCanonical emits a two-stage table mapping every rune to the
+// canonical member of its case folding orbit. The first stage maps a block of
+// 1<<foldCanonicalShift runes to a block of deltas in the second stage,
+// identical blocks are shared.
+func printFoldCanonical() {
+	if *test {
+		for j := range chars {
+			i := rune(j)
+			for r := simpleFold(i); r != i; r = simpleFold(r) {
+				if foldCanonical(r) != foldCanonical(i) {
+					fmt.Fprintf(os.Stderr, "foldCanonical(%#U) != foldCanonical(%#U)\n", r, i)
+				}
+			}
+		}
+		return
+	}
+
+	const blockSize = 1 << foldCanonicalShift
+	var max rune
+	for j := range chars {
+		if foldCanonical(rune(j)) != rune(j) {
+			max = rune(j)
+		}
+	}
+	nblocks := int(max+blockSize) >> foldCanonicalShift
+
+	var blocks [][blockSize]int32
+	var index []int
+	ids := make(map[[blockSize]int32]int)
+	for b := 0; b < nblocks; b++ {
+		var block [blockSize]int32
+		for k := range block {
+			r := rune(b*blockSize + k)
+			block[k] = int32(foldCanonical(r) - r)
+		}
+		id, ok := ids[block]
+		if !ok {
+			id = len(blocks)
+			ids[block] = id
+			blocks = append(blocks, block)
+		}
+		index = append(index, id)
+	}
+	if len(blocks) > 256 {
+		logger.Fatalf("too many fold blocks: %d", len(blocks))
+	}
+
+	ppt("const int fold_canonical_shift = %d;\n", foldCanonicalShift)
+	ppt("const rune fold_canonical_max = 0x%04X;\n", nblocks<<foldCanonicalShift)
+	ppt("const uint8 fold_canonical_index[fold_canonical_max >> fold_canonical_shift] = {\n")
+	for i, id := range index {
+		if i%16 == 0 {
+			ppt("\t")
+		}
+		ppt("%d,", id)
+		if i%16 == 15 || i+1 == len(index) {
+			ppt("\n")
+		} else {
+			ppt(" ")
+		}
+	}
+	ppt("};\n")
+	ppt("const int32 fold_canonical_delta[] = {\n")
+	for b, block := range blocks {
+		ppt("\t// block %d\n", b)
+		for k, d := range block {
+			if k%8 == 0 {
+				ppt("\t")
+			}
+			ppt("%d,", d)
+			if k%8 == 7 {
+				ppt("\n")
+			} else {
+				ppt(" ")
+			}
+		}
+	}
+	ppt("};\n\n")
+	foldCanonicalBytes = len(index) + len(blocks)*blockSize*4
+}
+
+const (
+	hangulSBase  = 0xAC00
+	hangulLBase  = 0x1100
+	hangulVBase  = 0x1161
+	hangulTBase  = 0x11A7
+	hangulLCount = 19
+	hangulVCount = 21
+	hangulTCount = 28
+	hangulSCount = hangulLCount * hangulVCount * hangulTCount
+)
+
+// Must match the norm_* flags in unicode.cc, the low 8 bits hold the
+// canonical combining class.
+const (
+	normNFDNo  = 1 << 8  // NFD_Quick_Check=No
+	normNFKDNo = 1 << 9  // NFKD_Quick_Check=No
+	normNFCNo  = 1 << 10 // NFC_Quick_Check=No
+	normNFKCNo = 1 << 11 // NFKC_Quick_Check=No
+	normMaybe  = 1 << 12 // NFC_Quick_Check=Maybe (and NFKC_Quick_Check=Maybe)
+)
+
+const normPropsShift = 5
+
+func isHangulSyllable(r rune) bool {
+	return hangulSBase <= r && r < hangulSBase+hangulSCount
+}
+
+// decompose appends the full canonical or, if compat is set, compatibility
+// decomposition of r to d. Hangul syllables are decomposed algorithmically at
+// runtime and are left as is.
+func decompose(d []rune, r rune, compat bool) []rune {
+	c := &chars[r]
+	if len(c.decomp) == 0 || (c.compat && !compat) {
+		return append(d, r)
+	}
+	for _, x := range c.decomp {
+		d = decompose(d, x, compat)
+	}
+	return d
+}
+
+func equalRunes(a, b []rune) bool {
+	if len(a) != len(b) {
+		return false
+	}
+	for i := range a {
+		if a[i] != b[i] {
+			return false
+		}
+	}
+	return true
+}
+
+// hasCanonicalDecomposition reports whether r has a canonical decomposition
+// mapping in UnicodeData.txt.
+func hasCanonicalDecomposition(r rune) bool {
+	return len(chars[r].decomp) > 0 && !chars[r].compat
+}
+
+// fullCompositionExclusion reports whether r has the Full_Composition_Exclusion
+// property: it is listed in CompositionExclusions.txt, or it is a singleton
+// decomposition, or it is a non-starter decomposition.
+func fullCompositionExclusion(r rune) bool {
+	if !hasCanonicalDecomposition(r) {
+		return false
+	}
+	d := chars[r].decomp
+	return compositionExclusions[r] || len(d) == 1 ||
+		chars[r].ccc != 0 || chars[d[0]].ccc != 0
+}
+
+// primaryComposite reports whether r is the result of a canonical composition
+// of a pair of runes.
+func primaryComposite(r rune) bool {
+	return hasCanonicalDecomposition(r) && len(chars[r].decomp) == 2 &&
+		!fullCompositionExclusion(r)
+}
+
+type composition struct {
+	first, second, composite rune
+}
+
+type compositionSlice []composition
+
+func (p compositionSlice) Len() int      { return len(p) }
+func (p compositionSlice) Swap(i, j int) { p[i], p[j] = p[j], p[i] }
+func (p compositionSlice) Less(i, j int) bool {
+	if p[i].first != p[j].first {
+		return p[i].first < p[j].first
+	}
+	return p[i].second < p[j].second
+}
+
+func normProps(r rune, composesBack map[rune]bool) uint16 {
+	p := uint16(chars[r].ccc)
+	canonical := decompose(nil, r, false)
+	compat := decompose(nil, r, true)
+	nfd := len(canonical) != 1 || canonical[0] != r || isHangulSyllable(r)
+	nfkd := len(compat) != 1 || compat[0] != r || isHangulSyllable(r)
+	if nfd {
+		p |= normNFDNo
+	}
+	if nfkd {
+		p |= normNFKDNo
+	}
+	if nfd && fullCompositionExclusion(r) {
+		p |= normNFCNo | normNFKCNo
+	}
+	if !equalRunes(canonical, compat) {
+		p |= normNFKCNo
+	}
+	if composesBack[r] {
+		p |= normMaybe
+	}
+	return p
+}
+
+func printDecompositions(name string, runes *[]rune, include func(r rune) []rune) int {
+	ppt("const decomposition _%s[] = {\n", name)
+	n := 0
+	for i := range chars {
+		d := include(rune(i))
+		if d == nil {
+			continue
+		}
+		ppt("\t{0x%04X, %d, %d},\n", i, len(*runes), len(d))
+		*runes = append(*runes, d...)
+		n++
+	}
+	ppt("};\n")
+	ppt("const slice<const decomposition> %s(_%s);\n\n", name, name)
+	return n
+}
+
+// printNormalization emits the tables used by unicode::normalize: a two-stage
+// table of normalization properties (canonical combining class and quick
+// check values), full canonical and compatibility decompositions and
+// canonical composition pairs. Hangul syllables are handled algorithmically.
+func printNormalization() {
+	if *test {
+		return
+	}
+
+	var pairs compositionSlice
+	composesBack := map[rune]bool{}
+	for i := range chars {
+		r := rune(i)
+		if primaryComposite(r) {
+			d := chars[r].decomp
+			pairs = append(pairs, composition{d[0], d[1], r})
+			composesBack[d[1]] = true
+		}
+	}
+	for r := rune(hangulVBase); r < hangulVBase+hangulVCount; r++ {
+		composesBack[r] = true
+	}
+	for r := rune(hangulTBase + 1); r < hangulTBase+hangulTCount; r++ {
+		composesBack[r] = true
+	}
+	sort.Sort(pairs)
+
+	// properties
+	const blockSize = 1 << normPropsShift
+	var max rune
+	for i := range chars {
+		if normProps(rune(i), composesBack) != 0 {
+			max = rune(i)
+		}
+	}
+	nblocks := int(max+blockSize) >> normPropsShift
+
+	var blocks [][blockSize]uint16
+	var index []int
+	ids := make(map[[blockSize]uint16]int)
+	for b := 0; b < nblocks; b++ {
+		var block [blockSize]uint16
+		for k := range block {
+			block[k] = normProps(rune(b*blockSize+k), composesBack)
+		}
+		id, ok := ids[block]
+		if !ok {
+			id = len(blocks)
+			ids[block] = id
+			blocks = append(blocks, block)
+		}
+		index = append(index, id)
+	}
+	indexType := "uint8"
+	indexSize := 1
+	if len(blocks) > 256 {
+		indexType = "uint16"
+		indexSize = 2
+	}
+
+	ppt("const int norm_props_shift = %d;\n", normPropsShift)
+	ppt("const rune norm_props_max = 0x%04X;\n", nblocks<<normPropsShift)
+	ppt("const %s norm_props_index[norm_props_max >> norm_props_shift] = {\n", indexType)
+	for i, id := range index {
+		if i%16 == 0 {
+			ppt("\t")
+		}
+		ppt("%d,", id)
+		if i%16 == 15 || i+1 == len(index) {
+			ppt("\n")
+		} else {
+			ppt(" ")
+		}
+	}
+	ppt("};\n")
+	ppt("const uint16 norm_props_block[] = {\n")
+	for b, block := range blocks {
+		ppt("\t// block %d\n", b)
+		for k, p := range block {
+			if k%8 == 0 {
+				ppt("\t")
+			}
+			ppt("0x%04X,", p)
+			if k%8 == 7 {
+				ppt("\n")
+			} else {
+				ppt(" ")
+			}
+		}
+	}
+	ppt("};\n\n")
+
+	// decompositions, the compatibility table only lists runes whose
+	// compatibility decomposition differs from the canonical one
+	var runes []rune
+	n := printDecompositions("canonical_decompositions", &runes, func(r rune) []rune {
+		if !hasCanonicalDecomposition(r) {
+			return nil
+		}
+		return decompose(nil, r, false)
+	})
+	n += printDecompositions("compat_decompositions", &runes, func(r rune) []rune {
+		if len(chars[r].decomp) == 0 {
+			return nil
+		}
+		compat := decompose(nil, r, true)
+		if equalRunes(compat, decompose(nil, r, false)) {
+			return nil
+		}
+		return compat
+	})
+	if len(runes) > 0xFFFF {
+		logger.Fatalf("too many decomposition runes: %d", len(runes))
+	}
+	ppt("const rune decomposition_runes[] = {\n")
+	for i, r := range runes {
+		if i%8 == 0 {
+			ppt("\t")
+		}
+		ppt("0x%04X,", r)
+		if i%8 == 7 || i+1 == len(runes) {
+			ppt("\n")
+		} else {
+			ppt(" ")
+		}
+	}
+	ppt("};\n\n")
+
+	// compositions
+	ppt("const composition _compositions[] = {\n")
+	for _, p := range pairs {
+		ppt("\t{0x%04X, 0x%04X, 0x%04X},\n", p.first, p.second, p.composite)
+	}
+	ppt("};\n")
+	ppt("const slice<const composition> compositions(_compositions);\n\n")
+
+	normBytes = len(index)*indexSize + len(blocks)*blockSize*2 +
+		n*8 + len(runes)*4 + len(pairs)*12
+}
+
 func printCatFold(name string, m map[string]map[rune]bool) {
 	if *test {
 		var pkgMap map[string]*unicode.RangeTable
@@ -1378,6 +1837,8 @@ func printCatFold(name string, m map[string]map[rune]bool) {
 var range16Count = 0  // Number of entries in the 16-bit range tables.
 var range32Count = 0  // Number of entries in the 32-bit range tables.
 var foldPairCount = 0 // Number of fold pairs in the exception tables.
+var foldCanonicalBytes = 0 // Size of the two-stage canonical fold table.
+var normBytes = 0 // Size of the normalization tables.
 
 func printSizes() {
 	if *test {
@@ -1390,6 +1851,8 @@ func printSizes() {
 	fmt.Printf("// Range bytes: %d 16-bit, %d 32-bit, %d total.\n", range16Bytes, range32Bytes, range16Bytes+range32Bytes)
 	fmt.Println()
 	fmt.Printf("// Fold orbit bytes: %d pairs, %d bytes\n", foldPairCount, foldPairCount*2*2)
+	fmt.Printf("// Fold canonical bytes: %d\n", foldCanonicalBytes)
+	fmt.Printf("// Normalization bytes: %d\n", normBytes)
 }
 
 func printFooter() {